@@ -0,0 +1,133 @@
+#!/usr/bin/env ruby
+#
+# Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+#
+# Permission to use, copy, modify, and distribute this software for any
+# purpose with or without fee is hereby granted, provided that the above
+# copyright notice and this permission notice appear in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+# ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+# ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+# OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+
+# Measure running time and peak memory (VmHWM, Linux only) of gt gff3 on a
+# large GFF3 file. The file is built from copies of a smaller annotation,
+# each copy with its own sequence IDs, e.g.
+#
+#   scripts/gff3-bench.rb -g bin/gt -c 50 -a "-sort -show no"
+#
+# Several -a options run several argument sets on the same file, which allows
+# to compare two binaries or two modes of the same binary.
+
+require 'optparse'
+require 'tmpdir'
+
+def parseargs(argv)
+  options = Hash.new
+  options[:gt] = "gt"
+  options[:copies] = 20
+  options[:runs] = 1
+  options[:input] = File.join(File.dirname(__FILE__), "..", "testdata",
+                              "encode_known_genes_Mar07.gff3")
+  options[:args] = Array.new
+  opts = OptionParser.new
+  opts.banner = "Usage: #{$0} [options]"
+  opts.on("-g", "--gt PATH", "gt binary to run (default: gt)") do |x|
+    options[:gt] = x
+  end
+  opts.on("-i", "--input FILE", "GFF3 file to copy") do |x|
+    options[:input] = x
+  end
+  opts.on("-c", "--copies NUM", Integer,
+          "number of copies (default: 20)") do |x|
+    options[:copies] = x
+  end
+  opts.on("-r", "--runs NUM", Integer, "runs per argument set, the best " +
+                                       "one is reported (default: 1)") do |x|
+    options[:runs] = x
+  end
+  opts.on("-a", "--args ARGS", "arguments of gt gff3 (default: " +
+                               "\"-show no\" and \"-sort -show no\")") do |x|
+    options[:args].push(x)
+  end
+  rest = opts.parse(argv)
+  if not rest.empty?
+    STDERR.puts "#{$0}: superfluous arguments\n#{opts}"
+    exit 1
+  end
+  if options[:args].empty?
+    options[:args] = ["-show no", "-sort -show no"]
+  end
+  return options
+end
+
+# write <copies> copies of <input> to <output>, renaming the sequence IDs
+def make_input(input, output, copies)
+  lines = File.readlines(input)
+  features = 0
+  File.open(output, "w") do |f|
+    f.puts "##gff-version 3"
+    copies.times do |c|
+      lines.each do |line|
+        if line.match(/^##sequence-region\s+(\S+)(.*)$/)
+          f.puts "##sequence-region #{$1}.#{c}#{$2}"
+        elsif line.match(/^##gff-version/)
+          next
+        elsif line.match(/^#/)
+          f.print line
+        else
+          seqid, rest = line.split("\t", 2)
+          f.print "#{seqid}.#{c}\t#{rest}"
+          features += 1
+        end
+      end
+    end
+  end
+  return features
+end
+
+# run <cmd> and return running time in seconds and peak memory in kB
+def run_measured(cmd)
+  start = Process.clock_gettime(Process::CLOCK_MONOTONIC)
+  pid = Process.spawn(cmd, :out => "/dev/null")
+  peak = 0
+  loop do
+    begin
+      status = File.read("/proc/#{pid}/status")
+      if m = status.match(/^VmHWM:\s+(\d+)\s+kB/)
+        peak = [peak, m[1].to_i].max
+      end
+    rescue Errno::ENOENT, Errno::ESRCH
+    end
+    break if Process.wait(pid, Process::WNOHANG)
+    sleep 0.01
+  end
+  if not $?.success?
+    STDERR.puts "#{$0}: \"#{cmd}\" failed"
+    exit 1
+  end
+  return Process.clock_gettime(Process::CLOCK_MONOTONIC) - start, peak
+end
+
+options = parseargs(ARGV)
+Dir.mktmpdir("gff3-bench") do |dir|
+  file = File.join(dir, "input.gff3")
+  features = make_input(options[:input], file, options[:copies])
+  puts "# #{features} features in #{File.size(file)} bytes"
+  puts "# args\ttime (s)\tfeatures/s\tpeak memory (kB)"
+  options[:args].each do |args|
+    best_time, best_peak = nil, nil
+    options[:runs].times do
+      time, peak = run_measured("#{options[:gt]} gff3 #{args} #{file}")
+      best_time = time if best_time.nil? or time < best_time
+      best_peak = peak if best_peak.nil? or peak < best_peak
+    end
+    puts "#{args}\t#{'%.2f' % best_time}\t" +
+         "#{(features / best_time).round}\t#{best_peak}"
+  end
+end
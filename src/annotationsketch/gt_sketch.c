@@ -32,6 +32,7 @@
 #include "core/warning_api.h"
 #include "extended/add_introns_stream_api.h"
 #include "extended/bed_in_stream.h"
+#include "extended/feature_index_mapped_api.h"
 #include "extended/feature_index_memory_api.h"
 #include "extended/feature_stream_api.h"
 #include "extended/gff3_in_stream.h"
@@ -56,7 +57,7 @@ typedef struct {
        unsafe,
        force,
        use_streams;
-  GtStr *seqid, *format, *stylefile, *input;
+  GtStr *seqid, *format, *stylefile, *input, *indexfile;
   GtUword start,
                 end;
   unsigned int width;
@@ -69,6 +70,7 @@ static void* gt_sketch_arguments_new(void)
   arguments->format = gt_str_new();
   arguments->input = gt_str_new();
   arguments->stylefile = gt_str_new();
+  arguments->indexfile = gt_str_new();
   return arguments;
 }
 
@@ -80,6 +82,7 @@ static void gt_sketch_arguments_delete(void *tool_arguments)
   gt_str_delete(arguments->format);
   gt_str_delete(arguments->input);
   gt_str_delete(arguments->stylefile);
+  gt_str_delete(arguments->indexfile);
   gt_free(arguments);
 }
 
@@ -87,7 +90,7 @@ static GtOptionParser* gt_sketch_option_parser_new(void *tool_arguments)
 {
   GtSketchArguments *arguments = tool_arguments;
   GtOptionParser *op;
-  GtOption *option, *option2;
+  GtOption *option, *option2, *index_option;
   static const char *formats[] = { "png",
 #ifdef CAIRO_HAS_PDF_SURFACE
     "pdf",
@@ -118,6 +121,16 @@ static GtOptionParser* gt_sketch_option_parser_new(void *tool_arguments)
                               "features on stdout)", &arguments->pipe, false);
   gt_option_parser_add_option(op, option);
 
+  /* -featureindex */
+  index_option = gt_option_new_string("featureindex", "read the annotation "
+                                      "from the given mapped feature index "
+                                      "(created with gt mkfeatureindex "
+                                      "-backend mapped) instead of input "
+                                      "files",
+                                      arguments->indexfile, NULL);
+  gt_option_parser_add_option(op, index_option);
+  gt_option_exclude(index_option, option);
+
   /* -flattenfiles */
   option = gt_option_new_bool("flattenfiles", "do not group tracks by source "
                               "file name and remove file names from track "
@@ -186,6 +199,7 @@ static GtOptionParser* gt_sketch_option_parser_new(void *tool_arguments)
                               "existing exon features (before drawing)",
                               &arguments->addintrons, false);
   gt_option_parser_add_option(op, option);
+  gt_option_exclude(index_option, option);
 
     /* -unsafe */
   option = gt_option_new_bool("unsafe", "enable unsafe mode for style file",
@@ -289,7 +303,14 @@ static int gt_sketch_runner(int argc, const char **argv, int parsed_args,
   }
 
   file = argv[parsed_args];
-  if (!had_err) {
+  if (!had_err && gt_str_length(arguments->indexfile) > 0) {
+    /* the index is opened without reading the annotation */
+    features = gt_feature_index_mapped_new(gt_str_get(arguments->indexfile),
+                                           err);
+    if (!features)
+      had_err = -1;
+  }
+  else if (!had_err) {
     /* create feature index */
     features = gt_feature_index_memory_new();
     parsed_args++;
@@ -0,0 +1,218 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <string.h>
+#include "core/arena.h"
+#include "core/assert_api.h"
+#include "core/ensure_api.h"
+#include "core/ma_api.h"
+#include "core/striped_lock.h"
+
+/* alignment of all blocks, sufficient for pointers, integers and doubles */
+#define GT_ARENA_ALIGNMENT  16UL
+#define GT_ARENA_ALIGN(SIZE) \
+        (((SIZE) + GT_ARENA_ALIGNMENT - 1) & ~(GT_ARENA_ALIGNMENT - 1))
+
+/* blocks larger than this fraction of the chunk size get a chunk of their own,
+   to limit the space wasted at the end of chunks */
+#define GT_ARENA_LARGE_BLOCK(ARENA) ((ARENA)->chunksize / 4)
+
+typedef struct GtArenaChunk GtArenaChunk;
+
+struct GtArenaChunk {
+  GtArenaChunk *next;
+  size_t size;
+};
+
+#define GT_ARENA_CHUNK_HEADER GT_ARENA_ALIGN(sizeof (GtArenaChunk))
+
+struct GtArena {
+  GtArenaChunk *chunks;
+  char *nextfree;
+  size_t chunksize,
+         available;
+  GtUword allocated;
+  unsigned int reference_count;
+};
+
+GtArena* gt_arena_new(size_t chunksize)
+{
+  GtArena *arena;
+  gt_assert(chunksize > 0);
+  arena = gt_malloc(sizeof *arena);
+  arena->chunks = NULL;
+  arena->nextfree = NULL;
+  arena->chunksize = GT_ARENA_ALIGN(chunksize);
+  arena->available = 0;
+  arena->allocated = 0;
+  arena->reference_count = 0;
+  return arena;
+}
+
+GtArena* gt_arena_ref(GtArena *arena)
+{
+  gt_assert(arena);
+#ifdef GT_THREADS_ENABLED
+  (void) __sync_add_and_fetch(&arena->reference_count, 1U);
+#else
+  arena->reference_count++;
+#endif
+  return arena;
+}
+
+static GtArenaChunk* gt_arena_add_chunk(GtArena *arena, size_t size)
+{
+  GtArenaChunk *chunk = gt_malloc(GT_ARENA_CHUNK_HEADER + size);
+  chunk->size = size;
+  chunk->next = arena->chunks;
+  arena->chunks = chunk;
+  arena->allocated += (GtUword) (GT_ARENA_CHUNK_HEADER + size);
+  return chunk;
+}
+
+/* the arena may be shared by objects handled in different threads, therefore
+   allocations are serialized on the striped lock of the arena */
+void* gt_arena_alloc(GtArena *arena, size_t size)
+{
+  GtArenaChunk *chunk;
+  void *block;
+  gt_assert(arena);
+  size = GT_ARENA_ALIGN(size > 0 ? size : 1);
+  gt_striped_lock_enter(arena);
+  if (size <= arena->available) {
+    block = arena->nextfree;
+    arena->nextfree += size;
+    arena->available -= size;
+  } else if (size > GT_ARENA_LARGE_BLOCK(arena)) {
+    /* keep the current chunk for subsequent small blocks */
+    chunk = gt_arena_add_chunk(arena, size);
+    if (chunk->next != NULL) {
+      arena->chunks = chunk->next;
+      chunk->next = arena->chunks->next;
+      arena->chunks->next = chunk;
+    }
+    block = (char*) chunk + GT_ARENA_CHUNK_HEADER;
+  } else {
+    chunk = gt_arena_add_chunk(arena, arena->chunksize);
+    block = (char*) chunk + GT_ARENA_CHUNK_HEADER;
+    arena->nextfree = (char*) block + size;
+    arena->available = arena->chunksize - size;
+  }
+  gt_striped_lock_leave(arena);
+  return block;
+}
+
+void* gt_arena_realloc(GtArena *arena, void *ptr, size_t oldsize,
+                       size_t newsize)
+{
+  void *block;
+  size_t aligned_oldsize, aligned_newsize;
+  gt_assert(arena);
+  if (!ptr)
+    return gt_arena_alloc(arena, newsize);
+  if (newsize <= oldsize)
+    return ptr;
+  aligned_oldsize = GT_ARENA_ALIGN(oldsize > 0 ? oldsize : 1);
+  aligned_newsize = GT_ARENA_ALIGN(newsize);
+  gt_striped_lock_enter(arena);
+  if ((char*) ptr + aligned_oldsize == arena->nextfree &&
+      aligned_newsize - aligned_oldsize <= arena->available) {
+    arena->nextfree += aligned_newsize - aligned_oldsize;
+    arena->available -= aligned_newsize - aligned_oldsize;
+    gt_striped_lock_leave(arena);
+    return ptr;
+  }
+  gt_striped_lock_leave(arena);
+  block = gt_arena_alloc(arena, newsize);
+  memcpy(block, ptr, oldsize);
+  return block;
+}
+
+GtUword gt_arena_size(GtArena *arena)
+{
+  GtUword allocated;
+  gt_assert(arena);
+  gt_striped_lock_enter(arena);
+  allocated = arena->allocated;
+  gt_striped_lock_leave(arena);
+  return allocated;
+}
+
+void gt_arena_delete(GtArena *arena)
+{
+  GtArenaChunk *chunk, *next;
+  if (!arena) return;
+#ifdef GT_THREADS_ENABLED
+  if (__sync_fetch_and_sub(&arena->reference_count, 1U) > 0)
+    return;
+#else
+  if (arena->reference_count) {
+    arena->reference_count--;
+    return;
+  }
+#endif
+  for (chunk = arena->chunks; chunk != NULL; chunk = next) {
+    next = chunk->next;
+    gt_free(chunk);
+  }
+  gt_free(arena);
+}
+
+int gt_arena_unit_test(GtError *err)
+{
+  GtArena *arena;
+  char *blocks[100], *large;
+  GtUword i, j;
+  int had_err = 0;
+  gt_error_check(err);
+
+  arena = gt_arena_new(256);
+  gt_ensure(gt_arena_size(arena) == 0);
+  for (i = 0; i < 100UL; i++) {
+    blocks[i] = gt_arena_alloc(arena, (size_t) (i % 17) + 1);
+    gt_ensure(((size_t) blocks[i]) % GT_ARENA_ALIGNMENT == 0);
+    memset(blocks[i], (int) i, (size_t) (i % 17) + 1);
+  }
+  /* a large block must not disturb the chunk used for small blocks */
+  large = gt_arena_alloc(arena, 1000);
+  memset(large, 0xff, 1000);
+  blocks[0] = gt_arena_alloc(arena, 1);
+  *blocks[0] = 0;
+  for (i = 1; !had_err && i < 100UL; i++) {
+    for (j = 0; !had_err && j <= i % 17; j++)
+      gt_ensure(blocks[i][j] == (char) i);
+  }
+  gt_ensure(gt_arena_size(arena) >= 1000UL + 100UL * GT_ARENA_ALIGNMENT);
+
+  /* the most recent block grows in place, others are copied */
+  blocks[0] = gt_arena_alloc(arena, 10);
+  memcpy(blocks[0], "123456789", 10);
+  blocks[1] = gt_arena_realloc(arena, blocks[0], 10, 40);
+  gt_ensure(blocks[1] == blocks[0]);
+  blocks[2] = gt_arena_alloc(arena, 1);
+  blocks[1] = gt_arena_realloc(arena, blocks[0], 40, 60);
+  gt_ensure(blocks[1] != blocks[0]);
+  gt_ensure(!strcmp(blocks[1], "123456789"));
+  gt_ensure(gt_arena_realloc(arena, blocks[1], 60, 20) == blocks[1]);
+
+  /* references keep the arena alive */
+  (void) gt_arena_ref(arena);
+  gt_arena_delete(arena);
+  blocks[1] = gt_arena_alloc(arena, 8);
+  gt_arena_delete(arena);
+
+  return had_err;
+}
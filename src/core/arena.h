@@ -0,0 +1,50 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdlib.h>
+#include "core/error_api.h"
+#include "core/types_api.h"
+
+/* A <GtArena> hands out memory from large chunks. Single blocks cannot be
+   freed, all chunks are freed at once when the last reference to the arena is
+   dropped. Objects allocated from an arena usually hold a reference to it, so
+   that the arena lives as long as any of its objects. */
+typedef struct GtArena GtArena;
+
+/* Return a new <GtArena> which allocates chunks of <chunksize> bytes. */
+GtArena* gt_arena_new(size_t chunksize);
+/* Increase the reference count of <arena> and return it. Thread-safe. */
+GtArena* gt_arena_ref(GtArena *arena);
+/* Return a block of <size> bytes from <arena>, suitably aligned for any
+   type. The block is valid until <arena> is freed. */
+void*    gt_arena_alloc(GtArena *arena, size_t size);
+/* Resize block <ptr> of <oldsize> bytes from <arena> to <newsize> bytes and
+   return it. If <ptr> is the most recent block of <arena> it is grown in place,
+   otherwise its contents are copied to a new block. <ptr> may be NULL. */
+void*    gt_arena_realloc(GtArena *arena, void *ptr, size_t oldsize,
+                          size_t newsize);
+/* Return the number of bytes allocated by <arena> for its chunks. */
+GtUword  gt_arena_size(GtArena *arena);
+/* Decrease the reference count of <arena> or free it, together with all
+   blocks allocated from it. Thread-safe. */
+void     gt_arena_delete(GtArena *arena);
+
+int      gt_arena_unit_test(GtError *err);
+
+#endif
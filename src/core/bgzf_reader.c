@@ -0,0 +1,337 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <zlib.h>
+#include "core/bgzf_reader.h"
+#include "core/cstr_api.h"
+#include "core/ensure_api.h"
+#include "core/fa_api.h"
+#include "core/ma_api.h"
+#include "core/thread_pool.h"
+#include "core/types_api.h"
+#include "core/xansi_api.h"
+
+/* the fixed part of the gzip header of a block, followed by the extra field */
+#define BGZF_FIXED_HEADER_SIZE  12UL
+/* CRC32 and ISIZE at the end of a block */
+#define BGZF_TRAILER_SIZE       8UL
+/* the largest block (BSIZE+1) allowed by the format */
+#define BGZF_MAX_RAW_SIZE       65536UL
+/* the maximal number of blocks decompressed at once */
+#define BGZF_MAX_BLOCKS         64UL
+
+#define BGZF_LE16(P)  ((GtUword) (P)[0] | ((GtUword) (P)[1] << 8))
+#define BGZF_LE32(P)  (BGZF_LE16(P) | (BGZF_LE16((P) + 2) << 16))
+
+typedef struct {
+  unsigned char data[BGZF_MAX_RAW_SIZE]; /* compressed data and trailer */
+  GtUword datalength,
+          isize, /* uncompressed size */
+          offset; /* of the block in the file */
+  unsigned char *out; /* destination of the uncompressed data */
+} BGZFBlock;
+
+struct GtBGZFReader {
+  FILE *fp;
+  char *path;
+  GtUword offset; /* of the next block in the file, for error messages */
+  BGZFBlock *blocks;
+  GtUword allocated;
+};
+
+/* Parse the header of a gzip member in <header> of <length> bytes and return
+   the size of the whole member (BSIZE+1) and the size of the header in
+   <headersize>, or 0 if the member is not a BGZF block. */
+static GtUword bgzf_block_size(const unsigned char *header, GtUword length,
+                               GtUword *headersize)
+{
+  GtUword xlen, i;
+  if (length < BGZF_FIXED_HEADER_SIZE || header[0] != 31 || header[1] != 139 ||
+      header[2] != 8 || header[3] != 4) {
+    return 0;
+  }
+  xlen = BGZF_LE16(header + 10);
+  if (length < BGZF_FIXED_HEADER_SIZE + xlen)
+    return 0;
+  *headersize = BGZF_FIXED_HEADER_SIZE + xlen;
+  /* look for the "BC" subfield holding BSIZE */
+  for (i = BGZF_FIXED_HEADER_SIZE; i + 4 <= *headersize;
+       i += 4 + BGZF_LE16(header + i + 2)) {
+    if (header[i] == 'B' && header[i+1] == 'C' &&
+        BGZF_LE16(header + i + 2) == 2 && i + 6 <= *headersize) {
+      GtUword blocksize = BGZF_LE16(header + i + 4) + 1;
+      return blocksize >= *headersize + BGZF_TRAILER_SIZE ? blocksize : 0;
+    }
+  }
+  return 0;
+}
+
+bool gt_bgzf_reader_is_bgzf(const char *path)
+{
+  unsigned char header[BGZF_FIXED_HEADER_SIZE + 6];
+  GtUword headersize;
+  size_t length;
+  FILE *fp;
+  gt_assert(path);
+  if (!(fp = fopen(path, "rb")))
+    return false;
+  length = fread(header, 1, sizeof header, fp);
+  fclose(fp);
+  return bgzf_block_size(header, length, &headersize) > 0;
+}
+
+static GtBGZFReader* bgzf_reader_new(FILE *fp, const char *path)
+{
+  GtBGZFReader *bgzf_reader = gt_calloc(1, sizeof *bgzf_reader);
+  bgzf_reader->fp = fp;
+  bgzf_reader->path = gt_cstr_dup(path);
+  bgzf_reader->allocated = 16UL;
+  bgzf_reader->blocks = gt_malloc(bgzf_reader->allocated *
+                                  sizeof *bgzf_reader->blocks);
+  return bgzf_reader;
+}
+
+GtBGZFReader* gt_bgzf_reader_new(const char *path, GtError *err)
+{
+  FILE *fp;
+  gt_error_check(err);
+  gt_assert(path);
+  if (!(fp = gt_fa_fopen(path, "rb", err)))
+    return NULL;
+  return bgzf_reader_new(fp, path);
+}
+
+GtBGZFReader* gt_bgzf_reader_xnew(const char *path)
+{
+  gt_assert(path);
+  return bgzf_reader_new(gt_fa_xfopen(path, "rb"), path);
+}
+
+static void bgzf_reader_corrupt(const GtBGZFReader *bgzf_reader,
+                                GtUword offset)
+{
+  fprintf(stderr, "cannot read from compressed file: file \"%s\" has a "
+          "corrupt BGZF block at offset "GT_WU"\n", bgzf_reader->path, offset);
+  exit(EXIT_FAILURE);
+}
+
+/* Read the next block of <bgzf_reader> into <block>, return false at the end
+   of the file. */
+static bool bgzf_reader_read_block(GtBGZFReader *bgzf_reader, BGZFBlock *block)
+{
+  unsigned char header[BGZF_MAX_RAW_SIZE];
+  GtUword blocksize, headersize, length;
+  /* the header of a block without further subfields */
+  length = gt_xfread(header, 1, BGZF_FIXED_HEADER_SIZE + 6, bgzf_reader->fp);
+  if (length == 0)
+    return false;
+  if (length < BGZF_FIXED_HEADER_SIZE + 2)
+    bgzf_reader_corrupt(bgzf_reader, bgzf_reader->offset);
+  headersize = BGZF_FIXED_HEADER_SIZE + BGZF_LE16(header + 10);
+  if (headersize > length) {
+    if (headersize > sizeof header)
+      bgzf_reader_corrupt(bgzf_reader, bgzf_reader->offset);
+    length += gt_xfread(header + length, 1, headersize - length,
+                        bgzf_reader->fp);
+  }
+  if (!(blocksize = bgzf_block_size(header, length, &headersize)))
+    bgzf_reader_corrupt(bgzf_reader, bgzf_reader->offset);
+  /* the rest of the block behind the header */
+  length -= headersize;
+  memcpy(block->data, header + headersize, length);
+  block->datalength = blocksize - headersize;
+  if (gt_xfread(block->data + length, 1, block->datalength - length,
+                bgzf_reader->fp) != block->datalength - length) {
+    bgzf_reader_corrupt(bgzf_reader, bgzf_reader->offset);
+  }
+  block->isize = BGZF_LE32(block->data + block->datalength - 4);
+  if (block->isize > GT_BGZF_MAX_BLOCK_SIZE)
+    bgzf_reader_corrupt(bgzf_reader, bgzf_reader->offset);
+  bgzf_reader->offset += blocksize;
+  return true;
+}
+
+static void bgzf_reader_inflate_blocks(GtUword start, GtUword end, void *data)
+{
+  GtBGZFReader *bgzf_reader = data;
+  GtUword i;
+  for (i = start; i < end; i++) {
+    BGZFBlock *block = bgzf_reader->blocks + i;
+    GtUword cdatalength = block->datalength - BGZF_TRAILER_SIZE;
+    z_stream stream;
+    int rval;
+    memset(&stream, 0, sizeof stream);
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+      fprintf(stderr, "cannot initialize decompression of file \"%s\"\n",
+              bgzf_reader->path);
+      exit(EXIT_FAILURE);
+    }
+    stream.next_in = block->data;
+    stream.avail_in = (uInt) cdatalength;
+    stream.next_out = block->out;
+    stream.avail_out = (uInt) block->isize;
+    rval = inflate(&stream, Z_FINISH);
+    (void) inflateEnd(&stream);
+    if (rval != Z_STREAM_END || stream.total_out != block->isize ||
+        crc32(crc32(0L, Z_NULL, 0), block->out, (uInt) block->isize)
+          != BGZF_LE32(block->data + cdatalength)) {
+      bgzf_reader_corrupt(bgzf_reader, block->offset);
+    }
+  }
+}
+
+size_t gt_bgzf_reader_xread(GtBGZFReader *bgzf_reader, void *buf,
+                            size_t nbytes)
+{
+  GtUword numofblocks, length = 0;
+  gt_assert(bgzf_reader && buf && nbytes >= GT_BGZF_MAX_BLOCK_SIZE);
+  /* skip blocks without data, like the empty block marking the end */
+  do {
+    /* read blocks as long as another one certainly fits into <buf> */
+    for (numofblocks = 0;
+         numofblocks < BGZF_MAX_BLOCKS &&
+         length + GT_BGZF_MAX_BLOCK_SIZE <= nbytes; numofblocks++) {
+      BGZFBlock *block;
+      GtUword offset = bgzf_reader->offset;
+      if (numofblocks == bgzf_reader->allocated) {
+        bgzf_reader->allocated *= 2;
+        bgzf_reader->blocks = gt_realloc(bgzf_reader->blocks,
+                                         bgzf_reader->allocated *
+                                         sizeof *bgzf_reader->blocks);
+      }
+      block = bgzf_reader->blocks + numofblocks;
+      if (!bgzf_reader_read_block(bgzf_reader, block))
+        break;
+      block->offset = offset;
+      block->out = (unsigned char*) buf + length;
+      length += block->isize;
+    }
+    if (numofblocks > 0) {
+      gt_thread_pool_parallel_for(0, numofblocks, 1, bgzf_reader_inflate_blocks,
+                                  bgzf_reader);
+    }
+  } while (length == 0 && numofblocks > 0);
+  return length;
+}
+
+void gt_bgzf_reader_rewind(GtBGZFReader *bgzf_reader)
+{
+  gt_assert(bgzf_reader);
+  rewind(bgzf_reader->fp);
+  bgzf_reader->offset = 0;
+}
+
+void gt_bgzf_reader_delete(GtBGZFReader *bgzf_reader)
+{
+  if (!bgzf_reader) return;
+  gt_fa_xfclose(bgzf_reader->fp);
+  gt_free(bgzf_reader->blocks);
+  gt_free(bgzf_reader->path);
+  gt_free(bgzf_reader);
+}
+
+/* write <length> bytes of <data> as a BGZF block to <fp> */
+static void bgzf_write_block(FILE *fp, const unsigned char *data,
+                             GtUword length)
+{
+  unsigned char header[18] = { 31, 139, 8, 4, 0, 0, 0, 0, 0, 255, 6, 0,
+                               'B', 'C', 2, 0, 0, 0 },
+                cdata[BGZF_MAX_RAW_SIZE], trailer[8];
+  GtUword blocksize, crc = crc32(crc32(0L, Z_NULL, 0), data, (uInt) length);
+  z_stream stream;
+  memset(&stream, 0, sizeof stream);
+  (void) deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS,
+                      8, Z_DEFAULT_STRATEGY);
+  stream.next_in = (unsigned char*) data;
+  stream.avail_in = (uInt) length;
+  stream.next_out = cdata;
+  stream.avail_out = (uInt) sizeof cdata;
+  (void) deflate(&stream, Z_FINISH);
+  blocksize = sizeof header + stream.total_out + sizeof trailer;
+  header[16] = (unsigned char) ((blocksize - 1) & 0xff);
+  header[17] = (unsigned char) ((blocksize - 1) >> 8);
+  trailer[0] = crc & 0xff;
+  trailer[1] = (crc >> 8) & 0xff;
+  trailer[2] = (crc >> 16) & 0xff;
+  trailer[3] = (crc >> 24) & 0xff;
+  trailer[4] = length & 0xff;
+  trailer[5] = (length >> 8) & 0xff;
+  trailer[6] = (length >> 16) & 0xff;
+  trailer[7] = 0;
+  gt_xfwrite(header, 1, sizeof header, fp);
+  gt_xfwrite(cdata, 1, stream.total_out, fp);
+  gt_xfwrite(trailer, 1, sizeof trailer, fp);
+  (void) deflateEnd(&stream);
+}
+
+int gt_bgzf_reader_unit_test(GtError *err)
+{
+  GtUword i, length, numofbytes = 5 * GT_BGZF_MAX_BLOCK_SIZE + 1000;
+  unsigned char *data, *buf;
+  GtBGZFReader *bgzf_reader;
+  GtStr *tmpfilename;
+  FILE *tmpfp;
+  int had_err = 0;
+  gt_error_check(err);
+
+  data = gt_malloc(numofbytes);
+  for (i = 0; i < numofbytes; i++)
+    data[i] = "ACGT\n"[(i * i + i / 7) % 5];
+  buf = gt_malloc(4 * GT_BGZF_MAX_BLOCK_SIZE);
+
+  /* blocks of different sizes, an empty one in between and at the end */
+  tmpfilename = gt_str_new();
+  tmpfp = gt_xtmpfp(tmpfilename);
+  bgzf_write_block(tmpfp, data, 100);
+  bgzf_write_block(tmpfp, data + 100, 0);
+  for (i = 100; i < numofbytes; i += length) {
+    length = numofbytes - i < 65280UL ? numofbytes - i : 65280UL;
+    bgzf_write_block(tmpfp, data + i, length);
+  }
+  bgzf_write_block(tmpfp, data, 0);
+  gt_fa_xfclose(tmpfp);
+  gt_ensure(gt_bgzf_reader_is_bgzf(gt_str_get(tmpfilename)));
+
+  bgzf_reader = gt_bgzf_reader_xnew(gt_str_get(tmpfilename));
+  for (i = 0; !had_err && i < 2UL; i++) {
+    GtUword total = 0;
+    while (!had_err &&
+           (length = gt_bgzf_reader_xread(bgzf_reader, buf,
+                                          4 * GT_BGZF_MAX_BLOCK_SIZE))) {
+      gt_ensure(total + length <= numofbytes);
+      gt_ensure(!had_err && !memcmp(buf, data + total, length));
+      total += length;
+    }
+    gt_ensure(total == numofbytes);
+    gt_bgzf_reader_rewind(bgzf_reader);
+  }
+  gt_bgzf_reader_delete(bgzf_reader);
+  gt_xremove(gt_str_get(tmpfilename));
+
+  /* an ordinary gzip file is not recognized */
+  tmpfp = gt_xtmpfp(tmpfilename);
+  gt_xfwrite("\37\213\10\0\0\0\0\0\0\377", 1, 10, tmpfp);
+  gt_fa_xfclose(tmpfp);
+  gt_ensure(!gt_bgzf_reader_is_bgzf(gt_str_get(tmpfilename)));
+  gt_xremove(gt_str_get(tmpfilename));
+
+  gt_str_delete(tmpfilename);
+  gt_free(buf);
+  gt_free(data);
+  return had_err;
+}
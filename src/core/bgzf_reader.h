@@ -0,0 +1,52 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BGZF_READER_H
+#define BGZF_READER_H
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "core/error_api.h"
+
+/* The maximal uncompressed size of a BGZF block. */
+#define GT_BGZF_MAX_BLOCK_SIZE  65536UL
+
+/* A <GtBGZFReader> decompresses files in the blocked gzip format (BGZF) used
+   by bgzip, tabix and samtools. A BGZF file is a series of gzip members of
+   at most 64KB each, which are decompressed independently of each other on
+   the threads of the pool (see core/thread_pool.h). */
+typedef struct GtBGZFReader GtBGZFReader;
+
+/* Return true if the file <path> starts with a BGZF block. */
+bool          gt_bgzf_reader_is_bgzf(const char *path);
+/* Return a new <GtBGZFReader> for the BGZF file <path>. Returns NULL and sets
+   <err> if the file cannot be opened. */
+GtBGZFReader* gt_bgzf_reader_new(const char *path, GtError *err);
+/* Like <gt_bgzf_reader_new()>, but terminates on error. */
+GtBGZFReader* gt_bgzf_reader_xnew(const char *path);
+/* Decompress the next blocks of <bgzf_reader> into <buf>, as many as fit into
+   <nbytes> bytes, which must be at least <GT_BGZF_MAX_BLOCK_SIZE>. Returns the
+   number of bytes stored in <buf>, 0 at the end of the file. Terminates on
+   corrupt input. */
+size_t        gt_bgzf_reader_xread(GtBGZFReader *bgzf_reader, void *buf,
+                                   size_t nbytes);
+/* Continue reading <bgzf_reader> from the beginning of the file. */
+void          gt_bgzf_reader_rewind(GtBGZFReader *bgzf_reader);
+void          gt_bgzf_reader_delete(GtBGZFReader *bgzf_reader);
+
+int           gt_bgzf_reader_unit_test(GtError *err);
+
+#endif
@@ -0,0 +1,465 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#ifdef GT_WITH_ZSTD
+#include <zstd.h>
+#endif
+#ifdef GT_WITH_LZMA
+#include <lzma.h>
+#endif
+#include "core/codec_file.h"
+#include "core/cstr_api.h"
+#include "core/ensure_api.h"
+#include "core/fa_api.h"
+#include "core/ma_api.h"
+#include "core/str_api.h"
+#include "core/thread_api.h"
+#include "core/unused_api.h"
+#include "core/xansi_api.h"
+
+/* size of the buffers for compressed and uncompressed data */
+#define GT_CODEC_FILE_BUFSIZE  (1UL << 17)
+
+struct GtCodecFile {
+  GtFileMode file_mode;
+  FILE *fp;
+  char *path;
+  unsigned char *inbuf, /* compressed data read from <fp> */
+                *outbuf; /* decompressed data, or data to be compressed */
+  size_t inpos,
+         inlen,
+         outpos,
+         outlen;
+  bool writing,
+       input_eof, /* all of <fp> has been read into <inbuf> */
+       eof; /* all data has been decompressed and read */
+#ifdef GT_WITH_ZSTD
+  ZSTD_DCtx *dctx;
+  ZSTD_CCtx *cctx;
+  size_t zstd_pending; /* 0 if the last frame read is complete */
+#endif
+#ifdef GT_WITH_LZMA
+  lzma_stream lzma;
+#endif
+};
+
+bool gt_codec_file_mode_is_supported(GtFileMode file_mode)
+{
+  switch (file_mode) {
+    case GT_FILE_MODE_ZSTD:
+#ifdef GT_WITH_ZSTD
+      return true;
+#else
+      return false;
+#endif
+    case GT_FILE_MODE_XZ:
+#ifdef GT_WITH_LZMA
+      return true;
+#else
+      return false;
+#endif
+    default:
+      return false;
+  }
+}
+
+static const char* codec_file_name(GtFileMode file_mode)
+{
+  return file_mode == GT_FILE_MODE_ZSTD ? "zstd" : "xz";
+}
+
+#if defined (GT_WITH_ZSTD) || defined (GT_WITH_LZMA)
+static void codec_file_fail(const GtCodecFile *codec_file, const char *what,
+                            const char *reason)
+{
+  fprintf(stderr, "cannot %s %s compressed file '%s': %s\n", what,
+          codec_file_name(codec_file->file_mode), codec_file->path, reason);
+  exit(EXIT_FAILURE);
+}
+#endif
+
+#ifdef GT_WITH_LZMA
+static const char* codec_file_lzma_strerror(lzma_ret ret)
+{
+  switch (ret) {
+    case LZMA_MEM_ERROR:
+      return "out of memory";
+    case LZMA_FORMAT_ERROR:
+      return "file format not recognized";
+    case LZMA_OPTIONS_ERROR:
+      return "unsupported compression options";
+    case LZMA_DATA_ERROR:
+      return "compressed data is corrupt";
+    case LZMA_BUF_ERROR:
+      return "unexpected end of input";
+    default:
+      return "internal error";
+  }
+}
+#endif
+
+/* Set up the encoder or decoder for a new stream. */
+static void codec_file_start(GtCodecFile *codec_file)
+{
+#ifdef GT_WITH_ZSTD
+  if (codec_file->file_mode == GT_FILE_MODE_ZSTD) {
+    if (codec_file->writing) {
+      if (!codec_file->cctx && !(codec_file->cctx = ZSTD_createCCtx()))
+        codec_file_fail(codec_file, "write", "out of memory");
+      /* only has an effect if the library supports multithreading */
+      if (gt_jobs > 1) {
+        (void) ZSTD_CCtx_setParameter(codec_file->cctx, ZSTD_c_nbWorkers,
+                                      (int) gt_jobs);
+      }
+    }
+    else {
+      if (!codec_file->dctx && !(codec_file->dctx = ZSTD_createDCtx()))
+        codec_file_fail(codec_file, "read", "out of memory");
+      (void) ZSTD_DCtx_reset(codec_file->dctx, ZSTD_reset_session_only);
+      codec_file->zstd_pending = 0;
+    }
+  }
+#endif
+#ifdef GT_WITH_LZMA
+  if (codec_file->file_mode == GT_FILE_MODE_XZ) {
+    lzma_stream init = LZMA_STREAM_INIT;
+    lzma_ret ret;
+    lzma_end(&codec_file->lzma);
+    codec_file->lzma = init;
+    if (codec_file->writing) {
+      ret = lzma_easy_encoder(&codec_file->lzma, LZMA_PRESET_DEFAULT,
+                              LZMA_CHECK_CRC64);
+    }
+    else {
+      ret = lzma_stream_decoder(&codec_file->lzma, UINT64_MAX,
+                                LZMA_CONCATENATED);
+    }
+    if (ret != LZMA_OK) {
+      codec_file_fail(codec_file, codec_file->writing ? "write" : "read",
+                      codec_file_lzma_strerror(ret));
+    }
+  }
+#endif
+  codec_file->inpos = codec_file->inlen = 0;
+  codec_file->outpos = codec_file->outlen = 0;
+  codec_file->input_eof = codec_file->eof = false;
+}
+
+GtCodecFile* gt_codec_file_new(GtFileMode file_mode, const char *path,
+                               const char *mode, GtError *err)
+{
+  GtCodecFile *codec_file;
+  FILE *fp;
+  gt_error_check(err);
+  gt_assert(path && mode);
+  gt_assert(file_mode == GT_FILE_MODE_ZSTD || file_mode == GT_FILE_MODE_XZ);
+  if (!gt_codec_file_mode_is_supported(file_mode)) {
+    gt_error_set(err, "cannot open file '%s': GenomeTools has been compiled "
+                 "without %s support", path, codec_file_name(file_mode));
+    return NULL;
+  }
+  if (!(fp = gt_fa_fopen(path, mode, err)))
+    return NULL;
+  codec_file = gt_calloc(1, sizeof *codec_file);
+  codec_file->file_mode = file_mode;
+  codec_file->fp = fp;
+  codec_file->path = gt_cstr_dup(path);
+  codec_file->writing = mode[0] == 'w' || mode[0] == 'a';
+  codec_file->inbuf = gt_malloc(GT_CODEC_FILE_BUFSIZE);
+  codec_file->outbuf = gt_malloc(GT_CODEC_FILE_BUFSIZE);
+#ifdef GT_WITH_LZMA
+  {
+    lzma_stream init = LZMA_STREAM_INIT;
+    codec_file->lzma = init;
+  }
+#endif
+  codec_file_start(codec_file);
+  return codec_file;
+}
+
+GtCodecFile* gt_codec_file_xnew(GtFileMode file_mode, const char *path,
+                                const char *mode)
+{
+  GtCodecFile *codec_file;
+  GtError *err = gt_error_new();
+  if (!(codec_file = gt_codec_file_new(file_mode, path, mode, err))) {
+    fprintf(stderr, "%s\n", gt_error_get(err));
+    exit(EXIT_FAILURE);
+  }
+  gt_error_delete(err);
+  return codec_file;
+}
+
+static void codec_file_read_input(GtCodecFile *codec_file)
+{
+  if (codec_file->inpos == codec_file->inlen && !codec_file->input_eof) {
+    codec_file->inpos = 0;
+    codec_file->inlen = gt_xfread(codec_file->inbuf, 1, GT_CODEC_FILE_BUFSIZE,
+                                  codec_file->fp);
+    if (!codec_file->inlen)
+      codec_file->input_eof = true;
+  }
+}
+
+/* Decompress into <outbuf> until at least one byte is available. Returns
+   false at the end of the file. */
+static bool codec_file_fill(GtCodecFile *codec_file)
+{
+  codec_file->outpos = codec_file->outlen = 0;
+  while (!codec_file->eof && !codec_file->outlen) {
+    codec_file_read_input(codec_file);
+#ifdef GT_WITH_ZSTD
+    if (codec_file->file_mode == GT_FILE_MODE_ZSTD) {
+      ZSTD_inBuffer in;
+      ZSTD_outBuffer out;
+      size_t ret;
+      in.src = codec_file->inbuf;
+      in.size = codec_file->inlen;
+      in.pos = codec_file->inpos;
+      out.dst = codec_file->outbuf;
+      out.size = GT_CODEC_FILE_BUFSIZE;
+      out.pos = 0;
+      ret = ZSTD_decompressStream(codec_file->dctx, &out, &in);
+      if (ZSTD_isError(ret))
+        codec_file_fail(codec_file, "read", ZSTD_getErrorName(ret));
+      /* without progress, the return value is the size of the header of a
+         next frame, which does not exist */
+      if (in.pos > codec_file->inpos || out.pos > 0)
+        codec_file->zstd_pending = ret;
+      codec_file->inpos = in.pos;
+      codec_file->outlen = out.pos;
+      /* the output buffer might have been too small, hence only an empty
+         output with no input left ends the file */
+      if (!out.pos && codec_file->input_eof &&
+          codec_file->inpos == codec_file->inlen) {
+        if (codec_file->zstd_pending)
+          codec_file_fail(codec_file, "read", "unexpected end of input");
+        codec_file->eof = true;
+      }
+    }
+#endif
+#ifdef GT_WITH_LZMA
+    if (codec_file->file_mode == GT_FILE_MODE_XZ) {
+      lzma_ret ret;
+      codec_file->lzma.next_in = codec_file->inbuf + codec_file->inpos;
+      codec_file->lzma.avail_in = codec_file->inlen - codec_file->inpos;
+      codec_file->lzma.next_out = codec_file->outbuf;
+      codec_file->lzma.avail_out = GT_CODEC_FILE_BUFSIZE;
+      ret = lzma_code(&codec_file->lzma,
+                      codec_file->input_eof ? LZMA_FINISH : LZMA_RUN);
+      codec_file->inpos = codec_file->inlen - codec_file->lzma.avail_in;
+      codec_file->outlen = GT_CODEC_FILE_BUFSIZE - codec_file->lzma.avail_out;
+      if (ret == LZMA_STREAM_END)
+        codec_file->eof = true;
+      else if (ret != LZMA_OK)
+        codec_file_fail(codec_file, "read", codec_file_lzma_strerror(ret));
+    }
+#endif
+  }
+  return codec_file->outlen > 0;
+}
+
+int gt_codec_file_xfgetc(GtCodecFile *codec_file)
+{
+  gt_assert(codec_file && !codec_file->writing);
+  if (codec_file->outpos == codec_file->outlen && !codec_file_fill(codec_file))
+    return EOF;
+  /* as returned by gt_xgzfgetc() and gt_xbzfgetc() */
+  return (char) codec_file->outbuf[codec_file->outpos++];
+}
+
+size_t gt_codec_file_xread(GtCodecFile *codec_file, void *buf, size_t nbytes)
+{
+  size_t length = 0;
+  gt_assert(codec_file && !codec_file->writing);
+  while (length < nbytes) {
+    size_t available;
+    if (codec_file->outpos == codec_file->outlen &&
+        !codec_file_fill(codec_file)) {
+      break;
+    }
+    available = codec_file->outlen - codec_file->outpos;
+    if (available > nbytes - length)
+      available = nbytes - length;
+    memcpy((char*) buf + length, codec_file->outbuf + codec_file->outpos,
+           available);
+    codec_file->outpos += available;
+    length += available;
+  }
+  return length;
+}
+
+/* Compress the data collected in <outbuf>, and finish the stream if <end> is
+   true. */
+static void codec_file_flush(GtCodecFile *codec_file, GT_UNUSED bool end)
+{
+#ifdef GT_WITH_ZSTD
+  if (codec_file->file_mode == GT_FILE_MODE_ZSTD) {
+    ZSTD_inBuffer in;
+    size_t remaining;
+    in.src = codec_file->outbuf;
+    in.size = codec_file->outlen;
+    in.pos = 0;
+    do {
+      ZSTD_outBuffer out;
+      out.dst = codec_file->inbuf;
+      out.size = GT_CODEC_FILE_BUFSIZE;
+      out.pos = 0;
+      remaining = ZSTD_compressStream2(codec_file->cctx, &out, &in,
+                                       end ? ZSTD_e_end : ZSTD_e_continue);
+      if (ZSTD_isError(remaining))
+        codec_file_fail(codec_file, "write", ZSTD_getErrorName(remaining));
+      if (out.pos)
+        gt_xfwrite(codec_file->inbuf, 1, out.pos, codec_file->fp);
+    } while (in.pos < in.size || (end && remaining));
+  }
+#endif
+#ifdef GT_WITH_LZMA
+  if (codec_file->file_mode == GT_FILE_MODE_XZ) {
+    lzma_ret ret;
+    codec_file->lzma.next_in = codec_file->outbuf;
+    codec_file->lzma.avail_in = codec_file->outlen;
+    do {
+      codec_file->lzma.next_out = codec_file->inbuf;
+      codec_file->lzma.avail_out = GT_CODEC_FILE_BUFSIZE;
+      ret = lzma_code(&codec_file->lzma, end ? LZMA_FINISH : LZMA_RUN);
+      if (ret != LZMA_OK && ret != LZMA_STREAM_END)
+        codec_file_fail(codec_file, "write", codec_file_lzma_strerror(ret));
+      gt_xfwrite(codec_file->inbuf, 1,
+                 GT_CODEC_FILE_BUFSIZE - codec_file->lzma.avail_out,
+                 codec_file->fp);
+    } while (codec_file->lzma.avail_in || (end && ret != LZMA_STREAM_END));
+  }
+#endif
+  codec_file->outlen = 0;
+}
+
+void gt_codec_file_xwrite(GtCodecFile *codec_file, const void *buf,
+                          size_t nbytes)
+{
+  gt_assert(codec_file && codec_file->writing);
+  while (nbytes > 0) {
+    size_t length = GT_CODEC_FILE_BUFSIZE - codec_file->outlen;
+    if (length > nbytes)
+      length = nbytes;
+    memcpy(codec_file->outbuf + codec_file->outlen, buf, length);
+    codec_file->outlen += length;
+    buf = (const char*) buf + length;
+    nbytes -= length;
+    if (codec_file->outlen == GT_CODEC_FILE_BUFSIZE)
+      codec_file_flush(codec_file, false);
+  }
+}
+
+void gt_codec_file_xrewind(GtCodecFile *codec_file)
+{
+  gt_assert(codec_file && !codec_file->writing);
+  rewind(codec_file->fp);
+  codec_file_start(codec_file);
+}
+
+void gt_codec_file_delete(GtCodecFile *codec_file)
+{
+  if (!codec_file) return;
+  if (codec_file->writing)
+    codec_file_flush(codec_file, true);
+  gt_fa_xfclose(codec_file->fp);
+#ifdef GT_WITH_ZSTD
+  ZSTD_freeDCtx(codec_file->dctx);
+  ZSTD_freeCCtx(codec_file->cctx);
+#endif
+#ifdef GT_WITH_LZMA
+  lzma_end(&codec_file->lzma);
+#endif
+  gt_free(codec_file->inbuf);
+  gt_free(codec_file->outbuf);
+  gt_free(codec_file->path);
+  gt_free(codec_file);
+}
+
+static int codec_file_unit_test_mode(GtFileMode file_mode, GtError *err)
+{
+  GtCodecFile *codec_file;
+  GtStr *tmpfilename;
+  char *data, *buf;
+  size_t datalen = 3 * GT_CODEC_FILE_BUFSIZE + 17, i;
+  FILE *tmpfp;
+  int had_err = 0;
+  gt_error_check(err);
+
+  data = gt_malloc(datalen);
+  buf = gt_malloc(datalen);
+  for (i = 0; i < datalen; i++)
+    data[i] = "ACGT\n"[(i * i + i / 7) % 5];
+  tmpfilename = gt_str_new();
+  tmpfp = gt_xtmpfp(tmpfilename);
+  gt_fa_xfclose(tmpfp);
+
+  /* write two streams, which are read as one */
+  codec_file = gt_codec_file_xnew(file_mode, gt_str_get(tmpfilename), "wb");
+  gt_codec_file_xwrite(codec_file, data, 5);
+  gt_codec_file_xwrite(codec_file, data + 5, datalen / 2 - 5);
+  gt_codec_file_delete(codec_file);
+  codec_file = gt_codec_file_xnew(file_mode, gt_str_get(tmpfilename), "ab");
+  gt_codec_file_xwrite(codec_file, data + datalen / 2,
+                       datalen - datalen / 2);
+  gt_codec_file_delete(codec_file);
+
+  codec_file = gt_codec_file_xnew(file_mode, gt_str_get(tmpfilename), "rb");
+  gt_ensure(gt_codec_file_xfgetc(codec_file) == data[0]);
+  gt_ensure(gt_codec_file_xread(codec_file, buf + 1, datalen) == datalen - 1);
+  gt_ensure(!memcmp(data + 1, buf + 1, datalen - 1));
+  gt_ensure(gt_codec_file_xread(codec_file, buf, datalen) == 0);
+  gt_ensure(gt_codec_file_xfgetc(codec_file) == EOF);
+  gt_codec_file_xrewind(codec_file);
+  for (i = 0; !had_err && i < datalen; i++)
+    gt_ensure(gt_codec_file_xfgetc(codec_file) == data[i]);
+  gt_ensure(gt_codec_file_xfgetc(codec_file) == EOF);
+  gt_codec_file_delete(codec_file);
+
+  /* an empty file */
+  codec_file = gt_codec_file_xnew(file_mode, gt_str_get(tmpfilename), "wb");
+  gt_codec_file_delete(codec_file);
+  codec_file = gt_codec_file_xnew(file_mode, gt_str_get(tmpfilename), "rb");
+  gt_ensure(gt_codec_file_xfgetc(codec_file) == EOF);
+  gt_codec_file_delete(codec_file);
+
+  gt_xremove(gt_str_get(tmpfilename));
+  gt_str_delete(tmpfilename);
+  gt_free(data);
+  gt_free(buf);
+  return had_err;
+}
+
+int gt_codec_file_unit_test(GtError *err)
+{
+  int had_err = 0;
+  gt_error_check(err);
+  if (gt_codec_file_mode_is_supported(GT_FILE_MODE_ZSTD))
+    had_err = codec_file_unit_test_mode(GT_FILE_MODE_ZSTD, err);
+  if (!had_err && gt_codec_file_mode_is_supported(GT_FILE_MODE_XZ))
+    had_err = codec_file_unit_test_mode(GT_FILE_MODE_XZ, err);
+  if (!had_err && !gt_codec_file_mode_is_supported(GT_FILE_MODE_ZSTD)) {
+    GtError *tmperr = gt_error_new();
+    gt_ensure(!gt_codec_file_new(GT_FILE_MODE_ZSTD, "unsupported.zst", "r",
+                                 tmperr));
+    gt_ensure(gt_error_is_set(tmperr));
+    gt_error_delete(tmperr);
+  }
+  return had_err;
+}
@@ -0,0 +1,61 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef CODEC_FILE_H
+#define CODEC_FILE_H
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "core/error_api.h"
+#include "core/file_api.h"
+
+/* A <GtCodecFile> reads or writes a file compressed with Zstandard
+   (<GT_FILE_MODE_ZSTD>) or xz (<GT_FILE_MODE_XZ>). The codecs are only
+   available if GenomeTools has been compiled with the respective library
+   (see the options with-zstd and with-xz of the Makefile).
+   Concatenated frames or streams are read as one file.
+   Like the wrappers in core/xzlib.h and core/xbzlib.h, all functions except
+   <gt_codec_file_new()> terminate the program on errors. */
+typedef struct GtCodecFile GtCodecFile;
+
+/* Return true if the codec for <file_mode> has been compiled in. */
+bool         gt_codec_file_mode_is_supported(GtFileMode file_mode);
+/* Return a new <GtCodecFile> for the file <path> opened with <mode>, which
+   is compressed according to <file_mode>. Returns NULL and sets <err> if the
+   file cannot be opened or the codec is not supported. */
+GtCodecFile* gt_codec_file_new(GtFileMode file_mode, const char *path,
+                               const char *mode, GtError *err);
+/* Like <gt_codec_file_new()>, but terminates on error. */
+GtCodecFile* gt_codec_file_xnew(GtFileMode file_mode, const char *path,
+                                const char *mode);
+/* Return the next character of <codec_file> as a char, or EOF. */
+int          gt_codec_file_xfgetc(GtCodecFile *codec_file);
+/* Decompress up to <nbytes> from <codec_file> into <buf>, returns the number
+   of bytes read, 0 at the end of the file. */
+size_t       gt_codec_file_xread(GtCodecFile *codec_file, void *buf,
+                                 size_t nbytes);
+/* Compress <nbytes> from <buf> into <codec_file>. */
+void         gt_codec_file_xwrite(GtCodecFile *codec_file, const void *buf,
+                                  size_t nbytes);
+/* Continue reading <codec_file> from the beginning of the file. */
+void         gt_codec_file_xrewind(GtCodecFile *codec_file);
+/* Finish the compressed data if <codec_file> has been opened for writing and
+   close the underlying file. */
+void         gt_codec_file_delete(GtCodecFile *codec_file);
+
+int          gt_codec_file_unit_test(GtError *err);
+
+#endif
@@ -513,6 +513,8 @@ static void binpreparenextrangeGtEncseqReader(GtEncseqReader *esr,
 static void singlepositioninseparatorViaequallength_updatestate(
                                    GtEncseqReader *esr);
 
+static GtUword fwdgetnexttwobitencodingstoppos(GtEncseqReader *esr);
+
 GtUchar gt_encseq_reader_next_encoded_char(GtEncseqReader *esr)
 {
   GtUchar cc;
@@ -717,40 +719,129 @@ static void showGtRange(const GtRange *range)
 }
 #endif
 
-void gt_encseq_extract_encoded_with_reader(GtEncseqReader *esr,
-                               const GtEncseq *encseq,
-                               GtUchar *buffer,
-                               GtUword frompos,
-                               GtUword topos)
+/* Patches the special characters marked in the bit vector of the
+   bit access type into the unpacked characters of <buffer>. */
+static void extract_encoded_patch_specialbits(const GtEncseq *encseq,
+                                              GtUchar *buffer,
+                                              GtUword frompos,
+                                              GtUword topos)
 {
-  GtUword idx, pos;
+  GtUword unit, pos, endpos;
+
+  for (unit = GT_DIVWORDSIZE(frompos); unit <= GT_DIVWORDSIZE(topos); unit++) {
+    if (encseq->specialbits[unit] == 0)
+      continue;
+    pos = GT_MAX(GT_MULWORDSIZE(unit), frompos);
+    endpos = GT_MIN(GT_MULWORDSIZE(unit + 1) - 1, topos);
+    for (/* Nothing */; pos <= endpos; pos++) {
+      if (GT_ISIBITSET(encseq->specialbits, pos) &&
+          buffer[pos - frompos] <= (GtUchar) GT_TWOBITS_FOR_SEPARATOR) {
+        buffer[pos - frompos]
+          = (buffer[pos - frompos] == (GtUchar) GT_TWOBITS_FOR_SEPARATOR)
+              ? (GtUchar) GT_SEPARATOR
+              : (GtUchar) GT_WILDCARD;
+      }
+    }
+  }
+}
+
+void gt_encseq_extract_encoded_with_kernel(GtEncseqReader *esr,
+                                           const GtEncseq *encseq,
+                                           GtUchar *buffer,
+                                           GtUword frompos,
+                                           GtUword topos,
+                                           GtEncseqUnpackKernel kernel)
+{
+  GtUword idx, pos, stoppos, endpos;
 
   gt_assert(frompos <= topos && encseq != NULL &&
             topos < encseq->logicaltotallength && buffer != NULL);
+  if (encseq->twobitencoding == NULL || topos >= encseq->totallength ||
+      (!gt_encseq_has_twobitencoding_stoppos_support(encseq) &&
+       encseq->sat != GT_ACCESS_TYPE_BITACCESS)) {
+    gt_encseq_reader_reinit_with_readmode(esr, encseq, GT_READMODE_FORWARD,
+                                          frompos);
+    for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
+      buffer[idx] = gt_encseq_reader_next_encoded_char(esr);
+    }
+    return;
+  }
+  if (encseq->sat == GT_ACCESS_TYPE_BITACCESS) {
+    gt_encseq_unpack_twobitencoding(buffer, encseq->twobitencoding, frompos,
+                                    topos + 1, kernel);
+    if (encseq->specialbits != NULL)
+      extract_encoded_patch_specialbits(encseq, buffer, frompos, topos);
+    return;
+  }
+  /* unpack the characters up to the next special position, which is
+     delivered by the reader */
   gt_encseq_reader_reinit_with_readmode(esr, encseq, GT_READMODE_FORWARD,
                                         frompos);
-  for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
-    buffer[idx] = gt_encseq_reader_next_encoded_char(esr);
+  pos = frompos;
+  while (pos <= topos) {
+    esr->currentpos = pos;
+    stoppos = fwdgetnexttwobitencodingstoppos(esr);
+    if (stoppos > pos) {
+      endpos = GT_MIN(stoppos, topos + 1);
+      gt_encseq_unpack_twobitencoding(buffer + pos - frompos,
+                                      encseq->twobitencoding, pos, endpos,
+                                      kernel);
+      pos = endpos;
+    } else {
+      buffer[pos - frompos]
+        = encseq->sat == GT_ACCESS_TYPE_EQUALLENGTH
+            ? gt_encseq_get_encoded_char(encseq, pos, GT_READMODE_FORWARD)
+            : gt_encseq_reader_next_encoded_char(esr);
+      pos++;
+    }
   }
 }
 
+void gt_encseq_extract_encoded_with_reader(GtEncseqReader *esr,
+                               const GtEncseq *encseq,
+                               GtUchar *buffer,
+                               GtUword frompos,
+                               GtUword topos)
+{
+  gt_encseq_extract_encoded_with_kernel(esr, encseq, buffer, frompos, topos,
+                                        gt_encseq_unpack_kernel_best());
+}
+
 void gt_encseq_extract_encoded(const GtEncseq *encseq,
                                GtUchar *buffer,
                                GtUword frompos,
                                GtUword topos)
 {
   GtEncseqReader *esr;
-  GtUword idx, pos;
 
   gt_assert(frompos <= topos && encseq != NULL &&
             topos < encseq->logicaltotallength && buffer != NULL);
   esr = gt_encseq_create_reader_with_readmode(encseq,
                                               GT_READMODE_FORWARD,
                                               frompos);
-  for (pos=frompos, idx = 0; pos <= topos; pos++, idx++) {
-    buffer[idx] = gt_encseq_reader_next_encoded_char(esr);
-  }
+  gt_encseq_extract_encoded_with_kernel(esr, encseq, buffer, frompos, topos,
+                                        gt_encseq_unpack_kernel_best());
+  gt_encseq_reader_delete(esr);
+}
+
+void gt_encseq_extract_encoded_rc(const GtEncseq *encseq,
+                                  GtUchar *buffer,
+                                  GtUword frompos,
+                                  GtUword topos)
+{
+  GtEncseqUnpackKernel kernel = gt_encseq_unpack_kernel_best();
+  GtEncseqReader *esr;
+
+  gt_assert(frompos <= topos && encseq != NULL &&
+            topos < encseq->logicaltotallength && buffer != NULL);
+  gt_assert(gt_alphabet_is_dna(encseq->alpha));
+  esr = gt_encseq_create_reader_with_readmode(encseq,
+                                              GT_READMODE_FORWARD,
+                                              frompos);
+  gt_encseq_extract_encoded_with_kernel(esr, encseq, buffer, frompos, topos,
+                                        kernel);
   gt_encseq_reader_delete(esr);
+  gt_encseq_unpack_reverse_complement(buffer, topos - frompos + 1, kernel);
 }
 
 void gt_encseq_extract_decoded_with_reader(GtEncseqReader *esr,
@@ -5532,6 +5623,11 @@ static int gt_inputfiles2sequencekeyvalues(const char *indexname,
                                      sizeof (GtUword));
     if (md5fp != NULL)
       md5enc = gt_md5_encoder_new();
+    /* With more than one thread, the FASTA input is parsed and mapped in
+       chunks on the thread pool. This loop still consumes the delivered
+       characters one by one: the MD5 state of a sequence and the lengths of
+       the current special, wildcard and nonspecial ranges are carried
+       across chunk boundaries, so they are not computed per chunk. */
     for (currentpos = 0; !haserr; currentpos++) {
 #if !(defined (_LP64) || defined (_WIN64))
 #define MAXSFXLENFOR32BIT 4294000000UL
@@ -27,6 +27,7 @@
 #include "core/encseq_api.h"
 #include "core/encseq_access_type.h"
 #include "core/encseq_options.h"
+#include "core/encseq_unpack.h"
 #include "core/filelengthvalues.h"
 #include "core/intbits.h"
 #include "core/md5_tab_api.h"
@@ -103,6 +104,15 @@ void gt_encseq_extract_encoded_with_reader(GtEncseqReader *esr,
                                GtUword frompos,
                                GtUword topos);
 
+/* Like <gt_encseq_extract_encoded_with_reader>, but unpacks the two bit
+   encoding with the given <kernel>, which must be supported by the CPU. */
+void gt_encseq_extract_encoded_with_kernel(GtEncseqReader *esr,
+                                           const GtEncseq *encseq,
+                                           GtUchar *buffer,
+                                           GtUword frompos,
+                                           GtUword topos,
+                                           GtEncseqUnpackKernel kernel);
+
 /* The following type stores the result of comparing a pair of twobit
   encodings. <common> stores the number of units which are common
   (either from the beginning or from the end. common is in the range 0 to
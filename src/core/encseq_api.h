@@ -123,6 +123,16 @@ void              gt_encseq_extract_encoded(const GtEncseq *encseq,
                                             GtUchar *buffer,
                                             GtUword frompos,
                                             GtUword topos);
+/* Stores the reverse complement of the encoded representation of the
+   substring from 0-based position <frompos> to position <topos> of <encseq>,
+   i.e. <buffer> starts with the complement of the character at <topos>.
+   Special characters are not complemented. <encseq> must have a DNA
+   alphabet. The result is written to the location pointed to by <buffer>,
+   which must be large enough to hold the result. */
+void              gt_encseq_extract_encoded_rc(const GtEncseq *encseq,
+                                               GtUchar *buffer,
+                                               GtUword frompos,
+                                               GtUword topos);
 /* Stores the decoded version of the substring from 0-based position <frompos>
    to position <topos> of <encseq>. If the extracted region contains a separator
    character, it will be represented by non-printable GT_SEPARATOR constant.
@@ -0,0 +1,360 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <string.h>
+#include "core/chardef_api.h"
+#include "core/encseq_unpack.h"
+#include "core/ensure_api.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/readmode.h"
+
+#if defined (__GNUC__) && defined (__x86_64__) && defined (_LP64)
+#define GT_ENCSEQ_UNPACK_X86
+#include <immintrin.h>
+#endif
+
+#define GT_ENCSEQ_UNPACK_CODE(TBE, IDX)\
+        ((GtUchar) (((TBE) >> GT_MULT2(GT_UNITSIN2BITENC - 1 - (IDX))) & 3))
+
+static const char *gt_encseq_unpack_kernel_names[] = { "scalar", "ssse3",
+                                                       "avx2" };
+
+bool gt_encseq_unpack_kernel_is_supported(GtEncseqUnpackKernel kernel)
+{
+  switch (kernel) {
+    case GT_ENCSEQ_UNPACK_SCALAR:
+      return true;
+#ifdef GT_ENCSEQ_UNPACK_X86
+    case GT_ENCSEQ_UNPACK_SSSE3:
+      return __builtin_cpu_supports("ssse3") ? true : false;
+    case GT_ENCSEQ_UNPACK_AVX2:
+      return __builtin_cpu_supports("avx2") ? true : false;
+#endif
+    default:
+      return false;
+  }
+}
+
+GtEncseqUnpackKernel gt_encseq_unpack_kernel_best(void)
+{
+  if (gt_encseq_unpack_kernel_is_supported(GT_ENCSEQ_UNPACK_AVX2))
+    return GT_ENCSEQ_UNPACK_AVX2;
+  if (gt_encseq_unpack_kernel_is_supported(GT_ENCSEQ_UNPACK_SSSE3))
+    return GT_ENCSEQ_UNPACK_SSSE3;
+  return GT_ENCSEQ_UNPACK_SCALAR;
+}
+
+const char* gt_encseq_unpack_kernel_name(GtEncseqUnpackKernel kernel)
+{
+  gt_assert(kernel < GT_ENCSEQ_UNPACK_NUMOFKERNELS);
+  return gt_encseq_unpack_kernel_names[kernel];
+}
+
+static void gt_encseq_unpack_units_scalar(GtUchar *dest,
+                                          const GtTwobitencoding *tbeptr,
+                                          GtUword numofunits)
+{
+  GtUword idx;
+  unsigned int j;
+
+  for (idx = 0; idx < numofunits; idx++) {
+    GtTwobitencoding tbe = tbeptr[idx];
+    for (j = 0; j < (unsigned int) GT_UNITSIN2BITENC; j++)
+      *dest++ = GT_ENCSEQ_UNPACK_CODE(tbe, j);
+  }
+}
+
+static void gt_encseq_unpack_reverse_complement_scalar(GtUchar *left,
+                                                       GtUchar *right)
+{
+  GtUchar tmp;
+
+  /* <right> points to the last character */
+  for (; left < right; left++, right--) {
+    tmp = GT_ISSPECIAL(*left) ? *left : GT_COMPLEMENTBASE(*left);
+    *left = GT_ISSPECIAL(*right) ? *right : GT_COMPLEMENTBASE(*right);
+    *right = tmp;
+  }
+  if (left == right && !GT_ISSPECIAL(*left))
+    *left = GT_COMPLEMENTBASE(*left);
+}
+
+#ifdef GT_ENCSEQ_UNPACK_X86
+/* The characters of a unit are stored from the most significant bits on, so
+   the first four characters are in byte 7 of the little endian word. After
+   replicating the bytes, the characters are selected from the high or low
+   nibble and then from the upper or lower two bits of the nibble. */
+
+__attribute__((target("ssse3")))
+static void gt_encseq_unpack_units_ssse3(GtUchar *dest,
+                                         const GtTwobitencoding *tbeptr,
+                                         GtUword numofunits)
+{
+  GtUword idx;
+  const __m128i first = _mm_setr_epi8(7, 7, 7, 7, 6, 6, 6, 6,
+                                      5, 5, 5, 5, 4, 4, 4, 4),
+                second = _mm_setr_epi8(3, 3, 3, 3, 2, 2, 2, 2,
+                                       1, 1, 1, 1, 0, 0, 0, 0),
+                highnibble = _mm_set1_epi32((int) 0x0000ffff),
+                highpair = _mm_set1_epi32((int) 0x00ff00ff),
+                lownibblemask = _mm_set1_epi8(0x0f),
+                lowpairmask = _mm_set1_epi8(0x03);
+
+  for (idx = 0; idx < numofunits; idx++) {
+    /* the intrinsic takes a signed 64-bit value, only the bits matter */
+    __m128i word = _mm_set1_epi64x((GtInt64) tbeptr[idx]), half[2];
+    int h;
+
+    half[0] = _mm_shuffle_epi8(word, first);
+    half[1] = _mm_shuffle_epi8(word, second);
+    for (h = 0; h < 2; h++) {
+      __m128i nibble, pair;
+      nibble = _mm_or_si128(
+                 _mm_and_si128(highnibble,
+                               _mm_and_si128(_mm_srli_epi16(half[h], 4),
+                                             lownibblemask)),
+                 _mm_andnot_si128(highnibble,
+                                  _mm_and_si128(half[h], lownibblemask)));
+      pair = _mm_or_si128(
+               _mm_and_si128(highpair,
+                             _mm_and_si128(_mm_srli_epi16(nibble, 2),
+                                           lowpairmask)),
+               _mm_andnot_si128(highpair,
+                                _mm_and_si128(nibble, lowpairmask)));
+      _mm_storeu_si128((__m128i *) dest, pair);
+      dest += 16;
+    }
+  }
+}
+
+__attribute__((target("avx2")))
+static void gt_encseq_unpack_units_avx2(GtUchar *dest,
+                                        const GtTwobitencoding *tbeptr,
+                                        GtUword numofunits)
+{
+  GtUword idx;
+  const __m256i select = _mm256_setr_epi8(7, 7, 7, 7, 6, 6, 6, 6,
+                                          5, 5, 5, 5, 4, 4, 4, 4,
+                                          3, 3, 3, 3, 2, 2, 2, 2,
+                                          1, 1, 1, 1, 0, 0, 0, 0),
+                highnibble = _mm256_set1_epi32((int) 0x0000ffff),
+                highpair = _mm256_set1_epi32((int) 0x00ff00ff),
+                lownibblemask = _mm256_set1_epi8(0x0f),
+                lowpairmask = _mm256_set1_epi8(0x03);
+
+  for (idx = 0; idx < numofunits; idx++) {
+    __m256i bytes, nibble, pair;
+
+    /* the intrinsic takes a signed 64-bit value, only the bits matter */
+    bytes = _mm256_shuffle_epi8(_mm256_set1_epi64x((GtInt64) tbeptr[idx]),
+                                select);
+    nibble = _mm256_or_si256(
+               _mm256_and_si256(highnibble,
+                                _mm256_and_si256(_mm256_srli_epi16(bytes, 4),
+                                                 lownibblemask)),
+               _mm256_andnot_si256(highnibble,
+                                   _mm256_and_si256(bytes, lownibblemask)));
+    pair = _mm256_or_si256(
+             _mm256_and_si256(highpair,
+                              _mm256_and_si256(_mm256_srli_epi16(nibble, 2),
+                                               lowpairmask)),
+             _mm256_andnot_si256(highpair,
+                                 _mm256_and_si256(nibble, lowpairmask)));
+    _mm256_storeu_si256((__m256i *) dest, pair);
+    dest += 32;
+  }
+}
+
+__attribute__((target("ssse3")))
+static __m128i gt_encseq_unpack_revcompl_ssse3(__m128i v)
+{
+  const __m128i reverse = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8,
+                                        7, 6, 5, 4, 3, 2, 1, 0),
+                wildcard = _mm_set1_epi8((char) GT_WILDCARD),
+                three = _mm_set1_epi8(3);
+  __m128i special = _mm_cmpeq_epi8(_mm_max_epu8(v, wildcard), v);
+
+  v = _mm_or_si128(_mm_and_si128(special, v),
+                   _mm_andnot_si128(special, _mm_sub_epi8(three, v)));
+  return _mm_shuffle_epi8(v, reverse);
+}
+
+__attribute__((target("ssse3")))
+static void gt_encseq_unpack_reverse_complement_ssse3(GtUchar *buffer,
+                                                      GtUword len)
+{
+  GtUchar *left = buffer, *right = buffer + len;
+
+  while (right - left >= 32) {
+    __m128i l = _mm_loadu_si128((const __m128i *) left),
+            r = _mm_loadu_si128((const __m128i *) (right - 16));
+    _mm_storeu_si128((__m128i *) left, gt_encseq_unpack_revcompl_ssse3(r));
+    _mm_storeu_si128((__m128i *) (right - 16),
+                     gt_encseq_unpack_revcompl_ssse3(l));
+    left += 16;
+    right -= 16;
+  }
+  if (left < right)
+    gt_encseq_unpack_reverse_complement_scalar(left, right - 1);
+}
+
+__attribute__((target("avx2")))
+static __m256i gt_encseq_unpack_revcompl_avx2(__m256i v)
+{
+  const __m256i reverse = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8,
+                                           7, 6, 5, 4, 3, 2, 1, 0,
+                                           15, 14, 13, 12, 11, 10, 9, 8,
+                                           7, 6, 5, 4, 3, 2, 1, 0),
+                wildcard = _mm256_set1_epi8((char) GT_WILDCARD),
+                three = _mm256_set1_epi8(3);
+  __m256i special = _mm256_cmpeq_epi8(_mm256_max_epu8(v, wildcard), v);
+
+  v = _mm256_or_si256(_mm256_and_si256(special, v),
+                      _mm256_andnot_si256(special, _mm256_sub_epi8(three, v)));
+  /* reverse the bytes of both lanes, then swap the lanes */
+  v = _mm256_shuffle_epi8(v, reverse);
+  return _mm256_permute4x64_epi64(v, 0x4e);
+}
+
+__attribute__((target("avx2")))
+static void gt_encseq_unpack_reverse_complement_avx2(GtUchar *buffer,
+                                                     GtUword len)
+{
+  GtUchar *left = buffer, *right = buffer + len;
+
+  while (right - left >= 64) {
+    __m256i l = _mm256_loadu_si256((const __m256i *) left),
+            r = _mm256_loadu_si256((const __m256i *) (right - 32));
+    _mm256_storeu_si256((__m256i *) left, gt_encseq_unpack_revcompl_avx2(r));
+    _mm256_storeu_si256((__m256i *) (right - 32),
+                        gt_encseq_unpack_revcompl_avx2(l));
+    left += 32;
+    right -= 32;
+  }
+  if (left < right)
+    gt_encseq_unpack_reverse_complement_scalar(left, right - 1);
+}
+#endif
+
+void gt_encseq_unpack_twobitencoding(GtUchar *dest,
+                                     const GtTwobitencoding *twobitencoding,
+                                     GtUword from,
+                                     GtUword to,
+                                     GtEncseqUnpackKernel kernel)
+{
+  GtUword pos = from, numofunits;
+
+  gt_assert(dest != NULL && twobitencoding != NULL && from <= to);
+  gt_assert(gt_encseq_unpack_kernel_is_supported(kernel));
+  /* characters in front of the first complete unit */
+  while (pos < to && GT_MODBYUNITSIN2BITENC(pos) != 0) {
+    *dest++ = GT_ENCSEQ_UNPACK_CODE(twobitencoding[GT_DIVBYUNITSIN2BITENC(pos)],
+                                    GT_MODBYUNITSIN2BITENC(pos));
+    pos++;
+  }
+  numofunits = (to - pos) / GT_UNITSIN2BITENC;
+  if (numofunits > 0) {
+    const GtTwobitencoding *tbeptr = twobitencoding +
+                                     GT_DIVBYUNITSIN2BITENC(pos);
+    switch (kernel) {
+#ifdef GT_ENCSEQ_UNPACK_X86
+      case GT_ENCSEQ_UNPACK_SSSE3:
+        gt_encseq_unpack_units_ssse3(dest, tbeptr, numofunits);
+        break;
+      case GT_ENCSEQ_UNPACK_AVX2:
+        gt_encseq_unpack_units_avx2(dest, tbeptr, numofunits);
+        break;
+#endif
+      default:
+        gt_encseq_unpack_units_scalar(dest, tbeptr, numofunits);
+    }
+    dest += numofunits * GT_UNITSIN2BITENC;
+    pos += numofunits * GT_UNITSIN2BITENC;
+  }
+  while (pos < to) {
+    *dest++ = GT_ENCSEQ_UNPACK_CODE(twobitencoding[GT_DIVBYUNITSIN2BITENC(pos)],
+                                    GT_MODBYUNITSIN2BITENC(pos));
+    pos++;
+  }
+}
+
+void gt_encseq_unpack_reverse_complement(GtUchar *buffer, GtUword len,
+                                         GtEncseqUnpackKernel kernel)
+{
+  gt_assert(buffer != NULL || len == 0);
+  gt_assert(gt_encseq_unpack_kernel_is_supported(kernel));
+  if (len == 0)
+    return;
+  switch (kernel) {
+#ifdef GT_ENCSEQ_UNPACK_X86
+    case GT_ENCSEQ_UNPACK_SSSE3:
+      gt_encseq_unpack_reverse_complement_ssse3(buffer, len);
+      break;
+    case GT_ENCSEQ_UNPACK_AVX2:
+      gt_encseq_unpack_reverse_complement_avx2(buffer, len);
+      break;
+#endif
+    default:
+      gt_encseq_unpack_reverse_complement_scalar(buffer, buffer + len - 1);
+  }
+}
+
+int gt_encseq_unpack_unit_test(GtError *err)
+{
+  int had_err = 0;
+  GtTwobitencoding tbe[16];
+  GtUchar expected[16 * GT_UNITSIN2BITENC], buf[16 * GT_UNITSIN2BITENC];
+  GtUword idx, from, to, numofchars = 16 * GT_UNITSIN2BITENC;
+  GtEncseqUnpackKernel kernel;
+
+  gt_error_check(err);
+
+  for (idx = 0; idx < 16UL; idx++)
+    tbe[idx] = 0;
+  for (idx = 0; idx < numofchars; idx++) {
+    expected[idx] = (GtUchar) gt_rand_max(3UL);
+    tbe[GT_DIVBYUNITSIN2BITENC(idx)]
+      |= (GtTwobitencoding) expected[idx]
+           << GT_MULT2(GT_UNITSIN2BITENC - 1 - GT_MODBYUNITSIN2BITENC(idx));
+  }
+  for (kernel = GT_ENCSEQ_UNPACK_SCALAR;
+       !had_err && kernel < GT_ENCSEQ_UNPACK_NUMOFKERNELS;
+       kernel++) {
+    if (!gt_encseq_unpack_kernel_is_supported(kernel))
+      continue;
+    for (from = 0; !had_err && from < 3UL * GT_UNITSIN2BITENC; from += 7UL) {
+      for (to = from; !had_err && to <= numofchars; to += 13UL) {
+        gt_encseq_unpack_twobitencoding(buf, tbe, from, to, kernel);
+        gt_ensure(memcmp(buf, expected + from, (size_t) (to - from)) == 0);
+        if (!had_err) {
+          /* specials are not complemented */
+          if (to > from)
+            buf[(to - from) / 2] = (GtUchar) GT_WILDCARD;
+          gt_encseq_unpack_reverse_complement(buf, to - from, kernel);
+          for (idx = 0; !had_err && idx < to - from; idx++) {
+            if (to > from && idx == to - from - 1 - (to - from) / 2)
+              gt_ensure(buf[idx] == (GtUchar) GT_WILDCARD);
+            else
+              gt_ensure(buf[idx] ==
+                        GT_COMPLEMENTBASE(expected[to - 1 - idx]));
+          }
+        }
+      }
+    }
+  }
+  return had_err;
+}
@@ -0,0 +1,61 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef ENCSEQ_UNPACK_H
+#define ENCSEQ_UNPACK_H
+
+#include <stdbool.h>
+#include "core/error_api.h"
+#include "core/intbits.h"
+#include "core/types_api.h"
+
+/* Kernels for unpacking a two bit encoding into one byte per character.
+   The SIMD kernels are only available on x86_64 with a compiler supporting
+   function specific target options; which of them the CPU supports is
+   determined at runtime. */
+typedef enum {
+  GT_ENCSEQ_UNPACK_SCALAR,
+  GT_ENCSEQ_UNPACK_SSSE3,
+  GT_ENCSEQ_UNPACK_AVX2,
+  GT_ENCSEQ_UNPACK_NUMOFKERNELS
+} GtEncseqUnpackKernel;
+
+/* Return true if <kernel> can be used on the running CPU. */
+bool                 gt_encseq_unpack_kernel_is_supported(GtEncseqUnpackKernel
+                                                          kernel);
+/* Return the fastest kernel supported by the running CPU. */
+GtEncseqUnpackKernel gt_encseq_unpack_kernel_best(void);
+/* Return the name of <kernel>. */
+const char*          gt_encseq_unpack_kernel_name(GtEncseqUnpackKernel kernel);
+/* Store the two bit codes of the positions <from> to <to>-1 of
+   <twobitencoding> in <dest>, using <kernel>. */
+void                 gt_encseq_unpack_twobitencoding(GtUchar *dest,
+                                                     const GtTwobitencoding
+                                                       *twobitencoding,
+                                                     GtUword from,
+                                                     GtUword to,
+                                                     GtEncseqUnpackKernel
+                                                       kernel);
+/* Reverse the <len> encoded characters in <buffer> and complement all of
+   them which are not special, using <kernel>. */
+void                 gt_encseq_unpack_reverse_complement(GtUchar *buffer,
+                                                         GtUword len,
+                                                         GtEncseqUnpackKernel
+                                                           kernel);
+
+int                  gt_encseq_unpack_unit_test(GtError *err);
+
+#endif
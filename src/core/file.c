@@ -17,13 +17,25 @@
 
 #include <stdio.h>
 #include <string.h>
+#include "core/bgzf_reader.h"
+#include "core/codec_file.h"
 #include "core/cstr_api.h"
 #include "core/fa_api.h"
 #include "core/ma_api.h"
+#include "core/thread_api.h"
+#include "core/thread_pool.h"
+#include "core/unused_api.h"
 #include "core/xansi_api.h"
 #include "core/xbzlib.h"
 #include "core/xzlib.h"
 
+/* compressed input is decompressed ahead into a ring of this many buffers of
+   the given size, if more than one thread is used */
+#define GT_FILE_READ_AHEAD_SLOTS     4U
+#define GT_FILE_READ_AHEAD_SLOTSIZE  (1UL << 20)
+
+typedef struct GtFileReadAhead GtFileReadAhead;
+
 struct GtFile {
   GtFileMode mode;
   GtUword reference_count;
@@ -31,7 +43,10 @@ struct GtFile {
     FILE *file;
     gzFile gzfile;
     BZFILE *bzfile;
+    GtCodecFile *codecfile;
   } fileptr;
+  GtBGZFReader *bgzf; /* replaces <gzfile> for BGZF input read ahead */
+  GtFileReadAhead *read_ahead;
   char *orig_path,
        *orig_mode,
        unget_char;
@@ -49,6 +64,10 @@ GtFileMode gt_file_mode_determine(const char *path)
     return GT_FILE_MODE_GZIP;
   if (path_length >= 5 && strcmp(".bz2", path + path_length - 4) == 0)
     return GT_FILE_MODE_BZIP2;
+  if (path_length >= 5 && strcmp(".zst", path + path_length - 4) == 0)
+    return GT_FILE_MODE_ZSTD;
+  if (path_length >= 4 && strcmp(".xz", path + path_length - 3) == 0)
+    return GT_FILE_MODE_XZ;
   return GT_FILE_MODE_UNCOMPRESSED;
 }
 
@@ -61,6 +80,10 @@ const char* gt_file_mode_suffix(GtFileMode mode)
       return ".gz";
     case GT_FILE_MODE_BZIP2:
       return ".bz2";
+    case GT_FILE_MODE_ZSTD:
+      return ".zst";
+    case GT_FILE_MODE_XZ:
+      return ".xz";
     default:
       gt_assert(0);
       return "";
@@ -81,9 +104,251 @@ size_t gt_file_basename_length(const char *path)
     return path_length - 3;
   if (path_length >= 5 && strcmp(".bz2", path + path_length - 4) == 0)
     return path_length - 4;
+  if (path_length >= 5 && strcmp(".zst", path + path_length - 4) == 0)
+    return path_length - 4;
+  if (path_length >= 4 && strcmp(".xz", path + path_length - 3) == 0)
+    return path_length - 3;
   return path_length;
 }
 
+#ifdef GT_THREADS_ENABLED
+
+#include <pthread.h>
+
+typedef struct {
+  char *buf;
+  size_t length;
+  bool filled;
+} GtFileReadAheadSlot;
+
+struct GtFileReadAhead {
+  GtFileReadAheadSlot slots[GT_FILE_READ_AHEAD_SLOTS];
+  GtThreadPoolGroup *group; /* the task filling the slots */
+  pthread_mutex_t mutex; /* protects the slots, <fill>, <filling>, <started>,
+                            and <eof> */
+  pthread_cond_t cond; /* signalled whenever a slot has been filled and when
+                          the filling task ends */
+  const char *pos, /* unread part of the current slot, NULL if there is none */
+             *end;
+  unsigned int current, /* slot being read */
+               fill; /* next slot to be filled */
+  bool filling, /* the filling task has been submitted and not finished */
+       started, /* the filling task is being executed by some worker */
+       eof;
+};
+
+static bool file_use_read_ahead(GtFileMode file_mode, const char *mode)
+{
+  return file_mode != GT_FILE_MODE_UNCOMPRESSED && mode[0] == 'r' &&
+         !strchr(mode, '+') && gt_jobs > 1;
+}
+
+static GtFileReadAhead* file_read_ahead_new(void)
+{
+  GtFileReadAhead *read_ahead = gt_calloc(1, sizeof *read_ahead);
+  unsigned int i;
+  for (i = 0; i < GT_FILE_READ_AHEAD_SLOTS; i++)
+    read_ahead->slots[i].buf = gt_malloc(GT_FILE_READ_AHEAD_SLOTSIZE);
+  read_ahead->group = gt_thread_pool_group_new();
+  pthread_mutex_init(&read_ahead->mutex, NULL);
+  pthread_cond_init(&read_ahead->cond, NULL);
+  return read_ahead;
+}
+
+/* Wait for the filling task and discard the data read ahead. */
+static void file_read_ahead_reset(GtFileReadAhead *read_ahead)
+{
+  unsigned int i;
+  gt_thread_pool_group_wait(read_ahead->group);
+  for (i = 0; i < GT_FILE_READ_AHEAD_SLOTS; i++)
+    read_ahead->slots[i].filled = false;
+  read_ahead->pos = read_ahead->end = NULL;
+  read_ahead->current = read_ahead->fill = 0;
+  read_ahead->filling = read_ahead->started = read_ahead->eof = false;
+}
+
+static void file_read_ahead_delete(GtFileReadAhead *read_ahead)
+{
+  unsigned int i;
+  if (!read_ahead) return;
+  gt_thread_pool_group_wait(read_ahead->group);
+  gt_thread_pool_group_delete(read_ahead->group);
+  pthread_cond_destroy(&read_ahead->cond);
+  pthread_mutex_destroy(&read_ahead->mutex);
+  for (i = 0; i < GT_FILE_READ_AHEAD_SLOTS; i++)
+    gt_free(read_ahead->slots[i].buf);
+  gt_free(read_ahead);
+}
+
+/* Decompress up to <nbytes> from <file> into <buf>, return the number of
+   bytes, 0 at the end of the file. */
+static size_t file_decompress(GtFile *file, char *buf, size_t nbytes)
+{
+  size_t length = 0;
+  int rval;
+  if (file->bgzf)
+    return gt_bgzf_reader_xread(file->bgzf, buf, nbytes);
+  if (file->mode == GT_FILE_MODE_ZSTD || file->mode == GT_FILE_MODE_XZ)
+    return gt_codec_file_xread(file->fileptr.codecfile, buf, nbytes);
+  do {
+    if (file->mode == GT_FILE_MODE_GZIP) {
+      rval = gt_xgzread(file->fileptr.gzfile, buf + length,
+                        (unsigned) (nbytes - length));
+    }
+    else {
+      gt_assert(file->mode == GT_FILE_MODE_BZIP2);
+      rval = gt_xbzread(file->fileptr.bzfile, buf + length,
+                        (unsigned) (nbytes - length));
+    }
+    length += rval;
+  } while (rval > 0 && length < nbytes);
+  return length;
+}
+
+/* The filling task decompresses into the free slots in ring order, until it
+   reaches a slot which has not been read yet or the end of the file. The
+   reader is woken up after each slot, so it can go on while the following
+   slots are filled. */
+static void file_read_ahead_fill(void *data)
+{
+  GtFile *file = data;
+  GtFileReadAhead *read_ahead = file->read_ahead;
+  pthread_mutex_lock(&read_ahead->mutex);
+  read_ahead->started = true;
+  for (;;) {
+    GtFileReadAheadSlot *slot = read_ahead->slots + read_ahead->fill;
+    size_t length;
+    if (slot->filled || read_ahead->eof)
+      break;
+    pthread_mutex_unlock(&read_ahead->mutex);
+    length = file_decompress(file, slot->buf, GT_FILE_READ_AHEAD_SLOTSIZE);
+    pthread_mutex_lock(&read_ahead->mutex);
+    if (length > 0) {
+      slot->length = length;
+      slot->filled = true;
+      read_ahead->fill = (read_ahead->fill + 1) % GT_FILE_READ_AHEAD_SLOTS;
+    }
+    else
+      read_ahead->eof = true;
+    pthread_cond_broadcast(&read_ahead->cond);
+  }
+  read_ahead->filling = read_ahead->started = false;
+  pthread_cond_broadcast(&read_ahead->cond);
+  pthread_mutex_unlock(&read_ahead->mutex);
+}
+
+/* Release the slot read so far and make the next one current, waiting for it
+   to be filled if necessary. Returns false at the end of the file. */
+static bool file_read_ahead_next_slot(GtFile *file)
+{
+  GtFileReadAhead *read_ahead = file->read_ahead;
+  GtFileReadAheadSlot *slot;
+  bool submit = false, queued, filled;
+  pthread_mutex_lock(&read_ahead->mutex);
+  if (read_ahead->pos) {
+    read_ahead->slots[read_ahead->current].filled = false;
+    read_ahead->current = (read_ahead->current + 1) % GT_FILE_READ_AHEAD_SLOTS;
+    read_ahead->pos = read_ahead->end = NULL;
+  }
+  if (!read_ahead->filling && !read_ahead->eof)
+    read_ahead->filling = submit = true;
+  slot = read_ahead->slots + read_ahead->current;
+  pthread_mutex_unlock(&read_ahead->mutex);
+  if (submit) {
+    gt_thread_pool_group_submit(read_ahead->group, file_read_ahead_fill,
+                                file);
+  }
+  /* the filling task stops only at the end of the file or in front of a
+     filled slot, and the current slot is the next one to be filled, so
+     wait for this slot only while the task goes on with the next ones */
+  pthread_mutex_lock(&read_ahead->mutex);
+  while (!slot->filled && read_ahead->started)
+    pthread_cond_wait(&read_ahead->cond, &read_ahead->mutex);
+  queued = !slot->filled && read_ahead->filling;
+  pthread_mutex_unlock(&read_ahead->mutex);
+  if (queued) {
+    /* no worker has taken the task yet, so execute it while waiting */
+    gt_thread_pool_group_wait(read_ahead->group);
+  }
+  pthread_mutex_lock(&read_ahead->mutex);
+  filled = slot->filled;
+  pthread_mutex_unlock(&read_ahead->mutex);
+  if (!filled)
+    return false;
+  read_ahead->pos = slot->buf;
+  read_ahead->end = slot->buf + slot->length;
+  return true;
+}
+
+static int file_read_ahead_getc(GtFile *file)
+{
+  GtFileReadAhead *read_ahead = file->read_ahead;
+  if (read_ahead->pos == read_ahead->end && !file_read_ahead_next_slot(file))
+    return EOF;
+  /* as returned by gt_xgzfgetc() and gt_xbzfgetc() */
+  return (char) *read_ahead->pos++;
+}
+
+static size_t file_read_ahead_read(GtFile *file, char *buf, size_t nbytes)
+{
+  GtFileReadAhead *read_ahead = file->read_ahead;
+  size_t length = 0;
+  while (length < nbytes) {
+    size_t available;
+    if (read_ahead->pos == read_ahead->end &&
+        !file_read_ahead_next_slot(file)) {
+      break;
+    }
+    available = (size_t) (read_ahead->end - read_ahead->pos);
+    if (available > nbytes - length)
+      available = nbytes - length;
+    memcpy(buf + length, read_ahead->pos, available);
+    read_ahead->pos += available;
+    length += available;
+  }
+  return length;
+}
+
+#else
+
+static bool file_use_read_ahead(GT_UNUSED GtFileMode file_mode,
+                                GT_UNUSED const char *mode)
+{
+  return false;
+}
+
+static GtFileReadAhead* file_read_ahead_new(void)
+{
+  gt_assert(false);
+  return NULL;
+}
+
+static void file_read_ahead_reset(GT_UNUSED GtFileReadAhead *read_ahead)
+{
+  gt_assert(false);
+}
+
+static void file_read_ahead_delete(GtFileReadAhead *read_ahead)
+{
+  gt_assert(read_ahead == NULL);
+}
+
+static int file_read_ahead_getc(GT_UNUSED GtFile *file)
+{
+  gt_assert(false);
+  return EOF;
+}
+
+static size_t file_read_ahead_read(GT_UNUSED GtFile *file,
+                                   GT_UNUSED char *buf,
+                                   GT_UNUSED size_t nbytes)
+{
+  gt_assert(false);
+  return 0;
+}
+
+#endif
+
 GtFile* gt_file_new(const char *path, const char *mode, GtError *err)
 {
   gt_error_check(err);
@@ -117,6 +382,15 @@ GtFile* gt_file_open(GtFileMode file_mode, const char *path, const char *mode,
         }
         break;
       case GT_FILE_MODE_GZIP:
+        if (file_use_read_ahead(file_mode, mode) &&
+            gt_bgzf_reader_is_bgzf(path)) {
+          file->bgzf = gt_bgzf_reader_new(path, err);
+          if (!file->bgzf) {
+            gt_file_delete_without_handle(file);
+            return NULL;
+          }
+          break;
+        }
         file->fileptr.gzfile = gt_fa_gzopen(path, mode, err);
         if (!file->fileptr.gzfile) {
           gt_file_delete_without_handle(file);
@@ -132,8 +406,19 @@ GtFile* gt_file_open(GtFileMode file_mode, const char *path, const char *mode,
         file->orig_path = gt_cstr_dup(path);
         file->orig_mode = gt_cstr_dup(path);
         break;
+      case GT_FILE_MODE_ZSTD:
+      case GT_FILE_MODE_XZ:
+        file->fileptr.codecfile = gt_codec_file_new(file_mode, path, mode,
+                                                    err);
+        if (!file->fileptr.codecfile) {
+          gt_file_delete_without_handle(file);
+          return NULL;
+        }
+        break;
       default: gt_assert(0);
     }
+    if (file_use_read_ahead(file_mode, mode))
+      file->read_ahead = file_read_ahead_new();
   }
   else {
     gt_assert(file_mode == GT_FILE_MODE_UNCOMPRESSED);
@@ -157,15 +442,26 @@ GtFile* gt_file_xopen_file_mode(GtFileMode file_mode, const char *path,
         file->fileptr.file = gt_fa_xfopen(path, mode);
         break;
       case GT_FILE_MODE_GZIP:
-        file->fileptr.gzfile = gt_fa_xgzopen(path, mode);
+        if (file_use_read_ahead(file_mode, mode) &&
+            gt_bgzf_reader_is_bgzf(path)) {
+          file->bgzf = gt_bgzf_reader_xnew(path);
+        }
+        else
+          file->fileptr.gzfile = gt_fa_xgzopen(path, mode);
         break;
       case GT_FILE_MODE_BZIP2:
         file->fileptr.bzfile = gt_fa_xbzopen(path, mode);
         file->orig_path = gt_cstr_dup(path);
         file->orig_mode = gt_cstr_dup(path);
         break;
+      case GT_FILE_MODE_ZSTD:
+      case GT_FILE_MODE_XZ:
+        file->fileptr.codecfile = gt_codec_file_xnew(file_mode, path, mode);
+        break;
       default: gt_assert(0);
     }
+    if (file_use_read_ahead(file_mode, mode))
+      file->read_ahead = file_read_ahead_new();
   }
   else {
     gt_assert(file_mode == GT_FILE_MODE_UNCOMPRESSED);
@@ -198,6 +494,25 @@ GtFileMode gt_file_mode(const GtFile *file)
   return file->mode;
 }
 
+/* A <GtFile> must not be used by several threads at once anyway (see the
+   unget buffer), so the locking of each character read by stdio, which costs
+   a lot as soon as a process has started threads, can be omitted. */
+static int file_xfgetc_unlocked(FILE *stream)
+{
+#ifndef _WIN32
+  int cc;
+  if ((cc = getc_unlocked(stream)) == EOF) {
+    if (ferror(stream)) {
+      perror("cannot read char");
+      exit(EXIT_FAILURE);
+    }
+  }
+  return cc;
+#else
+  return gt_xfgetc(stream);
+#endif
+}
+
 int gt_file_xfgetc(GtFile *file)
 {
   int c = -1;
@@ -206,10 +521,12 @@ int gt_file_xfgetc(GtFile *file)
       c = file->unget_char;
       file->unget_used = false;
     }
+    else if (file->read_ahead)
+      c = file_read_ahead_getc(file);
     else {
       switch (file->mode) {
         case GT_FILE_MODE_UNCOMPRESSED:
-          c = gt_xfgetc(file->fileptr.file);
+          c = file_xfgetc_unlocked(file->fileptr.file);
           break;
         case GT_FILE_MODE_GZIP:
           c = gt_xgzfgetc(file->fileptr.gzfile);
@@ -217,12 +534,16 @@ int gt_file_xfgetc(GtFile *file)
         case GT_FILE_MODE_BZIP2:
           c = gt_xbzfgetc(file->fileptr.bzfile);
           break;
+        case GT_FILE_MODE_ZSTD:
+        case GT_FILE_MODE_XZ:
+          c = gt_codec_file_xfgetc(file->fileptr.codecfile);
+          break;
         default: gt_assert(0);
       }
     }
   }
   else
-    c = gt_xfgetc(stdin);
+    c = file_xfgetc_unlocked(stdin);
   return c;
 }
 
@@ -284,6 +605,30 @@ static int vbzprintf(BZFILE *file, const char *format, va_list va, int buflen)
   return 0; /* success */
 }
 
+static int vcodecprintf(GtCodecFile *file, const char *format, va_list va,
+                        int buflen)
+{
+  int len;
+  if (!buflen) {
+    char buf[BUFSIZ];
+    /* no buffer length given -> try static buffer */
+    len = gt_xvsnprintf(buf, sizeof (buf), format, va);
+    if (len >= BUFSIZ)
+      return len; /* unsuccessful trial -> return buffer length for next call */
+    gt_codec_file_xwrite(file, buf, len);
+  }
+  else {
+    char *dynbuf;
+    /* buffer length given -> use dynamic buffer */
+    dynbuf = gt_malloc((buflen + 1) * sizeof (char));
+    len = gt_xvsnprintf(dynbuf, (buflen + 1) * sizeof (char), format, va);
+    gt_assert(len == buflen);
+    gt_codec_file_xwrite(file, dynbuf, buflen);
+    gt_free(dynbuf);
+  }
+  return 0; /* success */
+}
+
 static int xvprintf(GtFile *file, const char *format, va_list va, int buflen)
 {
   int rval = 0;
@@ -301,6 +646,10 @@ static int xvprintf(GtFile *file, const char *format, va_list va, int buflen)
       case GT_FILE_MODE_BZIP2:
         rval = vbzprintf(file->fileptr.bzfile, format, va, buflen);
         break;
+      case GT_FILE_MODE_ZSTD:
+      case GT_FILE_MODE_XZ:
+        rval = vcodecprintf(file->fileptr.codecfile, format, va, buflen);
+        break;
       default: gt_assert(0);
     }
   }
@@ -339,6 +688,13 @@ void gt_file_xfputc(int c, GtFile *file)
     case GT_FILE_MODE_BZIP2:
       gt_xbzfputc(c, file->fileptr.bzfile);
       break;
+    case GT_FILE_MODE_ZSTD:
+    case GT_FILE_MODE_XZ:
+      {
+        char cc = (char) c;
+        gt_codec_file_xwrite(file->fileptr.codecfile, &cc, 1);
+      }
+      break;
     default: gt_assert(0);
   }
 }
@@ -357,6 +713,10 @@ void gt_file_xfputs(const char *cstr, GtFile *file)
     case GT_FILE_MODE_BZIP2:
       gt_xbzfputs(cstr, file->fileptr.bzfile);
       break;
+    case GT_FILE_MODE_ZSTD:
+    case GT_FILE_MODE_XZ:
+      gt_codec_file_xwrite(file->fileptr.codecfile, cstr, strlen(cstr));
+      break;
     default: gt_assert(0);
   }
 }
@@ -364,7 +724,9 @@ void gt_file_xfputs(const char *cstr, GtFile *file)
 int gt_file_xread(GtFile *file, void *buf, size_t nbytes)
 {
   int rval = -1;
-  if (file) {
+  if (file && file->read_ahead)
+    rval = (int) file_read_ahead_read(file, buf, nbytes);
+  else if (file) {
     switch (file->mode) {
       case GT_FILE_MODE_UNCOMPRESSED:
         rval = gt_xfread(buf, 1, nbytes, file->fileptr.file);
@@ -375,6 +737,10 @@ int gt_file_xread(GtFile *file, void *buf, size_t nbytes)
       case GT_FILE_MODE_BZIP2:
         rval = gt_xbzread(file->fileptr.bzfile, buf, nbytes);
         break;
+      case GT_FILE_MODE_ZSTD:
+      case GT_FILE_MODE_XZ:
+        rval = (int) gt_codec_file_xread(file->fileptr.codecfile, buf, nbytes);
+        break;
       default: gt_assert(0);
     }
   }
@@ -399,6 +765,10 @@ void gt_file_xwrite(GtFile *file, void *buf, size_t nbytes)
     case GT_FILE_MODE_BZIP2:
       gt_xbzwrite(file->fileptr.bzfile, buf, nbytes);
       break;
+    case GT_FILE_MODE_ZSTD:
+    case GT_FILE_MODE_XZ:
+      gt_codec_file_xwrite(file->fileptr.codecfile, buf, nbytes);
+      break;
     default: gt_assert(0);
   }
 }
@@ -406,16 +776,25 @@ void gt_file_xwrite(GtFile *file, void *buf, size_t nbytes)
 void gt_file_xrewind(GtFile *file)
 {
   gt_assert(file);
+  if (file->read_ahead)
+    file_read_ahead_reset(file->read_ahead);
   switch (file->mode) {
     case GT_FILE_MODE_UNCOMPRESSED:
       rewind(file->fileptr.file);
       break;
     case GT_FILE_MODE_GZIP:
-      gt_xgzrewind(file->fileptr.gzfile);
+      if (file->bgzf)
+        gt_bgzf_reader_rewind(file->bgzf);
+      else
+        gt_xgzrewind(file->fileptr.gzfile);
       break;
     case GT_FILE_MODE_BZIP2:
       gt_xbzrewind(&file->fileptr.bzfile, file->orig_path, file->orig_mode);
       break;
+    case GT_FILE_MODE_ZSTD:
+    case GT_FILE_MODE_XZ:
+      gt_codec_file_xrewind(file->fileptr.codecfile);
+      break;
     default: gt_assert(0);
   }
 }
@@ -423,6 +802,7 @@ void gt_file_xrewind(GtFile *file)
 void gt_file_delete_without_handle(GtFile *file)
 {
   if (!file) return;
+  file_read_ahead_delete(file->read_ahead);
   gt_free(file->orig_path);
   gt_free(file->orig_mode);
   gt_free(file);
@@ -435,17 +815,25 @@ void gt_file_delete(GtFile *file)
     file->reference_count--;
     return;
   }
+  /* the filling task must not read from a closed file */
+  file_read_ahead_delete(file->read_ahead);
+  file->read_ahead = NULL;
   switch (file->mode) {
     case GT_FILE_MODE_UNCOMPRESSED:
         if (!file->is_stdin)
           gt_fa_fclose(file->fileptr.file);
       break;
     case GT_FILE_MODE_GZIP:
+        gt_bgzf_reader_delete(file->bgzf);
         gt_fa_gzclose(file->fileptr.gzfile);
       break;
     case GT_FILE_MODE_BZIP2:
         gt_fa_bzclose(file->fileptr.bzfile);
       break;
+    case GT_FILE_MODE_ZSTD:
+    case GT_FILE_MODE_XZ:
+        gt_codec_file_delete(file->fileptr.codecfile);
+      break;
     default: gt_assert(0);
   }
   gt_file_delete_without_handle(file);
@@ -24,11 +24,15 @@
 typedef enum {
   GT_FILE_MODE_UNCOMPRESSED,
   GT_FILE_MODE_GZIP,
-  GT_FILE_MODE_BZIP2
+  GT_FILE_MODE_BZIP2,
+  GT_FILE_MODE_ZSTD,
+  GT_FILE_MODE_XZ
 } GtFileMode;
 
 /* This class defines (generic) files in __GenomeTools__. A generic file is is a
-   file which either uncompressed or compressed (with gzip or bzip2).
+   file which either uncompressed or compressed (with gzip, bzip2, Zstandard,
+   or xz). Zstandard and xz compression are only available if __GenomeTools__
+   has been compiled with the respective library.
    A <NULL>-pointer as generic file implies <stdout>. */
 typedef struct GtFile GtFile;
 
@@ -36,7 +40,9 @@ typedef struct GtFile GtFile;
    file handle with given <mode>. Returns <NULL> and sets <err> accordingly, if
    the file <path> could not be opened. The compression mode is determined by
    the ending of <path> (gzip compression if it ends with '.gz', bzip2
-   compression if it ends with '.bz2', and uncompressed otherwise). */
+   compression if it ends with '.bz2', Zstandard compression if it ends with
+   '.zst', xz compression if it ends with '.xz', and uncompressed otherwise).
+   */
 GtFile*     gt_file_new(const char *path, const char *mode, GtError *err);
 
 /* Increments the reference count of <file>. */
@@ -71,16 +77,17 @@ void        gt_file_xwrite(GtFile *file, void *buf, size_t nbytes);
 void        gt_file_xrewind(GtFile *file);
 
 /* Returns <GT_FILE_MODE_GZIP> if file with <path> ends with '.gz',
-   <GT_FILE_MODE_BZIP2> if it ends with '.bz2', and <GT_FILE_MODE_UNCOMPRESSED>
-   otherwise. */
+   <GT_FILE_MODE_BZIP2> if it ends with '.bz2', <GT_FILE_MODE_ZSTD> if it ends
+   with '.zst', <GT_FILE_MODE_XZ> if it ends with '.xz', and
+   <GT_FILE_MODE_UNCOMPRESSED> otherwise. */
 GtFileMode  gt_file_mode_determine(const char *path);
 
-/* Returns ".gz" if <mode> is GFM_GZIP, ".bz2" if <mode> is GFM_BZIP2, and ""
-   otherwise. */
+/* Returns ".gz" if <mode> is GFM_GZIP, ".bz2" if <mode> is GFM_BZIP2, ".zst"
+   if <mode> is GFM_ZSTD, ".xz" if <mode> is GFM_XZ, and "" otherwise. */
 const char* gt_file_mode_suffix(GtFileMode mode);
 
 /* Returns the length of the ``basename'' of <path>. That is, the length of path
-   without '.gz' or '.bz2' suffixes. */
+   without '.gz', '.bz2', '.zst', or '.xz' suffixes. */
 size_t      gt_file_basename_length(const char *path);
 
 /* Create a new GtFile object and open the underlying file handle, returns
@@ -0,0 +1,695 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <stdlib.h>
+#include "core/ensure_api.h"
+#include "core/interval_index.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/minmax_api.h"
+#include "core/qsort_r_api.h"
+#include "core/thread_pool.h"
+#include "core/undef_api.h"
+#include "core/unused_api.h"
+
+/* The entries are kept in an array sorted by start position. The entry at
+   position i is a node of level k of the implicit tree, if the k lowest bits
+   of i are set and bit k is not. Hence the leaves are at the even positions,
+   and the root is at position 2^r-1 for the largest r with 2^r <= n. Nodes
+   beyond the end of the array inherit the <maxend> value of the last entry's
+   ancestors, as in the cgranges library by H. Li.
+   Intervals added after the last build are appended unsorted behind the
+   sorted part and merged into it by <gt_interval_index_build()>. A removed
+   interval keeps its place until the next merge, its value is set to
+   GT_UNDEF_UWORD. After a build the value of an entry is its position. */
+
+struct GtIntervalIndex {
+  GtArray *entries,
+          *values;
+  GtUword nof_sorted,
+          nof_removed,
+          root_level;
+  GtFree free_func;
+};
+
+int gt_interval_index_entry_compare(const void *v1, const void *v2)
+{
+  const GtIntervalIndexEntry *e1 = v1, *e2 = v2;
+  if (e1->start != e2->start)
+    return e1->start < e2->start ? -1 : 1;
+  if (e1->end != e2->end)
+    return e1->end < e2->end ? -1 : 1;
+  if (e1->value != e2->value)
+    return e1->value < e2->value ? -1 : 1;
+  return 0;
+}
+
+GtUword gt_interval_index_entries_build(GtIntervalIndexEntry *a, GtUword n)
+{
+  GtUword i, last_i = 0, last = 0, k;
+  if (n == 0)
+    return 0;
+  for (i = 0; i < n; i += 2) {
+    last_i = i;
+    last = a[i].maxend = a[i].end;
+  }
+  for (k = 1; (1UL << k) <= n; k++) {
+    GtUword x = 1UL << (k - 1), i0 = (x << 1) - 1, step = x << 2;
+    for (i = i0; i < n; i += step) {
+      GtUword el = a[i - x].maxend,
+              er = i + x < n ? a[i + x].maxend : last,
+              e = a[i].end;
+      e = GT_MAX(e, el);
+      a[i].maxend = GT_MAX(e, er);
+    }
+    last_i = ((last_i >> k) & 1) ? last_i - x : last_i + x;
+    if (last_i < n && a[last_i].maxend > last)
+      last = a[last_i].maxend;
+  }
+  return k - 1;
+}
+
+typedef struct {
+  GtUword level,
+          idx;
+  bool left_done;
+} GtIntervalIndexStackElem;
+
+int gt_interval_index_entries_overlap(const GtIntervalIndexEntry *a,
+                                      GtUword n,
+                                      GtUword root_level,
+                                      GtUword start,
+                                      GtUword end,
+                                      GtIntervalIndexEntryFunc func,
+                                      void *data)
+{
+  GtIntervalIndexStackElem stack[64];
+  int top = 0, rval = 0;
+  gt_assert(func && start <= end);
+  if (n == 0)
+    return 0;
+  stack[top].level = root_level;
+  stack[top].idx = (1UL << root_level) - 1;
+  stack[top++].left_done = false;
+  while (!rval && top > 0) {
+    GtIntervalIndexStackElem z = stack[--top];
+    if (z.level <= 3UL) {
+      /* small subtree, scan all of its intervals */
+      GtUword i, i0 = z.idx >> z.level << z.level,
+              i1 = GT_MIN(i0 + (1UL << (z.level + 1)) - 1, n);
+      for (i = i0; !rval && i < i1 && a[i].start <= end; i++) {
+        if (start <= a[i].end)
+          rval = func(i, data);
+      }
+    } else if (!z.left_done) {
+      /* the left child may lie beyond the last interval */
+      GtUword y = z.idx - (1UL << (z.level - 1));
+      stack[top].level = z.level;
+      stack[top].idx = z.idx;
+      stack[top++].left_done = true;
+      if (y >= n || a[y].maxend >= start) {
+        stack[top].level = z.level - 1;
+        stack[top].idx = y;
+        stack[top++].left_done = false;
+      }
+    } else if (z.idx < n && a[z.idx].start <= end) {
+      if (start <= a[z.idx].end)
+        rval = func(z.idx, data);
+      stack[top].level = z.level - 1;
+      stack[top].idx = z.idx + (1UL << (z.level - 1));
+      stack[top++].left_done = false;
+    }
+  }
+  return rval;
+}
+
+GtIntervalIndex* gt_interval_index_new(GtFree free_func)
+{
+  GtIntervalIndex *ii = gt_calloc(1, sizeof *ii);
+  ii->entries = gt_array_new(sizeof (GtIntervalIndexEntry));
+  ii->values = gt_array_new(sizeof (void*));
+  ii->free_func = free_func;
+  return ii;
+}
+
+void gt_interval_index_add(GtIntervalIndex *ii, void *value, GtUword start,
+                           GtUword end)
+{
+  GtIntervalIndexEntry entry;
+  gt_assert(ii && start <= end);
+  entry.start = start;
+  entry.end = entry.maxend = end;
+  entry.value = gt_array_size(ii->values);
+  gt_array_add(ii->entries, entry);
+  gt_array_add(ii->values, value);
+}
+
+typedef struct {
+  const GtIntervalIndex *ii;
+  const void *value;
+  GtUword start,
+          end,
+          idx;
+} GtIntervalIndexFindInfo;
+
+static int gt_interval_index_find_entry(GtUword idx, void *data)
+{
+  GtIntervalIndexFindInfo *info = data;
+  const GtIntervalIndexEntry *entry = gt_array_get(info->ii->entries, idx);
+  if (entry->value != GT_UNDEF_UWORD && entry->start == info->start
+        && entry->end == info->end
+        && *(void**) gt_array_get(info->ii->values, entry->value)
+             == info->value) {
+    info->idx = idx;
+    return 1;
+  }
+  return 0;
+}
+
+bool gt_interval_index_remove(GtIntervalIndex *ii, const void *value,
+                              GtUword start, GtUword end)
+{
+  GtIntervalIndexFindInfo info;
+  GtIntervalIndexEntry *entry;
+  void **v;
+  GtUword i;
+  gt_assert(ii && start <= end);
+  info.ii = ii;
+  info.value = value;
+  info.start = start;
+  info.end = end;
+  info.idx = GT_UNDEF_UWORD;
+  if (ii->nof_sorted > 0) {
+    (void) gt_interval_index_entries_overlap(gt_array_get_space(ii->entries),
+                                             ii->nof_sorted, ii->root_level,
+                                             start, end,
+                                             gt_interval_index_find_entry,
+                                             &info);
+  }
+  for (i = ii->nof_sorted;
+       info.idx == GT_UNDEF_UWORD && i < gt_array_size(ii->entries); i++) {
+    (void) gt_interval_index_find_entry(i, &info);
+  }
+  if (info.idx == GT_UNDEF_UWORD)
+    return false;
+  entry = gt_array_get(ii->entries, info.idx);
+  v = gt_array_get(ii->values, entry->value);
+  if (ii->free_func && *v)
+    ii->free_func(*v);
+  *v = NULL;
+  entry->value = GT_UNDEF_UWORD;
+  ii->nof_removed++;
+  return true;
+}
+
+static int gt_interval_index_cmp_range(const GtIntervalIndexEntry *e1,
+                                       const GtIntervalIndexEntry *e2)
+{
+  if (e1->start != e2->start)
+    return e1->start < e2->start ? -1 : 1;
+  if (e1->end != e2->end)
+    return e1->end < e2->end ? -1 : 1;
+  return 0;
+}
+
+void gt_interval_index_build(GtIntervalIndex *ii)
+{
+  GtIntervalIndexEntry *e;
+  GtArray *entries, *values;
+  GtUword i, j, n;
+  gt_assert(ii);
+  n = gt_array_size(ii->entries);
+  if (ii->nof_sorted == n)
+    return;
+  e = gt_array_get_space(ii->entries);
+  /* the values of the new entries are increasing, equal intervals keep the
+     order of insertion */
+  qsort(e + ii->nof_sorted, n - ii->nof_sorted, sizeof *e,
+        gt_interval_index_entry_compare);
+  entries = gt_array_new(sizeof (GtIntervalIndexEntry));
+  values = gt_array_new(sizeof (void*));
+  i = 0;
+  j = ii->nof_sorted;
+  while (i < ii->nof_sorted || j < n) {
+    GtIntervalIndexEntry entry;
+    if (i < ii->nof_sorted && e[i].value == GT_UNDEF_UWORD) {
+      i++;
+      continue;
+    }
+    if (j < n && e[j].value == GT_UNDEF_UWORD) {
+      j++;
+      continue;
+    }
+    if (j == n
+          || (i < ii->nof_sorted && gt_interval_index_cmp_range(e + i,
+                                                                e + j) <= 0))
+      entry = e[i++];
+    else
+      entry = e[j++];
+    gt_array_add(values, *(void**) gt_array_get(ii->values, entry.value));
+    entry.value = gt_array_size(entries);
+    gt_array_add(entries, entry);
+  }
+  gt_array_delete(ii->entries);
+  gt_array_delete(ii->values);
+  ii->entries = entries;
+  ii->values = values;
+  ii->nof_sorted = gt_array_size(entries);
+  ii->nof_removed = 0;
+  ii->root_level = gt_interval_index_entries_build(gt_array_get_space(entries),
+                                                   ii->nof_sorted);
+}
+
+bool gt_interval_index_is_built(const GtIntervalIndex *ii)
+{
+  gt_assert(ii);
+  return ii->nof_sorted == gt_array_size(ii->entries);
+}
+
+GtUword gt_interval_index_size(const GtIntervalIndex *ii)
+{
+  gt_assert(ii);
+  return gt_array_size(ii->entries) - ii->nof_removed;
+}
+
+typedef struct {
+  const GtIntervalIndex *ii;
+  GtIntervalIndexIteratorFunc func;
+  void *data;
+} GtIntervalIndexIterateInfo;
+
+static int gt_interval_index_iterate_entry(GtUword idx, void *data)
+{
+  GtIntervalIndexIterateInfo *info = data;
+  const GtIntervalIndexEntry *entry = gt_array_get(info->ii->entries, idx);
+  if (entry->value == GT_UNDEF_UWORD)
+    return 0;
+  return info->func(*(void**) gt_array_get(info->ii->values, idx),
+                    entry->start, entry->end, info->data);
+}
+
+int gt_interval_index_iterate_overlapping(const GtIntervalIndex *ii,
+                                          GtIntervalIndexIteratorFunc func,
+                                          GtUword start,
+                                          GtUword end,
+                                          void *data)
+{
+  GtIntervalIndexIterateInfo info;
+  gt_assert(ii && func && start <= end);
+  gt_assert(gt_interval_index_is_built(ii));
+  info.ii = ii;
+  info.func = func;
+  info.data = data;
+  return gt_interval_index_entries_overlap(gt_array_get_space(ii->entries),
+                                           ii->nof_sorted, ii->root_level,
+                                           start, end,
+                                           gt_interval_index_iterate_entry,
+                                           &info);
+}
+
+static int gt_interval_index_collect(void *value, GT_UNUSED GtUword start,
+                                     GT_UNUSED GtUword end, void *data)
+{
+  gt_array_add((GtArray*) data, value);
+  return 0;
+}
+
+void gt_interval_index_find_all_overlapping(const GtIntervalIndex *ii,
+                                            GtUword start,
+                                            GtUword end,
+                                            GtArray *results)
+{
+  GT_UNUSED int rval;
+  gt_assert(results);
+  rval = gt_interval_index_iterate_overlapping(ii, gt_interval_index_collect,
+                                               start, end, results);
+  gt_assert(!rval); /* gt_interval_index_collect() is sane */
+}
+
+/* batch queries */
+
+typedef struct {
+  const GtIntervalIndex *ii;
+  const GtRange *queries;
+  const GtUword *order;
+  GtUword *offsets;
+  void **out;
+} GtIntervalIndexBatchInfo;
+
+typedef struct {
+  const GtIntervalIndex *ii;
+  GtUword count;
+  void **out;
+} GtIntervalIndexBatchQuery;
+
+static int gt_interval_index_batch_count(GtUword idx, void *data)
+{
+  GtIntervalIndexBatchQuery *q = data;
+  if (((GtIntervalIndexEntry*) gt_array_get(q->ii->entries, idx))->value
+        != GT_UNDEF_UWORD)
+    q->count++;
+  return 0;
+}
+
+static int gt_interval_index_batch_store(GtUword idx, void *data)
+{
+  GtIntervalIndexBatchQuery *q = data;
+  if (((GtIntervalIndexEntry*) gt_array_get(q->ii->entries, idx))->value
+        != GT_UNDEF_UWORD)
+    q->out[q->count++] = *(void**) gt_array_get(q->ii->values, idx);
+  return 0;
+}
+
+/* The first pass stores the number of results of query q in offsets[q+1],
+   the second pass writes them to their final place. */
+static void gt_interval_index_batch_range(GtUword from, GtUword to, void *data,
+                                          bool store)
+{
+  GtIntervalIndexBatchInfo *info = data;
+  GtIntervalIndexBatchQuery q;
+  GtUword p;
+  q.ii = info->ii;
+  for (p = from; p < to; p++) {
+    GtUword qnum = info->order[p];
+    q.count = 0;
+    q.out = store ? info->out + info->offsets[qnum] : NULL;
+    (void) gt_interval_index_entries_overlap(
+                                       gt_array_get_space(info->ii->entries),
+                                       info->ii->nof_sorted,
+                                       info->ii->root_level,
+                                       info->queries[qnum].start,
+                                       info->queries[qnum].end,
+                                       store ? gt_interval_index_batch_store
+                                             : gt_interval_index_batch_count,
+                                       &q);
+    if (!store)
+      info->offsets[qnum + 1] = q.count;
+  }
+}
+
+static void gt_interval_index_batch_count_range(GtUword from, GtUword to,
+                                                void *data)
+{
+  gt_interval_index_batch_range(from, to, data, false);
+}
+
+static void gt_interval_index_batch_store_range(GtUword from, GtUword to,
+                                                void *data)
+{
+  gt_interval_index_batch_range(from, to, data, true);
+}
+
+static int gt_interval_index_cmp_query(const void *v1, const void *v2,
+                                       void *data)
+{
+  const GtRange *queries = data;
+  GtUword q1 = *(const GtUword*) v1, q2 = *(const GtUword*) v2;
+  if (queries[q1].start != queries[q2].start)
+    return queries[q1].start < queries[q2].start ? -1 : 1;
+  if (q1 != q2)
+    return q1 < q2 ? -1 : 1;
+  return 0;
+}
+
+void gt_interval_index_find_all_overlapping_batch(const GtIntervalIndex *ii,
+                                                  const GtRange *queries,
+                                                  GtUword nof_queries,
+                                                  GtArray *results,
+                                                  GtUword *offsets)
+{
+  GtIntervalIndexBatchInfo info;
+  GtUword *order, q;
+  gt_assert(ii && (queries || nof_queries == 0) && results && offsets);
+  gt_assert(gt_interval_index_is_built(ii));
+  gt_assert(gt_array_elem_size(results) == sizeof (void*));
+  offsets[0] = gt_array_size(results);
+  if (nof_queries == 0)
+    return;
+  /* neighbouring queries visit neighbouring parts of the array */
+  order = gt_malloc(nof_queries * sizeof *order);
+  for (q = 0; q < nof_queries; q++) {
+    gt_assert(queries[q].start <= queries[q].end);
+    order[q] = q;
+  }
+  gt_qsort_r(order, nof_queries, sizeof *order, (void*) queries,
+             gt_interval_index_cmp_query);
+  info.ii = ii;
+  info.queries = queries;
+  info.order = order;
+  info.offsets = offsets;
+  gt_thread_pool_parallel_for(0, nof_queries, 0,
+                              gt_interval_index_batch_count_range, &info);
+  for (q = 0; q < nof_queries; q++)
+    offsets[q + 1] += offsets[q];
+  while (gt_array_size(results) < offsets[nof_queries]) {
+    void *null = NULL;
+    gt_array_add(results, null);
+  }
+  info.out = gt_array_get_space(results);
+  gt_thread_pool_parallel_for(0, nof_queries, 0,
+                              gt_interval_index_batch_store_range, &info);
+  gt_free(order);
+}
+
+int gt_interval_index_traverse(const GtIntervalIndex *ii,
+                               GtIntervalIndexIteratorFunc func, void *data)
+{
+  GtIntervalIndexIterateInfo info;
+  GtUword i;
+  int rval = 0;
+  gt_assert(ii && func);
+  gt_assert(gt_interval_index_is_built(ii));
+  info.ii = ii;
+  info.func = func;
+  info.data = data;
+  for (i = 0; !rval && i < ii->nof_sorted; i++)
+    rval = gt_interval_index_iterate_entry(i, &info);
+  return rval;
+}
+
+void gt_interval_index_delete(GtIntervalIndex *ii)
+{
+  if (!ii) return;
+  if (ii->free_func) {
+    GtUword i;
+    for (i = 0; i < gt_array_size(ii->values); i++) {
+      void *value = *(void**) gt_array_get(ii->values, i);
+      if (value)
+        ii->free_func(value);
+    }
+  }
+  gt_array_delete(ii->entries);
+  gt_array_delete(ii->values);
+  gt_free(ii);
+}
+
+#define GT_INTERVAL_INDEX_TEST_NOF_ENTRIES    300
+#define GT_INTERVAL_INDEX_TEST_NOF_INTERVALS  3000
+#define GT_INTERVAL_INDEX_TEST_NOF_QUERIES    500
+#define GT_INTERVAL_INDEX_TEST_END            90000
+#define GT_INTERVAL_INDEX_TEST_WIDTH          700
+#define GT_INTERVAL_INDEX_TEST_QUERY_WIDTH    5000
+
+static int gt_interval_index_test_collect_idx(GtUword idx, void *data)
+{
+  gt_array_add((GtArray*) data, idx);
+  return 0;
+}
+
+static int gt_interval_index_entries_unit_test(GtError *err)
+{
+  GtIntervalIndexEntry entries[GT_INTERVAL_INDEX_TEST_NOF_ENTRIES];
+  GtArray *found;
+  GtUword n, i, q, root_level;
+  int had_err = 0;
+  gt_error_check(err);
+
+  found = gt_array_new(sizeof (GtUword));
+  for (n = 0; !had_err && n <= GT_INTERVAL_INDEX_TEST_NOF_ENTRIES; n += 37) {
+    for (i = 0; i < n; i++) {
+      entries[i].start = gt_rand_max(GT_INTERVAL_INDEX_TEST_END);
+      entries[i].end = entries[i].start
+                         + gt_rand_max(GT_INTERVAL_INDEX_TEST_WIDTH);
+      entries[i].value = i;
+    }
+    qsort(entries, n, sizeof *entries, gt_interval_index_entry_compare);
+    root_level = gt_interval_index_entries_build(entries, n);
+    for (q = 0; !had_err && q < 100UL; q++) {
+      GtUword start = gt_rand_max(GT_INTERVAL_INDEX_TEST_END),
+              end = start + gt_rand_max(GT_INTERVAL_INDEX_TEST_QUERY_WIDTH),
+              j = 0;
+      gt_array_reset(found);
+      (void) gt_interval_index_entries_overlap(entries, n, root_level, start,
+                                             end,
+                                             gt_interval_index_test_collect_idx,
+                                             found);
+      /* compare with a linear scan, the results are in ascending order */
+      for (i = 0; !had_err && i < n; i++) {
+        if (entries[i].start <= end && start <= entries[i].end) {
+          gt_ensure(j < gt_array_size(found));
+          if (!had_err)
+            gt_ensure(*(GtUword*) gt_array_get(found, j) == i);
+          j++;
+        }
+      }
+      gt_ensure(j == gt_array_size(found));
+    }
+  }
+  gt_array_delete(found);
+  return had_err;
+}
+
+/* Collect the ids of the intervals in <ranges> which are not removed and
+   overlap <query>, in the order of an interval index. */
+static void gt_interval_index_test_scan(const GtRange *ranges,
+                                        const bool *removed, GtUword n,
+                                        const GtRange *query, GtArray *ref)
+{
+  GtUword i, j;
+  gt_array_reset(ref);
+  for (i = 0; i < n; i++) {
+    if (!removed[i] && gt_range_overlap(ranges + i, query))
+      gt_array_add(ref, i);
+  }
+  /* insertion sort by range, equal ranges keep their order */
+  for (i = 1; i < gt_array_size(ref); i++) {
+    GtUword *a = gt_array_get_space(ref), x = a[i];
+    for (j = i; j > 0 && gt_range_compare(ranges + a[j-1], ranges + x) > 0;
+         j--) {
+      a[j] = a[j-1];
+    }
+    a[j] = x;
+  }
+}
+
+static int gt_interval_index_test_compare(const GtArray *res,
+                                          GtUword from, GtUword to,
+                                          const GtArray *ref, GtError *err)
+{
+  GtUword i;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_ensure(to - from == gt_array_size(ref));
+  for (i = 0; !had_err && i < gt_array_size(ref); i++) {
+    gt_ensure((GtUword) *(void**) gt_array_get(res, from + i) - 1
+                == *(GtUword*) gt_array_get(ref, i));
+  }
+  return had_err;
+}
+
+int gt_interval_index_unit_test(GtError *err)
+{
+  GtIntervalIndex *ii;
+  GtRange *ranges, queries[GT_INTERVAL_INDEX_TEST_NOF_QUERIES];
+  GtUword i, q, nof_added = 0, *offsets;
+  GtArray *res, *ref;
+  bool *removed;
+  int had_err = 0;
+  gt_error_check(err);
+
+  had_err = gt_interval_index_entries_unit_test(err);
+
+  /* values are ids + 1, equal ranges are frequent */
+  ranges = gt_malloc(GT_INTERVAL_INDEX_TEST_NOF_INTERVALS * sizeof *ranges);
+  removed = gt_calloc(GT_INTERVAL_INDEX_TEST_NOF_INTERVALS, sizeof *removed);
+  offsets = gt_malloc((GT_INTERVAL_INDEX_TEST_NOF_QUERIES + 1)
+                      * sizeof *offsets);
+  res = gt_array_new(sizeof (void*));
+  ref = gt_array_new(sizeof (GtUword));
+  for (i = 0; i < GT_INTERVAL_INDEX_TEST_NOF_INTERVALS; i++) {
+    ranges[i].start = gt_rand_max(GT_INTERVAL_INDEX_TEST_END / 10) * 10;
+    ranges[i].end = ranges[i].start
+                      + gt_rand_max(GT_INTERVAL_INDEX_TEST_WIDTH / 100) * 100;
+  }
+  ii = gt_interval_index_new(NULL);
+  gt_ensure(gt_interval_index_is_built(ii));
+  gt_ensure(gt_interval_index_size(ii) == 0);
+
+  /* add the intervals in four rounds, removing some before each build */
+  while (!had_err && nof_added < GT_INTERVAL_INDEX_TEST_NOF_INTERVALS) {
+    GtUword next = nof_added + GT_INTERVAL_INDEX_TEST_NOF_INTERVALS / 4;
+    for (i = nof_added; i < next; i++) {
+      gt_interval_index_add(ii, (void*) (i + 1), ranges[i].start,
+                            ranges[i].end);
+    }
+    gt_ensure(!gt_interval_index_is_built(ii));
+    nof_added = next;
+    for (q = 0; !had_err && q < 50UL; q++) {
+      i = gt_rand_max(nof_added - 1);
+      gt_ensure(gt_interval_index_remove(ii, (void*) (i + 1), ranges[i].start,
+                                         ranges[i].end) == !removed[i]);
+      removed[i] = true;
+    }
+    gt_interval_index_build(ii);
+    gt_ensure(gt_interval_index_is_built(ii));
+
+    for (q = 0; q < GT_INTERVAL_INDEX_TEST_NOF_QUERIES; q++) {
+      queries[q].start = gt_rand_max(GT_INTERVAL_INDEX_TEST_END);
+      queries[q].end = queries[q].start
+                         + gt_rand_max(GT_INTERVAL_INDEX_TEST_QUERY_WIDTH);
+    }
+    /* the batch appends to the results */
+    gt_array_reset(res);
+    gt_array_add(res, ranges);
+    gt_interval_index_find_all_overlapping_batch(ii, queries,
+                                           GT_INTERVAL_INDEX_TEST_NOF_QUERIES,
+                                           res, offsets);
+    gt_ensure(offsets[0] == 1UL);
+    gt_ensure(gt_array_size(res)
+                == offsets[GT_INTERVAL_INDEX_TEST_NOF_QUERIES]);
+    for (q = 0; !had_err && q < GT_INTERVAL_INDEX_TEST_NOF_QUERIES; q++) {
+      gt_interval_index_test_scan(ranges, removed, nof_added, queries + q,
+                                  ref);
+      had_err = gt_interval_index_test_compare(res, offsets[q],
+                                               offsets[q + 1], ref, err);
+    }
+    for (q = 0; !had_err && q < GT_INTERVAL_INDEX_TEST_NOF_QUERIES; q++) {
+      gt_interval_index_test_scan(ranges, removed, nof_added, queries + q,
+                                  ref);
+      gt_array_reset(res);
+      gt_interval_index_find_all_overlapping(ii, queries[q].start,
+                                             queries[q].end, res);
+      had_err = gt_interval_index_test_compare(res, 0, gt_array_size(res),
+                                               ref, err);
+    }
+  }
+  for (q = 0, i = 0; i < GT_INTERVAL_INDEX_TEST_NOF_INTERVALS; i++) {
+    if (!removed[i])
+      q++;
+  }
+  gt_ensure(gt_interval_index_size(ii) == q);
+  gt_interval_index_delete(ii);
+
+  /* values are freed on removal and deletion */
+  ii = gt_interval_index_new(gt_free_func);
+  for (i = 0; i < 100UL; i++) {
+    GtRange *rng = gt_malloc(sizeof *rng);
+    *rng = ranges[i];
+    gt_interval_index_add(ii, rng, rng->start, rng->end);
+    if (i % 3 == 0)
+      gt_ensure(gt_interval_index_remove(ii, rng, rng->start, rng->end));
+    if (i == 50UL)
+      gt_interval_index_build(ii);
+  }
+  gt_interval_index_delete(ii);
+
+  gt_array_delete(ref);
+  gt_array_delete(res);
+  gt_free(offsets);
+  gt_free(removed);
+  gt_free(ranges);
+  return had_err;
+}
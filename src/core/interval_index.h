@@ -0,0 +1,61 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef INTERVAL_INDEX_H
+#define INTERVAL_INDEX_H
+
+#include "core/error_api.h"
+#include "core/interval_index_api.h"
+
+/* An interval in the array layout of a <GtIntervalIndex>. <maxend> is the
+   largest end position in the subtree of the interval in the implicit tree
+   over the sorted array, <value> is free for the user. */
+typedef struct {
+  GtUword start,
+          end,
+          maxend,
+          value;
+} GtIntervalIndexEntry;
+
+/* Function called for the position <idx> of an interval reported by
+   <gt_interval_index_entries_overlap()>. A return value different from 0
+   stops the iteration. */
+typedef int (*GtIntervalIndexEntryFunc)(GtUword idx, void *data);
+
+/* Compare two <GtIntervalIndexEntry>s by start, end and value. */
+int     gt_interval_index_entry_compare(const void *v1, const void *v2);
+
+/* Compute the <maxend> values of the <n> entries in <entries>, which must be
+   sorted by start position. Returns the level of the root of the implicit
+   tree, which is needed for queries. */
+GtUword gt_interval_index_entries_build(GtIntervalIndexEntry *entries,
+                                        GtUword n);
+
+/* Call <func> for the position of each of the <n> entries in <entries>
+   (prepared by <gt_interval_index_entries_build()>, which returned
+   <root_level>) overlapping the range from <start> to <end>, in ascending
+   order. Returns the first non-zero return value of <func>, or 0. */
+int     gt_interval_index_entries_overlap(const GtIntervalIndexEntry *entries,
+                                          GtUword n,
+                                          GtUword root_level,
+                                          GtUword start,
+                                          GtUword end,
+                                          GtIntervalIndexEntryFunc func,
+                                          void *data);
+
+int     gt_interval_index_unit_test(GtError *err);
+
+#endif
@@ -0,0 +1,115 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef INTERVAL_INDEX_API_H
+#define INTERVAL_INDEX_API_H
+
+#include "core/array_api.h"
+#include "core/fptr_api.h"
+#include "core/range_api.h"
+
+/* The <GtIntervalIndex> class stores intervals with associated data in a
+   single array sorted by start position, which is searched as an implicit
+   augmented interval tree. Intervals are added in bulk and become visible to
+   queries after the index has been (re)built, which merges the newly added
+   intervals into the sorted array. Queries do not modify the index and can be
+   run concurrently. Use <GtIntervalTree> if insertions and queries are
+   interleaved. */
+typedef struct GtIntervalIndex GtIntervalIndex;
+
+/* Function called for the <value> of each interval from <start> to <end>
+   reported by a query. Use <data> to pass in arbitrary user data. A return
+   value different from 0 stops the iteration and is passed on. */
+typedef int (*GtIntervalIndexIteratorFunc)(void *value, GtUword start,
+                                           GtUword end, void *data);
+
+/* Return a new, empty <GtIntervalIndex>. If <free_func> is given, it is
+   applied to the values of all intervals in the index upon deletion or
+   removal. */
+GtIntervalIndex* gt_interval_index_new(GtFree free_func);
+
+/* Add the interval from <start> to <end> with value <value> to
+   <interval_index>. The interval is not found by queries until
+   <gt_interval_index_build()> is called. */
+void             gt_interval_index_add(GtIntervalIndex *interval_index,
+                                       void *value, GtUword start,
+                                       GtUword end);
+
+/* Remove the interval from <start> to <end> with value <value> from
+   <interval_index>, freeing <value> according to the free function of the
+   index. Returns true if the interval was found. The index stays built. */
+bool             gt_interval_index_remove(GtIntervalIndex *interval_index,
+                                          const void *value, GtUword start,
+                                          GtUword end);
+
+/* Merge all intervals added since the last call into the searchable part of
+   <interval_index>. Does nothing if no intervals have been added. */
+void             gt_interval_index_build(GtIntervalIndex *interval_index);
+
+/* Return true if all intervals of <interval_index> are searchable. */
+bool             gt_interval_index_is_built(const GtIntervalIndex
+                                            *interval_index);
+
+/* Return the number of intervals in <interval_index>. */
+GtUword          gt_interval_index_size(const GtIntervalIndex *interval_index);
+
+/* Add the values of all intervals in the built <interval_index> which
+   overlap the range from <start> to <end> to <results>, ordered by interval
+   start position. Intervals with equal ranges appear in the order in which
+   they were added. */
+void             gt_interval_index_find_all_overlapping(const GtIntervalIndex
+                                                        *interval_index,
+                                                        GtUword start,
+                                                        GtUword end,
+                                                        GtArray *results);
+
+/* Call <func> for all intervals in the built <interval_index> which overlap
+   the range from <start> to <end>, in the same order as
+   <gt_interval_index_find_all_overlapping()>. Returns the first non-zero
+   return value of <func>, or 0. */
+int              gt_interval_index_iterate_overlapping(
+                                         const GtIntervalIndex *interval_index,
+                                         GtIntervalIndexIteratorFunc func,
+                                         GtUword start,
+                                         GtUword end,
+                                         void *data);
+
+/* Answer the <nof_queries> queries for the ranges in <queries> on the built
+   <interval_index> at once. The values of the intervals overlapping
+   <queries>[i] are appended to <results> (an array of pointers) and stored
+   at the positions <offsets>[i] to <offsets>[i+1]-1, in the same order as
+   <gt_interval_index_find_all_overlapping()>. <offsets> must have space for
+   <nof_queries>+1 entries. The queries are processed in order of their start
+   positions, using <gt_jobs> threads. */
+void             gt_interval_index_find_all_overlapping_batch(
+                                         const GtIntervalIndex *interval_index,
+                                         const GtRange *queries,
+                                         GtUword nof_queries,
+                                         GtArray *results,
+                                         GtUword *offsets);
+
+/* Call <func> for all intervals in the built <interval_index>, ordered by
+   start position. Returns the first non-zero return value of <func>, or 0. */
+int              gt_interval_index_traverse(const GtIntervalIndex
+                                            *interval_index,
+                                            GtIntervalIndexIteratorFunc func,
+                                            void *data);
+
+/* Delete <interval_index>, freeing the values of all intervals according to
+   its free function. */
+void             gt_interval_index_delete(GtIntervalIndex *interval_index);
+
+#endif
@@ -166,10 +166,11 @@ static void interval_tree_find_all_internal(GtIntervalTree *it,
   x = node;
   if (low <= x->high && x->low <= high)
     func(node, data);
-  /* recursively search left and right subtrees */
+  /* recursively search left and right subtrees, the intervals in the right
+     subtree do not start before <x> */
   if (x->left != it->nil && low <= x->left->max)
     interval_tree_find_all_internal(it, x->left, func, low, high, data);
-  if (x->right != it->nil && low <= x->right->max)
+  if (x->right != it->nil && low <= x->right->max && x->low <= high)
     interval_tree_find_all_internal(it, x->right, func, low, high, data);
 }
 
@@ -690,6 +691,33 @@ int gt_interval_tree_unit_test(GT_UNUSED GtError *err)
     }
   }
 
+  gt_interval_tree_delete(it);
+
+  /* interleave insertions and queries, as the line breaker does */
+  it = gt_interval_tree_new(NULL);
+  gt_array_reset(narr);
+  for (i = 0; i < num_testranges && !had_err; i++) {
+    GtUword start = gt_rand_max(gt_range_max_basepos), j;
+    bool found = false;
+    qrange.start = start;
+    qrange.end = start + gt_rand_max(width);
+    res = gt_interval_tree_find_first_overlapping(it, qrange.start,
+                                                  qrange.end);
+    for (j = 0; !found && j < gt_array_size(narr); j++) {
+      GtIntervalTreeNode *node = *(GtIntervalTreeNode**) gt_array_get(narr, j);
+      found = (qrange.start <= node->high && node->low <= qrange.end);
+    }
+    gt_ensure(found == (res != NULL));
+    if (!res) {
+      GtIntervalTreeNode *new_node = gt_interval_tree_node_new(NULL,
+                                                               qrange.start,
+                                                               qrange.end);
+      gt_interval_tree_insert(it, new_node);
+      gt_array_add(narr, new_node);
+    }
+  }
+  gt_ensure(gt_interval_tree_size(it) == gt_array_size(narr));
+
   gt_array_delete(arr);
   gt_array_delete(narr);
   gt_interval_tree_delete(it);
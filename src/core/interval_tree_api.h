@@ -23,7 +23,8 @@
 
 /* This is an interval tree data structure, implemented according to
    Cormen et al., Introduction to Algorithms, 2nd edition, MIT Press,
-   Cambridge, MA, USA, 2001 */
+   Cambridge, MA, USA, 2001. It supports insertions and removals interleaved
+   with queries, use a <GtIntervalIndex> to query intervals added in bulk. */
 typedef struct GtIntervalTree GtIntervalTree;
 typedef struct GtIntervalTreeNode GtIntervalTreeNode;
 
@@ -17,10 +17,11 @@
 
 #include <string.h>
 #include "core/io.h"
+#include "core/line_source.h"
 #include "core/ma_api.h"
 
 struct GtIO {
-  GtFile *fp;
+  GtLineSource *source;
   GtStr *path;
   GtUword line_number;
   bool line_start;
@@ -33,7 +34,7 @@ GtIO* gt_io_new(const char *path, const char *mode)
   /* XXX: only the read mode has been implemented */
   gt_assert(!strcmp(mode, "r"));
   io = gt_malloc(sizeof *io);
-  io->fp = gt_file_xopen(path, mode);
+  io->source = gt_line_source_xnew(path);
   io->path = path ? gt_str_new_cstr(path) : gt_str_new_cstr("stdin");
   io->line_number = 1;
   io->line_start = true;
@@ -43,7 +44,7 @@ GtIO* gt_io_new(const char *path, const char *mode)
 void gt_io_delete(GtIO *io)
 {
   if (!io) return;
-  gt_file_delete(io->fp);
+  gt_line_source_delete(io->source);
   gt_str_delete(io->path);
   gt_free(io);
 }
@@ -52,7 +53,7 @@ int gt_io_get_char(GtIO *io, char *c)
 {
   int cc;
   gt_assert(io && c);
-  cc = gt_file_xfgetc(io->fp);
+  cc = gt_line_source_getc(io->source);
   if (cc == '\n') {
     io->line_number++;
     io->line_start = true;
@@ -68,7 +69,7 @@ int gt_io_get_char(GtIO *io, char *c)
 void gt_io_unget_char(GtIO *io, char c)
 {
   gt_assert(io);
-  gt_file_unget_char(io->fp, c);
+  gt_line_source_unget_char(io->source, c);
 }
 
 bool gt_io_line_start(const GtIO *io)
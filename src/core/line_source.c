@@ -0,0 +1,298 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+#include <sys/stat.h>
+#include <string.h>
+#include "core/compat_api.h"
+#include "core/ensure_api.h"
+#include "core/fa_api.h"
+#include "core/line_source.h"
+#include "core/ma_api.h"
+#include "core/xansi_api.h"
+
+/* the pages of a mapping which have been read are released after this many
+   bytes, to keep the resident set small for large inputs */
+#define GT_LINE_SOURCE_RELEASE_SIZE  (8UL << 20)
+
+struct GtLineSource {
+  GtFile *file; /* input if not mapped */
+  GtStr *buffer; /* current line if not mapped */
+  const char *map, /* the mapping, NULL for an empty file */
+             *pos, /* next character to be read */
+             *end,
+             *released; /* pages in front of it have been released */
+  size_t maplen;
+  bool mapped,
+       owns_file,
+       char_read; /* the last character has been read from the mapping */
+};
+
+static bool line_source_mappable(const char *path, size_t *size)
+{
+  struct stat sb;
+  if (!path || gt_file_mode_determine(path) != GT_FILE_MODE_UNCOMPRESSED ||
+      stat(path, &sb) || !S_ISREG(sb.st_mode)) {
+    return false;
+  }
+  *size = (size_t) sb.st_size;
+  return true;
+}
+
+static GtLineSource* line_source_new_mapped(const char *map, size_t maplen)
+{
+  GtLineSource *line_source = gt_calloc(1, sizeof *line_source);
+  line_source->mapped = true;
+  line_source->map = line_source->pos = line_source->released = map;
+  line_source->end = map ? map + maplen : NULL;
+  line_source->maplen = maplen;
+  return line_source;
+}
+
+GtLineSource* gt_line_source_new(const char *path, GtError *err)
+{
+  GtLineSource *line_source;
+  size_t size;
+  gt_error_check(err);
+  if (line_source_mappable(path, &size)) {
+    void *map = NULL;
+    /* an empty file cannot be mapped */
+    if (size > 0 && !(map = gt_fa_mmap_read(path, &size, err)))
+      return NULL;
+    return line_source_new_mapped(map, size);
+  }
+  else {
+    GtFile *file = NULL;
+    if (path && !(file = gt_file_new(path, "r", err)))
+      return NULL;
+    line_source = gt_line_source_new_file(file);
+    line_source->owns_file = true;
+  }
+  return line_source;
+}
+
+GtLineSource* gt_line_source_xnew(const char *path)
+{
+  GtLineSource *line_source;
+  size_t size;
+  if (line_source_mappable(path, &size)) {
+    void *map = NULL;
+    if (size > 0)
+      map = gt_fa_xmmap_read(path, &size);
+    return line_source_new_mapped(map, size);
+  }
+  line_source = gt_line_source_new_file(path ? gt_file_xopen(path, "r")
+                                             : NULL);
+  line_source->owns_file = true;
+  return line_source;
+}
+
+GtLineSource* gt_line_source_new_file(GtFile *file)
+{
+  GtLineSource *line_source = gt_calloc(1, sizeof *line_source);
+  line_source->file = file;
+  line_source->buffer = gt_str_new();
+  return line_source;
+}
+
+GtFile* gt_line_source_get_file(const GtLineSource *line_source)
+{
+  gt_assert(line_source);
+  return line_source->file;
+}
+
+bool gt_line_source_is_mapped(const GtLineSource *line_source)
+{
+  gt_assert(line_source);
+  return line_source->mapped;
+}
+
+static void line_source_release(GtLineSource *line_source)
+{
+#if !defined(_WIN32) && defined(MADV_DONTNEED)
+  /* the mapping is read only, released pages are read again if needed */
+  GtUword pagesize = gt_pagesize();
+  size_t len = ((size_t) (line_source->pos - line_source->released))
+               & ~(pagesize - 1);
+  (void) madvise((void*) line_source->released, len, MADV_DONTNEED);
+  line_source->released += len;
+#else
+  line_source->released = line_source->pos;
+#endif
+}
+
+int gt_line_source_next(GtLineSource *line_source, const char **line,
+                        GtUword *length)
+{
+  const char *newline;
+  GtUword len, carriage_returns;
+  gt_assert(line_source && line && length);
+  if (!line_source->mapped) {
+    gt_str_reset(line_source->buffer);
+    if (gt_str_read_next_line_generic(line_source->buffer,
+                                      line_source->file) == EOF) {
+      return EOF;
+    }
+    *line = gt_str_get(line_source->buffer);
+    *length = gt_str_length(line_source->buffer);
+    return 0;
+  }
+  line_source->char_read = false;
+  if (line_source->pos == line_source->end ||
+      !(newline = memchr(line_source->pos, '\n',
+                         (size_t) (line_source->end - line_source->pos)))) {
+    line_source->pos = line_source->end;
+    return EOF;
+  }
+  len = (GtUword) (newline - line_source->pos);
+  /* gt_str_read_next_line_generic() reads '\r' characters in pairs, therefore
+     only an odd number of them in front of the '\n' ends with "\r\n" */
+  for (carriage_returns = 0;
+       carriage_returns < len &&
+       line_source->pos[len - carriage_returns - 1] == '\r';
+       carriage_returns++) /* nothing */;
+  *line = line_source->pos;
+  *length = len - (carriage_returns % 2);
+  line_source->pos = newline + 1;
+  if ((GtUword) (line_source->pos - line_source->released) >=
+      GT_LINE_SOURCE_RELEASE_SIZE) {
+    line_source_release(line_source);
+  }
+  return 0;
+}
+
+int gt_line_source_read_line(GtLineSource *line_source, GtStr *str)
+{
+  const char *line;
+  GtUword length;
+  gt_assert(line_source && str);
+  if (!line_source->mapped)
+    return gt_str_read_next_line_generic(str, line_source->file);
+  if (gt_line_source_next(line_source, &line, &length) == EOF)
+    return EOF;
+  gt_str_append_cstr_nt(str, line, length);
+  return 0;
+}
+
+int gt_line_source_getc(GtLineSource *line_source)
+{
+  gt_assert(line_source);
+  if (!line_source->mapped)
+    return gt_file_xfgetc(line_source->file);
+  if (line_source->pos == line_source->end) {
+    line_source->char_read = false;
+    return EOF;
+  }
+  if ((GtUword) (line_source->pos - line_source->released) >=
+      GT_LINE_SOURCE_RELEASE_SIZE) {
+    line_source_release(line_source);
+  }
+  line_source->char_read = true;
+  return (unsigned char) *line_source->pos++;
+}
+
+void gt_line_source_unget_char(GtLineSource *line_source, char c)
+{
+  gt_assert(line_source);
+  if (!line_source->mapped) {
+    gt_file_unget_char(line_source->file, c);
+    return;
+  }
+  /* after EOF has been read, EOF is read again */
+  if (line_source->char_read) {
+    gt_assert(line_source->pos[-1] == c);
+    line_source->pos--;
+    line_source->char_read = false;
+  }
+}
+
+void gt_line_source_delete(GtLineSource *line_source)
+{
+  if (!line_source) return;
+  if (line_source->map)
+    gt_fa_xmunmap((void*) line_source->map);
+  if (line_source->owns_file)
+    gt_file_delete(line_source->file);
+  gt_str_delete(line_source->buffer);
+  gt_free(line_source);
+}
+
+int gt_line_source_unit_test(GtError *err)
+{
+  static const char *input = "a\tb\n\nc\r\nd\r\r\ne\r\r\r\nf\rg\nlast";
+  static const char *lines[] = { "a\tb", "", "c", "d\r\r", "e\r\r", "f\rg" };
+  GtLineSource *line_sources[2];
+  GtStr *tmpfilename, *str;
+  const char *line;
+  GtUword length, i, j;
+  FILE *tmpfp;
+  int had_err = 0;
+  gt_error_check(err);
+
+  tmpfilename = gt_str_new();
+  tmpfp = gt_xtmpfp(tmpfilename);
+  gt_xfputs(input, tmpfp);
+  gt_fa_xfclose(tmpfp);
+  line_sources[0] = gt_line_source_xnew(gt_str_get(tmpfilename));
+  gt_ensure(gt_line_source_is_mapped(line_sources[0]));
+  line_sources[1] =
+    gt_line_source_new_file(gt_file_xopen(gt_str_get(tmpfilename), "r"));
+  gt_ensure(!gt_line_source_is_mapped(line_sources[1]));
+
+  /* both kinds of sources return the same lines */
+  for (i = 0; !had_err && i < 2UL; i++) {
+    GtLineSource *line_source = line_sources[i];
+    gt_ensure(gt_line_source_getc(line_source) == 'a');
+    gt_line_source_unget_char(line_source, 'a');
+    for (j = 0; !had_err && j < sizeof lines / sizeof lines[0]; j++) {
+      gt_ensure(!gt_line_source_next(line_source, &line, &length));
+      gt_ensure(length == strlen(lines[j]));
+      gt_ensure(!strncmp(line, lines[j], length));
+    }
+    gt_ensure(gt_line_source_next(line_source, &line, &length) == EOF);
+    gt_ensure(gt_line_source_getc(line_source) == EOF);
+  }
+  gt_file_delete(gt_line_source_get_file(line_sources[1]));
+  gt_line_source_delete(line_sources[1]);
+  gt_line_source_delete(line_sources[0]);
+
+  /* read lines into a string and characters after them */
+  line_sources[0] = gt_line_source_xnew(gt_str_get(tmpfilename));
+  str = gt_str_new_cstr(">");
+  gt_ensure(!gt_line_source_read_line(line_sources[0], str));
+  gt_ensure(!strcmp(gt_str_get(str), ">a\tb"));
+  gt_ensure(!gt_line_source_read_line(line_sources[0], str));
+  gt_ensure(gt_line_source_getc(line_sources[0]) == 'c');
+  gt_line_source_delete(line_sources[0]);
+  gt_str_delete(str);
+  gt_xremove(gt_str_get(tmpfilename));
+
+  /* an empty file is mapped, but has no lines */
+  tmpfp = gt_xtmpfp(tmpfilename);
+  gt_fa_xfclose(tmpfp);
+  line_sources[0] = gt_line_source_xnew(gt_str_get(tmpfilename));
+  gt_ensure(gt_line_source_next(line_sources[0], &line, &length) == EOF);
+  gt_ensure(gt_line_source_getc(line_sources[0]) == EOF);
+  gt_line_source_unget_char(line_sources[0], (char) EOF);
+  gt_ensure(gt_line_source_getc(line_sources[0]) == EOF);
+  gt_line_source_delete(line_sources[0]);
+  gt_xremove(gt_str_get(tmpfilename));
+  gt_str_delete(tmpfilename);
+
+  return had_err;
+}
@@ -0,0 +1,62 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef LINE_SOURCE_H
+#define LINE_SOURCE_H
+
+#include "core/error_api.h"
+#include "core/file_api.h"
+#include "core/str_api.h"
+#include "core/types_api.h"
+
+/* A <GtLineSource> delivers the lines of a text input. Uncompressed regular
+   files are memory mapped and their lines are returned as views into the
+   mapping, without reading them character by character. All other inputs
+   (compressed files, pipes, stdin) are read through a <GtFile>.
+   Lines are terminated by "\n" or "\r\n", a last line without terminator is
+   not returned, exactly as with <gt_str_read_next_line_generic()>. */
+typedef struct GtLineSource GtLineSource;
+
+/* Return a new <GtLineSource> for the file <path>, or for stdin if <path> is
+   NULL. Returns NULL and sets <err> if the file cannot be opened. */
+GtLineSource* gt_line_source_new(const char *path, GtError *err);
+/* Like <gt_line_source_new()>, but terminates on error. */
+GtLineSource* gt_line_source_xnew(const char *path);
+/* Return a new <GtLineSource> reading from <file> (stdin if NULL), which is
+   not closed by the line source. */
+GtLineSource* gt_line_source_new_file(GtFile *file);
+/* Return the <GtFile> read by <line_source>, NULL if it is memory mapped or
+   reads from stdin. */
+GtFile*       gt_line_source_get_file(const GtLineSource *line_source);
+/* Return true if the input of <line_source> is memory mapped. */
+bool          gt_line_source_is_mapped(const GtLineSource *line_source);
+/* Set <line> and <length> to the next line of <line_source>, without its
+   terminator, and return 0. Return EOF if no line is left. The line is not
+   '\0'-terminated and valid until the next call on <line_source>. */
+int           gt_line_source_next(GtLineSource *line_source, const char **line,
+                                  GtUword *length);
+/* Append the next line of <line_source> to <str> and return 0, or return EOF
+   if no line is left. */
+int           gt_line_source_read_line(GtLineSource *line_source, GtStr *str);
+/* Return the next character of <line_source> or EOF. */
+int           gt_line_source_getc(GtLineSource *line_source);
+/* Put <c> back to <line_source>, at most one character at a time. */
+void          gt_line_source_unget_char(GtLineSource *line_source, char c);
+void          gt_line_source_delete(GtLineSource *line_source);
+
+int           gt_line_source_unit_test(GtError *err);
+
+#endif
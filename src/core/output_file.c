@@ -16,6 +16,7 @@
 */
 
 #include <string.h>
+#include "core/codec_file.h"
 #include "core/file_api.h"
 #include "core/fileutils_api.h"
 #include "core/ma_api.h"
@@ -26,6 +27,8 @@ struct GtOutputFileInfo {
   GtStr *output_filename;
   bool gzip,
        bzip2,
+       zstd,
+       xz,
        force;
   GtFile **outfp;
 };
@@ -47,13 +50,24 @@ static int determine_outfp(void *data, GtError *err)
   if (!gt_str_length(ofi->output_filename))
     *ofi->outfp = NULL; /* no output file given -> use stdout */
   else { /* outputfile given -> create generic file pointer */
-    gt_assert(!(ofi->gzip && ofi->bzip2));
+    gt_assert(ofi->gzip + ofi->bzip2 + ofi->zstd + ofi->xz <= 1);
     if (ofi->gzip)
       file_mode = GT_FILE_MODE_GZIP;
     else if (ofi->bzip2)
       file_mode = GT_FILE_MODE_BZIP2;
+    else if (ofi->zstd)
+      file_mode = GT_FILE_MODE_ZSTD;
+    else if (ofi->xz)
+      file_mode = GT_FILE_MODE_XZ;
     else
       file_mode = GT_FILE_MODE_UNCOMPRESSED;
+    if ((file_mode == GT_FILE_MODE_ZSTD || file_mode == GT_FILE_MODE_XZ) &&
+        !gt_codec_file_mode_is_supported(file_mode)) {
+      gt_error_set(err, "option -%s is not available, GenomeTools has been "
+                   "compiled without %s support", ofi->zstd ? "zstd" : "xz",
+                   ofi->zstd ? "Zstandard" : "xz");
+      return -1;
+    }
     if (file_mode != GT_FILE_MODE_UNCOMPRESSED &&
         strcmp(gt_str_get(ofi->output_filename) +
                gt_str_length(ofi->output_filename) -
@@ -83,7 +97,7 @@ static int determine_outfp(void *data, GtError *err)
 void gt_output_file_info_register_options(GtOutputFileInfo *ofi,
                                           GtOptionParser *op, GtFile **outfp)
 {
-  GtOption *opto, *optgzip, *optbzip2, *optforce;
+  GtOption *opto, *optgzip, *optbzip2, *optzstd, *optxz, *optforce;
   gt_assert(outfp && ofi);
   ofi->outfp = outfp;
   /* register option -o */
@@ -98,16 +112,31 @@ void gt_output_file_info_register_options(GtOutputFileInfo *ofi,
   optbzip2 = gt_option_new_bool("bzip2", "write bzip2 compressed output file",
                                 &ofi->bzip2, false);
   gt_option_parser_add_option(op, optbzip2);
+  /* register option -zstd */
+  optzstd = gt_option_new_bool("zstd", "write Zstandard compressed output file",
+                               &ofi->zstd, false);
+  gt_option_parser_add_option(op, optzstd);
+  /* register option -xz */
+  optxz = gt_option_new_bool("xz", "write xz compressed output file",
+                             &ofi->xz, false);
+  gt_option_parser_add_option(op, optxz);
   /* register option -force */
   optforce = gt_option_new_bool(GT_FORCE_OPT_CSTR,
                                 "force writing to output file",
                                 &ofi->force, false);
   gt_option_parser_add_option(op, optforce);
-  /* options -gzip and -bzip2 exclude each other */
+  /* options -gzip, -bzip2, -zstd, and -xz exclude each other */
   gt_option_exclude(optgzip, optbzip2);
+  gt_option_exclude(optgzip, optzstd);
+  gt_option_exclude(optgzip, optxz);
+  gt_option_exclude(optbzip2, optzstd);
+  gt_option_exclude(optbzip2, optxz);
+  gt_option_exclude(optzstd, optxz);
   /* option implications */
   gt_option_imply(optgzip, opto);
   gt_option_imply(optbzip2, opto);
+  gt_option_imply(optzstd, opto);
+  gt_option_imply(optxz, opto);
   gt_option_imply(optforce, opto);
   /* set hook function to determine <outfp> */
   gt_option_parser_register_hook(op, determine_outfp, ofi);
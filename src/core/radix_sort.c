@@ -60,6 +60,7 @@
 #include "core/radix_sort.h"
 #ifdef GT_THREADS_ENABLED
 #include "core/thread_api.h"
+#include "core/thread_pool.h"
 #endif
 
 #define GT_RADIX_KEY(MASK,SHIFT,VALUE)    (((VALUE) >> (SHIFT)) & (MASK))
@@ -372,10 +373,9 @@ typedef struct
 {
   GtStackGtRadixsort_stackelem stack;
   GtRadixbuffer *rbuf;
-  GtThread *thread;
 } GtRadixinplacethreadinfo;
 
-static void *gt_radixsort_thread_caller(void *data)
+static void gt_radixsort_thread_caller(void *data)
 {
   GtRadixinplacethreadinfo *threadinfo = (GtRadixinplacethreadinfo *) data;
   if (threadinfo->rbuf->elemtype == GtRadixelemtypeGtUwordPair)
@@ -398,7 +398,6 @@ static void *gt_radixsort_thread_caller(void *data)
       }
     }
   }
-  return NULL;
 }
 #endif
 
@@ -693,6 +692,7 @@ static void gt_radixsort_inplace(GtRadixsortinfo *radixsortinfo,
 #ifdef GT_THREADS_ENABLED
     GtUword last = 0, j;
     unsigned int t;
+    GtThreadPoolGroup *group = gt_thread_pool_group_new();
 
     gt_assert(radixsortinfo->stack.nextfree <= UINT8_MAX+1);
     for (j=0; j<radixsortinfo->stack.nextfree; j++)
@@ -711,16 +711,11 @@ static void gt_radixsort_inplace(GtRadixsortinfo *radixsortinfo,
                       radixsortinfo->stack.space[j]);
       }
       last = radixsortinfo->endindexes[t] + 1;
-      radixsortinfo->threadinfo[t].thread
-        = gt_thread_new (gt_radixsort_thread_caller,
-                         radixsortinfo->threadinfo + t,NULL);
-      gt_assert (radixsortinfo->threadinfo[t].thread != NULL);
-    }
-    for (t = 0; t < threads; t++)
-    {
-      gt_thread_join(radixsortinfo->threadinfo[t].thread);
-      gt_thread_delete(radixsortinfo->threadinfo[t].thread);
+      gt_thread_pool_group_submit(group,gt_radixsort_thread_caller,
+                                  radixsortinfo->threadinfo + t);
     }
+    gt_thread_pool_group_wait(group);
+    gt_thread_pool_group_delete(group);
 #endif
   }
 }
@@ -17,15 +17,79 @@
 */
 
 #include <ctype.h>
+#include <string.h>
 #include "core/cstr_api.h"
+#include "core/desc_buffer.h"
+#include "core/dynalloc.h"
+#include "core/ma_api.h"
+#include "core/minmax_api.h"
 #include "core/sequence_buffer_fasta.h"
 #include "core/sequence_buffer_rep.h"
 #include "core/sequence_buffer_inline.h"
+#include "core/thread_api.h"
+#include "core/thread_pool.h"
 
 #define FASTASEPARATOR    '>'
 #define NEWLINESYMBOL     '\n'
 #define CRSYMBOL          '\r'
 
+/* With more than one thread, the input files are read in chunks of about
+   this size, which end at a line end or at the end of a file. The chunks are
+   parsed and mapped on the thread pool and delivered in order, in blocks of
+   exactly the same content as in the sequential case.
+   Only parsing and mapping run per chunk. The special ranges, the MD5 sums
+   and the two bit encoding are still computed by the consumers in encseq.c
+   from the delivered characters: the MD5 of a sequence cannot be split at
+   chunk boundaries, and the tables depend on the access type and the dust
+   masker. */
+#define GT_SEQUENCE_BUFFER_FASTA_CHUNKSIZE  (1UL << 21)
+
+typedef struct {
+  GtUword outpos, /* position in the output of the chunk */
+          descstart; /* start of the description events */
+} GtSequenceBufferFastaHeader;
+
+typedef struct {
+  GtThreadPoolGroup *group; /* the task parsing the chunk */
+  const unsigned char *symbolmap;
+  unsigned char *raw, /* the input of the chunk */
+                *out,
+                *outorig;
+  char *desc; /* appended description characters, '\n' finishes one */
+  GtUword rawlength,
+          outlength,
+          outread, /* delivered part of <out> */
+          desclength,
+          filenum,
+          fileadd,
+          newlines,
+          errornewlines, /* newlines in front of the illegal character */
+          *separators, /* positions of the separators in <out> */
+          numofseparators,
+          nextseparator,
+          numofheaders,
+          nextheader,
+          chardist[UCHAR_MAX+1];
+  GtSequenceBufferFastaHeader *headers;
+  size_t rawallocated,
+         outallocated,
+         descallocated,
+         separatorsallocated,
+         headersallocated;
+  uint64_t trailingspecials,
+           errorline;
+  GtUint64 counter;
+  unsigned char illegalchar;
+  bool valid, /* holds data of the input */
+       activated,
+       firstinfile,
+       firstoverallseq,
+       withdesc,
+       hasheader,
+       hasnonspecial,
+       failed;
+} GtSequenceBufferFastaChunk;
+
 struct GtSequenceBufferFasta {
   const GtSequenceBuffer parent_instance;
   GtStr *headerbuffer;
@@ -33,12 +97,25 @@ struct GtSequenceBufferFasta {
        firstseqinfile,
        firstoverallseq,
        nextfile;
+  /* the members below are only used for parallel parsing */
+  GtSequenceBufferFastaChunk *chunks;
+  GtFile *readfile;
+  unsigned char *carry; /* input read behind the last line end of a chunk */
+  GtUword numofchunks,
+          currentchunk,
+          readfilenum,
+          carrylength;
+  size_t carryallocated;
+  bool parallel,
+       started,
+       headerinfile;
 };
 
 #define gt_sequence_buffer_fasta_cast(SB)\
         gt_sequence_buffer_cast(gt_sequence_buffer_fasta_class(), SB)
 
-static int gt_sequence_buffer_fasta_advance(GtSequenceBuffer *sb, GtError *err)
+static int gt_sequence_buffer_fasta_advance_sequential(GtSequenceBuffer *sb,
+                                                       GtError *err)
 {
   int currentchar, ret = 0;
   GtUword currentoutpos = 0, currentfileadd = 0, currentfileread = 0;
@@ -170,9 +247,383 @@ static int gt_sequence_buffer_fasta_advance(GtSequenceBuffer *sb, GtError *err)
   return 0;
 }
 
+/* Parses the input of a chunk like the sequential advance function, starting
+   after a line end. The effects on the members of the sequence buffer are
+   recorded in the chunk and applied when the chunk is delivered. */
+static void gt_sequence_buffer_fasta_chunk_parse(void *data)
+{
+  GtSequenceBufferFastaChunk *chunk = data;
+  const unsigned char *symbolmap = chunk->symbolmap;
+  unsigned char cc, charcode;
+  GtUword idx, outpos = 0;
+  bool indesc = false,
+       firstseqinfile = chunk->firstinfile,
+       firstoverallseq = chunk->firstoverallseq;
+
+  if (chunk->outallocated < (size_t) chunk->rawlength) {
+    chunk->outallocated = (size_t) chunk->rawlength;
+    chunk->out = gt_realloc(chunk->out, chunk->outallocated);
+    chunk->outorig = gt_realloc(chunk->outorig, chunk->outallocated);
+  }
+  chunk->desclength = chunk->fileadd = chunk->newlines = 0;
+  chunk->numofseparators = chunk->numofheaders = 0;
+  memset(chunk->chardist, 0, sizeof chunk->chardist);
+  chunk->trailingspecials = 0;
+  chunk->counter = 0;
+  chunk->hasheader = chunk->hasnonspecial = chunk->failed = false;
+  for (idx = 0; idx < chunk->rawlength; idx++) {
+    cc = chunk->raw[idx];
+    if (cc == NEWLINESYMBOL)
+      chunk->newlines++;
+    if (indesc) {
+      if (cc == NEWLINESYMBOL)
+        indesc = false;
+      if (chunk->withdesc && cc != CRSYMBOL) {
+        if ((size_t) chunk->desclength >= chunk->descallocated) {
+          chunk->desc = gt_dynalloc(chunk->desc, &chunk->descallocated,
+                                    (chunk->desclength + 1) * sizeof (char));
+        }
+        chunk->desc[chunk->desclength++] = (char) cc;
+      }
+      continue;
+    }
+    if (isspace((int) cc))
+      continue;
+    if (cc == FASTASEPARATOR) {
+      chunk->hasheader = true;
+      if (firstoverallseq) {
+        firstoverallseq = false;
+        firstseqinfile = false;
+      } else {
+        if (firstseqinfile)
+          firstseqinfile = false;
+        else
+          chunk->fileadd++;
+        if ((size_t) chunk->numofseparators >= chunk->separatorsallocated /
+                                               sizeof (GtUword)) {
+          chunk->separators = gt_dynalloc(chunk->separators,
+                                          &chunk->separatorsallocated,
+                                          (chunk->numofseparators + 1) *
+                                          sizeof (GtUword));
+        }
+        chunk->separators[chunk->numofseparators++] = outpos;
+        chunk->out[outpos++] = (unsigned char) GT_SEPARATOR;
+        chunk->trailingspecials++;
+      }
+      if (chunk->withdesc) {
+        if ((size_t) chunk->numofheaders >= chunk->headersallocated /
+                                            sizeof (*chunk->headers)) {
+          chunk->headers = gt_dynalloc(chunk->headers,
+                                       &chunk->headersallocated,
+                                       (chunk->numofheaders + 1) *
+                                       sizeof (*chunk->headers));
+        }
+        chunk->headers[chunk->numofheaders].outpos = outpos;
+        chunk->headers[chunk->numofheaders++].descstart = chunk->desclength;
+      }
+      indesc = true;
+      continue;
+    }
+    if (symbolmap != NULL) {
+      charcode = symbolmap[(unsigned int) cc];
+      if (charcode == GT_UNDEFCHAR) {
+        chunk->failed = true;
+        chunk->illegalchar = cc;
+        chunk->errornewlines = chunk->newlines;
+        break;
+      }
+      if (GT_ISSPECIAL(charcode))
+        chunk->trailingspecials++;
+      else {
+        chunk->trailingspecials = 0;
+        chunk->hasnonspecial = true;
+        chunk->chardist[(int) charcode]++;
+      }
+      chunk->out[outpos] = charcode;
+    } else
+      chunk->out[outpos] = cc;
+    chunk->outorig[outpos++] = cc;
+    chunk->counter++;
+    chunk->fileadd++;
+  }
+  chunk->outlength = outpos;
+}
+
+/* Reads the next chunk of the input into <chunk>. A chunk ends after a line
+   end or at the end of a file. */
+static void gt_sequence_buffer_fasta_chunk_read(GtSequenceBuffer *sb,
+                                                GtSequenceBufferFastaChunk
+                                                                        *chunk)
+{
+  GtSequenceBufferFasta *sbf = (GtSequenceBufferFasta*) sb;
+  GtUword target = GT_SEQUENCE_BUFFER_FASTA_CHUNKSIZE, idx;
+  size_t len;
+
+  chunk->valid = chunk->activated = false;
+  chunk->outlength = chunk->outread = 0;
+  chunk->nextseparator = chunk->nextheader = 0;
+  if (sbf->readfile == NULL) {
+    if (sbf->readfilenum == gt_str_array_size(sb->pvt->filenametab))
+      return;
+    sbf->readfile = gt_file_xopen(gt_str_array_get(sb->pvt->filenametab,
+                                                   sbf->readfilenum),
+                                  "rb");
+    chunk->firstinfile = true;
+  } else
+    chunk->firstinfile = false;
+  chunk->valid = true;
+  chunk->filenum = sbf->readfilenum;
+  chunk->symbolmap = sb->pvt->symbolmap;
+  chunk->withdesc = sb->pvt->descptr != NULL;
+  chunk->firstoverallseq = false;
+  chunk->raw = gt_dynalloc(chunk->raw, &chunk->rawallocated,
+                           (size_t) GT_MAX(target, sbf->carrylength));
+  memcpy(chunk->raw, sbf->carry, (size_t) sbf->carrylength);
+  chunk->rawlength = sbf->carrylength;
+  sbf->carrylength = 0;
+  while (true) {
+    while (chunk->rawlength < target) {
+      len = gt_file_xread(sbf->readfile, chunk->raw + chunk->rawlength,
+                          (size_t) (target - chunk->rawlength));
+      if (len == 0) {
+        gt_file_delete(sbf->readfile);
+        sbf->readfile = NULL;
+        sbf->readfilenum++;
+        return;
+      }
+      chunk->rawlength += (GtUword) len;
+    }
+    for (idx = chunk->rawlength; idx > 0; idx--) {
+      if (chunk->raw[idx-1] == NEWLINESYMBOL)
+        break;
+    }
+    if (idx > 0) {
+      sbf->carrylength = chunk->rawlength - idx;
+      if (sbf->carrylength > (GtUword) sbf->carryallocated) {
+        sbf->carry = gt_dynalloc(sbf->carry, &sbf->carryallocated,
+                                 (size_t) sbf->carrylength);
+      }
+      memcpy(sbf->carry, chunk->raw + idx, (size_t) sbf->carrylength);
+      chunk->rawlength = idx;
+      return;
+    }
+    /* no line end yet, continue with a larger chunk */
+    target += GT_SEQUENCE_BUFFER_FASTA_CHUNKSIZE;
+    chunk->raw = gt_dynalloc(chunk->raw, &chunk->rawallocated,
+                             (size_t) target);
+  }
+}
+
+static void gt_sequence_buffer_fasta_chunk_submit(GtSequenceBuffer *sb,
+                                                  GtSequenceBufferFastaChunk
+                                                                        *chunk)
+{
+  gt_sequence_buffer_fasta_chunk_read(sb, chunk);
+  if (chunk->valid) {
+    gt_thread_pool_group_submit(chunk->group,
+                                gt_sequence_buffer_fasta_chunk_parse, chunk);
+  }
+}
+
+static void gt_sequence_buffer_fasta_chunks_delete(GtSequenceBufferFasta *sbf)
+{
+  GtUword idx;
+  GtSequenceBufferFastaChunk *chunk;
+  for (idx = 0; idx < sbf->numofchunks; idx++) {
+    chunk = sbf->chunks + idx;
+    gt_thread_pool_group_wait(chunk->group);
+    gt_thread_pool_group_delete(chunk->group);
+    gt_free(chunk->raw);
+    gt_free(chunk->out);
+    gt_free(chunk->outorig);
+    gt_free(chunk->desc);
+    gt_free(chunk->separators);
+    gt_free(chunk->headers);
+  }
+  gt_free(sbf->chunks);
+  sbf->chunks = NULL;
+  sbf->numofchunks = 0;
+  gt_free(sbf->carry);
+  sbf->carry = NULL;
+  sbf->carrylength = sbf->carryallocated = 0;
+  gt_file_delete(sbf->readfile);
+  sbf->readfile = NULL;
+}
+
+/* Starts parsing the first chunks. Returns false if the input does not start
+   with a FASTA header, which is left to the sequential advance function. */
+static bool gt_sequence_buffer_fasta_chunks_start(GtSequenceBuffer *sb)
+{
+  GtSequenceBufferFasta *sbf = (GtSequenceBufferFasta*) sb;
+  GtSequenceBufferFastaChunk *chunk;
+  GtUword idx;
+
+  sbf->started = true;
+  sbf->numofchunks = 2 * (GtUword) gt_jobs;
+  sbf->chunks = gt_calloc((size_t) sbf->numofchunks, sizeof (*sbf->chunks));
+  for (idx = 0; idx < sbf->numofchunks; idx++)
+    sbf->chunks[idx].group = gt_thread_pool_group_new();
+  chunk = sbf->chunks;
+  gt_sequence_buffer_fasta_chunk_read(sb, chunk);
+  for (idx = 0; chunk->valid && idx < chunk->rawlength; idx++) {
+    if (!isspace((int) chunk->raw[idx]))
+      break;
+  }
+  if (!chunk->valid || idx == chunk->rawlength ||
+      chunk->raw[idx] != FASTASEPARATOR) {
+    gt_sequence_buffer_fasta_chunks_delete(sbf);
+    return false;
+  }
+  chunk->firstoverallseq = true;
+  sbf->firstoverallseq = false;
+  gt_thread_pool_group_submit(chunk->group,
+                              gt_sequence_buffer_fasta_chunk_parse, chunk);
+  for (idx = 1; idx < sbf->numofchunks; idx++)
+    gt_sequence_buffer_fasta_chunk_submit(sb, sbf->chunks + idx);
+  sbf->currentchunk = 0;
+  return true;
+}
+
+/* Waits for the parser of <chunk> and applies its effects on the members of
+   the sequence buffer, except for the descriptions. */
+static void gt_sequence_buffer_fasta_chunk_activate(GtSequenceBuffer *sb,
+                                                    GtSequenceBufferFastaChunk
+                                                                        *chunk)
+{
+  GtSequenceBufferFasta *sbf = (GtSequenceBufferFasta*) sb;
+  GtSequenceBufferMembers *pvt = sb->pvt;
+  GtUword idx;
+
+  gt_thread_pool_group_wait(chunk->group);
+  chunk->activated = true;
+  pvt->filenum = (unsigned int) chunk->filenum;
+  if (chunk->firstinfile) {
+    pvt->linenum = (uint64_t) 1;
+    sbf->headerinfile = false;
+    if (pvt->filelengthtab != NULL) {
+      pvt->filelengthtab[pvt->filenum].length = 0;
+      pvt->filelengthtab[pvt->filenum].effectivelength = 0;
+    }
+  }
+  if (pvt->filelengthtab != NULL) {
+    pvt->filelengthtab[pvt->filenum].length += (uint64_t) chunk->rawlength;
+    pvt->filelengthtab[pvt->filenum].effectivelength
+      += (uint64_t) chunk->fileadd;
+    /* the parser assumes that an earlier chunk of the file had a header */
+    if (chunk->hasheader && !chunk->firstinfile && !sbf->headerinfile)
+      pvt->filelengthtab[pvt->filenum].effectivelength--;
+  }
+  if (chunk->hasheader)
+    sbf->headerinfile = true;
+  if (pvt->chardisttab != NULL) {
+    for (idx = 0; idx <= (GtUword) UCHAR_MAX; idx++)
+      pvt->chardisttab[idx] += chunk->chardist[idx];
+  }
+  if (chunk->hasnonspecial)
+    pvt->lastspeciallength = chunk->trailingspecials;
+  else
+    pvt->lastspeciallength += chunk->trailingspecials;
+  pvt->counter += chunk->counter;
+  chunk->errorline = pvt->linenum + chunk->errornewlines;
+  pvt->linenum += chunk->newlines;
+}
+
+/* Appends the descriptions of the headers in front of position <outpos> of
+   <chunk> to the description buffer. */
+static void gt_sequence_buffer_fasta_chunk_descs(GtSequenceBuffer *sb,
+                                                 GtSequenceBufferFastaChunk
+                                                                       *chunk,
+                                                 GtUword outpos)
+{
+  GtUword idx, end;
+  while (chunk->nextheader < chunk->numofheaders &&
+         chunk->headers[chunk->nextheader].outpos < outpos) {
+    end = chunk->nextheader + 1 < chunk->numofheaders
+          ? chunk->headers[chunk->nextheader + 1].descstart
+          : chunk->desclength;
+    for (idx = chunk->headers[chunk->nextheader].descstart; idx < end; idx++) {
+      if (chunk->desc[idx] == NEWLINESYMBOL)
+        gt_desc_buffer_finish(sb->pvt->descptr);
+      else
+        gt_desc_buffer_append_char(sb->pvt->descptr, chunk->desc[idx]);
+    }
+    chunk->nextheader++;
+  }
+}
+
+/* Fills the output buffer from the parsed chunks, in exactly the same blocks
+   as the sequential advance function. */
+static int gt_sequence_buffer_fasta_advance_parallel(GtSequenceBuffer *sb,
+                                                     GtError *err)
+{
+  GtSequenceBufferFasta *sbf = (GtSequenceBufferFasta*) sb;
+  GtSequenceBufferMembers *pvt = sb->pvt;
+  GtSequenceBufferFastaChunk *chunk;
+  GtUword currentoutpos = 0, len, sep;
+
+  while (currentoutpos < (GtUword) OUTBUFSIZE) {
+    chunk = sbf->chunks + sbf->currentchunk;
+    if (!chunk->valid) {
+      pvt->complete = true;
+      break;
+    }
+    if (!chunk->activated)
+      gt_sequence_buffer_fasta_chunk_activate(sb, chunk);
+    len = GT_MIN((GtUword) OUTBUFSIZE - currentoutpos,
+                 chunk->outlength - chunk->outread);
+    /* like in the sequential case, the original characters at the positions
+       of separators are left unchanged */
+    while (chunk->nextseparator < chunk->numofseparators &&
+           (sep = chunk->separators[chunk->nextseparator])
+             < chunk->outread + len) {
+      chunk->outorig[sep] = pvt->outbuforig[currentoutpos + sep -
+                                            chunk->outread];
+      chunk->nextseparator++;
+    }
+    memcpy(pvt->outbuf + currentoutpos, chunk->out + chunk->outread,
+           (size_t) len);
+    memcpy(pvt->outbuforig + currentoutpos, chunk->outorig + chunk->outread,
+           (size_t) len);
+    currentoutpos += len;
+    chunk->outread += len;
+    if (pvt->descptr != NULL)
+      gt_sequence_buffer_fasta_chunk_descs(sb, chunk, chunk->outread);
+    if (currentoutpos < (GtUword) OUTBUFSIZE) {
+      /* the chunk is exhausted */
+      if (pvt->descptr != NULL)
+        gt_sequence_buffer_fasta_chunk_descs(sb, chunk, chunk->outlength + 1);
+      if (chunk->failed) {
+        gt_error_set(err, "illegal character '%c': file \"%s\", line "GT_LLU"",
+                     chunk->illegalchar,
+                     gt_str_array_get(pvt->filenametab, chunk->filenum),
+                     (GtUint64) chunk->errorline);
+        return -2;
+      }
+      gt_sequence_buffer_fasta_chunk_submit(sb, chunk);
+      sbf->currentchunk = (sbf->currentchunk + 1) % sbf->numofchunks;
+    }
+  }
+  pvt->nextfree = currentoutpos;
+  return 0;
+}
+
+static int gt_sequence_buffer_fasta_advance(GtSequenceBuffer *sb, GtError *err)
+{
+  GtSequenceBufferFasta *sbf = (GtSequenceBufferFasta*) sb;
+  gt_error_check(err);
+  if (sbf->parallel && !sbf->started &&
+      !gt_sequence_buffer_fasta_chunks_start(sb)) {
+    sbf->parallel = false;
+  }
+  if (sbf->parallel)
+    return gt_sequence_buffer_fasta_advance_parallel(sb, err);
+  return gt_sequence_buffer_fasta_advance_sequential(sb, err);
+}
+
 static void gt_sequence_buffer_fasta_free(GtSequenceBuffer *sb)
 {
   GtSequenceBufferFasta *sbf = gt_sequence_buffer_fasta_cast(sb);
+  gt_sequence_buffer_fasta_chunks_delete(sbf);
   gt_file_delete(sb->pvt->inputstream);
   gt_str_delete(sbf->headerbuffer);
 }
@@ -213,5 +664,6 @@ GtSequenceBuffer* gt_sequence_buffer_fasta_new(const GtStrArray *sequences)
   sb->pvt->nextread = sb->pvt->nextfree = 0;
   sb->pvt->complete = false;
   sb->pvt->lastspeciallength = 0;
+  sbf->parallel = gt_jobs > 1;
   return sb;
 }
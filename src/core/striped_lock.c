@@ -0,0 +1,64 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/assert_api.h"
+#include "core/striped_lock.h"
+#include "core/thread_api.h"
+#include "core/types_api.h"
+
+/* must be a power of two */
+#define GT_STRIPED_LOCK_NUM 64UL
+
+static GtMutex *gt_striped_locks[GT_STRIPED_LOCK_NUM] = { NULL };
+
+void gt_striped_lock_init(void)
+{
+  GtUword i;
+  for (i = 0; i < GT_STRIPED_LOCK_NUM; i++)
+    gt_striped_locks[i] = gt_mutex_new();
+}
+
+void gt_striped_lock_clean(void)
+{
+  GtUword i;
+  for (i = 0; i < GT_STRIPED_LOCK_NUM; i++) {
+    gt_mutex_delete(gt_striped_locks[i]);
+    gt_striped_locks[i] = NULL;
+  }
+}
+
+#ifdef GT_THREADS_ENABLED
+/* objects are at least word aligned, so the lowest address bits are dropped
+   before mixing the remaining ones */
+static GtMutex* gt_striped_lock_get(const void *ptr)
+{
+  GtUword hash = (GtUword) ptr >> 4;
+  hash ^= hash >> 7;
+  hash ^= hash >> 13;
+  gt_assert(gt_striped_locks[hash & (GT_STRIPED_LOCK_NUM - 1)]);
+  return gt_striped_locks[hash & (GT_STRIPED_LOCK_NUM - 1)];
+}
+
+void gt_striped_lock_enter_func(const void *ptr)
+{
+  gt_mutex_lock(gt_striped_lock_get(ptr));
+}
+
+void gt_striped_lock_leave_func(const void *ptr)
+{
+  gt_mutex_unlock(gt_striped_lock_get(ptr));
+}
+#endif
@@ -0,0 +1,52 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef STRIPED_LOCK_H
+#define STRIPED_LOCK_H
+
+/* The striped lock is a fixed table of mutexes shared by many small objects.
+   The mutex protecting an object is selected by hashing its address, so
+   objects do not have to carry a lock of their own. Two objects may share a
+   mutex, therefore at most one striped lock may be held at a time. */
+
+/* Initializes the table of striped locks. */
+void    gt_striped_lock_init(void);
+/* Cleans static resources required for the striped locks. */
+void    gt_striped_lock_clean(void);
+
+/* Marks the beginning of a critical section protecting the object at address
+   <PTR>. */
+#ifdef GT_THREADS_ENABLED
+#define gt_striped_lock_enter(PTR) \
+        gt_striped_lock_enter_func(PTR)
+void    gt_striped_lock_enter_func(const void *ptr);
+#else
+#define gt_striped_lock_enter(PTR) \
+        ((void) 0)
+#endif
+
+/* Marks the end of a critical section protecting the object at address
+   <PTR>. */
+#ifdef GT_THREADS_ENABLED
+#define gt_striped_lock_leave(PTR) \
+        gt_striped_lock_leave_func(PTR)
+void    gt_striped_lock_leave_func(const void *ptr);
+#else
+#define gt_striped_lock_leave(PTR) \
+        ((void) 0)
+#endif
+
+#endif
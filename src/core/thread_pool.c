@@ -0,0 +1,714 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "core/ensure_api.h"
+#include "core/ma_api.h"
+#include "core/minmax_api.h"
+#include "core/thread_api.h"
+#include "core/thread_pool.h"
+#include "core/unused_api.h"
+
+struct GtThreadPoolScratch {
+  unsigned int numofslots,
+               numofextra;
+  size_t size;
+  void *space,
+       **extra; /* slots of the threads not belonging to the pool, which
+                   are allocated on demand */
+  GtMutex *mutex; /* protects <extra> and <numofextra> */
+};
+
+typedef struct {
+  GtUword start, end;
+  GtThreadPoolRangeFunc func;
+  void *data;
+} GtThreadPoolRange;
+
+static void gt_thread_pool_range_func(void *data)
+{
+  GtThreadPoolRange *range = data;
+  range->func(range->start, range->end, range->data);
+}
+
+#ifdef GT_THREADS_ENABLED
+
+#include <pthread.h>
+
+typedef struct {
+  GtThreadPoolFunc func;
+  void *data;
+  GtThreadPoolGroup *group;
+} GtThreadPoolTask;
+
+/* a double ended queue of tasks, implemented as a ring buffer; the owner
+   pushes and pops at the back, thieves take from the front */
+typedef struct {
+  pthread_mutex_t mutex;
+  GtThreadPoolTask *space;
+  GtUword front, numofentries, allocated;
+} GtThreadPoolDeque;
+
+typedef struct {
+  unsigned int numofworkers;
+  GtThreadPoolDeque *deques;
+  GtThread **threads;
+  pthread_mutex_t sleep_mutex;
+  pthread_cond_t sleep_cond;
+  GtUword numofqueued; /* protected by <sleep_mutex> */
+  bool shutdown;
+} GtThreadPool;
+
+struct GtThreadPoolGroup {
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  GtUword unfinished;
+};
+
+static GtThreadPool *pool = NULL;
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+/* the number of the calling worker plus one, NULL if none is assigned yet */
+static pthread_key_t worker_key;
+static pthread_once_t worker_key_once = PTHREAD_ONCE_INIT;
+/* <external_used[i]> is true if number <numofworkers>+<i> is assigned to a
+   thread not belonging to the pool, protected by <pool_mutex> */
+static bool *external_used = NULL;
+static unsigned int numofexternal = 0;
+
+static GtThreadPool* gt_thread_pool_get(void);
+
+static void gt_thread_pool_worker_id_set(unsigned int worker_id)
+{
+  pthread_setspecific(worker_key, (void *) (uintptr_t) (worker_id + 1));
+}
+
+/* Called when a thread not belonging to the pool exits, releasing its
+   number for the next such thread. */
+static void gt_thread_pool_worker_id_release(void *value)
+{
+  unsigned int worker_id = (unsigned int) ((uintptr_t) value - 1);
+  pthread_mutex_lock(&pool_mutex);
+  if (pool != NULL && worker_id >= pool->numofworkers &&
+      worker_id - pool->numofworkers < numofexternal) {
+    external_used[worker_id - pool->numofworkers] = false;
+  }
+  pthread_mutex_unlock(&pool_mutex);
+}
+
+static void gt_thread_pool_worker_key_init(void)
+{
+  GT_UNUSED int rval;
+  rval = pthread_key_create(&worker_key, gt_thread_pool_worker_id_release);
+  gt_assert(!rval);
+}
+
+/* Assign the smallest free number beyond the workers of the pool to the
+   calling thread, which does not belong to the pool and is not worker 0. */
+static unsigned int gt_thread_pool_worker_id_assign(GtThreadPool *tp)
+{
+  unsigned int idx;
+
+  pthread_mutex_lock(&pool_mutex);
+  for (idx = 0; idx < numofexternal && external_used[idx]; idx++)
+    /* Nothing */;
+  if (idx == numofexternal) {
+    external_used = gt_realloc(external_used,
+                               sizeof *external_used * (numofexternal + 1));
+    numofexternal++;
+  }
+  external_used[idx] = true;
+  pthread_mutex_unlock(&pool_mutex);
+  gt_thread_pool_worker_id_set(tp->numofworkers + idx);
+  return tp->numofworkers + idx;
+}
+
+unsigned int gt_thread_pool_worker_id(void)
+{
+  void *value;
+  (void) pthread_once(&worker_key_once, gt_thread_pool_worker_key_init);
+  value = pthread_getspecific(worker_key);
+  if (value == NULL) {
+    /* creating the pool makes the calling thread worker 0 */
+    GtThreadPool *tp = gt_thread_pool_get();
+    value = pthread_getspecific(worker_key);
+    if (value == NULL)
+      return gt_thread_pool_worker_id_assign(tp);
+  }
+  return (unsigned int) ((uintptr_t) value - 1);
+}
+
+static void gt_thread_pool_deque_push(GtThreadPoolDeque *deque,
+                                      const GtThreadPoolTask *task)
+{
+  pthread_mutex_lock(&deque->mutex);
+  if (deque->numofentries == deque->allocated) {
+    GtUword idx, newallocated = deque->allocated * 2 + 16;
+    GtThreadPoolTask *newspace = gt_malloc(sizeof *newspace * newallocated);
+    for (idx = 0; idx < deque->numofentries; idx++) {
+      newspace[idx] = deque->space[(deque->front + idx) % deque->allocated];
+    }
+    gt_free(deque->space);
+    deque->space = newspace;
+    deque->front = 0;
+    deque->allocated = newallocated;
+  }
+  deque->space[(deque->front + deque->numofentries) % deque->allocated]
+    = *task;
+  deque->numofentries++;
+  pthread_mutex_unlock(&deque->mutex);
+}
+
+static bool gt_thread_pool_deque_pop_back(GtThreadPoolDeque *deque,
+                                          GtThreadPoolTask *task)
+{
+  bool found = false;
+  pthread_mutex_lock(&deque->mutex);
+  if (deque->numofentries > 0) {
+    deque->numofentries--;
+    *task = deque->space[(deque->front + deque->numofentries)
+                         % deque->allocated];
+    found = true;
+  }
+  pthread_mutex_unlock(&deque->mutex);
+  return found;
+}
+
+static bool gt_thread_pool_deque_pop_front(GtThreadPoolDeque *deque,
+                                           GtThreadPoolTask *task)
+{
+  bool found = false;
+  pthread_mutex_lock(&deque->mutex);
+  if (deque->numofentries > 0) {
+    *task = deque->space[deque->front];
+    deque->front = (deque->front + 1) % deque->allocated;
+    deque->numofentries--;
+    found = true;
+  }
+  pthread_mutex_unlock(&deque->mutex);
+  return found;
+}
+
+/* take a task from the own deque, or steal one from the other workers,
+   starting with the right neighbour to spread the thieves */
+static bool gt_thread_pool_take(GtThreadPool *tp, unsigned int worker_id,
+                                GtThreadPoolTask *task)
+{
+  unsigned int idx;
+  bool found = gt_thread_pool_deque_pop_back(tp->deques + worker_id, task);
+
+  for (idx = 1; !found && idx < tp->numofworkers; idx++) {
+    found = gt_thread_pool_deque_pop_front(tp->deques +
+                                           (worker_id + idx) % tp->numofworkers,
+                                           task);
+  }
+  if (found) {
+    pthread_mutex_lock(&tp->sleep_mutex);
+    gt_assert(tp->numofqueued > 0);
+    tp->numofqueued--;
+    pthread_mutex_unlock(&tp->sleep_mutex);
+  }
+  return found;
+}
+
+static void gt_thread_pool_run(GtThreadPoolTask *task)
+{
+  GtThreadPoolGroup *group = task->group;
+  task->func(task->data);
+  pthread_mutex_lock(&group->mutex);
+  gt_assert(group->unfinished > 0);
+  if (--group->unfinished == 0) {
+    pthread_cond_broadcast(&group->cond);
+  }
+  pthread_mutex_unlock(&group->mutex);
+}
+
+static void* gt_thread_pool_worker(void *data)
+{
+  unsigned int worker_id = (unsigned int) (uintptr_t) data;
+  GtThreadPool *tp = pool;
+  GtThreadPoolTask task;
+
+  gt_thread_pool_worker_id_set(worker_id);
+  while (true) {
+    if (gt_thread_pool_take(tp, worker_id, &task)) {
+      gt_thread_pool_run(&task);
+    } else {
+      pthread_mutex_lock(&tp->sleep_mutex);
+      while (tp->numofqueued == 0 && !tp->shutdown) {
+        pthread_cond_wait(&tp->sleep_cond, &tp->sleep_mutex);
+      }
+      if (tp->shutdown && tp->numofqueued == 0) {
+        pthread_mutex_unlock(&tp->sleep_mutex);
+        break;
+      }
+      pthread_mutex_unlock(&tp->sleep_mutex);
+    }
+  }
+  /* the number of a pool thread is not released on exit */
+  pthread_setspecific(worker_key, NULL);
+  return NULL;
+}
+
+static void gt_thread_pool_delete(GtThreadPool *tp)
+{
+  unsigned int idx;
+
+  if (tp == NULL)
+    return;
+  pthread_mutex_lock(&tp->sleep_mutex);
+  tp->shutdown = true;
+  pthread_cond_broadcast(&tp->sleep_cond);
+  pthread_mutex_unlock(&tp->sleep_mutex);
+  for (idx = 1; idx < tp->numofworkers; idx++) {
+    if (tp->threads[idx] != NULL) {
+      gt_thread_join(tp->threads[idx]);
+      gt_thread_delete(tp->threads[idx]);
+    }
+  }
+  for (idx = 0; idx < tp->numofworkers; idx++) {
+    gt_assert(tp->deques[idx].numofentries == 0);
+    pthread_mutex_destroy(&tp->deques[idx].mutex);
+    gt_free(tp->deques[idx].space);
+  }
+  pthread_cond_destroy(&tp->sleep_cond);
+  pthread_mutex_destroy(&tp->sleep_mutex);
+  gt_free(tp->deques);
+  gt_free(tp->threads);
+  gt_free(tp);
+}
+
+static GtThreadPool* gt_thread_pool_new(unsigned int numofworkers)
+{
+  GtThreadPool *tp = gt_malloc(sizeof *tp);
+  unsigned int idx;
+
+  gt_assert(numofworkers > 0);
+  tp->numofworkers = numofworkers;
+  tp->deques = gt_calloc((size_t) numofworkers, sizeof *tp->deques);
+  tp->threads = gt_calloc((size_t) numofworkers, sizeof *tp->threads);
+  for (idx = 0; idx < numofworkers; idx++) {
+    pthread_mutex_init(&tp->deques[idx].mutex, NULL);
+  }
+  pthread_mutex_init(&tp->sleep_mutex, NULL);
+  pthread_cond_init(&tp->sleep_cond, NULL);
+  tp->numofqueued = 0;
+  tp->shutdown = false;
+  return tp;
+}
+
+static void gt_thread_pool_start(GtThreadPool *tp)
+{
+  unsigned int idx;
+  GtError *err = gt_error_new();
+
+  for (idx = 1; idx < tp->numofworkers; idx++) {
+    tp->threads[idx] = gt_thread_new(gt_thread_pool_worker,
+                                     (void *) (uintptr_t) idx, err);
+    if (tp->threads[idx] == NULL) {
+      /* the remaining workers are not started, their deques stay empty
+         and are never pushed onto, so the pool just gets smaller */
+      gt_error_unset(err);
+      break;
+    }
+  }
+  gt_error_delete(err);
+}
+
+/* Return the pool, creating it on first use with <gt_jobs> workers. The
+   pool keeps its size until <gt_thread_pool_clean()>, as the number of
+   workers determines the size of the scratch objects in use. The thread
+   creating the pool becomes worker 0. */
+static GtThreadPool* gt_thread_pool_get(void)
+{
+  (void) pthread_once(&worker_key_once, gt_thread_pool_worker_key_init);
+  pthread_mutex_lock(&pool_mutex);
+  if (pool == NULL) {
+    pool = gt_thread_pool_new(GT_MAX(gt_jobs, 1U));
+    gt_thread_pool_start(pool);
+    if (pthread_getspecific(worker_key) == NULL)
+      gt_thread_pool_worker_id_set(0);
+  }
+  pthread_mutex_unlock(&pool_mutex);
+  return pool;
+}
+
+GtThreadPoolGroup* gt_thread_pool_group_new(void)
+{
+  GtThreadPoolGroup *group = gt_malloc(sizeof *group);
+  pthread_mutex_init(&group->mutex, NULL);
+  pthread_cond_init(&group->cond, NULL);
+  group->unfinished = 0;
+  return group;
+}
+
+void gt_thread_pool_group_submit(GtThreadPoolGroup *group,
+                                 GtThreadPoolFunc func, void *data)
+{
+  GtThreadPool *tp = gt_thread_pool_get();
+  GtThreadPoolTask task;
+  unsigned int worker_id = gt_thread_pool_worker_id();
+
+  gt_assert(group != NULL && func != NULL);
+  if (worker_id >= tp->numofworkers) {
+    worker_id = 0;
+  }
+  task.func = func;
+  task.data = data;
+  task.group = group;
+  pthread_mutex_lock(&group->mutex);
+  group->unfinished++;
+  pthread_mutex_unlock(&group->mutex);
+  /* count the task before it becomes visible, so that a thief taking it
+     never sees a counter of zero */
+  pthread_mutex_lock(&tp->sleep_mutex);
+  tp->numofqueued++;
+  pthread_mutex_unlock(&tp->sleep_mutex);
+  gt_thread_pool_deque_push(tp->deques + worker_id, &task);
+  pthread_mutex_lock(&tp->sleep_mutex);
+  pthread_cond_signal(&tp->sleep_cond);
+  pthread_mutex_unlock(&tp->sleep_mutex);
+}
+
+void gt_thread_pool_group_wait(GtThreadPoolGroup *group)
+{
+  GtThreadPool *tp = gt_thread_pool_get();
+  GtThreadPoolTask task;
+  unsigned int worker_id = gt_thread_pool_worker_id();
+
+  gt_assert(group != NULL);
+  if (worker_id >= tp->numofworkers) {
+    worker_id = 0;
+  }
+  while (true) {
+    pthread_mutex_lock(&group->mutex);
+    if (group->unfinished == 0) {
+      pthread_mutex_unlock(&group->mutex);
+      break;
+    }
+    pthread_mutex_unlock(&group->mutex);
+    if (gt_thread_pool_take(tp, worker_id, &task)) {
+      gt_thread_pool_run(&task);
+    } else {
+      /* all remaining tasks of the group are being executed, so there is
+         nothing to help with */
+      pthread_mutex_lock(&group->mutex);
+      if (group->unfinished > 0) {
+        pthread_cond_wait(&group->cond, &group->mutex);
+      }
+      pthread_mutex_unlock(&group->mutex);
+    }
+  }
+}
+
+void gt_thread_pool_group_delete(GtThreadPoolGroup *group)
+{
+  if (group == NULL)
+    return;
+  gt_assert(group->unfinished == 0);
+  pthread_cond_destroy(&group->cond);
+  pthread_mutex_destroy(&group->mutex);
+  gt_free(group);
+}
+
+unsigned int gt_thread_pool_num_of_workers(void)
+{
+  return gt_thread_pool_get()->numofworkers;
+}
+
+void gt_thread_pool_clean(void)
+{
+  pthread_mutex_lock(&pool_mutex);
+  gt_thread_pool_delete(pool);
+  pool = NULL;
+  gt_free(external_used);
+  external_used = NULL;
+  numofexternal = 0;
+  pthread_mutex_unlock(&pool_mutex);
+  (void) pthread_once(&worker_key_once, gt_thread_pool_worker_key_init);
+  pthread_setspecific(worker_key, NULL);
+}
+
+#else
+
+struct GtThreadPoolGroup {
+  GtUword unfinished;
+};
+
+unsigned int gt_thread_pool_worker_id(void)
+{
+  return 0;
+}
+
+GtThreadPoolGroup* gt_thread_pool_group_new(void)
+{
+  GtThreadPoolGroup *group = gt_malloc(sizeof *group);
+  group->unfinished = 0;
+  return group;
+}
+
+void gt_thread_pool_group_submit(GT_UNUSED GtThreadPoolGroup *group,
+                                 GtThreadPoolFunc func, void *data)
+{
+  gt_assert(group != NULL && func != NULL);
+  func(data);
+}
+
+void gt_thread_pool_group_wait(GT_UNUSED GtThreadPoolGroup *group)
+{
+  gt_assert(group != NULL);
+}
+
+void gt_thread_pool_group_delete(GtThreadPoolGroup *group)
+{
+  gt_free(group);
+}
+
+unsigned int gt_thread_pool_num_of_workers(void)
+{
+  return 1U;
+}
+
+void gt_thread_pool_clean(void)
+{
+  return;
+}
+
+#endif
+
+void gt_thread_pool_parallel_for(GtUword start, GtUword end,
+                                 GtUword grainsize,
+                                 GtThreadPoolRangeFunc func, void *data)
+{
+  GtThreadPoolGroup *group;
+  GtThreadPoolRange *ranges;
+  GtUword idx, numofranges;
+
+  gt_assert(func != NULL);
+  if (start >= end)
+    return;
+  if (grainsize == 0) {
+    /* a few chunks per worker leave room for stealing */
+    GtUword numofchunks = 4UL * (GtUword) gt_thread_pool_num_of_workers();
+    grainsize = GT_MAX(1UL, (end - start + numofchunks - 1) / numofchunks);
+  }
+  numofranges = (end - start + grainsize - 1) / grainsize;
+  if (numofranges == 1UL) {
+    func(start, end, data);
+    return;
+  }
+  ranges = gt_malloc(sizeof *ranges * numofranges);
+  group = gt_thread_pool_group_new();
+  for (idx = 0; idx < numofranges; idx++) {
+    ranges[idx].start = start + idx * grainsize;
+    ranges[idx].end = GT_MIN(end, ranges[idx].start + grainsize);
+    ranges[idx].func = func;
+    ranges[idx].data = data;
+    gt_thread_pool_group_submit(group, gt_thread_pool_range_func,
+                                ranges + idx);
+  }
+  gt_thread_pool_group_wait(group);
+  gt_thread_pool_group_delete(group);
+  gt_free(ranges);
+}
+
+GtThreadPoolScratch* gt_thread_pool_scratch_new(size_t size)
+{
+  GtThreadPoolScratch *scratch = gt_malloc(sizeof *scratch);
+  scratch->numofslots = gt_thread_pool_num_of_workers();
+  scratch->numofextra = 0;
+  scratch->size = size;
+  scratch->space = gt_calloc((size_t) scratch->numofslots, size);
+  scratch->extra = NULL;
+  scratch->mutex = gt_mutex_new();
+  return scratch;
+}
+
+void* gt_thread_pool_scratch_get_by_id(GtThreadPoolScratch *scratch,
+                                       unsigned int worker_id)
+{
+  void *slot;
+  unsigned int idx;
+
+  gt_assert(scratch != NULL);
+  if (worker_id < scratch->numofslots)
+    return (char *) scratch->space + scratch->size * worker_id;
+  idx = worker_id - scratch->numofslots;
+  gt_mutex_lock(scratch->mutex);
+  if (idx >= scratch->numofextra) {
+    scratch->extra = gt_realloc(scratch->extra,
+                                sizeof *scratch->extra * (idx + 1));
+    memset(scratch->extra + scratch->numofextra, 0,
+           sizeof *scratch->extra * (idx + 1 - scratch->numofextra));
+    scratch->numofextra = idx + 1;
+  }
+  if (scratch->extra[idx] == NULL)
+    scratch->extra[idx] = gt_calloc((size_t) 1, scratch->size);
+  slot = scratch->extra[idx];
+  gt_mutex_unlock(scratch->mutex);
+  return slot;
+}
+
+void* gt_thread_pool_scratch_get(GtThreadPoolScratch *scratch)
+{
+  return gt_thread_pool_scratch_get_by_id(scratch, gt_thread_pool_worker_id());
+}
+
+unsigned int gt_thread_pool_scratch_size(const GtThreadPoolScratch *scratch)
+{
+  unsigned int numofslots;
+  gt_assert(scratch != NULL);
+  gt_mutex_lock(scratch->mutex);
+  numofslots = scratch->numofslots + scratch->numofextra;
+  gt_mutex_unlock(scratch->mutex);
+  return numofslots;
+}
+
+void gt_thread_pool_scratch_delete(GtThreadPoolScratch *scratch)
+{
+  unsigned int idx;
+  if (scratch == NULL)
+    return;
+  for (idx = 0; idx < scratch->numofextra; idx++)
+    gt_free(scratch->extra[idx]);
+  gt_free(scratch->extra);
+  gt_mutex_delete(scratch->mutex);
+  gt_free(scratch->space);
+  gt_free(scratch);
+}
+
+#define GT_THREAD_POOL_TEST_SIZE 100000UL
+
+static void gt_thread_pool_test_sum(GtUword start, GtUword end, void *data)
+{
+  GtUword idx, *sum = gt_thread_pool_scratch_get(data);
+  for (idx = start; idx < end; idx++) {
+    *sum += idx;
+  }
+}
+
+typedef struct {
+  GtUword start, end, result;
+} GtThreadPoolTestNested;
+
+static void gt_thread_pool_test_nested(void *data)
+{
+  GtThreadPoolTestNested *nested = data;
+  GtThreadPoolScratch *scratch = gt_thread_pool_scratch_new(sizeof (GtUword));
+  unsigned int idx;
+
+  gt_thread_pool_parallel_for(nested->start, nested->end, 7UL,
+                              gt_thread_pool_test_sum, scratch);
+  nested->result = 0;
+  for (idx = 0; idx < gt_thread_pool_scratch_size(scratch); idx++) {
+    nested->result
+      += *(GtUword *) gt_thread_pool_scratch_get_by_id(scratch, idx);
+  }
+  gt_thread_pool_scratch_delete(scratch);
+}
+
+#ifdef GT_THREADS_ENABLED
+typedef struct {
+  GtThreadPoolScratch *scratch;
+  GtUword start, end;
+  unsigned int worker_id;
+} GtThreadPoolTestExternal;
+
+/* executed by a thread not belonging to the pool */
+static void* gt_thread_pool_test_external(void *data)
+{
+  GtThreadPoolTestExternal *external = data;
+  external->worker_id = gt_thread_pool_worker_id();
+  gt_thread_pool_parallel_for(external->start, external->end, 7UL,
+                              gt_thread_pool_test_sum, external->scratch);
+  return NULL;
+}
+#endif
+
+int gt_thread_pool_unit_test(GtError *err)
+{
+  GtThreadPoolScratch *scratch;
+  GtThreadPoolGroup *group;
+  GtThreadPoolTestNested nested[8];
+  GtUword idx, sum = 0;
+  int had_err = 0;
+
+  gt_error_check(err);
+  scratch = gt_thread_pool_scratch_new(sizeof (GtUword));
+  gt_thread_pool_parallel_for(0, GT_THREAD_POOL_TEST_SIZE, 0,
+                              gt_thread_pool_test_sum, scratch);
+  for (idx = 0; idx < gt_thread_pool_scratch_size(scratch); idx++) {
+    sum += *(GtUword *) gt_thread_pool_scratch_get_by_id(scratch,
+                                                         (unsigned int) idx);
+  }
+  gt_thread_pool_scratch_delete(scratch);
+  gt_ensure(sum == GT_THREAD_POOL_TEST_SIZE * (GT_THREAD_POOL_TEST_SIZE - 1)
+                   / 2);
+
+  if (!had_err) {
+    group = gt_thread_pool_group_new();
+    for (idx = 0; idx < 8UL; idx++) {
+      nested[idx].start = idx * 1000UL;
+      nested[idx].end = (idx + 1) * 1000UL;
+      gt_thread_pool_group_submit(group, gt_thread_pool_test_nested,
+                                  nested + idx);
+    }
+    gt_thread_pool_group_wait(group);
+    gt_thread_pool_group_delete(group);
+    for (idx = 0; !had_err && idx < 8UL; idx++) {
+      gt_ensure(nested[idx].result
+                == (nested[idx].start + nested[idx].end - 1) * 1000UL / 2);
+    }
+  }
+#ifdef GT_THREADS_ENABLED
+  /* threads not belonging to the pool use it at the same time and get
+     scratch slots of their own */
+  if (!had_err) {
+    GtThreadPoolTestExternal external[2];
+    GtThread *threads[2];
+
+    scratch = gt_thread_pool_scratch_new(sizeof (GtUword));
+    for (idx = 0; !had_err && idx < 2UL; idx++) {
+      external[idx].scratch = scratch;
+      external[idx].start = idx * GT_THREAD_POOL_TEST_SIZE;
+      external[idx].end = (idx + 1) * GT_THREAD_POOL_TEST_SIZE;
+      threads[idx] = gt_thread_new(gt_thread_pool_test_external,
+                                   external + idx, err);
+      if (threads[idx] == NULL)
+        had_err = -1;
+    }
+    while (idx-- > 0) {
+      if (threads[idx] != NULL) {
+        gt_thread_join(threads[idx]);
+        gt_thread_delete(threads[idx]);
+      }
+    }
+    if (!had_err) {
+      gt_ensure(external[0].worker_id >= gt_thread_pool_num_of_workers());
+      gt_ensure(external[1].worker_id >= gt_thread_pool_num_of_workers());
+    }
+    sum = 0;
+    for (idx = 0; idx < gt_thread_pool_scratch_size(scratch); idx++) {
+      sum += *(GtUword *) gt_thread_pool_scratch_get_by_id(scratch,
+                                                           (unsigned int) idx);
+    }
+    gt_thread_pool_scratch_delete(scratch);
+    gt_ensure(sum == 2 * GT_THREAD_POOL_TEST_SIZE
+                     * (2 * GT_THREAD_POOL_TEST_SIZE - 1) / 2);
+  }
+#endif
+  return had_err;
+}
@@ -0,0 +1,112 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stddef.h>
+#include "core/error_api.h"
+#include "core/types_api.h"
+
+/* The thread pool module maintains a single, process-wide set of worker
+   threads. The pool is created lazily on first use with <gt_jobs> workers
+   and keeps this size until <gt_thread_pool_clean()> is called. Worker 0 is
+   the thread which created the pool (usually the main thread) and workers
+   1 to <gt_jobs>-1 are pool threads. Other threads using the pool get
+   numbers of their own beyond the workers, so that they can use the pool
+   at the same time as worker 0. Each worker owns a deque of
+   tasks: new tasks are pushed onto the deque of the submitting worker, a
+   worker takes tasks from the back of its own deque and, when it runs out
+   of work, steals from the front of the deques of the other workers.
+   Waiting for a group executes pending tasks, so groups may be nested.
+   If threads are disabled, all tasks are executed sequentially upon
+   submission. */
+
+/* A task to be executed by the pool. */
+typedef void (*GtThreadPoolFunc)(void *data);
+
+/* A function processing the index range from <start> to <end>-1. */
+typedef void (*GtThreadPoolRangeFunc)(GtUword start, GtUword end, void *data);
+
+/* A set of tasks which can be waited for collectively. */
+typedef struct GtThreadPoolGroup GtThreadPoolGroup;
+
+/* Storage of equal size for each worker of the pool. */
+typedef struct GtThreadPoolScratch GtThreadPoolScratch;
+
+/* Return a new, empty task group. */
+GtThreadPoolGroup*   gt_thread_pool_group_new(void);
+
+/* Schedule <func> to be called with <data> as part of <group>. */
+void                 gt_thread_pool_group_submit(GtThreadPoolGroup *group,
+                                                 GtThreadPoolFunc func,
+                                                 void *data);
+
+/* Return when all tasks submitted to <group> are finished. The calling
+   thread executes pending tasks while waiting. */
+void                 gt_thread_pool_group_wait(GtThreadPoolGroup *group);
+
+/* Delete <group>, which must not have unfinished tasks. */
+void                 gt_thread_pool_group_delete(GtThreadPoolGroup *group);
+
+/* Split the index range from <start> to <end>-1 into chunks of <grainsize>
+   many indices (a suitable size is chosen if <grainsize> is 0) and call
+   <func> for each chunk in parallel. Returns when all chunks are
+   processed. */
+void                 gt_thread_pool_parallel_for(GtUword start, GtUword end,
+                                                 GtUword grainsize,
+                                                 GtThreadPoolRangeFunc func,
+                                                 void *data);
+
+/* Return the number of workers of the pool, i.e. <gt_jobs> at the time the
+   pool was created. */
+unsigned int         gt_thread_pool_num_of_workers(void);
+
+/* Return the number of the calling worker, a value in the range from 0 to
+   <gt_thread_pool_num_of_workers()>-1. Threads not belonging to the pool,
+   except worker 0, get the smallest number not below
+   <gt_thread_pool_num_of_workers()> which is not in use by another such
+   thread. The number is released when the thread exits. */
+unsigned int         gt_thread_pool_worker_id(void);
+
+/* Return a new object holding <size> bytes of zeroed memory for each worker
+   of the pool. */
+GtThreadPoolScratch* gt_thread_pool_scratch_new(size_t size);
+
+/* Return the memory of <scratch> belonging to the calling worker. */
+void*                gt_thread_pool_scratch_get(GtThreadPoolScratch *scratch);
+
+/* Return the memory of <scratch> belonging to worker <worker_id>, for
+   instance to combine the results of all workers after a parallel run. */
+void*                gt_thread_pool_scratch_get_by_id(GtThreadPoolScratch
+                                                        *scratch,
+                                                      unsigned int worker_id);
+
+/* Return the number of slots in <scratch>, including the slots of threads
+   not belonging to the pool, which are allocated on first use. */
+unsigned int         gt_thread_pool_scratch_size(const GtThreadPoolScratch
+                                                   *scratch);
+
+void                 gt_thread_pool_scratch_delete(GtThreadPoolScratch
+                                                     *scratch);
+
+/* Terminate the pool threads and free the pool. Called by
+   <gt_lib_clean()>. */
+void                 gt_thread_pool_clean(void);
+
+int                  gt_thread_pool_unit_test(GtError *err);
+
+#endif
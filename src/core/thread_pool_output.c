@@ -0,0 +1,170 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/assert_api.h"
+#include "core/ensure_api.h"
+#include "core/fa_api.h"
+#include "core/ma_api.h"
+#include "core/minmax_api.h"
+#include "core/thread_pool.h"
+#include "core/thread_pool_output.h"
+#include "core/unused_api.h"
+#include "core/xansi_api.h"
+
+struct GtThreadPoolOutput {
+  FILE **streams;
+  GtUword numofchunks;
+};
+
+typedef struct {
+  GtThreadPoolOutput *tpo;
+  GtThreadPoolOutputFunc func;
+  void *data;
+  GtUword start, grainsize;
+} GtThreadPoolOutputInfo;
+
+GtThreadPoolOutput* gt_thread_pool_output_new(unsigned int chunksperworker)
+{
+  GtThreadPoolOutput *tpo = gt_malloc(sizeof *tpo);
+  GtUword chunk;
+
+  gt_assert(chunksperworker > 0);
+  tpo->numofchunks = (GtUword) chunksperworker *
+                     (GtUword) gt_thread_pool_num_of_workers();
+  tpo->streams = gt_malloc(sizeof *tpo->streams * tpo->numofchunks);
+  for (chunk = 0; chunk < tpo->numofchunks; chunk++) {
+    tpo->streams[chunk]
+      = gt_xtmpfp_generic(NULL, GT_TMPFP_OPENBINARY | GT_TMPFP_AUTOREMOVE);
+  }
+  return tpo;
+}
+
+GtUword gt_thread_pool_output_num_of_chunks(const GtThreadPoolOutput *tpo)
+{
+  gt_assert(tpo != NULL);
+  return tpo->numofchunks;
+}
+
+FILE* gt_thread_pool_output_stream(GtThreadPoolOutput *tpo, GtUword chunk)
+{
+  gt_assert(tpo != NULL && chunk < tpo->numofchunks);
+  return tpo->streams[chunk];
+}
+
+void gt_thread_pool_output_flush(GtThreadPoolOutput *tpo, GtUword numofchunks,
+                                 FILE *outfp)
+{
+  char buffer[BUFSIZ];
+  GtUword chunk;
+
+  gt_assert(tpo != NULL && numofchunks <= tpo->numofchunks);
+  for (chunk = 0; chunk < numofchunks; chunk++) {
+    FILE *stream = tpo->streams[chunk];
+    /* only the content written since the last rewind is copied */
+    size_t remaining = (size_t) ftell(stream);
+
+    rewind(stream);
+    while (remaining > 0) {
+      size_t len = gt_xfread(buffer, sizeof *buffer,
+                             GT_MIN(remaining, sizeof buffer), stream);
+      gt_xfwrite(buffer, sizeof *buffer, len, outfp);
+      remaining -= len;
+    }
+    rewind(stream);
+  }
+}
+
+static void gt_thread_pool_output_range(GtUword start, GtUword end,
+                                        void *data)
+{
+  GtThreadPoolOutputInfo *info = data;
+  GtUword chunk = (start - info->start) / info->grainsize;
+
+  gt_assert((start - info->start) % info->grainsize == 0);
+  info->func(start, end, gt_thread_pool_output_stream(info->tpo, chunk),
+             info->data);
+}
+
+void gt_thread_pool_output_parallel_for(GtThreadPoolOutput *tpo,
+                                        GtUword start, GtUword end,
+                                        GtThreadPoolOutputFunc func,
+                                        void *data, FILE *outfp)
+{
+  GtThreadPoolOutputInfo info;
+
+  gt_assert(tpo != NULL && func != NULL);
+  if (start >= end)
+    return;
+  info.tpo = tpo;
+  info.func = func;
+  info.data = data;
+  info.start = start;
+  info.grainsize = (end - start + tpo->numofchunks - 1) / tpo->numofchunks;
+  gt_thread_pool_parallel_for(start, end, info.grainsize,
+                              gt_thread_pool_output_range, &info);
+  gt_thread_pool_output_flush(tpo,
+                              (end - start + info.grainsize - 1) /
+                              info.grainsize, outfp);
+}
+
+void gt_thread_pool_output_delete(GtThreadPoolOutput *tpo)
+{
+  GtUword chunk;
+
+  if (tpo == NULL)
+    return;
+  for (chunk = 0; chunk < tpo->numofchunks; chunk++)
+    gt_fa_xfclose(tpo->streams[chunk]);
+  gt_free(tpo->streams);
+  gt_free(tpo);
+}
+
+static void gt_thread_pool_output_test_func(GtUword start, GtUword end,
+                                            FILE *outfp, GT_UNUSED void *data)
+{
+  GtUword idx;
+
+  for (idx = start; idx < end; idx++)
+    fprintf(outfp, GT_WU "\n", idx);
+}
+
+int gt_thread_pool_output_unit_test(GtError *err)
+{
+  const GtUword ends[] = {1UL, 3UL, 100UL, 10000UL};
+  GtThreadPoolOutput *tpo;
+  GtUword idx, run, value;
+  int had_err = 0;
+
+  gt_error_check(err);
+  tpo = gt_thread_pool_output_new(4U);
+  /* the temporary files are reused by consecutive runs */
+  for (run = 0; !had_err && run < sizeof ends / sizeof ends[0]; run++) {
+    FILE *outfp = gt_xtmpfp_generic(NULL, GT_TMPFP_AUTOREMOVE);
+
+    gt_thread_pool_output_parallel_for(tpo, 0, ends[run],
+                                       gt_thread_pool_output_test_func, NULL,
+                                       outfp);
+    rewind(outfp);
+    for (idx = 0; !had_err && idx < ends[run]; idx++) {
+      gt_ensure(fscanf(outfp, GT_WU, &value) == 1);
+      gt_ensure(value == idx);
+    }
+    gt_ensure(fscanf(outfp, GT_WU, &value) == EOF);
+    gt_fa_xfclose(outfp);
+  }
+  gt_thread_pool_output_delete(tpo);
+  return had_err;
+}
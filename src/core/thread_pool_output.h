@@ -0,0 +1,72 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef THREAD_POOL_OUTPUT_H
+#define THREAD_POOL_OUTPUT_H
+
+#include <stdio.h>
+#include "core/error_api.h"
+#include "core/types_api.h"
+
+/* A set of temporary files, one per chunk of a parallel computation, which
+   makes the output of the chunks appear in the order of the chunks, i.e.
+   in the same order as in a sequential computation. */
+typedef struct GtThreadPoolOutput GtThreadPoolOutput;
+
+/* A function processing the index range from <start> to <end>-1 and
+   writing its output to <outfp>. */
+typedef void (*GtThreadPoolOutputFunc)(GtUword start, GtUword end,
+                                       FILE *outfp, void *data);
+
+/* Return a new object with <chunksperworker> temporary files per worker of
+   the pool. A few chunks per worker leave room for work stealing. */
+GtThreadPoolOutput* gt_thread_pool_output_new(unsigned int chunksperworker);
+
+/* Return the number of chunks, i.e. of temporary files, of <tpo>. */
+GtUword             gt_thread_pool_output_num_of_chunks(const
+                                                        GtThreadPoolOutput
+                                                          *tpo);
+
+/* Return the temporary file of chunk <chunk>. */
+FILE*               gt_thread_pool_output_stream(GtThreadPoolOutput *tpo,
+                                                 GtUword chunk);
+
+/* Copy the output written to the temporary files of the first <numofchunks>
+   chunks to <outfp> in the order of the chunks. The temporary files are
+   rewound, so that they can be reused. */
+void                gt_thread_pool_output_flush(GtThreadPoolOutput *tpo,
+                                                GtUword numofchunks,
+                                                FILE *outfp);
+
+/* Split the index range from <start> to <end>-1 into at most
+   <gt_thread_pool_output_num_of_chunks()> chunks and call <func> for each
+   chunk in parallel, with the temporary file of the chunk as output. When
+   all chunks are processed, their output is copied to <outfp> in the order
+   of the chunks. */
+void                gt_thread_pool_output_parallel_for(GtThreadPoolOutput
+                                                         *tpo,
+                                                       GtUword start,
+                                                       GtUword end,
+                                                       GtThreadPoolOutputFunc
+                                                         func,
+                                                       void *data,
+                                                       FILE *outfp);
+
+void                gt_thread_pool_output_delete(GtThreadPoolOutput *tpo);
+
+int                 gt_thread_pool_output_unit_test(GtError *err);
+
+#endif
@@ -93,6 +93,97 @@ static const GtFeatureIndexClass* feature_index_gfflike_class(void);
 #define feature_index_gfflike_cast(V)\
         gt_feature_index_cast(feature_index_gfflike_class(), V)
 
+/* Features are assigned to the smallest bin of a UCSC-style hierarchy which
+   contains their range. The finest level has bins of 2^17 positions, each
+   coarser level has bins eight times larger. Features which fit into none of
+   them are put into bin 0. A range query only needs to look at bin 0 and one
+   run of consecutive bins per level. */
+#define GT_ANNO_DB_BIN_FIRSTSHIFT 17
+#define GT_ANNO_DB_BIN_NEXTSHIFT  3
+#define GT_ANNO_DB_BIN_LEVELS     5
+
+static const GtUword anno_db_gfflike_bin_offsets[GT_ANNO_DB_BIN_LEVELS]
+  = {4681UL, 585UL, 73UL, 9UL, 1UL};
+
+static GtUword anno_db_gfflike_bin(GtUword start, GtUword end)
+{
+  GtUword startbin = start >> GT_ANNO_DB_BIN_FIRSTSHIFT,
+          endbin = end >> GT_ANNO_DB_BIN_FIRSTSHIFT;
+  unsigned int level;
+
+  for (level = 0; level < GT_ANNO_DB_BIN_LEVELS; level++) {
+    if (startbin == endbin)
+      return anno_db_gfflike_bin_offsets[level] + startbin;
+    startbin >>= GT_ANNO_DB_BIN_NEXTSHIFT;
+    endbin >>= GT_ANNO_DB_BIN_NEXTSHIFT;
+  }
+  return 0;
+}
+
+/* binds the first and last bin of each level overlapping <rng> to the
+   parameters of <stmt>, starting at parameter <idx> */
+static void anno_db_gfflike_bind_bins(GtRDBStmt *stmt, unsigned int idx,
+                                      const GtRange *rng, GtError *err)
+{
+  GtUword startbin = rng->start >> GT_ANNO_DB_BIN_FIRSTSHIFT,
+          endbin = rng->end >> GT_ANNO_DB_BIN_FIRSTSHIFT;
+  unsigned int level;
+
+  for (level = 0; level < GT_ANNO_DB_BIN_LEVELS; level++) {
+    gt_rdb_stmt_bind_ulong(stmt, idx++,
+                           anno_db_gfflike_bin_offsets[level] + startbin, err);
+    gt_rdb_stmt_bind_ulong(stmt, idx++,
+                           anno_db_gfflike_bin_offsets[level] + endbin, err);
+    startbin >>= GT_ANNO_DB_BIN_NEXTSHIFT;
+    endbin >>= GT_ANNO_DB_BIN_NEXTSHIFT;
+  }
+}
+
+/* the same assignment as in anno_db_gfflike_bin(), for databases created
+   before features were binned */
+#define GT_ANNO_DB_BIN_LEVEL_SQL(SHIFT, OFFSET) \
+        "WHEN (start >> " #SHIFT ") = (end >> " #SHIFT ") " \
+        "THEN " #OFFSET " + (start >> " #SHIFT ") "
+#define GT_ANNO_DB_BIN_UPDATE_SQL \
+        "UPDATE features SET bin = CASE " \
+        GT_ANNO_DB_BIN_LEVEL_SQL(17, 4681) \
+        GT_ANNO_DB_BIN_LEVEL_SQL(20, 585) \
+        GT_ANNO_DB_BIN_LEVEL_SQL(23, 73) \
+        GT_ANNO_DB_BIN_LEVEL_SQL(26, 9) \
+        GT_ANNO_DB_BIN_LEVEL_SQL(29, 1) \
+        "ELSE 0 END"
+
+static int anno_db_gfflike_add_bins(GtRDB *db, GtError *err)
+{
+  GtRDBStmt *stmt;
+  GtError *testerr;
+  bool has_bins;
+  int had_err = 0;
+  gt_assert(db);
+
+  testerr = gt_error_new();
+  stmt = gt_rdb_prepare(db, "SELECT bin FROM features LIMIT 1", 0, testerr);
+  has_bins = (stmt != NULL);
+  gt_rdb_stmt_delete(stmt);
+  gt_error_delete(testerr);
+  if (has_bins)
+    return 0;
+  gt_log_log("adding bin column to features table");
+  stmt = gt_rdb_prepare(db, "ALTER TABLE features "
+                            "ADD COLUMN bin INTEGER NOT NULL DEFAULT 0",
+                        0, err);
+  if (!stmt || gt_rdb_stmt_exec(stmt, err) < 0)
+    had_err = -1;
+  gt_rdb_stmt_delete(stmt);
+  if (!had_err) {
+    stmt = gt_rdb_prepare(db, GT_ANNO_DB_BIN_UPDATE_SQL, 0, err);
+    if (!stmt || gt_rdb_stmt_exec(stmt, err) < 0)
+      had_err = -1;
+    gt_rdb_stmt_delete(stmt);
+  }
+  return had_err;
+}
+
 static int anno_db_gfflike_validate_sqlite(GtRDBSqlite *db, GtError *err,
                                            bool *check)
 {
@@ -156,7 +247,8 @@ static int anno_db_gfflike_create_tables_sqlite(GtRDBSqlite *db, GtError *err)
                            "is_multi INTEGER NOT NULL, "
                            "is_pseudo INTEGER NOT NULL, "
                            "is_marked INTEGER NOT NULL, "
-                           "multi_representative INTEGER NOT NULL)",
+                           "multi_representative INTEGER NOT NULL, "
+                           "bin INTEGER NOT NULL DEFAULT 0)",
                            0, err);
   if (!stmt || (had_err = gt_rdb_stmt_exec(stmt, err)) < 0) {
     return -1;
@@ -256,6 +348,14 @@ static int anno_db_gfflike_create_indexes_sqlite(GtRDBSqlite *db, GtError *err)
   if (!stmt || (had_err = gt_rdb_stmt_exec(stmt, err)) < 0) {
     return -1;
   } else gt_rdb_stmt_delete(stmt);
+  stmt = gt_rdb_prepare((GtRDB*) db,
+                           "CREATE INDEX IF NOT EXISTS feature_bin "
+                           "ON features (seqid, bin, start, end)",
+                           0,
+                           err);
+  if (!stmt || (had_err = gt_rdb_stmt_exec(stmt, err)) < 0) {
+    return -1;
+  } else gt_rdb_stmt_delete(stmt);
   stmt = gt_rdb_prepare((GtRDB*) db,
                            "CREATE INDEX IF NOT EXISTS name_sequenceregion "
                            "ON sequenceregions (sequenceregion_name)",
@@ -343,7 +443,8 @@ static int anno_db_gfflike_create_tables_mysql(GtRDBMySQL *db, GtError *err)
                            "is_multi INTEGER NOT NULL, "
                            "is_pseudo INTEGER NOT NULL, "
                            "is_marked INTEGER NOT NULL, "
-                           "multi_representative INTEGER NOT NULL)",
+                           "multi_representative INTEGER NOT NULL, "
+                           "bin INTEGER NOT NULL DEFAULT 0)",
                            0,
                            err);
   if (!stmt || (had_err = gt_rdb_stmt_exec(stmt, err)) < 0) {
@@ -473,6 +574,20 @@ static int anno_db_gfflike_create_indexes_mysql(GtRDBMySQL *db, GtError *err)
     gt_rdb_stmt_delete(stmt);
   }
 
+  if (!gt_cstr_table_get(cst, "feature_bin")) {
+    stmt = gt_rdb_prepare((GtRDB*) db,
+                             "CREATE INDEX feature_bin "
+                             "ON features (seqid, bin, start, end)",
+                             0,
+                             err);
+    if (!stmt || (had_err = gt_rdb_stmt_exec(stmt, err)) < 0) {
+      gt_rdb_stmt_delete(stmt);
+      gt_cstr_table_delete(cst);
+      return -1;
+    }
+    gt_rdb_stmt_delete(stmt);
+  }
+
   if (!gt_cstr_table_get(cst, "name_sequenceregion")) {
     stmt = gt_rdb_prepare((GtRDB*) db,
                              "CREATE INDEX name_sequenceregion "
@@ -578,6 +693,8 @@ int anno_db_gfflike_init_sqlite(GT_UNUSED GtRDBVisitor *rdbv, GtRDBSqlite *db,
                       "tables are missing");
     had_err = -1;
   }
+  if (!had_err)
+    had_err = anno_db_gfflike_add_bins((GtRDB*) db, err);
   if (!had_err) {
     had_err = anno_db_gfflike_create_indexes_sqlite(db, err);
   }
@@ -616,6 +733,8 @@ int anno_db_gfflike_init_mysql(GT_UNUSED GtRDBVisitor *rdbv, GtRDBMySQL *db,
     gt_error_set(err, "corrupt database schema: tables are missing");
     had_err = -1;
   }
+  if (!had_err)
+    had_err = anno_db_gfflike_add_bins((GtRDB*) db, err);
   if (!had_err) {
     had_err = anno_db_gfflike_create_indexes_mysql(db, err);
   }
@@ -859,6 +978,8 @@ static int insert_single_node(GtFeatureIndexGFFlike *fi,
                        gt_feature_node_is_pseudo(fn), err);
   gt_rdb_stmt_bind_int(fi->stmts[GT_PSTMT_FEATURE_INSERT], 11,
                        gt_feature_node_is_marked(fn), err);
+  gt_rdb_stmt_bind_ulong(fi->stmts[GT_PSTMT_FEATURE_INSERT], 12,
+                         anno_db_gfflike_bin(rng.start, rng.end), err);
   rval = gt_rdb_stmt_exec(fi->stmts[GT_PSTMT_FEATURE_INSERT], err);
   if (rval < 0) gt_error_check(err);
 
@@ -1302,12 +1423,13 @@ static int get_nodes_for_stmt(GtFeatureIndexGFFlike *fi,
   GtRDBStmt *attr_stmt, *parent_stmt;
   int had_err = 0;
   GtUword i;
-  GtArray *nodes;
-  bool is_child;
+  GtArray *nodes, *is_new;
+  bool is_child, flag;
   gt_assert(fi && results && stmt);
   attr_stmt = fi->stmts[GT_PSTMT_GET_ATTRIBUTE_SELECT];
   parent_stmt = fi->stmts[GT_PSTMT_GET_PARENTS_SELECT];
   nodes = gt_array_new(sizeof (GtUword));
+  is_new = gt_array_new(sizeof (bool));
   HashElemInfo node_hashtype = {
     gt_ht_ptr_elem_hash,
     { NULL },
@@ -1347,6 +1469,8 @@ static int get_nodes_for_stmt(GtFeatureIndexGFFlike *fi,
     if ((ul_node_gt_hashmap_get(fi->cache_id2node, id)) != NULL) {
 
       gt_array_add(nodes, id);
+      flag = false;
+      gt_array_add(is_new, flag);
 
     } else {     /* otherwise build new nodes from database info */
 
@@ -1394,6 +1518,8 @@ static int get_nodes_for_stmt(GtFeatureIndexGFFlike *fi,
         }
       }
       gt_array_add(nodes, id);
+      flag = true;
+      gt_array_add(is_new, flag);
     }
     gt_str_delete(seqid_str);
     gt_str_delete(source_str);
@@ -1418,6 +1544,9 @@ static int get_nodes_for_stmt(GtFeatureIndexGFFlike *fi,
       parent = *(GtFeatureNode**) ul_node_gt_hashmap_get(fi->cache_id2node,
                                                        par_id);
       gt_assert(parent);
+      /* cached nodes were linked to their parents when they were built */
+      if (!*(bool*) gt_array_get(is_new, i))
+        continue;
       /* if a child has multiple parents, increase refcount */
       if (gt_hashtable_get(seen_as_children, &newfn)) {
         gt_genome_node_ref((GtGenomeNode*) newfn);
@@ -1437,6 +1566,7 @@ static int get_nodes_for_stmt(GtFeatureIndexGFFlike *fi,
     gt_feature_node_set_observer(newfn, fi->obs);
   }
   gt_array_delete(nodes);
+  gt_array_delete(is_new);
   gt_hashtable_delete(seen_as_children);
   return had_err;
 }
@@ -1476,8 +1606,11 @@ int gt_feature_index_gfflike_get_features_for_range(GtFeatureIndex *gfi,
   gt_mutex_lock(fi->dblock);
   gt_rdb_stmt_reset(stmt, err);
   gt_rdb_stmt_bind_string(stmt, 0, seqid, err);
-  gt_rdb_stmt_bind_ulong(stmt, 1, qry_range->end, err);
-  gt_rdb_stmt_bind_ulong(stmt, 2, qry_range->start, err);
+  anno_db_gfflike_bind_bins(stmt, 1, qry_range, err);
+  gt_rdb_stmt_bind_ulong(stmt, 1 + 2 * GT_ANNO_DB_BIN_LEVELS, qry_range->end,
+                         err);
+  gt_rdb_stmt_bind_ulong(stmt, 2 + 2 * GT_ANNO_DB_BIN_LEVELS, qry_range->start,
+                         err);
   retval = get_nodes_for_stmt(fi, results, stmt, err);
   gt_mutex_unlock(fi->dblock);
   return retval;
@@ -1748,10 +1881,10 @@ static int prepstmt_init(GtFeatureIndexGFFlike *fis, GtError *err)
                         "INSERT INTO features "
                         "(seqid, source, type, start, end, score, strand, "
                         "phase, is_multi, "
-                        "multi_representative, is_pseudo, is_marked) "
+                        "multi_representative, is_pseudo, is_marked, bin) "
                         "VALUES "
-                        "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)",
-                         12,
+                        "(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)",
+                         13,
                          err);
   if (!r) return -1;
   r = fis->stmts[GT_PSTMT_FEATURE_UPDATE] = gt_rdb_prepare(fis->db,
@@ -1778,12 +1911,25 @@ static int prepstmt_init(GtFeatureIndexGFFlike *fis, GtError *err)
                         "FROM sequenceregions s, features f, "
                         "     sources src, types t "
                         "WHERE s.sequenceregion_name = ?  "
-                        "AND s.sequenceregion_id = f.seqid "
+                        /* the seqid join is repeated for each bin level so
+                           that every term can be answered from the
+                           feature_bin index */
+                        "AND ((s.sequenceregion_id = f.seqid AND f.bin = 0) "
+                        "  OR (s.sequenceregion_id = f.seqid "
+                        "      AND f.bin BETWEEN ? AND ?) "
+                        "  OR (s.sequenceregion_id = f.seqid "
+                        "      AND f.bin BETWEEN ? AND ?) "
+                        "  OR (s.sequenceregion_id = f.seqid "
+                        "      AND f.bin BETWEEN ? AND ?) "
+                        "  OR (s.sequenceregion_id = f.seqid "
+                        "      AND f.bin BETWEEN ? AND ?) "
+                        "  OR (s.sequenceregion_id = f.seqid "
+                        "      AND f.bin BETWEEN ? AND ?)) "
                         "AND (f.start <= ? AND f.end >= ?) "
                         "AND src.source_id = f.source "
                         "AND t.type_id = f.type "
                         "ORDER BY f.id ASC",
-                         3,
+                         13,
                          err);
   if (!r) return -1;
   r = fis->stmts[GT_PSTMT_GET_ALL] = gt_rdb_prepare(fis->db,
@@ -2070,6 +2216,59 @@ int gt_anno_db_gfflike_unit_test(GtError *err)
     gt_ensure(status == 0);
   }
 
+  /* bin assignment */
+  gt_ensure(anno_db_gfflike_bin(1UL, 100UL) == 4681UL);
+  gt_ensure(anno_db_gfflike_bin(1UL << 17, (1UL << 17) + 1) == 4682UL);
+  gt_ensure(anno_db_gfflike_bin(1UL, 1UL << 17) == 585UL);
+  gt_ensure(anno_db_gfflike_bin(1UL, (1UL << 29) - 1) == 1UL);
+  gt_ensure(anno_db_gfflike_bin(1UL << 28, 1UL << 29) == 0UL);
+
+#ifdef HAVE_SQLITE
+  /* strip the bin column from the populated database and reopen it, which
+     must restore the bins of all features */
+  gt_feature_index_delete(fi);
+  fi = NULL;
+  if (!had_err) {
+    static const char *unbin[] = {
+      "ALTER TABLE features RENAME TO features_binned",
+      "CREATE TABLE features AS SELECT id, seqid, source, type, start, end, "
+        "score, strand, phase, is_multi, is_pseudo, is_marked, "
+        "multi_representative FROM features_binned",
+      "DROP TABLE features_binned",
+      NULL
+    };
+    GtRDBStmt *stmt;
+    GtUword i;
+    for (i = 0; !had_err && unbin[i] != NULL; i++) {
+      stmt = gt_rdb_prepare(rdb, unbin[i], 0, testerr);
+      gt_ensure(stmt != NULL);
+      if (!had_err)
+        gt_ensure(gt_rdb_stmt_exec(stmt, testerr) >= 0);
+      gt_rdb_stmt_delete(stmt);
+    }
+  }
+  if (!had_err) {
+    fi = gt_anno_db_schema_get_feature_index(adb, rdb, testerr);
+    gt_ensure(fi != NULL);
+  }
+  if (!had_err) {
+    GtRDBStmt *stmt;
+    GtUword start, end, bin, nof_features = 0;
+    stmt = gt_rdb_prepare(rdb, "SELECT start, end, bin FROM features", 0,
+                          testerr);
+    gt_ensure(stmt != NULL);
+    while (!had_err && gt_rdb_stmt_exec(stmt, testerr) == 0) {
+      gt_rdb_stmt_get_ulong(stmt, 0, &start, testerr);
+      gt_rdb_stmt_get_ulong(stmt, 1, &end, testerr);
+      gt_rdb_stmt_get_ulong(stmt, 2, &bin, testerr);
+      gt_ensure(bin == anno_db_gfflike_bin(start, end));
+      nof_features++;
+    }
+    gt_ensure(nof_features > 0);
+    gt_rdb_stmt_delete(stmt);
+  }
+#endif
+
   gt_xremove(gt_str_get(tmpfilename));
   gt_str_delete(tmpfilename);
   gt_feature_index_delete(fi);
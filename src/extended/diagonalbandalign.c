@@ -19,13 +19,16 @@
 #include <string.h>
 #include "core/array2dim_api.h"
 #include "core/assert_api.h"
+#include "core/ensure_api.h"
 #include "core/ma_api.h"
 #include "core/minmax_api.h"
 #include "core/error_api.h"
 #include "core/types_api.h"
 #include "core/divmodmul_api.h"
+#include "core/mathsupport_api.h"
 #include "core/unused_api.h"
 #include "extended/diagonalbandalign.h"
+#include "extended/linearalign_simd.h"
 #include "extended/linspace_management.h"
 #include "extended/reconstructalignment.h"
 #include "match/squarededist.h"
@@ -488,7 +491,8 @@ static inline void set_linear_DiagentryRtabentry(LinearAlignEdge edge,
 
 /* calculate all E- and Rtabcolumns, store crosspoints in  Diagcolumn,
    return lastcrosspoint from optimal path */
-static GtUword evaluateallDBtabcolumns(GtLinspaceManagement *spacemanager,
+static GtUword evaluateallDBtabcolumns(GtLinearalignSimdKernel kernel,
+                                       GtLinspaceManagement *spacemanager,
                                        GtDiagAlignentry *Diagcolumn,
                                        const GtScoreHandler *scorehandler,
                                        LinearAlignEdge edge,
@@ -505,7 +509,8 @@ static GtUword evaluateallDBtabcolumns(GtLinspaceManagement *spacemanager,
   GtUword gapcost, colindex, rowindex, val, *EDtabcolumn, *Rtabcolumn,
           northwestEDtabentry, westEDtabentry = GT_UWORD_MAX,
           northwestRtabentry, westRtabentry = GT_UWORD_MAX,
-          low_row, high_row; /*lowest and highest row between a diagonal band*/
+          low_row, high_row, /*lowest and highest row between a diagonal band*/
+          lastcrosspoint;
   GtWord diag;
   bool last_row = false;
 
@@ -526,6 +531,15 @@ static GtUword evaluateallDBtabcolumns(GtLinspaceManagement *spacemanager,
  /* first column */
   firstDBtabcolumn(EDtabcolumn, Rtabcolumn, Diagcolumn, edge, offset,
                    left_dist, right_dist, gapcost);
+  if (gt_linearalign_simd_diagonalband(kernel, EDtabcolumn, Rtabcolumn,
+                                       Diagcolumn, &lastcrosspoint,
+                                       scorehandler,
+                                       offset, useq, ustart, ulen,
+                                       vseq, vstart, vlen,
+                                       left_dist, right_dist))
+  {
+    return lastcrosspoint;
+  }
    if (high_row == ulen)
      last_row = true;
   /* next columns */
@@ -702,7 +716,8 @@ static void evaluateDBcrosspoints(GtLinspaceManagement *spacemanager,
     return;
   }
 
-  cpoint = evaluateallDBtabcolumns (spacemanager, Diagcolumn, scorehandler,edge,
+  cpoint = evaluateallDBtabcolumns (gt_linearalign_simd_kernel_best(),
+                                    spacemanager, Diagcolumn, scorehandler,edge,
                                     rowoffset, useq, ustart, ulen,
                                     vseq, vstart, vlen,
                                     left_dist, right_dist);
@@ -1041,3 +1056,100 @@ void gt_diagonalbandalign_check(GT_UNUSED bool forward,
   gt_linspace_management_delete(spacemanager);
   gt_scorehandler_delete(scorehandler);
 }
+
+/*---------------------------------unit test---------------------------------*/
+
+#define DIAGONALBAND_TEST_MINLEN 32UL
+#define DIAGONALBAND_TEST_MAXLEN 300UL
+
+int gt_diagonalbandalign_unit_test(GtError *err)
+{
+  int had_err = 0;
+  const GtWord costs[][3] = {{0, 1, 1}, {0, 4, 3}, {0, 900, 700}};
+  GtUchar useq[DIAGONALBAND_TEST_MAXLEN], vseq[DIAGONALBAND_TEST_MAXLEN];
+  GtUword EDtab[DIAGONALBAND_TEST_MAXLEN + 1],
+          Rtab[DIAGONALBAND_TEST_MAXLEN + 1], trial, ulen, vlen, width, idx,
+          lastwidth, cpoint[2];
+  GtDiagAlignentry Diagtab[2][DIAGONALBAND_TEST_MAXLEN + 1];
+  GtLinspaceManagement *spacemanager = gt_linspace_management_new();
+
+  gt_error_check(err);
+  for (trial = 0; !had_err && trial < 30UL; trial++)
+  {
+    const GtWord *cost = costs[trial % 3];
+    GtScoreHandler *scorehandler;
+    GtLinearalignSimdKernel kernel;
+    GtWord left_dist, right_dist;
+
+    ulen = DIAGONALBAND_TEST_MINLEN
+           + gt_rand_max(DIAGONALBAND_TEST_MAXLEN - DIAGONALBAND_TEST_MINLEN);
+    vlen = DIAGONALBAND_TEST_MINLEN
+           + gt_rand_max(DIAGONALBAND_TEST_MAXLEN - DIAGONALBAND_TEST_MINLEN);
+    gt_linearalign_simd_random_sequence(useq, ulen);
+    gt_linearalign_simd_random_sequence(vseq, vlen);
+    /* valid band of at least the minimal width */
+    left_dist = GT_MIN(0, (GtWord) vlen - (GtWord) ulen)
+                - (GtWord) gt_rand_max(40UL);
+    left_dist = GT_MAX(-(GtWord) ulen, left_dist);
+    right_dist = GT_MAX(0, (GtWord) vlen - (GtWord) ulen)
+                 + (GtWord) gt_rand_max(40UL);
+    right_dist = GT_MAX(left_dist + (GtWord) DIAGONALBAND_TEST_MINLEN,
+                        right_dist);
+    right_dist = GT_MIN((GtWord) vlen, right_dist);
+    width = GT_MIN((GtUword) (right_dist - left_dist), ulen);
+    /* number of rows of the last column within the band */
+    lastwidth = GT_MIN(ulen, (GtUword) ((GtWord) vlen - left_dist)) + 1
+                - (GtUword) GT_MAX(0, (GtWord) vlen - right_dist);
+    scorehandler = gt_scorehandler_new(cost[0], cost[1], 0, cost[2]);
+    gt_linspace_management_check(spacemanager, width, vlen, sizeof (*EDtab),
+                                 sizeof (*Rtab), sizeof (**Diagtab));
+
+    for (kernel = GT_LINEARALIGN_SIMD_SCALAR;
+         !had_err && kernel < GT_LINEARALIGN_SIMD_NUMOFKERNELS;
+         kernel++)
+    {
+      GtDiagAlignentry *Diagcolumn
+        = gt_linspace_management_get_crosspointTabspace(spacemanager);
+      const GtUword k = kernel == GT_LINEARALIGN_SIMD_SCALAR ? 0 : 1;
+
+      if (!gt_linearalign_simd_kernel_is_supported(kernel))
+        continue;
+      for (idx = 0; idx <= vlen; idx++)
+      {
+        Diagcolumn[idx].lastcpoint = GT_UWORD_MAX;
+        Diagcolumn[idx].currentrowindex = GT_UWORD_MAX;
+        Diagcolumn[idx].last_type = Linear_X;
+      }
+      cpoint[k] = evaluateallDBtabcolumns(kernel, spacemanager, Diagcolumn,
+                                          scorehandler, Linear_X, 0,
+                                          useq, 0, ulen, vseq, 0, vlen,
+                                          left_dist, right_dist);
+      memcpy(Diagtab[k], Diagcolumn, sizeof (*Diagcolumn) * (vlen + 1));
+      if (k == 0)
+      {
+        memcpy(EDtab, gt_linspace_management_get_valueTabspace(spacemanager),
+               sizeof (*EDtab) * lastwidth);
+        memcpy(Rtab, gt_linspace_management_get_rTabspace(spacemanager),
+               sizeof (*Rtab) * lastwidth);
+        continue;
+      }
+      gt_ensure(cpoint[0] == cpoint[1]);
+      gt_ensure(memcmp(EDtab,
+                       gt_linspace_management_get_valueTabspace(spacemanager),
+                       sizeof (*EDtab) * lastwidth) == 0);
+      gt_ensure(memcmp(Rtab,
+                       gt_linspace_management_get_rTabspace(spacemanager),
+                       sizeof (*Rtab) * lastwidth) == 0);
+      for (idx = 0; !had_err && idx <= vlen; idx++)
+      {
+        gt_ensure(Diagtab[0][idx].lastcpoint == Diagtab[1][idx].lastcpoint);
+        gt_ensure(Diagtab[0][idx].currentrowindex
+                  == Diagtab[1][idx].currentrowindex);
+        gt_ensure(Diagtab[0][idx].last_type == Diagtab[1][idx].last_type);
+      }
+    }
+    gt_scorehandler_delete(scorehandler);
+  }
+  gt_linspace_management_delete(spacemanager);
+  return had_err;
+}
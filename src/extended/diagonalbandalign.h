@@ -128,4 +128,6 @@ void    gt_diagonalbandalign_check(GT_UNUSED bool forward,
                                    GtUword ulen,
                                    const GtUchar *vseq,
                                    GtUword vlen);
+
+int     gt_diagonalbandalign_unit_test(GtError *err);
 #endif
@@ -0,0 +1,1302 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "core/arena.h"
+#include "core/array.h"
+#include "core/class_alloc_lock.h"
+#include "core/cstr_api.h"
+#include "core/ensure_api.h"
+#include "core/fa_api.h"
+#include "core/hashmap_api.h"
+#include "core/interval_index.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/minmax_api.h"
+#include "core/qsort_r_api.h"
+#include "core/str_array_api.h"
+#include "core/thread_api.h"
+#include "core/undef_api.h"
+#include "core/unused_api.h"
+#include "core/xansi_api.h"
+#include "extended/array_in_stream_api.h"
+#include "extended/feature_index_mapped.h"
+#include "extended/feature_index_memory_api.h"
+#include "extended/feature_index_rep.h"
+#include "extended/feature_node.h"
+#include "extended/feature_node_iterator_api.h"
+#include "extended/genome_node.h"
+#include "extended/region_node.h"
+
+/* Layout of an index file, all numbers are native <GtUword>s:
+   - the header <GtFeatureIndexMappedHeader>
+   - the offsets of all strings in the string pool
+   - the string pool, a sequence of '\0'-terminated strings, padded to a
+     multiple of the word size
+   - one <GtFeatureIndexMappedSeqid> for each sequence region, sorted by name
+   - the intervals of each sequence region as <GtIntervalIndexEntry>s, with
+     the record offsets as values
+   - the feature records, one for each top-level feature.
+   All offsets are relative to the start of the file, except the record
+   offsets, which are relative to the start of the feature records.
+   A feature record consists of the number of its nodes, followed by the
+   nodes in depth-first order. Each node is stored as the words given by
+   <GtFeatureIndexMappedNodeWord>, followed by tag/value string numbers for
+   each attribute and the node numbers of its children. Nodes with more than
+   one parent are stored only once. */
+
+#define GT_FEATURE_INDEX_MAPPED_MAGIC   "GTFIMAP"
+#define GT_FEATURE_INDEX_MAPPED_VERSION 1UL
+#define GT_FEATURE_INDEX_MAPPED_CHUNKSIZE (64UL << 10)
+
+#define GT_FIM_PSEUDO      1UL
+#define GT_FIM_HAS_SCORE   (1UL << 1)
+#define GT_FIM_MULTI       (1UL << 2)
+#define GT_FIM_STRAND_SHIFT 8
+#define GT_FIM_PHASE_SHIFT  16
+
+typedef enum {
+  GT_FIM_FLAGS,
+  GT_FIM_TYPE,
+  GT_FIM_SOURCE,
+  GT_FIM_START,
+  GT_FIM_END,
+  GT_FIM_SCORE,
+  GT_FIM_REPRESENTATIVE,
+  GT_FIM_NOF_ATTRIBUTES,
+  GT_FIM_NOF_CHILDREN,
+  GT_FIM_NODE_WORDS
+} GtFeatureIndexMappedNodeWord;
+
+typedef struct {
+  char magic[8];
+  GtUword version,
+          wordsize,
+          filesize,
+          nof_strings,
+          nof_seqids,
+          first_seqid,
+          stroffsets_offset,
+          strpool_offset,
+          seqids_offset,
+          records_offset,
+          records_size;
+} GtFeatureIndexMappedHeader;
+
+typedef struct {
+  GtUword name,
+          has_region,
+          region_start,
+          region_end,
+          range_start,
+          range_end,
+          nof_features,
+          intervals_offset,
+          root_level;
+} GtFeatureIndexMappedSeqid;
+
+/* the materialized feature nodes of one sequence region */
+typedef struct {
+  GtGenomeNode **nodes;
+  GtStr *seqid;
+  GtArena *arena;
+} GtFeatureIndexMappedCache;
+
+struct GtFeatureIndexMapped {
+  const GtFeatureIndex parent_instance;
+  void *map;
+  const GtFeatureIndexMappedHeader *header;
+  const GtUword *stroffsets,
+                *records;
+  const char *strpool;
+  const GtFeatureIndexMappedSeqid *seqids;
+  GtFeatureIndexMappedCache *cache;
+  GtStr **sources;
+  GtMutex *mutex;
+};
+
+#define gt_feature_index_mapped_cast(FI)\
+        gt_feature_index_cast(gt_feature_index_mapped_class(), FI)
+
+/* writing */
+
+typedef struct {
+  GtHashmap *string_nums;
+  GtArray *stroffsets;
+  GtStr *strpool;
+  GtArray *records,
+          *node_order;
+  GtHashmap *node_nums;
+} GtFeatureIndexMappedWriter;
+
+static GtUword gt_feature_index_mapped_intern(GtFeatureIndexMappedWriter *w,
+                                              const char *str)
+{
+  GtUword num;
+  if (!(num = (GtUword) gt_hashmap_get(w->string_nums, str))) {
+    GtUword offset = gt_str_length(w->strpool);
+    gt_array_add(w->stroffsets, offset);
+    num = gt_array_size(w->stroffsets);
+    gt_str_append_cstr(w->strpool, str);
+    gt_str_append_char(w->strpool, '\0');
+    gt_hashmap_add(w->string_nums, gt_cstr_dup(str), (void*) num);
+  }
+  return num - 1;
+}
+
+static void gt_feature_index_mapped_number_nodes(GtFeatureIndexMappedWriter *w,
+                                                 GtFeatureNode *fn)
+{
+  GtFeatureNodeIterator *fni;
+  GtFeatureNode *child;
+  if (gt_hashmap_get(w->node_nums, fn))
+    return;
+  gt_array_add(w->node_order, fn);
+  gt_hashmap_add(w->node_nums, fn,
+                 (void*) (GtUword) gt_array_size(w->node_order));
+  fni = gt_feature_node_iterator_new_direct(fn);
+  while ((child = gt_feature_node_iterator_next(fni)))
+    gt_feature_index_mapped_number_nodes(w, child);
+  gt_feature_node_iterator_delete(fni);
+}
+
+typedef struct {
+  GtFeatureIndexMappedWriter *w;
+  GtArray *words;
+} GtFeatureIndexMappedAttrInfo;
+
+static void gt_feature_index_mapped_store_attribute(const char *tag,
+                                                    const char *value,
+                                                    void *data)
+{
+  GtFeatureIndexMappedAttrInfo *info = data;
+  GtUword num;
+  num = gt_feature_index_mapped_intern(info->w, tag);
+  gt_array_add(info->words, num);
+  num = gt_feature_index_mapped_intern(info->w, value);
+  gt_array_add(info->words, num);
+}
+
+/* Append the record of the feature tree (or DAG) rooted at <root> to the
+   records of <w> and return its offset. */
+static GtUword gt_feature_index_mapped_store_record(
+                                                  GtFeatureIndexMappedWriter *w,
+                                                  GtFeatureNode *root)
+{
+  GtFeatureIndexMappedAttrInfo info;
+  GtUword i, offset, nof_nodes;
+  gt_array_reset(w->node_order);
+  gt_hashmap_reset(w->node_nums);
+  gt_feature_index_mapped_number_nodes(w, root);
+  offset = gt_array_size(w->records);
+  nof_nodes = gt_array_size(w->node_order);
+  gt_array_add(w->records, nof_nodes);
+  info.w = w;
+  info.words = w->records;
+  for (i = 0; i < nof_nodes; i++) {
+    GtFeatureNode *fn = *(GtFeatureNode**) gt_array_get(w->node_order, i),
+                  *child;
+    GtFeatureNodeIterator *fni;
+    GtUword node[GT_FIM_NODE_WORDS], nof_attrs_pos, nof_children = 0,
+            before, j;
+    GtRange rng = gt_genome_node_get_range((GtGenomeNode*) fn);
+    memset(node, 0, sizeof node);
+    node[GT_FIM_FLAGS] =
+                    ((GtUword) gt_feature_node_get_strand(fn)
+                       << GT_FIM_STRAND_SHIFT) |
+                    ((GtUword) gt_feature_node_get_phase(fn)
+                       << GT_FIM_PHASE_SHIFT);
+    if (gt_feature_node_is_pseudo(fn)) {
+      node[GT_FIM_FLAGS] |= GT_FIM_PSEUDO;
+      node[GT_FIM_TYPE] = GT_UNDEF_UWORD;
+    }
+    else
+      node[GT_FIM_TYPE] = gt_feature_index_mapped_intern(w,
+                                                  gt_feature_node_get_type(fn));
+    node[GT_FIM_SOURCE] = gt_feature_node_has_source(fn)
+                          ? gt_feature_index_mapped_intern(w,
+                                                gt_feature_node_get_source(fn))
+                          : GT_UNDEF_UWORD;
+    node[GT_FIM_START] = rng.start;
+    node[GT_FIM_END] = rng.end;
+    if (gt_feature_node_score_is_defined(fn)) {
+      float score = gt_feature_node_get_score(fn);
+      uint32_t bits;
+      memcpy(&bits, &score, sizeof bits);
+      node[GT_FIM_FLAGS] |= GT_FIM_HAS_SCORE;
+      node[GT_FIM_SCORE] = bits;
+    }
+    node[GT_FIM_REPRESENTATIVE] = GT_UNDEF_UWORD;
+    if (gt_feature_node_is_multi(fn) && !gt_feature_node_is_pseudo(fn)) {
+      GtUword repnum = (GtUword) gt_hashmap_get(w->node_nums,
+                                  gt_feature_node_get_multi_representative(fn));
+      node[GT_FIM_FLAGS] |= GT_FIM_MULTI;
+      /* a representative outside of the record represents itself */
+      node[GT_FIM_REPRESENTATIVE] = repnum > 0 ? repnum - 1 : i;
+    }
+    for (j = 0; j < (GtUword) GT_FIM_NODE_WORDS; j++)
+      gt_array_add(w->records, node[j]);
+    nof_attrs_pos = gt_array_size(w->records) - 2;
+    before = gt_array_size(w->records);
+    gt_feature_node_foreach_attribute(fn,
+                                      gt_feature_index_mapped_store_attribute,
+                                      &info);
+    *(GtUword*) gt_array_get(w->records, nof_attrs_pos) =
+                                       (gt_array_size(w->records) - before) / 2;
+    fni = gt_feature_node_iterator_new_direct(fn);
+    while ((child = gt_feature_node_iterator_next(fni))) {
+      GtUword childnum = (GtUword) gt_hashmap_get(w->node_nums, child);
+      gt_assert(childnum > 0);
+      childnum--;
+      gt_array_add(w->records, childnum);
+      nof_children++;
+    }
+    gt_feature_node_iterator_delete(fni);
+    *(GtUword*) gt_array_get(w->records, nof_attrs_pos + 1) = nof_children;
+  }
+  return offset;
+}
+
+static int gt_feature_index_mapped_cmp_seqid(const void *v1, const void *v2,
+                                             void *data)
+{
+  const GtFeatureIndexMappedSeqid *s1 = v1, *s2 = v2;
+  GtFeatureIndexMappedWriter *w = data;
+  const char *pool = gt_str_get(w->strpool);
+  return strcmp(pool + *(GtUword*) gt_array_get(w->stroffsets, s1->name),
+                pool + *(GtUword*) gt_array_get(w->stroffsets, s2->name));
+}
+
+/* the nodes of one sequence region, collected before writing */
+typedef struct {
+  GtStr *seqid;
+  GtArray *features;
+  GtRange region,
+          dyn_range;
+  bool has_region;
+} GtFeatureIndexMappedRegionInfo;
+
+/* Return the collected information for the sequence region of <gn>. */
+static GtFeatureIndexMappedRegionInfo* gt_feature_index_mapped_region_info(
+                                                             GtHashmap *regions,
+                                                             GtArray *order,
+                                                             GtGenomeNode *gn)
+{
+  GtFeatureIndexMappedRegionInfo *info;
+  GtStr *seqid = gt_genome_node_get_seqid(gn);
+  if (!(info = gt_hashmap_get(regions, gt_str_get(seqid)))) {
+    info = gt_calloc(1, sizeof *info);
+    info->seqid = gt_str_ref(seqid);
+    info->features = gt_array_new(sizeof (GtGenomeNode*));
+    info->dyn_range.start = GT_UNDEF_UWORD;
+    info->dyn_range.end = 0;
+    gt_hashmap_add(regions, gt_str_get(info->seqid), info);
+    gt_array_add(order, info);
+  }
+  return info;
+}
+
+static void gt_feature_index_mapped_region_info_delete(
+                                           GtFeatureIndexMappedRegionInfo *info)
+{
+  GtUword i;
+  if (!info) return;
+  for (i = 0; i < gt_array_size(info->features); i++)
+    gt_genome_node_delete(*(GtGenomeNode**) gt_array_get(info->features, i));
+  gt_array_delete(info->features);
+  gt_str_delete(info->seqid);
+  gt_free(info);
+}
+
+int gt_feature_index_mapped_write(GtNodeStream *in_stream,
+                                  const char *filename,
+                                  GtError *err)
+{
+  GtFeatureIndexMappedWriter w;
+  GtFeatureIndexMappedHeader header;
+  GtHashmap *regions;
+  GtArray *order, *seqtab, *intervals;
+  GtGenomeNode *gn;
+  FILE *fp = NULL;
+  GtUword i, j, offset;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(in_stream && filename);
+
+  w.string_nums = gt_hashmap_new(GT_HASH_STRING, gt_free_func, NULL);
+  w.stroffsets = gt_array_new(sizeof (GtUword));
+  w.strpool = gt_str_new();
+  w.records = gt_array_new(sizeof (GtUword));
+  w.node_order = gt_array_new(sizeof (GtFeatureNode*));
+  w.node_nums = gt_hashmap_new(GT_HASH_DIRECT, NULL, NULL);
+  regions = gt_hashmap_new(GT_HASH_STRING, NULL,
+                           (GtFree) gt_feature_index_mapped_region_info_delete);
+  order = gt_array_new(sizeof (GtFeatureIndexMappedRegionInfo*));
+  seqtab = gt_array_new(sizeof (GtFeatureIndexMappedSeqid));
+  intervals = gt_array_new(sizeof (GtIntervalIndexEntry));
+  memset(&header, 0, sizeof header);
+  header.first_seqid = GT_UNDEF_UWORD;
+
+  /* collect the feature nodes of each sequence region in input order */
+  while (!(had_err = gt_node_stream_next(in_stream, &gn, err)) && gn) {
+    GtFeatureIndexMappedRegionInfo *info;
+    if (gt_region_node_try_cast(gn)) {
+      info = gt_feature_index_mapped_region_info(regions, order, gn);
+      if (!info->has_region) {
+        info->has_region = true;
+        info->region = gt_genome_node_get_range(gn);
+      }
+      gt_genome_node_delete(gn);
+    }
+    else if (gt_feature_node_try_cast(gn)) {
+      GtRange rng = gt_genome_node_get_range(gn);
+      info = gt_feature_index_mapped_region_info(regions, order, gn);
+      gt_array_add(info->features, gn);
+      info->dyn_range.start = GT_MIN(info->dyn_range.start, rng.start);
+      info->dyn_range.end = GT_MAX(info->dyn_range.end, rng.end);
+    }
+    else
+      gt_genome_node_delete(gn);
+  }
+
+  for (i = 0; !had_err && i < gt_array_size(order); i++) {
+    GtFeatureIndexMappedRegionInfo *info =
+                  *(GtFeatureIndexMappedRegionInfo**) gt_array_get(order, i);
+    GtFeatureIndexMappedSeqid entry;
+    memset(&entry, 0, sizeof entry);
+    entry.name = gt_feature_index_mapped_intern(&w, gt_str_get(info->seqid));
+    if (info->has_region) {
+      entry.has_region = 1;
+      entry.region_start = info->region.start;
+      entry.region_end = info->region.end;
+    }
+    /* like the database backends, prefer the range of the region node */
+    if (info->has_region) {
+      entry.range_start = info->region.start;
+      entry.range_end = info->region.end;
+    } else {
+      entry.range_start = info->dyn_range.start;
+      entry.range_end = info->dyn_range.end;
+    }
+    entry.nof_features = gt_array_size(info->features);
+    entry.intervals_offset = gt_array_size(intervals);
+    for (j = 0; j < gt_array_size(info->features); j++) {
+      GtFeatureNode *fn = *(GtFeatureNode**) gt_array_get(info->features, j);
+      GtIntervalIndexEntry iv;
+      GtRange rng = gt_genome_node_get_range((GtGenomeNode*) fn);
+      iv.start = rng.start;
+      iv.end = rng.end;
+      iv.maxend = rng.end;
+      iv.value = gt_feature_index_mapped_store_record(&w, fn);
+      gt_array_add(intervals, iv);
+    }
+    if (entry.nof_features > 0) {
+      /* records are in input order, so equal intervals keep it */
+      GtIntervalIndexEntry *ivs =
+                               gt_array_get(intervals, entry.intervals_offset);
+      qsort(ivs, entry.nof_features, sizeof *ivs,
+            gt_interval_index_entry_compare);
+      entry.root_level = gt_interval_index_entries_build(ivs,
+                                                            entry.nof_features);
+    }
+    gt_array_add(seqtab, entry);
+  }
+
+  if (!had_err) {
+    GtUword nof_seqids = gt_array_size(seqtab), poolsize;
+    if (nof_seqids > 0)
+      gt_qsort_r(gt_array_get_space(seqtab), nof_seqids,
+                 sizeof (GtFeatureIndexMappedSeqid), &w,
+                 gt_feature_index_mapped_cmp_seqid);
+    /* the first sequence region in the input got the first string */
+    for (i = 0; i < nof_seqids; i++) {
+      GtFeatureIndexMappedSeqid *entry = gt_array_get(seqtab, i);
+      if (entry->name == 0)
+        header.first_seqid = i;
+    }
+    /* pad the string pool, so that all following sections are aligned */
+    while (gt_str_length(w.strpool) % sizeof (GtUword))
+      gt_str_append_char(w.strpool, '\0');
+    poolsize = gt_str_length(w.strpool);
+    memcpy(header.magic, GT_FEATURE_INDEX_MAPPED_MAGIC,
+           sizeof header.magic);
+    header.version = GT_FEATURE_INDEX_MAPPED_VERSION;
+    header.wordsize = (GtUword) sizeof (GtUword);
+    header.nof_strings = gt_array_size(w.stroffsets);
+    header.nof_seqids = nof_seqids;
+    header.stroffsets_offset = sizeof header;
+    header.strpool_offset = header.stroffsets_offset
+                            + header.nof_strings * sizeof (GtUword);
+    header.seqids_offset = header.strpool_offset + poolsize;
+    offset = header.seqids_offset
+             + nof_seqids * sizeof (GtFeatureIndexMappedSeqid);
+    for (i = 0; i < nof_seqids; i++) {
+      GtFeatureIndexMappedSeqid *entry = gt_array_get(seqtab, i);
+      entry->intervals_offset = offset + entry->intervals_offset
+                                * sizeof (GtIntervalIndexEntry);
+    }
+    header.records_offset = offset + gt_array_size(intervals)
+                                     * sizeof (GtIntervalIndexEntry);
+    header.records_size = gt_array_size(w.records);
+    header.filesize = header.records_offset
+                      + header.records_size * sizeof (GtUword);
+    if (!(fp = gt_fa_fopen(filename, "wb", err)))
+      had_err = -1;
+  }
+  if (!had_err) {
+    gt_xfwrite_one(&header, fp);
+    gt_xfwrite(gt_array_get_space(w.stroffsets), sizeof (GtUword),
+               gt_array_size(w.stroffsets), fp);
+    gt_xfwrite(gt_str_get_mem(w.strpool), sizeof (char),
+               gt_str_length(w.strpool), fp);
+    gt_xfwrite(gt_array_get_space(seqtab), sizeof (GtFeatureIndexMappedSeqid),
+               gt_array_size(seqtab), fp);
+    gt_xfwrite(gt_array_get_space(intervals),
+               sizeof (GtIntervalIndexEntry),
+               gt_array_size(intervals), fp);
+    gt_xfwrite(gt_array_get_space(w.records), sizeof (GtUword),
+               gt_array_size(w.records), fp);
+  }
+  gt_fa_xfclose(fp);
+  gt_array_delete(intervals);
+  gt_array_delete(seqtab);
+  gt_array_delete(order);
+  gt_hashmap_delete(regions);
+  gt_hashmap_delete(w.node_nums);
+  gt_array_delete(w.node_order);
+  gt_array_delete(w.records);
+  gt_str_delete(w.strpool);
+  gt_array_delete(w.stroffsets);
+  gt_hashmap_delete(w.string_nums);
+  return had_err;
+}
+
+/* reading */
+
+static const char* gt_feature_index_mapped_string(
+                                                const GtFeatureIndexMapped *fim,
+                                                GtUword num)
+{
+  gt_assert(num < fim->header->nof_strings);
+  return fim->strpool + fim->stroffsets[num];
+}
+
+/* Return true if <num> refers to a non-empty string inside the string pool,
+   which is known to end with a '\0'. */
+static bool gt_feature_index_mapped_valid_string(
+                                                const GtFeatureIndexMapped *fim,
+                                                GtUword num)
+{
+  return num < fim->header->nof_strings &&
+         fim->stroffsets[num] < fim->header->seqids_offset
+                                - fim->header->strpool_offset &&
+         fim->strpool[fim->stroffsets[num]] != '\0';
+}
+
+/* Check the fields of a single node with <left> words following its fixed
+   part. */
+static bool gt_feature_index_mapped_valid_node(const GtFeatureIndexMapped *fim,
+                                               const GtUword *node,
+                                               GtUword nodenum,
+                                               GtUword nof_nodes,
+                                               GtUword left)
+{
+  const GtUword *ext = node + GT_FIM_NODE_WORDS;
+  GtUword j, k, flags = node[GT_FIM_FLAGS],
+          nof_attrs = node[GT_FIM_NOF_ATTRIBUTES],
+          nof_children = node[GT_FIM_NOF_CHILDREN];
+  if (nof_attrs > left / 2 || nof_children > left - 2 * nof_attrs ||
+      node[GT_FIM_START] > node[GT_FIM_END] ||
+      ((flags >> GT_FIM_STRAND_SHIFT) & 0xff) >= GT_NUM_OF_STRAND_TYPES ||
+      ((flags >> GT_FIM_PHASE_SHIFT) & 0xff) > GT_PHASE_UNDEFINED)
+    return false;
+  /* only the root can be a pseudo-node, and it is never a multi-feature */
+  if (flags & GT_FIM_PSEUDO) {
+    if (nodenum > 0 || (flags & GT_FIM_MULTI) || nof_attrs > 0)
+      return false;
+  }
+  else if (!gt_feature_index_mapped_valid_string(fim, node[GT_FIM_TYPE]))
+    return false;
+  if (node[GT_FIM_SOURCE] != GT_UNDEF_UWORD &&
+      !gt_feature_index_mapped_valid_string(fim, node[GT_FIM_SOURCE]))
+    return false;
+  if ((flags & GT_FIM_MULTI) && node[GT_FIM_REPRESENTATIVE] >= nof_nodes)
+    return false;
+  for (j = 0; j < 2 * nof_attrs; j += 2) {
+    if (!gt_feature_index_mapped_valid_string(fim, ext[j]) ||
+        !gt_feature_index_mapped_valid_string(fim, ext[j + 1]))
+      return false;
+    for (k = 0; k < j; k += 2) {
+      if (ext[k] == ext[j])
+        return false;
+    }
+  }
+  /* node 0 is the root, it cannot be the child of another node */
+  for (j = 0; j < nof_children; j++) {
+    if (ext[2 * nof_attrs + j] == 0 || ext[2 * nof_attrs + j] >= nof_nodes)
+      return false;
+  }
+  return true;
+}
+
+/* Check that the record at <offset> lies inside the feature records and that
+   it describes a valid feature graph, so that it can be built without further
+   checks. */
+static int gt_feature_index_mapped_check_record(
+                                                const GtFeatureIndexMapped *fim,
+                                                GtUword offset,
+                                                GtError *err)
+{
+  const GtUword **nodes, *node;
+  GtUword i, j, nof_nodes, left, *stack, *pos, stacksize, visited;
+  unsigned char *state;
+  gt_error_check(err);
+  if (offset < fim->header->records_size) {
+    nof_nodes = fim->records[offset];
+    left = fim->header->records_size - offset - 1;
+  }
+  else
+    nof_nodes = left = 0;
+  if (nof_nodes == 0 || nof_nodes > left / GT_FIM_NODE_WORDS) {
+    gt_error_set(err, "mapped feature index is corrupt: invalid feature "
+                      "record at offset " GT_WU, offset);
+    return -1;
+  }
+  nodes = gt_malloc(nof_nodes * sizeof *nodes);
+  for (i = 0, node = fim->records + offset + 1; i < nof_nodes; i++) {
+    if (left < (GtUword) GT_FIM_NODE_WORDS)
+      break;
+    left -= GT_FIM_NODE_WORDS;
+    if (!gt_feature_index_mapped_valid_node(fim, node, i, nof_nodes, left))
+      break;
+    nodes[i] = node;
+    left -= 2 * node[GT_FIM_NOF_ATTRIBUTES] + node[GT_FIM_NOF_CHILDREN];
+    node += GT_FIM_NODE_WORDS + 2 * node[GT_FIM_NOF_ATTRIBUTES]
+            + node[GT_FIM_NOF_CHILDREN];
+  }
+  /* a multi-feature must point to a representative representing itself */
+  for (j = 0; j < i; j++) {
+    GtUword rep = nodes[j][GT_FIM_REPRESENTATIVE];
+    if ((nodes[j][GT_FIM_FLAGS] & GT_FIM_MULTI) &&
+        (rep >= i || !(nodes[rep][GT_FIM_FLAGS] & GT_FIM_MULTI) ||
+         nodes[rep][GT_FIM_REPRESENTATIVE] != rep)) {
+      i = j;
+      break;
+    }
+  }
+  if (i < nof_nodes) {
+    gt_free(nodes);
+    gt_error_set(err, "mapped feature index is corrupt: invalid node " GT_WU
+                      " in feature record at offset " GT_WU, i, offset);
+    return -1;
+  }
+  /* depth-first traversal from the root: every node must be reachable and the
+     graph must not contain a cycle (0 = unseen, 1 = on stack, 2 = done) */
+  state = gt_calloc(nof_nodes, sizeof *state);
+  stack = gt_malloc(nof_nodes * sizeof *stack);
+  pos = gt_malloc(nof_nodes * sizeof *pos);
+  stack[0] = 0;
+  pos[0] = 0;
+  state[0] = 1;
+  stacksize = visited = 1;
+  while (stacksize > 0) {
+    const GtUword *top = nodes[stack[stacksize - 1]];
+    if (pos[stacksize - 1] < top[GT_FIM_NOF_CHILDREN]) {
+      GtUword child = top[GT_FIM_NODE_WORDS + 2 * top[GT_FIM_NOF_ATTRIBUTES]
+                          + pos[stacksize - 1]++];
+      if (state[child] == 1)
+        break;
+      if (state[child] == 0) {
+        state[child] = 1;
+        stack[stacksize] = child;
+        pos[stacksize++] = 0;
+        visited++;
+      }
+    }
+    else
+      state[stack[--stacksize]] = 2;
+  }
+  gt_free(pos);
+  gt_free(stack);
+  gt_free(state);
+  gt_free(nodes);
+  if (stacksize > 0 || visited < nof_nodes) {
+    gt_error_set(err, "mapped feature index is corrupt: feature record at "
+                      "offset " GT_WU " is not a valid feature graph", offset);
+    return -1;
+  }
+  return 0;
+}
+
+/* Return the number of the sequence region <seqid> or <GT_UNDEF_UWORD>. */
+static GtUword gt_feature_index_mapped_find_seqid(
+                                                const GtFeatureIndexMapped *fim,
+                                                const char *seqid)
+{
+  GtUword left = 0, right = fim->header->nof_seqids;
+  while (left < right) {
+    GtUword mid = left + (right - left) / 2;
+    int cmp = strcmp(seqid,
+                     gt_feature_index_mapped_string(fim,
+                                                    fim->seqids[mid].name));
+    if (cmp == 0)
+      return mid;
+    if (cmp < 0)
+      right = mid;
+    else
+      left = mid + 1;
+  }
+  return GT_UNDEF_UWORD;
+}
+
+static GtStr* gt_feature_index_mapped_source(GtFeatureIndexMapped *fim,
+                                             GtUword num)
+{
+  if (!fim->sources[num])
+    fim->sources[num] = gt_str_new_cstr(gt_feature_index_mapped_string(fim,
+                                                                       num));
+  return fim->sources[num];
+}
+
+/* Build the feature nodes of the record at <offset>. Must be called with
+   <fim->mutex> locked. Returns NULL and sets <err> if the record is
+   corrupt. */
+static GtGenomeNode* gt_feature_index_mapped_build(GtFeatureIndexMapped *fim,
+                                               GtFeatureIndexMappedCache *cache,
+                                               GtUword offset,
+                                               GtError *err)
+{
+  const GtUword *rec, *node;
+  GtUword i, j, nof_nodes;
+  GtFeatureNode **nodes;
+  GtGenomeNode *root;
+  bool *has_parent;
+  if (gt_feature_index_mapped_check_record(fim, offset, err))
+    return NULL;
+  rec = fim->records + offset;
+  nof_nodes = *rec++;
+  nodes = gt_malloc(nof_nodes * sizeof *nodes);
+  has_parent = gt_calloc(nof_nodes, sizeof *has_parent);
+  for (i = 0, node = rec; i < nof_nodes; i++) {
+    GtUword flags = node[GT_FIM_FLAGS];
+    GtStrand strand = (GtStrand) ((flags >> GT_FIM_STRAND_SHIFT) & 0xff);
+    GtGenomeNode *gn;
+    const GtUword *attr;
+    if (flags & GT_FIM_PSEUDO)
+      gn = gt_feature_node_new_pseudo(cache->seqid, node[GT_FIM_START],
+                                      node[GT_FIM_END], strand);
+    else
+      gn = gt_feature_node_new_in_arena(cache->seqid,
+                               gt_feature_index_mapped_string(fim,
+                                                             node[GT_FIM_TYPE]),
+                               node[GT_FIM_START], node[GT_FIM_END], strand,
+                               cache->arena);
+    nodes[i] = (GtFeatureNode*) gn;
+    if (node[GT_FIM_SOURCE] != GT_UNDEF_UWORD)
+      gt_feature_node_set_source(nodes[i],
+                                 gt_feature_index_mapped_source(fim,
+                                                          node[GT_FIM_SOURCE]));
+    if (flags & GT_FIM_HAS_SCORE) {
+      uint32_t bits = (uint32_t) node[GT_FIM_SCORE];
+      float score;
+      memcpy(&score, &bits, sizeof score);
+      gt_feature_node_set_score(nodes[i], score);
+    }
+    gt_feature_node_set_phase(nodes[i],
+                              (GtPhase) ((flags >> GT_FIM_PHASE_SHIFT) & 0xff));
+    attr = node + GT_FIM_NODE_WORDS;
+    for (j = 0; j < node[GT_FIM_NOF_ATTRIBUTES]; j++, attr += 2) {
+      gt_feature_node_add_attribute(nodes[i],
+                                    gt_feature_index_mapped_string(fim,
+                                                                   attr[0]),
+                                    gt_feature_index_mapped_string(fim,
+                                                                   attr[1]));
+    }
+    node = attr + node[GT_FIM_NOF_CHILDREN];
+  }
+  /* link children and multi-features */
+  for (i = 0, node = rec; i < nof_nodes; i++) {
+    const GtUword *child = node + GT_FIM_NODE_WORDS
+                           + 2 * node[GT_FIM_NOF_ATTRIBUTES];
+    for (j = 0; j < node[GT_FIM_NOF_CHILDREN]; j++) {
+      gt_assert(child[j] < nof_nodes);
+      /* a child with several parents is referenced by each of them */
+      if (has_parent[child[j]])
+        gt_genome_node_ref((GtGenomeNode*) nodes[child[j]]);
+      has_parent[child[j]] = true;
+      gt_feature_node_add_child(nodes[i], nodes[child[j]]);
+    }
+    if ((node[GT_FIM_FLAGS] & GT_FIM_MULTI) && node[GT_FIM_REPRESENTATIVE] == i)
+      gt_feature_node_make_multi_representative(nodes[i]);
+    node = child + node[GT_FIM_NOF_CHILDREN];
+  }
+  for (i = 0, node = rec; i < nof_nodes; i++) {
+    if ((node[GT_FIM_FLAGS] & GT_FIM_MULTI) &&
+        node[GT_FIM_REPRESENTATIVE] != i) {
+      gt_assert(node[GT_FIM_REPRESENTATIVE] < nof_nodes);
+      gt_feature_node_set_multi_representative(nodes[i],
+                                        nodes[node[GT_FIM_REPRESENTATIVE]]);
+    }
+    node += GT_FIM_NODE_WORDS + 2 * node[GT_FIM_NOF_ATTRIBUTES]
+            + node[GT_FIM_NOF_CHILDREN];
+  }
+  root = (GtGenomeNode*) nodes[0];
+  gt_free(has_parent);
+  gt_free(nodes);
+  return root;
+}
+
+/* Return the feature node for interval <idx> of sequence region <seqnum>,
+   building it if necessary. Returns NULL and sets <err> if its record is
+   corrupt. */
+static GtGenomeNode* gt_feature_index_mapped_get_node(GtFeatureIndexMapped *fim,
+                                                      GtUword seqnum,
+                                                      GtUword idx,
+                                                      GtError *err)
+{
+  const GtFeatureIndexMappedSeqid *entry = fim->seqids + seqnum;
+  GtFeatureIndexMappedCache *cache = fim->cache + seqnum;
+  const GtIntervalIndexEntry *ivs;
+  GtGenomeNode *gn;
+  gt_assert(idx < entry->nof_features);
+  gt_mutex_lock(fim->mutex);
+  if (!cache->nodes) {
+    cache->nodes = gt_calloc(entry->nof_features, sizeof *cache->nodes);
+    cache->seqid = gt_str_new_cstr(gt_feature_index_mapped_string(fim,
+                                                                  entry->name));
+    cache->arena = gt_arena_new(GT_FEATURE_INDEX_MAPPED_CHUNKSIZE);
+  }
+  if (!(gn = cache->nodes[idx])) {
+    ivs = (const GtIntervalIndexEntry*)
+          ((const char*) fim->map + entry->intervals_offset);
+    gn = cache->nodes[idx] = gt_feature_index_mapped_build(fim, cache,
+                                                           ivs[idx].value,
+                                                           err);
+  }
+  gt_mutex_unlock(fim->mutex);
+  return gn;
+}
+
+static int gt_feature_index_mapped_read_only(GT_UNUSED GtFeatureIndex *gfi,
+                                             GtError *err)
+{
+  gt_error_check(err);
+  gt_error_set(err, "mapped feature index cannot be modified");
+  return -1;
+}
+
+static int gt_feature_index_mapped_add_region_node(GtFeatureIndex *gfi,
+                                                   GT_UNUSED GtRegionNode *rn,
+                                                   GtError *err)
+{
+  return gt_feature_index_mapped_read_only(gfi, err);
+}
+
+static int gt_feature_index_mapped_add_feature_node(GtFeatureIndex *gfi,
+                                                    GT_UNUSED GtFeatureNode *fn,
+                                                    GtError *err)
+{
+  return gt_feature_index_mapped_read_only(gfi, err);
+}
+
+static int gt_feature_index_mapped_remove_node(GtFeatureIndex *gfi,
+                                               GT_UNUSED GtFeatureNode *fn,
+                                               GtError *err)
+{
+  return gt_feature_index_mapped_read_only(gfi, err);
+}
+
+/* Stops at the first corrupt record, sets <err> and returns the features read
+   so far. */
+static GtArray* gt_feature_index_mapped_get_features_for_seqid(
+                                                           GtFeatureIndex *gfi,
+                                                           const char *seqid,
+                                                           GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  GtArray *a;
+  GtUword seqnum, i;
+  gt_error_check(err);
+  gt_assert(gfi && seqid);
+  fim = gt_feature_index_mapped_cast(gfi);
+  a = gt_array_new(sizeof (GtFeatureNode*));
+  seqnum = gt_feature_index_mapped_find_seqid(fim, seqid);
+  if (seqnum != GT_UNDEF_UWORD) {
+    for (i = 0; i < fim->seqids[seqnum].nof_features; i++) {
+      GtGenomeNode *gn = gt_feature_index_mapped_get_node(fim, seqnum, i, err);
+      if (!gn)
+        break;
+      gt_array_add(a, gn);
+    }
+  }
+  return a;
+}
+
+typedef struct {
+  GtFeatureIndexMapped *fim;
+  GtUword seqnum;
+  GtArray *results;
+  GtError *err;
+} GtFeatureIndexMappedCollectInfo;
+
+static int gt_feature_index_mapped_collect(GtUword idx, void *data)
+{
+  GtFeatureIndexMappedCollectInfo *info = data;
+  GtGenomeNode *gn = gt_feature_index_mapped_get_node(info->fim, info->seqnum,
+                                                      idx, info->err);
+  if (!gn)
+    return -1;
+  gt_array_add(info->results, gn);
+  return 0;
+}
+
+static int gt_feature_index_mapped_get_features_for_range(GtFeatureIndex *gfi,
+                                                       GtArray *results,
+                                                       const char *seqid,
+                                                       const GtRange *qry_range,
+                                                       GtError *err)
+{
+  GtFeatureIndexMappedCollectInfo info;
+  const GtFeatureIndexMappedSeqid *entry;
+  GtFeatureIndexMapped *fim;
+  gt_error_check(err);
+  gt_assert(gfi && results && seqid && qry_range);
+
+  fim = gt_feature_index_mapped_cast(gfi);
+  info.seqnum = gt_feature_index_mapped_find_seqid(fim, seqid);
+  if (info.seqnum == GT_UNDEF_UWORD) {
+    gt_error_set(err, "feature index does not contain the given sequence id");
+    return -1;
+  }
+  entry = fim->seqids + info.seqnum;
+  info.fim = fim;
+  info.results = results;
+  info.err = err;
+  if (gt_interval_index_entries_overlap((const GtIntervalIndexEntry*)
+                                        ((const char*) fim->map
+                                         + entry->intervals_offset),
+                                        entry->nof_features,
+                                        entry->root_level,
+                                        qry_range->start, qry_range->end,
+                                        gt_feature_index_mapped_collect,
+                                        &info))
+    return -1;
+  gt_array_sort_stable(results, (GtCompare) gt_genome_node_compare);
+  return 0;
+}
+
+static char* gt_feature_index_mapped_get_first_seqid(const GtFeatureIndex *gfi,
+                                                     GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  gt_error_check(err);
+  gt_assert(gfi);
+  fim = gt_feature_index_mapped_cast((GtFeatureIndex*) gfi);
+  if (fim->header->first_seqid == GT_UNDEF_UWORD) {
+    gt_error_set(err, "no sequence regions in index");
+    return NULL;
+  }
+  return gt_cstr_dup(gt_feature_index_mapped_string(fim,
+                                fim->seqids[fim->header->first_seqid].name));
+}
+
+static GtStrArray* gt_feature_index_mapped_get_seqids(const GtFeatureIndex *gfi,
+                                                      GT_UNUSED GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  GtStrArray *seqids;
+  GtUword i;
+  gt_assert(gfi);
+  fim = gt_feature_index_mapped_cast((GtFeatureIndex*) gfi);
+  seqids = gt_str_array_new();
+  for (i = 0; i < fim->header->nof_seqids; i++)
+    gt_str_array_add_cstr(seqids,
+                          gt_feature_index_mapped_string(fim,
+                                                         fim->seqids[i].name));
+  return seqids;
+}
+
+static int gt_feature_index_mapped_get_range_for_seqid(GtFeatureIndex *gfi,
+                                                       GtRange *range,
+                                                       const char *seqid,
+                                                       GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  GtUword seqnum;
+  gt_error_check(err);
+  gt_assert(gfi && range && seqid);
+  fim = gt_feature_index_mapped_cast(gfi);
+  if ((seqnum = gt_feature_index_mapped_find_seqid(fim, seqid))
+                                                            == GT_UNDEF_UWORD) {
+    gt_error_set(err, "sequence region '%s' does not exist in feature index",
+                 seqid);
+    return -1;
+  }
+  range->start = fim->seqids[seqnum].range_start;
+  range->end = fim->seqids[seqnum].range_end;
+  return 0;
+}
+
+static int gt_feature_index_mapped_get_orig_range_for_seqid(GtFeatureIndex
+                                                              *gfi,
+                                                            GtRange *range,
+                                                            const char *seqid,
+                                                            GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  GtUword seqnum;
+  gt_error_check(err);
+  gt_assert(gfi && range && seqid);
+  fim = gt_feature_index_mapped_cast(gfi);
+  if ((seqnum = gt_feature_index_mapped_find_seqid(fim, seqid))
+                                                            == GT_UNDEF_UWORD) {
+    gt_error_set(err, "sequence region '%s' does not exist in feature index",
+                 seqid);
+    return -1;
+  }
+  if (fim->seqids[seqnum].has_region) {
+    range->start = fim->seqids[seqnum].region_start;
+    range->end = fim->seqids[seqnum].region_end;
+  }
+  return 0;
+}
+
+static int gt_feature_index_mapped_has_seqid(const GtFeatureIndex *gfi,
+                                             bool *has_seqid,
+                                             const char *seqid,
+                                             GT_UNUSED GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  gt_assert(gfi && has_seqid && seqid);
+  fim = gt_feature_index_mapped_cast((GtFeatureIndex*) gfi);
+  *has_seqid = (gt_feature_index_mapped_find_seqid(fim, seqid)
+                                                             != GT_UNDEF_UWORD);
+  return 0;
+}
+
+static void gt_feature_index_mapped_delete(GtFeatureIndex *gfi)
+{
+  GtFeatureIndexMapped *fim;
+  GtUword i, j;
+  if (!gfi) return;
+  fim = gt_feature_index_mapped_cast(gfi);
+  if (fim->cache) {
+    for (i = 0; i < fim->header->nof_seqids; i++) {
+      GtFeatureIndexMappedCache *cache = fim->cache + i;
+      if (!cache->nodes)
+        continue;
+      for (j = 0; j < fim->seqids[i].nof_features; j++)
+        gt_genome_node_delete(cache->nodes[j]);
+      gt_free(cache->nodes);
+      gt_str_delete(cache->seqid);
+      gt_arena_delete(cache->arena);
+    }
+    gt_free(fim->cache);
+  }
+  if (fim->sources) {
+    for (i = 0; i < fim->header->nof_strings; i++)
+      gt_str_delete(fim->sources[i]);
+    gt_free(fim->sources);
+  }
+  gt_mutex_delete(fim->mutex);
+  gt_fa_xmunmap(fim->map);
+}
+
+const GtFeatureIndexClass* gt_feature_index_mapped_class(void)
+{
+  static const GtFeatureIndexClass *fic = NULL;
+  gt_class_alloc_lock_enter();
+  if (!fic) {
+    fic = gt_feature_index_class_new(sizeof (GtFeatureIndexMapped),
+                     gt_feature_index_mapped_add_region_node,
+                     gt_feature_index_mapped_add_feature_node,
+                     gt_feature_index_mapped_remove_node,
+                     gt_feature_index_mapped_get_features_for_seqid,
+                     gt_feature_index_mapped_get_features_for_range,
+                     gt_feature_index_mapped_get_first_seqid,
+                     NULL,
+                     gt_feature_index_mapped_get_seqids,
+                     gt_feature_index_mapped_get_range_for_seqid,
+                     gt_feature_index_mapped_get_orig_range_for_seqid,
+                     gt_feature_index_mapped_has_seqid,
+                     gt_feature_index_mapped_delete);
+  }
+  gt_class_alloc_lock_leave();
+  return fic;
+}
+
+/* Check that the sections described by <header> lie inside a file of <len>
+   bytes. */
+static int gt_feature_index_mapped_check_header(
+                                       const GtFeatureIndexMappedHeader *header,
+                                       size_t len)
+{
+  if (len < sizeof *header ||
+      memcmp(header->magic, GT_FEATURE_INDEX_MAPPED_MAGIC,
+             sizeof header->magic) != 0 ||
+      header->version != GT_FEATURE_INDEX_MAPPED_VERSION ||
+      header->wordsize != (GtUword) sizeof (GtUword) ||
+      header->filesize != (GtUword) len ||
+      header->stroffsets_offset != (GtUword) sizeof *header ||
+      header->strpool_offset < header->stroffsets_offset ||
+      header->seqids_offset < header->strpool_offset ||
+      header->records_offset < header->seqids_offset ||
+      header->records_offset > header->filesize ||
+      header->seqids_offset % sizeof (GtUword) != 0 ||
+      header->records_offset % sizeof (GtUword) != 0 ||
+      header->records_size > (header->filesize - header->records_offset)
+                             / sizeof (GtUword) ||
+      (header->strpool_offset - header->stroffsets_offset) / sizeof (GtUword)
+        != header->nof_strings ||
+      (header->records_offset - header->seqids_offset)
+        / sizeof (GtFeatureIndexMappedSeqid) < header->nof_seqids ||
+      (header->nof_seqids > 0 && header->first_seqid >= header->nof_seqids) ||
+      (header->nof_strings > 0 &&
+       (header->seqids_offset == header->strpool_offset ||
+        ((const char*) header)[header->seqids_offset - 1] != '\0')))
+    return -1;
+  return 0;
+}
+
+/* Check the names and interval tables of all sequence regions. */
+static int gt_feature_index_mapped_check_seqids(const GtFeatureIndexMapped *fim)
+{
+  const GtFeatureIndexMappedHeader *header = fim->header;
+  GtUword i, intervals_start = header->seqids_offset
+                               + header->nof_seqids
+                                 * sizeof (GtFeatureIndexMappedSeqid);
+  for (i = 0; i < header->nof_seqids; i++) {
+    const GtFeatureIndexMappedSeqid *entry = fim->seqids + i;
+    if (!gt_feature_index_mapped_valid_string(fim, entry->name) ||
+        entry->range_start > entry->range_end ||
+        (entry->has_region && entry->region_start > entry->region_end) ||
+        entry->intervals_offset < intervals_start ||
+        entry->intervals_offset > header->records_offset ||
+        entry->intervals_offset % sizeof (GtUword) != 0 ||
+        entry->nof_features > (header->records_offset
+                               - entry->intervals_offset)
+                              / sizeof (GtIntervalIndexEntry) ||
+        entry->root_level != (entry->nof_features > 0
+                              ? gt_determinebitspervalue(entry->nof_features)
+                                - 1
+                              : 0))
+      return -1;
+  }
+  return 0;
+}
+
+GtFeatureIndex* gt_feature_index_mapped_new(const char *filename,
+                                            GtError *err)
+{
+  GtFeatureIndexMapped *fim;
+  GtFeatureIndex *fi;
+  void *map;
+  size_t len;
+  gt_error_check(err);
+  gt_assert(filename);
+
+  if (!(map = gt_fa_mmap_read(filename, &len, err)))
+    return NULL;
+  if (gt_feature_index_mapped_check_header(map, len)) {
+    gt_error_set(err, "file '%s' is not a mapped feature index or is "
+                      "corrupt", filename);
+    gt_fa_xmunmap(map);
+    return NULL;
+  }
+  fi = gt_feature_index_create(gt_feature_index_mapped_class());
+  fim = gt_feature_index_mapped_cast(fi);
+  fim->map = map;
+  fim->header = map;
+  fim->stroffsets = (const GtUword*) ((const char*) map
+                                      + fim->header->stroffsets_offset);
+  fim->strpool = (const char*) map + fim->header->strpool_offset;
+  fim->seqids = (const GtFeatureIndexMappedSeqid*)
+                ((const char*) map + fim->header->seqids_offset);
+  fim->records = (const GtUword*) ((const char*) map
+                                   + fim->header->records_offset);
+  fim->cache = gt_calloc(GT_MAX(fim->header->nof_seqids, 1UL),
+                         sizeof *fim->cache);
+  fim->sources = gt_calloc(GT_MAX(fim->header->nof_strings, 1UL),
+                           sizeof *fim->sources);
+  fim->mutex = gt_mutex_new();
+  if (gt_feature_index_mapped_check_seqids(fim)) {
+    gt_error_set(err, "file '%s' is not a mapped feature index or is "
+                      "corrupt", filename);
+    gt_feature_index_delete(fi);
+    return NULL;
+  }
+  return fi;
+}
+
+#define GT_FIM_TEST_NOF_FEATURES 500
+#define GT_FIM_TEST_END 100000
+#define GT_FIM_TEST_WIDTH 3000
+
+/* Write the index <src> without the second half of its feature records to
+   <dest>. If <patch> is true, the header is adjusted to the new size, so that
+   only the record offsets point outside the file. */
+static void gt_feature_index_mapped_test_truncate(const char *src,
+                                                  GtStr *dest, bool patch)
+{
+  GtFeatureIndexMappedHeader header;
+  void *map;
+  size_t len;
+  FILE *fp;
+  map = gt_fa_xmmap_read(src, &len);
+  memcpy(&header, map, sizeof header);
+  header.records_size /= 2;
+  len = header.records_offset + header.records_size * sizeof (GtUword);
+  if (patch)
+    header.filesize = len;
+  fp = gt_xtmpfp(dest);
+  gt_xfwrite_one(&header, fp);
+  gt_xfwrite((const char*) map + sizeof header, sizeof (char),
+             len - sizeof header, fp);
+  gt_fa_xfclose(fp);
+  gt_fa_xmunmap(map);
+}
+
+int gt_feature_index_mapped_unit_test(GtError *err)
+{
+  GtFeatureIndex *fim = NULL, *fi;
+  GtNodeStream *array_in_stream;
+  GtArray *nodes, *res1, *res2;
+  GtStr *filename, *seqid;
+  GtStrArray *seqids = NULL;
+  GtRange rng;
+  FILE *fp;
+  GtUword i;
+  int had_err = 0;
+  gt_error_check(err);
+
+  /* build a memory index with nested and overlapping features, the same nodes
+     are written to the mapped index */
+  fi = gt_feature_index_memory_new();
+  nodes = gt_array_new(sizeof (GtGenomeNode*));
+  seqid = gt_str_new_cstr("testseqid");
+  for (i = 0; i < GT_FIM_TEST_NOF_FEATURES; i++) {
+    GtGenomeNode *gene, *exon;
+    GtUword start = 1 + gt_rand_max(GT_FIM_TEST_END),
+            end = start + gt_rand_max(GT_FIM_TEST_WIDTH);
+    gene = gt_feature_node_new(seqid, "gene", start, end, GT_STRAND_FORWARD);
+    exon = gt_feature_node_new(seqid, "exon", start, start + (end - start) / 2,
+                               GT_STRAND_FORWARD);
+    gt_feature_node_add_attribute((GtFeatureNode*) exon, "Name", "test");
+    gt_feature_node_set_score((GtFeatureNode*) exon, (float) i);
+    gt_feature_node_add_child((GtFeatureNode*) gene, (GtFeatureNode*) exon);
+    if (!had_err)
+      had_err = gt_feature_index_add_feature_node(fi, (GtFeatureNode*) gene,
+                                                  err);
+    gt_array_add(nodes, gene);
+  }
+  gt_str_delete(seqid);
+
+  filename = gt_str_new();
+  fp = gt_xtmpfp(filename);
+  gt_fa_xfclose(fp);
+  array_in_stream = gt_array_in_stream_new(nodes, NULL, err);
+  if (!had_err)
+    had_err = gt_feature_index_mapped_write(array_in_stream,
+                                            gt_str_get(filename), err);
+  gt_node_stream_delete(array_in_stream);
+  gt_array_delete(nodes);
+  if (!had_err) {
+    fim = gt_feature_index_mapped_new(gt_str_get(filename), err);
+    gt_ensure(fim != NULL);
+  }
+  if (!had_err) {
+    seqids = gt_feature_index_get_seqids(fim, err);
+    gt_ensure(seqids && gt_str_array_size(seqids) == 1);
+    if (!had_err) {
+      /* the index is read-only */
+      GtGenomeNode *gn = gt_feature_node_new_standard_gene();
+      gt_ensure(gt_feature_index_add_feature_node(fim, (GtFeatureNode*) gn,
+                                                  err) != 0);
+      gt_error_unset(err);
+      gt_genome_node_delete(gn);
+    }
+  }
+  res1 = gt_array_new(sizeof (GtFeatureNode*));
+  res2 = gt_array_new(sizeof (GtFeatureNode*));
+  for (i = 0; !had_err && i < 100UL; i++) {
+    GtUword j;
+    rng.start = 1 + gt_rand_max(GT_FIM_TEST_END);
+    rng.end = rng.start + gt_rand_max(GT_FIM_TEST_WIDTH);
+    gt_array_reset(res1);
+    gt_array_reset(res2);
+    had_err = gt_feature_index_get_features_for_range(fi, res1, "testseqid",
+                                                      &rng, err);
+    if (!had_err)
+      had_err = gt_feature_index_get_features_for_range(fim, res2, "testseqid",
+                                                        &rng, err);
+    gt_ensure(gt_array_size(res1) == gt_array_size(res2));
+    for (j = 0; !had_err && j < gt_array_size(res1); j++) {
+      GtFeatureNode *fn1 = *(GtFeatureNode**) gt_array_get(res1, j),
+                    *fn2 = *(GtFeatureNode**) gt_array_get(res2, j);
+      GtRange r1 = gt_genome_node_get_range((GtGenomeNode*) fn1),
+              r2 = gt_genome_node_get_range((GtGenomeNode*) fn2);
+      gt_ensure(gt_range_compare(&r1, &r2) == 0);
+      gt_ensure(gt_feature_node_number_of_children(fn1)
+                  == gt_feature_node_number_of_children(fn2));
+    }
+  }
+  gt_array_delete(res1);
+  gt_array_delete(res2);
+  gt_str_array_delete(seqids);
+  gt_feature_index_delete(fim);
+  gt_feature_index_delete(fi);
+
+  if (!had_err) {
+    /* a truncated index is rejected when it is opened */
+    GtStr *truncname = gt_str_new();
+    gt_feature_index_mapped_test_truncate(gt_str_get(filename), truncname,
+                                          false);
+    fim = gt_feature_index_mapped_new(gt_str_get(truncname), err);
+    gt_ensure(fim == NULL && gt_error_is_set(err));
+    gt_error_unset(err);
+    gt_xremove(gt_str_get(truncname));
+    gt_str_reset(truncname);
+    /* with a matching header, the missing records are detected on access */
+    gt_feature_index_mapped_test_truncate(gt_str_get(filename), truncname,
+                                          true);
+    fim = gt_feature_index_mapped_new(gt_str_get(truncname), err);
+    gt_ensure(fim != NULL);
+    if (!had_err) {
+      GtArray *features;
+      rng.start = 1;
+      rng.end = GT_FIM_TEST_END + GT_FIM_TEST_WIDTH;
+      res1 = gt_array_new(sizeof (GtFeatureNode*));
+      gt_ensure(gt_feature_index_get_features_for_range(fim, res1, "testseqid",
+                                                        &rng, err) != 0);
+      gt_ensure(gt_error_is_set(err));
+      gt_error_unset(err);
+      features = gt_feature_index_get_features_for_seqid(fim, "testseqid",
+                                                         err);
+      gt_ensure(gt_array_size(features) < GT_FIM_TEST_NOF_FEATURES);
+      gt_ensure(gt_error_is_set(err));
+      gt_error_unset(err);
+      gt_array_delete(features);
+      gt_array_delete(res1);
+    }
+    gt_feature_index_delete(fim);
+    gt_xremove(gt_str_get(truncname));
+    gt_str_delete(truncname);
+  }
+  gt_xremove(gt_str_get(filename));
+  gt_str_delete(filename);
+  return had_err;
+}
@@ -0,0 +1,48 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef FEATURE_INDEX_MAPPED_API_H
+#define FEATURE_INDEX_MAPPED_API_H
+
+#include "core/error_api.h"
+#include "extended/feature_index_api.h"
+#include "extended/node_stream_api.h"
+
+/* The <GtFeatureIndexMapped> class implements a read-only <GtFeatureIndex>
+   on top of an index file which is mapped into memory. The file stores the
+   features of each sequence region sorted by start position, together with
+   an implicit interval tree for range queries, and all strings are stored
+   only once. Opening an index does not depend on its size. A feature node
+   (with its children) is only built when a query returns it for the first
+   time, and is then kept until the index is deleted. */
+typedef struct GtFeatureIndexMapped GtFeatureIndexMapped;
+
+/* Read all nodes from <in_stream> and write their sequence regions and
+   features to a new mapped index file <filename>. Features with equal ranges
+   are returned by queries in the order of <in_stream>. Returns 0 on success,
+   a negative value otherwise. The message in <err> is set accordingly. */
+int             gt_feature_index_mapped_write(GtNodeStream *in_stream,
+                                              const char *filename,
+                                              GtError *err);
+
+/* Return a new <GtFeatureIndexMapped> object for the index file <filename>,
+   or NULL on error. The message in <err> is set accordingly.
+   The feature nodes returned by range and sequence region queries belong to
+   the index and must not be deleted by the caller. */
+GtFeatureIndex* gt_feature_index_mapped_new(const char *filename,
+                                            GtError *err);
+
+#endif
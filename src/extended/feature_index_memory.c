@@ -24,10 +24,11 @@
 #include "core/cstr_api.h"
 #include "core/ensure_api.h"
 #include "core/hashmap_api.h"
-#include "core/interval_tree.h"
+#include "core/interval_index_api.h"
 #include "core/ma_api.h"
 #include "core/minmax_api.h"
 #include "core/range_api.h"
+#include "core/thread_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "extended/feature_index_memory.h"
@@ -42,6 +43,7 @@ struct GtFeatureIndexMemory {
   GtHashmap *nodes_in_index;
   GtArray *ids;
   char *firstseqid;
+  GtMutex *mutex;
   GtUword nof_region_nodes,
                 reference_count,
                 nof_nodes;
@@ -51,14 +53,14 @@ struct GtFeatureIndexMemory {
         gt_feature_index_cast(gt_feature_index_memory_class(), FI)
 
 typedef struct {
-  GtIntervalTree *features;
+  GtIntervalIndex *features;
   GtRegionNode *region;
   GtRange dyn_range;
 } RegionInfo;
 
 static void region_info_delete(RegionInfo *info)
 {
-  gt_interval_tree_delete(info->features);
+  gt_interval_index_delete(info->features);
   if (info->region)
     gt_genome_node_delete((GtGenomeNode*)info->region);
   gt_free(info);
@@ -77,8 +79,8 @@ int gt_feature_index_memory_add_region_node(GtFeatureIndex *gfi,
   if (!gt_hashmap_get(fi->regions, seqid)) {
     info = gt_calloc(1, sizeof (RegionInfo));
     info->region = (GtRegionNode*) gt_genome_node_ref((GtGenomeNode*) rn);
-    info->features = gt_interval_tree_new((GtFree)
-                                          gt_genome_node_delete);
+    info->features = gt_interval_index_new((GtFree)
+                                           gt_genome_node_delete);
     info->dyn_range.start = ~0UL;
     info->dyn_range.end   = 0;
     gt_hashmap_add(fi->regions, seqid, info);
@@ -97,7 +99,6 @@ int gt_feature_index_memory_add_feature_node(GtFeatureIndex *gfi,
   GtFeatureIndexMemory *fi;
   GtRange node_range;
   RegionInfo *info;
-  GtIntervalTreeNode *new_node;
   gt_assert(gfi && fn);
 
   fi = gt_feature_index_memory_cast(gfi);
@@ -116,8 +117,8 @@ int gt_feature_index_memory_add_feature_node(GtFeatureIndex *gfi,
   {
     info = gt_calloc(1, sizeof (RegionInfo));
     info->region = NULL;
-    info->features = gt_interval_tree_new((GtFree)
-                                          gt_genome_node_delete);
+    info->features = gt_interval_index_new((GtFree)
+                                           gt_genome_node_delete);
     info->dyn_range.start = ~0UL;
     info->dyn_range.end   = 0;
     gt_hashmap_add(fi->regions, seqid, info);
@@ -125,29 +126,26 @@ int gt_feature_index_memory_add_feature_node(GtFeatureIndex *gfi,
       fi->firstseqid = seqid;
   }
 
-  /* add node to the appropriate array in the hashtable */
-  new_node = gt_interval_tree_node_new(gn, node_range.start, node_range.end);
-  gt_interval_tree_insert(info->features, new_node);
+  /* add node to the appropriate array in the hashtable, it becomes visible to
+     queries with the next build of the interval index */
+  gt_interval_index_add(info->features, gn, node_range.start, node_range.end);
   /* update dynamic range */
   info->dyn_range.start = GT_MIN(info->dyn_range.start, node_range.start);
   info->dyn_range.end = GT_MAX(info->dyn_range.end, node_range.end);
   return 0;
 }
 
-typedef struct {
-  GtIntervalTreeNode *node;
-  GtGenomeNode *genome_node;
-} GtFeatureIndexMemoryByPtrExtractInfo;
-
-static int gt_feature_index_memory_get_itreenode_by_ptr(GtIntervalTreeNode *n,
-                                                        void *data)
+/* Queries run under the read lock of the feature index, so the first query
+   after a modification builds the interval index of the region under
+   <fi->mutex>. */
+static GtIntervalIndex* gt_feature_index_memory_get_intervals(
+                                                       GtFeatureIndexMemory *fi,
+                                                       RegionInfo *info)
 {
-  GtFeatureIndexMemoryByPtrExtractInfo *i =
-                                   (GtFeatureIndexMemoryByPtrExtractInfo*) data;
-  if (i->genome_node == gt_interval_tree_node_get_data(n)) {
-    i->node = n;
-  }
-  return 0;
+  gt_mutex_lock(fi->mutex);
+  gt_interval_index_build(info->features);
+  gt_mutex_unlock(fi->mutex);
+  return info->features;
 }
 
 int gt_feature_index_memory_remove_node(GtFeatureIndex *gfi,
@@ -157,7 +155,6 @@ int gt_feature_index_memory_remove_node(GtFeatureIndex *gfi,
   char* seqid;
   GtFeatureIndexMemory *fi;
   GtRange node_range;
-  GtFeatureIndexMemoryByPtrExtractInfo info;
   RegionInfo *rinfo;
   gt_assert(gfi && gn);
 
@@ -169,24 +166,18 @@ int gt_feature_index_memory_remove_node(GtFeatureIndex *gfi,
   rinfo = (RegionInfo*) gt_hashmap_get(fi->regions, seqid);
   if (!rinfo)
     return 0;
-  info.genome_node = (GtGenomeNode*) gn;
-  info.node = NULL;
-
-  gt_interval_tree_iterate_overlapping(rinfo->features,
-                                   gt_feature_index_memory_get_itreenode_by_ptr,
-                                   node_range.start,
-                                   node_range.end,
-                                   &info);
-
-  if (info.node)
-    gt_interval_tree_remove(rinfo->features, info.node);
+  gt_hashmap_remove(fi->nodes_in_index, gn);
+  (void) gt_interval_index_remove(rinfo->features, gn, node_range.start,
+                                  node_range.end);
   return 0;
 }
 
-static int collect_features_from_itree(GtIntervalTreeNode *node, void *data)
+static int collect_features_from_index(void *value,
+                                       GT_UNUSED GtUword start,
+                                       GT_UNUSED GtUword end, void *data)
 {
   GtArray *a = (GtArray*) data;
-  GtGenomeNode *gn = (GtGenomeNode*) gt_interval_tree_node_get_data(node);
+  GtGenomeNode *gn = (GtGenomeNode*) value;
   gt_array_add(a, gn);
   return 0;
 }
@@ -204,11 +195,11 @@ GtArray* gt_feature_index_memory_get_features_for_seqid(GtFeatureIndex *gfi,
   a = gt_array_new(sizeof (GtFeatureNode*));
   ri = (RegionInfo*) gt_hashmap_get(fi->regions, seqid);
   if (ri) {
-    had_err = gt_interval_tree_traverse(ri->features,
-                                        collect_features_from_itree,
-                                        a);
+    had_err = gt_interval_index_traverse(
+                                 gt_feature_index_memory_get_intervals(fi, ri),
+                                 collect_features_from_index, a);
   }
-  gt_assert(!had_err);   /* collect_features_from_itree() is sane */
+  gt_assert(!had_err);   /* collect_features_from_index() is sane */
   return a;
 }
 
@@ -237,9 +228,11 @@ int gt_feature_index_memory_get_features_for_range(GtFeatureIndex *gfi,
     gt_error_set(err, "feature index does not contain the given sequence id");
     return -1;
   }
-  gt_interval_tree_find_all_overlapping(ri->features, qry_range->start,
-                                        qry_range->end, results);
-  gt_array_sort(results, gt_genome_node_cmp_range_start);
+  gt_interval_index_find_all_overlapping(
+                                  gt_feature_index_memory_get_intervals(fi, ri),
+                                  qry_range->start, qry_range->end, results);
+  /* equal ranges keep the order in which they were added */
+  gt_array_sort_stable(results, gt_genome_node_cmp_range_start);
   return 0;
 }
 
@@ -358,6 +351,7 @@ void gt_feature_index_memory_delete(GtFeatureIndex *gfi)
   fi = gt_feature_index_memory_cast(gfi);
   gt_hashmap_delete(fi->regions);
   gt_hashmap_delete(fi->nodes_in_index);
+  gt_mutex_delete(fi->mutex);
 }
 
 const GtFeatureIndexClass* gt_feature_index_memory_class(void)
@@ -393,6 +387,7 @@ GtFeatureIndex* gt_feature_index_memory_new(void)
   fim->regions = gt_hashmap_new(GT_HASH_STRING, NULL,
                                 (GtFree) region_info_delete);
   fim->nodes_in_index = gt_hashmap_new(GT_HASH_DIRECT, NULL, NULL);
+  fim->mutex = gt_mutex_new();
   return fi;
 }
 
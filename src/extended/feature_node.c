@@ -86,7 +86,8 @@ static void feature_node_free(GtGenomeNode *gn)
   GtFeatureNode *fn = gt_feature_node_cast(gn);
   gt_str_delete(fn->seqid);
   gt_str_delete(fn->source);
-  gt_tag_value_map_delete(fn->attributes);
+  if (!gn->arena)
+    gt_tag_value_map_delete(fn->attributes);
   if (fn->children) {
     GtDlistelem *dlistelem;
     for (dlistelem = gt_dlist_first(fn->children);
@@ -231,16 +232,11 @@ static void set_tree_status(unsigned int *bit_field, TreeStatus tree_status)
   *bit_field |= tree_status << TREE_STATUS_OFFSET;
 }
 
-GtGenomeNode* gt_feature_node_new(GtStr *seqid, const char *type,
-                                  GtUword start, GtUword end,
-                                  GtStrand strand)
+static void feature_node_init(GtGenomeNode *gn, GtStr *seqid,
+                              const char *type, GtUword start, GtUword end,
+                              GtStrand strand)
 {
-  GtGenomeNode *gn;
-  GtFeatureNode *fn;
-  gt_assert(seqid && type);
-  gt_assert(start <= end);
-  gn = gt_genome_node_create(gt_feature_node_class());
-  fn = gt_feature_node_cast(gn);
+  GtFeatureNode *fn = gt_feature_node_cast(gn);
   fn->seqid       = gt_str_ref(seqid);
   fn->source      = NULL;
   fn->type        = gt_symbol(type);
@@ -258,6 +254,29 @@ GtGenomeNode* gt_feature_node_new(GtStr *seqid, const char *type,
   set_tree_status(&fn->bit_field, IS_TREE);
   /* the DFS status is set to DFS_WHITE already */
   fn->representative = NULL;
+}
+
+GtGenomeNode* gt_feature_node_new(GtStr *seqid, const char *type,
+                                  GtUword start, GtUword end,
+                                  GtStrand strand)
+{
+  GtGenomeNode *gn;
+  gt_assert(seqid && type);
+  gt_assert(start <= end);
+  gn = gt_genome_node_create(gt_feature_node_class());
+  feature_node_init(gn, seqid, type, start, end, strand);
+  return gn;
+}
+
+GtGenomeNode* gt_feature_node_new_in_arena(GtStr *seqid, const char *type,
+                                           GtUword start, GtUword end,
+                                           GtStrand strand, GtArena *arena)
+{
+  GtGenomeNode *gn;
+  gt_assert(seqid && type && arena);
+  gt_assert(start <= end);
+  gn = gt_genome_node_create_in_arena(gt_feature_node_class(), arena);
+  feature_node_init(gn, seqid, type, start, end, strand);
   return gn;
 }
 
@@ -670,7 +689,17 @@ void gt_feature_node_add_attribute(GtFeatureNode *fn,
   gt_assert(fn && attr_name && attr_value);
   gt_assert(strlen(attr_name)); /* attribute name cannot be empty */
   gt_assert(strlen(attr_value)); /* attribute value cannot be empty */
-  if (!fn->attributes)
+  if (fn->parent_instance.arena) {
+    if (!fn->attributes) {
+      fn->attributes = gt_tag_value_map_new_in_arena(attr_name, attr_value,
+                                                    fn->parent_instance.arena);
+    }
+    else {
+      gt_tag_value_map_add_in_arena(&fn->attributes, attr_name, attr_value,
+                                    fn->parent_instance.arena);
+    }
+  }
+  else if (!fn->attributes)
     fn->attributes = gt_tag_value_map_new(attr_name, attr_value);
   else
     gt_tag_value_map_add(&fn->attributes, attr_name, attr_value);
@@ -687,7 +716,17 @@ void gt_feature_node_set_attribute(GtFeatureNode *fn,
   gt_assert(fn && attr_name && attr_value);
   gt_assert(strlen(attr_name)); /* attribute name cannot be empty */
   gt_assert(strlen(attr_value)); /* attribute value cannot be empty */
-  if (!fn->attributes)
+  if (fn->parent_instance.arena) {
+    if (!fn->attributes) {
+      fn->attributes = gt_tag_value_map_new_in_arena(attr_name, attr_value,
+                                                    fn->parent_instance.arena);
+    }
+    else {
+      gt_tag_value_map_set_in_arena(&fn->attributes, attr_name, attr_value,
+                                    fn->parent_instance.arena);
+    }
+  }
+  else if (!fn->attributes)
     fn->attributes = gt_tag_value_map_new(attr_name, attr_value);
   else
     gt_tag_value_map_set(&fn->attributes, attr_name, attr_value);
@@ -704,9 +743,15 @@ void gt_feature_node_remove_attribute(GtFeatureNode *fn,
   gt_assert(strlen(attr_name)); /* attribute name cannot be empty */
   gt_assert(fn->attributes); /* attribute list must exist already */
   if (gt_tag_value_map_size(fn->attributes) == 1) {
-    gt_tag_value_map_delete(fn->attributes);
+    if (!fn->parent_instance.arena)
+      gt_tag_value_map_delete(fn->attributes);
     fn->attributes = NULL;
-  } else
+  }
+  else if (fn->parent_instance.arena) {
+    gt_tag_value_map_remove_in_arena(&fn->attributes, attr_name,
+                                     fn->parent_instance.arena);
+  }
+  else
     gt_tag_value_map_remove(&fn->attributes, attr_name);
   if (fn->observer && fn->observer->attribute_deleted) {
     fn->observer->attribute_deleted(fn, attr_name, fn->observer->data);
@@ -18,6 +18,7 @@
 #ifndef FEATURE_NODE_H
 #define FEATURE_NODE_H
 
+#include "core/arena.h"
 #include "core/bittab.h"
 #include "core/range_api.h"
 #include "core/strand_api.h"
@@ -32,6 +33,12 @@ typedef int (*GtFeatureNodeTraverseFunc)(GtFeatureNode*, void*, GtError*);
 
 const GtGenomeNodeClass* gt_feature_node_class(void);
 
+/* Like <gt_feature_node_new()>, but the node and its attributes are allocated
+   from <arena>. */
+GtGenomeNode*  gt_feature_node_new_in_arena(GtStr *seqid, const char *type,
+                                            GtUword start, GtUword end,
+                                            GtStrand strand, GtArena *arena);
+
 GtFeatureNode* gt_feature_node_clone(const GtFeatureNode*);
 void           gt_feature_node_get_exons(GtFeatureNode*,
                                          GtArray *exon_features);
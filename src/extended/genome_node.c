@@ -26,6 +26,7 @@
 #include "core/msort.h"
 #include "core/parseutils_api.h"
 #include "core/queue_api.h"
+#include "core/striped_lock.h"
 #include "core/unused_api.h"
 #include "extended/eof_node_api.h"
 #include "extended/genome_node_rep.h"
@@ -33,6 +34,21 @@
 #include "extended/gff3_visitor_api.h"
 #include "extended/region_node_api.h"
 
+/* The reference count is changed atomically. gt_genome_node_unref() returns
+   the count before the decrement, if it was 0 the caller held the last
+   reference and the count is meaningless afterwards. */
+#ifdef GT_THREADS_ENABLED
+#define gt_genome_node_refcount_inc(GN) \
+        (void) __sync_add_and_fetch(&(GN)->reference_count, 1U)
+#define gt_genome_node_refcount_dec(GN) \
+        __sync_fetch_and_sub(&(GN)->reference_count, 1U)
+#else
+#define gt_genome_node_refcount_inc(GN) \
+        (void) (GN)->reference_count++
+#define gt_genome_node_refcount_dec(GN) \
+        (GN)->reference_count--
+#endif
+
 typedef struct {
   void *ptr;
   GtFree free_func;
@@ -41,9 +57,7 @@ typedef struct {
 GtGenomeNode* gt_genome_node_ref(GtGenomeNode *gn)
 {
   gt_assert(gn);
-  gt_rwlock_wrlock(gn->lock);
-  gn->reference_count++;
-  gt_rwlock_unlock(gn->lock);
+  gt_genome_node_refcount_inc(gn);
   return gn;
 }
 
@@ -82,6 +96,17 @@ static void userdata_delete(void *data)
   gt_free(ud);
 }
 
+/* Take the data out of <ud>, so that deleting <ud> does not free it. Returns
+   the data and stores the function to free it in <free_func>. */
+static void* userdata_detach(GtGenomeNodeUserData *ud, GtFree *free_func)
+{
+  void *ptr = ud->ptr;
+  *free_func = ud->free_func;
+  ud->free_func = NULL;
+  ud->ptr = NULL;
+  return ptr;
+}
+
 static int compare_genome_node_type(GtGenomeNode *gn_a, GtGenomeNode *gn_b)
 {
   void *rn_a, *rn_b, *sn_a, *sn_b, *en_a, *en_b;
@@ -223,9 +248,23 @@ GtGenomeNode* gt_genome_node_create(const GtGenomeNodeClass *gnc)
   gn->reference_count    = 0;
   gn->userdata           = NULL;
   gn->userdata_nof_items = 0;
-#ifdef GT_THREADS_ENABLED
-  gn->lock              = gt_rwlock_new();
-#endif
+  gn->arena              = NULL;
+  return gn;
+}
+
+GtGenomeNode* gt_genome_node_create_in_arena(const GtGenomeNodeClass *gnc,
+                                             GtArena *arena)
+{
+  GtGenomeNode *gn;
+  gt_assert(gnc && gnc->size && arena);
+  gn                     = gt_arena_alloc(arena, gnc->size);
+  gn->c_class            = gnc;
+  gn->filename           = NULL; /* means the node is generated */
+  gn->line_number        = 0;
+  gn->reference_count    = 0;
+  gn->userdata           = NULL;
+  gn->userdata_nof_items = 0;
+  gn->arena              = gt_arena_ref(arena);
   return gn;
 }
 
@@ -423,10 +462,13 @@ void gt_genome_node_add_user_data(GtGenomeNode *gn, const char *key, void *data,
                                   GtFree free_func)
 {
   GtGenomeNodeUserData *ud, *myud;
+  GtFree old_free_func = NULL;
+  void *old_ptr = NULL;
   gt_assert(gn && key);
   ud = gt_malloc(sizeof (GtGenomeNodeUserData));
   ud->ptr = data;
   ud->free_func = free_func;
+  gt_striped_lock_enter(gn);
   if (!gn->userdata) {
     gn->userdata = gt_hashmap_new(GT_HASH_STRING, gt_free_func,
                                   userdata_delete);
@@ -434,36 +476,49 @@ void gt_genome_node_add_user_data(GtGenomeNode *gn, const char *key, void *data,
   gt_assert(gn->userdata != NULL);
   /* remove old data entry first if there is one */
   if ((myud = gt_hashmap_get(gn->userdata, key)) != NULL) {
+    old_ptr = userdata_detach(myud, &old_free_func);
     gt_hashmap_remove(gn->userdata, key);
   } else {
     gn->userdata_nof_items++;
   }
   gt_hashmap_add(gn->userdata, gt_cstr_dup((char*) key), ud);
+  gt_striped_lock_leave(gn);
+  if (old_free_func)
+    old_free_func(old_ptr);
 }
 
 void* gt_genome_node_get_user_data(const GtGenomeNode *gn, const char *key)
 {
-  GtGenomeNodeUserData *ud;
+  GtGenomeNodeUserData *ud = NULL;
   gt_assert(gn && key);
-  if (!gn->userdata)
-    return NULL;
-  ud = (GtGenomeNodeUserData*) gt_hashmap_get(gn->userdata, key);
+  gt_striped_lock_enter(gn);
+  if (gn->userdata)
+    ud = (GtGenomeNodeUserData*) gt_hashmap_get(gn->userdata, key);
+  gt_striped_lock_leave(gn);
   return (ud ? ud->ptr : NULL);
 }
 
 void gt_genome_node_release_user_data(GtGenomeNode *gn, const char *key)
 {
   GtGenomeNodeUserData *ud;
+  GtFree free_func = NULL;
+  void *ptr = NULL;
   gt_assert(gn && key);
-  if (!gn->userdata)
-    return;
-  if ((ud = (GtGenomeNodeUserData*) gt_hashmap_get(gn->userdata, key))) {
+  gt_striped_lock_enter(gn);
+  if (gn->userdata &&
+      (ud = (GtGenomeNodeUserData*) gt_hashmap_get(gn->userdata, key))) {
+    ptr = userdata_detach(ud, &free_func);
     gt_hashmap_remove(gn->userdata, (char*) key);
     if (--gn->userdata_nof_items == 0) {
       gt_hashmap_delete(gn->userdata);
       gn->userdata = NULL;
     }
   }
+  gt_striped_lock_leave(gn);
+  /* the data is freed outside of the lock, <free_func> may access other
+     nodes */
+  if (free_func)
+    free_func(ptr);
 }
 
 int gt_genome_node_unit_test(GtError *err)
@@ -523,21 +578,16 @@ int gt_genome_node_unit_test(GtError *err)
 void gt_genome_node_delete(GtGenomeNode *gn)
 {
   if (!gn) return;
-  gt_rwlock_wrlock(gn->lock);
-  if (gn->reference_count) {
-    gn->reference_count--;
-    gt_rwlock_unlock(gn->lock);
+  if (gt_genome_node_refcount_dec(gn) > 0)
     return;
-  }
   gt_assert(gn->c_class);
   if (gn->c_class->free)
     gn->c_class->free(gn);
   gt_str_delete(gn->filename);
   if (gn->userdata)
     gt_hashmap_delete(gn->userdata);
-  gt_rwlock_unlock(gn->lock);
-#ifdef GT_THREADS_ENABLED
-  gt_rwlock_delete(gn->lock);
-#endif
-  gt_free(gn);
+  if (gn->arena)
+    gt_arena_delete(gn->arena); /* the memory is freed with the arena */
+  else
+    gt_free(gn);
 }
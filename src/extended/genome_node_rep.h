@@ -19,9 +19,9 @@
 #define GENOME_NODE_REP_H
 
 #include <stdio.h>
+#include "core/arena.h"
 #include "core/dlist.h"
 #include "core/hashmap_api.h"
-#include "core/thread_api.h"
 #include "extended/genome_node.h"
 
 typedef void    (*GtGenomeNodeFreeFunc)(GtGenomeNode*);
@@ -52,11 +52,10 @@ struct GtGenomeNode
   const GtGenomeNodeClass *c_class;
   GtStr *filename;
   GtHashmap *userdata; /* created on demand */
-  /* GtGenomeNodes are very space critical, therefore we can justify a bit
-     ifdef-hell here... */
-#ifdef GT_THREADS_ENABLED
-  GtRWLock *lock;
-#endif
+  GtArena *arena; /* the node memory belongs to <arena> if not NULL */
+  /* GtGenomeNodes are very space critical, therefore they do not carry a lock
+     of their own: the reference count is changed atomically and the user data
+     is protected by the striped lock (see core/striped_lock.h) */
   unsigned int line_number,
                reference_count,
                userdata_nof_items;
@@ -71,5 +70,9 @@ const GtGenomeNodeClass* gt_genome_node_class_new(size_t size,
                                        GtGenomeNodeChangeSeqidFunc change_seqid,
                                        GtGenomeNodeAcceptFunc accept);
 GtGenomeNode* gt_genome_node_create(const GtGenomeNodeClass*);
+/* Like <gt_genome_node_create()>, but the node is allocated from <arena>,
+   which is referenced until the node is deleted. */
+GtGenomeNode* gt_genome_node_create_in_arena(const GtGenomeNodeClass*,
+                                             GtArena *arena);
 
 #endif
@@ -0,0 +1,635 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <string.h>
+#include "core/array_api.h"
+#include "core/ensure_api.h"
+#include "core/fa_api.h"
+#include "core/hashmap_api.h"
+#include "core/ma_api.h"
+#include "core/undef_api.h"
+#include "core/xansi_api.h"
+#include "extended/comment_node_api.h"
+#include "extended/feature_node.h"
+#include "extended/feature_node_rep.h"
+#include "extended/genome_node_rep.h"
+#include "extended/genome_node_serializer.h"
+#include "extended/gff3_visitor.h"
+#include "extended/meta_node_api.h"
+#include "extended/node_visitor_api.h"
+#include "extended/region_node_api.h"
+#include "extended/sequence_node_api.h"
+
+/* node type tags */
+#define GT_GNS_FEATURE  'F'
+#define GT_GNS_REGION   'R'
+#define GT_GNS_SEQUENCE 'S'
+#define GT_GNS_COMMENT  'C'
+#define GT_GNS_META     'M'
+
+/* approximate allocation overhead per node (allocator bookkeeping, lock
+   and list element) */
+#define GT_GNS_NODE_OVERHEAD 64UL
+
+struct GtGenomeNodeDeserializer {
+  FILE *fp;
+  char *space;
+  GtUword allocated;
+  GtStr *buf,
+        *seqid,
+        *source,
+        *filename;
+  GtArray *nodes,
+          *children;
+};
+
+static void gns_write_uword(GtUword value, FILE *fp)
+{
+  gt_xfwrite_one(&value, fp);
+}
+
+/* strings are written with their length plus one, so that 0 denotes a
+   missing string */
+static void gns_write_string(const char *cstr, GtUword len, FILE *fp)
+{
+  if (cstr == NULL) {
+    gns_write_uword(0, fp);
+  } else {
+    gns_write_uword(len + 1, fp);
+    gt_xfwrite(cstr, sizeof (char), (size_t) len, fp);
+  }
+}
+
+static void gns_write_str(const GtStr *str, FILE *fp)
+{
+  if (str == NULL)
+    gns_write_string(NULL, 0, fp);
+  else
+    gns_write_string(gt_str_get(str), gt_str_length(str), fp);
+}
+
+static void gns_write_cstr(const char *cstr, FILE *fp)
+{
+  gns_write_string(cstr, cstr == NULL ? 0 : (GtUword) strlen(cstr), fp);
+}
+
+static void gns_write_origin(const GtGenomeNode *gn, FILE *fp)
+{
+  gns_write_str(gn->filename, fp);
+  gt_xfwrite_one(&gn->line_number, fp);
+}
+
+/* the length of a tag value map, including the terminating '\0' */
+static GtUword gns_tag_value_map_length(const char *map)
+{
+  const char *map_ptr = map;
+  do {
+    while (*map_ptr++ != '\0'); /* skip tag */
+    while (*map_ptr++ != '\0'); /* skip value */
+  } while (*map_ptr != '\0');
+  return (GtUword) (map_ptr - map + 1);
+}
+
+static void gns_collect(GtFeatureNode *fn, GtArray *nodes, GtHashmap *index)
+{
+  GtDlistelem *elem;
+  if (gt_hashmap_get(index, fn) != NULL)
+    return; /* node with multiple parents, already collected */
+  gt_array_add(nodes, fn);
+  gt_hashmap_add(index, fn, (void*) gt_array_size(nodes));
+  if (fn->children != NULL) {
+    for (elem = gt_dlist_first(fn->children); elem != NULL;
+         elem = gt_dlistelem_next(elem)) {
+      gns_collect(gt_dlistelem_get_data(elem), nodes, index);
+    }
+  }
+}
+
+static GtUword gns_index(GtHashmap *index, GtFeatureNode *fn)
+{
+  GtUword idx = (GtUword) gt_hashmap_get(index, fn);
+  return idx == 0 ? GT_UNDEF_UWORD : idx - 1;
+}
+
+static void gns_write_feature_node(GtFeatureNode *fn, GtHashmap *index,
+                                   FILE *fp)
+{
+  GtDlistelem *elem;
+  gns_write_origin((GtGenomeNode*) fn, fp);
+  gns_write_str(fn->seqid, fp);
+  gns_write_str(fn->source, fp);
+  gns_write_cstr(fn->type, fp);
+  gns_write_uword(fn->range.start, fp);
+  gns_write_uword(fn->range.end, fp);
+  gt_xfwrite_one(&fn->score, fp);
+  gt_xfwrite_one(&fn->bit_field, fp);
+  if (fn->attributes == NULL)
+    gns_write_uword(0, fp);
+  else {
+    GtUword len = gns_tag_value_map_length(fn->attributes);
+    gns_write_uword(len, fp);
+    gt_xfwrite(fn->attributes, sizeof (char), (size_t) len, fp);
+  }
+  gns_write_uword(fn->representative == NULL
+                  ? GT_UNDEF_UWORD
+                  : gns_index(index, fn->representative), fp);
+  gns_write_uword(fn->children == NULL ? 0 : gt_dlist_size(fn->children), fp);
+  if (fn->children != NULL) {
+    for (elem = gt_dlist_first(fn->children); elem != NULL;
+         elem = gt_dlistelem_next(elem)) {
+      gns_write_uword(gns_index(index, gt_dlistelem_get_data(elem)), fp);
+    }
+  }
+}
+
+static void gns_write_feature_tree(GtFeatureNode *fn, FILE *fp)
+{
+  GtArray *nodes = gt_array_new(sizeof (GtFeatureNode*));
+  GtHashmap *index = gt_hashmap_new(GT_HASH_DIRECT, NULL, NULL);
+  GtUword i;
+
+  gns_collect(fn, nodes, index);
+  gns_write_uword(gt_array_size(nodes), fp);
+  for (i = 0; i < gt_array_size(nodes); i++) {
+    gns_write_feature_node(*(GtFeatureNode**) gt_array_get(nodes, i), index,
+                           fp);
+  }
+  gt_hashmap_delete(index);
+  gt_array_delete(nodes);
+}
+
+int gt_genome_node_serialize(GtGenomeNode *gn, FILE *fp, GtError *err)
+{
+  GtFeatureNode *fn;
+  GtSequenceNode *sn;
+  GtCommentNode *cn;
+  GtMetaNode *mn;
+  gt_error_check(err);
+  gt_assert(gn && fp);
+
+  if ((fn = gt_feature_node_try_cast(gn))) {
+    gt_xfputc(GT_GNS_FEATURE, fp);
+    gns_write_feature_tree(fn, fp);
+  } else if (gt_region_node_try_cast(gn) != NULL) {
+    GtRange range = gt_genome_node_get_range(gn);
+    gt_xfputc(GT_GNS_REGION, fp);
+    gns_write_origin(gn, fp);
+    gns_write_str(gt_genome_node_get_seqid(gn), fp);
+    gns_write_uword(range.start, fp);
+    gns_write_uword(range.end, fp);
+  } else if ((sn = gt_sequence_node_try_cast(gn))) {
+    gt_xfputc(GT_GNS_SEQUENCE, fp);
+    gns_write_origin(gn, fp);
+    gns_write_cstr(gt_sequence_node_get_description(sn), fp);
+    gns_write_string(gt_sequence_node_get_sequence(sn),
+                     gt_sequence_node_get_sequence_length(sn), fp);
+  } else if ((cn = gt_comment_node_try_cast(gn))) {
+    gt_xfputc(GT_GNS_COMMENT, fp);
+    gns_write_origin(gn, fp);
+    gns_write_cstr(gt_comment_node_get_comment(cn), fp);
+  } else if ((mn = gt_meta_node_try_cast(gn))) {
+    gt_xfputc(GT_GNS_META, fp);
+    gns_write_origin(gn, fp);
+    gns_write_cstr(gt_meta_node_get_directive(mn), fp);
+    gns_write_cstr(gt_meta_node_get_data(mn), fp);
+  } else {
+    gt_error_set(err, "cannot serialize genome node of unknown type");
+    return -1;
+  }
+  return 0;
+}
+
+static GtUword gns_estimate_feature_size(GtFeatureNode *fn)
+{
+  GtUword size = (GtUword) sizeof (GtFeatureNode) + GT_GNS_NODE_OVERHEAD;
+  GtDlistelem *elem;
+  if (fn->attributes != NULL)
+    size += gns_tag_value_map_length(fn->attributes);
+  if (fn->children != NULL) {
+    for (elem = gt_dlist_first(fn->children); elem != NULL;
+         elem = gt_dlistelem_next(elem)) {
+      size += gns_estimate_feature_size(gt_dlistelem_get_data(elem));
+    }
+  }
+  return size;
+}
+
+GtUword gt_genome_node_estimate_size(GtGenomeNode *gn)
+{
+  GtFeatureNode *fn;
+  GtSequenceNode *sn;
+  GtCommentNode *cn;
+  GtMetaNode *mn;
+  gt_assert(gn);
+  if ((fn = gt_feature_node_try_cast(gn)))
+    return gns_estimate_feature_size(fn);
+  if ((sn = gt_sequence_node_try_cast(gn))) {
+    return (GtUword) gn->c_class->size + GT_GNS_NODE_OVERHEAD
+           + gt_sequence_node_get_sequence_length(sn)
+           + (GtUword) strlen(gt_sequence_node_get_description(sn));
+  }
+  if ((cn = gt_comment_node_try_cast(gn))) {
+    /* the comment is stored twice */
+    return (GtUword) gn->c_class->size + GT_GNS_NODE_OVERHEAD
+           + 2 * (GtUword) strlen(gt_comment_node_get_comment(cn));
+  }
+  if ((mn = gt_meta_node_try_cast(gn))) {
+    const char *data = gt_meta_node_get_data(mn);
+    return (GtUword) gn->c_class->size + GT_GNS_NODE_OVERHEAD
+           + (GtUword) strlen(gt_meta_node_get_directive(mn))
+           + (data == NULL ? 0 : (GtUword) strlen(data));
+  }
+  return (GtUword) gn->c_class->size + GT_GNS_NODE_OVERHEAD;
+}
+
+GtGenomeNodeDeserializer* gt_genome_node_deserializer_new(FILE *fp)
+{
+  GtGenomeNodeDeserializer *gnd = gt_malloc(sizeof *gnd);
+  gt_assert(fp);
+  gnd->fp = fp;
+  gnd->space = NULL;
+  gnd->allocated = 0;
+  gnd->buf = gt_str_new();
+  gnd->seqid = NULL;
+  gnd->source = NULL;
+  gnd->filename = NULL;
+  gnd->nodes = gt_array_new(sizeof (GtFeatureNode*));
+  gnd->children = gt_array_new(sizeof (GtUword));
+  return gnd;
+}
+
+void gt_genome_node_deserializer_delete(GtGenomeNodeDeserializer *gnd)
+{
+  if (!gnd) return;
+  gt_free(gnd->space);
+  gt_str_delete(gnd->buf);
+  gt_str_delete(gnd->seqid);
+  gt_str_delete(gnd->source);
+  gt_str_delete(gnd->filename);
+  gt_array_delete(gnd->nodes);
+  gt_array_delete(gnd->children);
+  gt_free(gnd);
+}
+
+static int gns_read(GtGenomeNodeDeserializer *gnd, void *ptr, size_t size,
+                    GtError *err)
+{
+  if (size > 0 && gt_xfread(ptr, size, (size_t) 1, gnd->fp) != (size_t) 1) {
+    gt_error_set(err, "unexpected end of serialized genome node file");
+    return -1;
+  }
+  return 0;
+}
+
+static int gns_read_uword(GtGenomeNodeDeserializer *gnd, GtUword *value,
+                          GtError *err)
+{
+  return gns_read(gnd, value, sizeof *value, err);
+}
+
+/* read a string into the buffer of <gnd>, <defined> is set to false for a
+   missing string */
+static int gns_read_string(GtGenomeNodeDeserializer *gnd, bool *defined,
+                           GtError *err)
+{
+  GtUword len;
+  gt_str_reset(gnd->buf);
+  if (gns_read_uword(gnd, &len, err) != 0)
+    return -1;
+  *defined = len > 0;
+  if (len > 1) {
+    if (len - 1 > gnd->allocated) {
+      gnd->allocated = len - 1;
+      gnd->space = gt_realloc(gnd->space, sizeof (char) * gnd->allocated);
+    }
+    if (gns_read(gnd, gnd->space, (size_t) (len - 1), err) != 0)
+      return -1;
+    gt_str_append_cstr_nt(gnd->buf, gnd->space, len - 1);
+  }
+  return 0;
+}
+
+/* read a string and return a reference to it, shared with the previous node
+   if equal to <*cache> */
+static int gns_read_cached_str(GtGenomeNodeDeserializer *gnd, GtStr **cache,
+                               GtStr **str, GtError *err)
+{
+  bool defined;
+  if (gns_read_string(gnd, &defined, err) != 0)
+    return -1;
+  if (!defined) {
+    *str = NULL;
+    return 0;
+  }
+  if (*cache == NULL || gt_str_cmp(*cache, gnd->buf) != 0) {
+    gt_str_delete(*cache);
+    *cache = gt_str_clone(gnd->buf);
+  }
+  *str = *cache;
+  return 0;
+}
+
+static int gns_read_origin(GtGenomeNodeDeserializer *gnd, GtStr **filename,
+                           unsigned int *line_number, GtError *err)
+{
+  if (gns_read_cached_str(gnd, &gnd->filename, filename, err) != 0 ||
+      gns_read(gnd, line_number, sizeof *line_number, err) != 0)
+    return -1;
+  return 0;
+}
+
+static int gns_read_feature_node(GtGenomeNodeDeserializer *gnd,
+                                 GtFeatureNode **fnp,
+                                 GtUword *representative, GtError *err)
+{
+  GtGenomeNode *gn = NULL;
+  GtFeatureNode *fn;
+  GtStr *filename, *seqid, *source;
+  GtUword start, end, len, i, child;
+  unsigned int line_number, bit_field;
+  bool defined;
+  float score;
+
+  if (gns_read_origin(gnd, &filename, &line_number, err) != 0 ||
+      gns_read_cached_str(gnd, &gnd->seqid, &seqid, err) != 0 ||
+      gns_read_cached_str(gnd, &gnd->source, &source, err) != 0 ||
+      gns_read_string(gnd, &defined, err) != 0)
+    return -1;
+  if (seqid == NULL) {
+    gt_error_set(err, "serialized feature node without sequence ID");
+    return -1;
+  }
+  if (gns_read_uword(gnd, &start, err) != 0 ||
+      gns_read_uword(gnd, &end, err) != 0)
+    return -1;
+  if (start > end) {
+    gt_error_set(err, "serialized feature node with invalid range");
+    return -1;
+  }
+  if (defined)
+    gn = gt_feature_node_new(seqid, gt_str_get(gnd->buf), start, end,
+                             GT_STRAND_UNKNOWN);
+  else
+    gn = gt_feature_node_new_pseudo(seqid, start, end, GT_STRAND_UNKNOWN);
+  fn = gt_feature_node_cast(gn);
+  if (filename != NULL)
+    gt_genome_node_set_origin(gn, filename, line_number);
+  if (source != NULL)
+    fn->source = gt_str_ref(source);
+  if (gns_read(gnd, &score, sizeof score, err) != 0 ||
+      gns_read(gnd, &bit_field, sizeof bit_field, err) != 0 ||
+      gns_read_uword(gnd, &len, err) != 0) {
+    gt_genome_node_delete(gn);
+    return -1;
+  }
+  fn->score = score;
+  /* the bit field is restored after the children have been added */
+  fn->bit_field = bit_field;
+  if (len > 0) {
+    fn->attributes = gt_malloc(sizeof (char) * len);
+    if (gns_read(gnd, fn->attributes, (size_t) len, err) != 0) {
+      gt_genome_node_delete(gn);
+      return -1;
+    }
+  }
+  if (gns_read_uword(gnd, representative, err) != 0 ||
+      gns_read_uword(gnd, &len, err) != 0) {
+    gt_genome_node_delete(gn);
+    return -1;
+  }
+  gt_array_add(gnd->children, len);
+  for (i = 0; i < len; i++) {
+    if (gns_read_uword(gnd, &child, err) != 0) {
+      gt_genome_node_delete(gn);
+      return -1;
+    }
+    gt_array_add(gnd->children, child);
+  }
+  *fnp = fn;
+  return 0;
+}
+
+static int gns_read_feature_tree(GtGenomeNodeDeserializer *gnd,
+                                 GtGenomeNode **gn, GtError *err)
+{
+  GtFeatureNode *fn, **nodes;
+  GtUword numofnodes, i, j, pos, numofchildren, *children, *representatives;
+  unsigned int *bit_fields;
+  bool *has_parent;
+  int had_err = 0;
+
+  if (gns_read_uword(gnd, &numofnodes, err) != 0)
+    return -1;
+  if (numofnodes == 0) {
+    gt_error_set(err, "serialized feature tree without nodes");
+    return -1;
+  }
+  gt_array_reset(gnd->nodes);
+  gt_array_reset(gnd->children);
+  representatives = gt_malloc(sizeof *representatives * numofnodes);
+  for (i = 0; !had_err && i < numofnodes; i++) {
+    had_err = gns_read_feature_node(gnd, &fn, representatives + i, err);
+    if (!had_err)
+      gt_array_add(gnd->nodes, fn);
+  }
+  nodes = gt_array_get_space(gnd->nodes);
+  children = gt_array_get_space(gnd->children);
+  /* validate the child indices before linking any nodes */
+  for (i = 0, pos = 0; !had_err && i < numofnodes; i++) {
+    numofchildren = children[pos++];
+    for (j = 0; !had_err && j < numofchildren; j++, pos++) {
+      if (children[pos] >= numofnodes || children[pos] == 0) {
+        gt_error_set(err, "serialized feature tree with invalid child");
+        had_err = -1;
+      }
+    }
+    if (!had_err && representatives[i] != GT_UNDEF_UWORD &&
+        representatives[i] >= numofnodes) {
+      gt_error_set(err, "serialized feature tree with invalid "
+                        "representative");
+      had_err = -1;
+    }
+  }
+  if (had_err) {
+    for (i = 0; i < gt_array_size(gnd->nodes); i++)
+      gt_genome_node_delete((GtGenomeNode*) nodes[i]);
+    gt_free(representatives);
+    return had_err;
+  }
+  bit_fields = gt_malloc(sizeof *bit_fields * numofnodes);
+  has_parent = gt_calloc((size_t) numofnodes, sizeof *has_parent);
+  for (i = 0; i < numofnodes; i++)
+    bit_fields[i] = nodes[i]->bit_field;
+  for (i = 0, pos = 0; i < numofnodes; i++) {
+    numofchildren = children[pos++];
+    for (j = 0; j < numofchildren; j++, pos++) {
+      fn = nodes[children[pos]];
+      /* every additional parent holds another reference */
+      if (has_parent[children[pos]])
+        (void) gt_genome_node_ref((GtGenomeNode*) fn);
+      has_parent[children[pos]] = true;
+      gt_feature_node_add_child(nodes[i], fn);
+    }
+  }
+  for (i = 0; i < numofnodes; i++) {
+    nodes[i]->bit_field = bit_fields[i];
+    if (representatives[i] != GT_UNDEF_UWORD)
+      nodes[i]->representative = nodes[representatives[i]];
+  }
+  *gn = (GtGenomeNode*) nodes[0];
+  gt_free(has_parent);
+  gt_free(bit_fields);
+  gt_free(representatives);
+  return 0;
+}
+
+int gt_genome_node_deserializer_next(GtGenomeNodeDeserializer *gnd,
+                                     GtGenomeNode **gn, GtError *err)
+{
+  GtUword start, end;
+  GtStr *filename = NULL, *seqid, *str = NULL;
+  unsigned int line_number = 0;
+  bool defined;
+  int cc, had_err = 0;
+  gt_error_check(err);
+  gt_assert(gnd && gn);
+
+  *gn = NULL;
+  if ((cc = gt_xfgetc(gnd->fp)) == EOF)
+    return 0;
+  if (cc == GT_GNS_FEATURE)
+    return gns_read_feature_tree(gnd, gn, err);
+  had_err = gns_read_origin(gnd, &filename, &line_number, err);
+  if (!had_err) {
+    switch (cc) {
+      case GT_GNS_REGION:
+        had_err = gns_read_cached_str(gnd, &gnd->seqid, &seqid, err);
+        if (!had_err && seqid == NULL) {
+          gt_error_set(err, "serialized region node without sequence ID");
+          had_err = -1;
+        }
+        if (!had_err)
+          had_err = gns_read_uword(gnd, &start, err);
+        if (!had_err)
+          had_err = gns_read_uword(gnd, &end, err);
+        if (!had_err)
+          *gn = gt_region_node_new(seqid, start, end);
+        break;
+      case GT_GNS_SEQUENCE:
+        had_err = gns_read_string(gnd, &defined, err);
+        if (!had_err) {
+          str = gt_str_clone(gnd->buf);
+          had_err = gns_read_string(gnd, &defined, err);
+        }
+        if (!had_err) {
+          GtStr *sequence = gt_str_clone(gnd->buf);
+          *gn = gt_sequence_node_new(gt_str_get(str), sequence);
+          gt_str_delete(sequence);
+        }
+        break;
+      case GT_GNS_COMMENT:
+        had_err = gns_read_string(gnd, &defined, err);
+        if (!had_err)
+          *gn = gt_comment_node_new(gt_str_get(gnd->buf));
+        break;
+      case GT_GNS_META:
+        had_err = gns_read_string(gnd, &defined, err);
+        if (!had_err) {
+          str = gt_str_clone(gnd->buf);
+          had_err = gns_read_string(gnd, &defined, err);
+        }
+        if (!had_err) {
+          *gn = gt_meta_node_new(gt_str_get(str),
+                                 defined ? gt_str_get(gnd->buf) : NULL);
+        }
+        break;
+      default:
+        gt_error_set(err, "unknown node type in serialized genome node file");
+        had_err = -1;
+    }
+  }
+  gt_str_delete(str);
+  if (!had_err && filename != NULL)
+    gt_genome_node_set_origin(*gn, filename, line_number);
+  return had_err;
+}
+
+static int gns_show(GtGenomeNode *gn, GtNodeVisitor *gv, GtError *err)
+{
+  return gt_genome_node_accept(gn, gv, err);
+}
+
+int gt_genome_node_serializer_unit_test(GtError *err)
+{
+  GtGenomeNodeDeserializer *gnd;
+  GtGenomeNode *nodes[5], *gn;
+  GtNodeVisitor *gv;
+  GtStr *seqid, *sequence, *expected, *result;
+  GtUword i;
+  FILE *fp;
+  int had_err = 0;
+  gt_error_check(err);
+
+  seqid = gt_str_new_cstr("ctg123");
+  sequence = gt_str_new_cstr("acgtacgt");
+  nodes[0] = gt_meta_node_new("gff-version", "3");
+  nodes[1] = gt_region_node_new(seqid, 1, 10000);
+  nodes[2] = gt_feature_node_new_standard_gene();
+  gt_feature_node_add_attribute((GtFeatureNode*) nodes[2], "ID", "gene1");
+  gt_feature_node_set_score((GtFeatureNode*) nodes[2], 0.5);
+  nodes[3] = gt_comment_node_new("a comment");
+  nodes[4] = gt_sequence_node_new("ctg123", sequence);
+  gt_str_delete(sequence);
+
+  expected = gt_str_new();
+  result = gt_str_new();
+  fp = gt_xtmpfp_generic(NULL, GT_TMPFP_AUTOREMOVE | GT_TMPFP_OPENBINARY);
+  gv = gt_gff3_visitor_new_to_str(expected);
+  for (i = 0; !had_err && i < 5UL; i++) {
+    had_err = gt_genome_node_serialize(nodes[i], fp, err);
+    if (!had_err)
+      had_err = gns_show(nodes[i], gv, err);
+  }
+  gt_node_visitor_delete(gv);
+
+  if (!had_err) {
+    rewind(fp);
+    gnd = gt_genome_node_deserializer_new(fp);
+    gv = gt_gff3_visitor_new_to_str(result);
+    for (i = 0; !had_err && i < 5UL; i++) {
+      had_err = gt_genome_node_deserializer_next(gnd, &gn, err);
+      gt_ensure(gn != NULL);
+      if (!had_err)
+        had_err = gns_show(gn, gv, err);
+      gt_genome_node_delete(gn);
+    }
+    if (!had_err) {
+      had_err = gt_genome_node_deserializer_next(gnd, &gn, err);
+      gt_ensure(gn == NULL);
+    }
+    gt_node_visitor_delete(gv);
+    gt_genome_node_deserializer_delete(gnd);
+    gt_ensure(!strcmp(gt_str_get(expected), gt_str_get(result)));
+  }
+
+  gt_fa_xfclose(fp);
+  for (i = 0; i < 5UL; i++)
+    gt_genome_node_delete(nodes[i]);
+  gt_str_delete(result);
+  gt_str_delete(expected);
+  gt_str_delete(seqid);
+  return had_err;
+}
@@ -0,0 +1,60 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef GENOME_NODE_SERIALIZER_H
+#define GENOME_NODE_SERIALIZER_H
+
+#include <stdio.h>
+#include "core/error_api.h"
+#include "extended/genome_node_api.h"
+
+/* The genome node serializer writes <GtGenomeNode>s to a binary file and reads
+   them back. Feature nodes are written together with all their descendants,
+   including nodes with multiple parents and multi-feature representatives.
+   The format is meant for temporary files written and read by the same
+   process (e.g. runs of an external sort) and is therefore neither portable
+   nor versioned. User data and observers attached to nodes are not
+   preserved. */
+typedef struct GtGenomeNodeDeserializer GtGenomeNodeDeserializer;
+
+/* Append <gn> to <fp>. Returns -1 and sets <err> if <gn> is of a node type
+   which cannot be serialized (EOF nodes and custom node types), 0
+   otherwise. */
+int                       gt_genome_node_serialize(GtGenomeNode *gn,
+                                                   FILE *fp, GtError *err);
+
+/* Return an estimate of the number of bytes occupied by <gn> in memory,
+   including all its descendants. */
+GtUword                   gt_genome_node_estimate_size(GtGenomeNode *gn);
+
+/* Return a new deserializer reading the nodes serialized to <fp>, starting at
+   the current file position. Strings equal to the ones of the previous node
+   are shared between the nodes read. */
+GtGenomeNodeDeserializer* gt_genome_node_deserializer_new(FILE *fp);
+
+/* Read the next node into <gn>, which is set to NULL at the end of file.
+   Returns -1 and sets <err> if the file is corrupt, 0 otherwise. */
+int                       gt_genome_node_deserializer_next(
+                                             GtGenomeNodeDeserializer *gnd,
+                                             GtGenomeNode **gn,
+                                             GtError *err);
+
+void                      gt_genome_node_deserializer_delete(
+                                             GtGenomeNodeDeserializer *gnd);
+
+int                       gt_genome_node_serializer_unit_test(GtError *err);
+
+#endif
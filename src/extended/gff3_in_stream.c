@@ -146,6 +146,12 @@ void gt_gff3_in_stream_enable_tidy_mode(GtGFF3InStream *is)
                                        is->cds_check_stream);
 }
 
+void gt_gff3_in_stream_enable_arena(GtGFF3InStream *is)
+{
+  gt_assert(is);
+  gt_gff3_in_stream_plain_enable_arena(is->gff3_in_stream_plain);
+}
+
 void gt_gff3_in_stream_fix_region_boundaries(GtGFF3InStream *is)
 {
   gt_assert(is);
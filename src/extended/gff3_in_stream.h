@@ -33,5 +33,7 @@ int                      gt_gff3_in_stream_set_offsetfile(GtNodeStream*, GtStr*,
 void                     gt_gff3_in_stream_disable_add_ids(GtNodeStream*);
 void                     gt_gff3_in_stream_fix_region_boundaries(
                                                                GtGFF3InStream*);
+/* Allocate the parsed feature nodes from arenas (see core/arena.h). */
+void                     gt_gff3_in_stream_enable_arena(GtGFF3InStream*);
 
 #endif
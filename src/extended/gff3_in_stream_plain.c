@@ -23,6 +23,7 @@
 #include "core/queue.h"
 #include "core/progressbar.h"
 #include "core/str_array.h"
+#include "core/thread_api.h"
 #include "extended/genome_node.h"
 #include "extended/gff3_in_stream_plain.h"
 #include "extended/gff3_parser.h"
@@ -38,7 +39,7 @@ struct GtGFF3InStreamPlain {
        stdin_processed,
        file_is_open,
        progress_bar;
-  GtFile *fpin;
+  GtLineSource *source;
   GtUint64 line_number;
   GtQueue *genome_node_buffer;
   GtGFF3Parser *gff3_parser;
@@ -103,13 +104,13 @@ static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
             had_err = -1;
             break;
           }
-          is->fpin = gt_file_xopen(NULL, "r");
+          is->source = gt_line_source_xnew(NULL);
           is->file_is_open = true;
           is->stdin_argument = true;
         }
         else {
-          is->fpin = gt_file_xopen(gt_str_array_get(is->files,
-                                                       is->next_file), "r");
+          is->source = gt_line_source_xnew(gt_str_array_get(is->files,
+                                                            is->next_file));
           is->file_is_open = true;
         }
         is->next_file++;
@@ -117,7 +118,7 @@ static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
       else {
         if (is->stdin_processed)
           break;
-        is->fpin = NULL;
+        is->source = gt_line_source_xnew(NULL);
         is->file_is_open = true;
       }
       is->line_number = 0;
@@ -126,7 +127,7 @@ static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
         printf("processing file \"%s\"\n", gt_str_array_size(is->files)
                ? gt_str_array_get(is->files, is->next_file-1) : "stdin");
       }
-      if (!had_err && is->fpin && is->progress_bar) {
+      if (!had_err && gt_str_array_size(is->files) && is->progress_bar) {
         gt_progressbar_start(&is->line_number,
                             gt_file_number_of_lines(gt_str_array_get(is->files,
                                                              is->next_file-1)));
@@ -139,19 +140,24 @@ static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
                   ? gt_str_array_get_str(is->files, is->next_file-1)
                   : is->stdinstr;
     /* read two nodes */
-    had_err = gt_gff3_parser_parse_genome_nodes(is->gff3_parser, &status_code,
-                                                is->genome_node_buffer,
-                                                is->used_types, filenamestr,
-                                                &is->line_number, is->fpin,
-                                                err);
+    had_err =
+      gt_gff3_parser_parse_genome_nodes_from_source(is->gff3_parser,
+                                                    &status_code,
+                                                    is->genome_node_buffer,
+                                                    is->used_types, filenamestr,
+                                                    &is->line_number,
+                                                    is->source, err);
     if (had_err)
       break;
     if (status_code != EOF) {
-      had_err = gt_gff3_parser_parse_genome_nodes(is->gff3_parser, &status_code,
-                                                  is->genome_node_buffer,
-                                                  is->used_types, filenamestr,
-                                                  &is->line_number, is->fpin,
-                                                  err);
+      had_err =
+        gt_gff3_parser_parse_genome_nodes_from_source(is->gff3_parser,
+                                                      &status_code,
+                                                      is->genome_node_buffer,
+                                                      is->used_types,
+                                                      filenamestr,
+                                                      &is->line_number,
+                                                      is->source, err);
       if (had_err)
         break;
     }
@@ -159,10 +165,10 @@ static int gff3_in_stream_plain_next(GtNodeStream *ns, GtGenomeNode **gn,
     if (status_code == EOF) {
       /* end of current file */
       if (is->progress_bar) gt_progressbar_stop();
-      gt_file_delete(is->fpin);
-      is->fpin = NULL;
-      is->file_is_open = false;
       gt_gff3_parser_reset(is->gff3_parser);
+      gt_line_source_delete(is->source);
+      is->source = NULL;
+      is->file_is_open = false;
       if (!gt_str_array_size(is->files)) {
         is->stdin_processed = true;
         break;
@@ -203,7 +209,7 @@ static void gff3_in_stream_plain_free(GtNodeStream *ns)
   gt_queue_delete(gff3_in_stream_plain->genome_node_buffer);
   gt_gff3_parser_delete(gff3_in_stream_plain->gff3_parser);
   gt_cstr_table_delete(gff3_in_stream_plain->used_types);
-  gt_file_delete(gff3_in_stream_plain->fpin);
+  gt_line_source_delete(gff3_in_stream_plain->source);
 }
 
 const GtNodeStreamClass* gt_gff3_in_stream_plain_class(void)
@@ -232,6 +238,11 @@ static GtNodeStream* gff3_in_stream_plain_new(GtStrArray *files,
   gff3_in_stream_plain->genome_node_buffer  = gt_queue_new();
   gff3_in_stream_plain->gff3_parser         = gt_gff3_parser_new(NULL);
   gff3_in_stream_plain->used_types          = gt_cstr_table_new();
+#ifdef GT_THREADS_ENABLED
+  /* with -j, preparse the input lines on the worker threads */
+  if (gt_jobs > 1)
+    gt_gff3_parser_enable_parallel_mode(gff3_in_stream_plain->gff3_parser);
+#endif
   return ns;
 }
 
@@ -312,6 +323,13 @@ void gt_gff3_in_stream_plain_enable_tidy_mode(GtNodeStream *ns)
   gt_gff3_parser_enable_tidy_mode(is->gff3_parser);
 }
 
+void gt_gff3_in_stream_plain_enable_arena(GtNodeStream *ns)
+{
+  GtGFF3InStreamPlain *is = gff3_in_stream_plain_cast(ns);
+  gt_assert(is);
+  gt_gff3_parser_enable_arena(is->gff3_parser);
+}
+
 GtNodeStream* gt_gff3_in_stream_plain_new_unsorted(int num_of_files,
                                                    const char **filenames)
 {
@@ -19,17 +19,20 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "core/arena.h"
 #include "core/array.h"
 #include "core/assert_api.h"
 #include "core/compat_api.h"
 #include "core/cstr_api.h"
 #include "core/hashmap_api.h"
+#include "core/line_source.h"
 #include "core/ma_api.h"
 #include "core/md5_seqid_api.h"
 #include "core/parseutils.h"
 #include "core/queue.h"
 #include "core/splitter.h"
 #include "core/symbol_api.h"
+#include "core/thread_pool.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
 #include "core/warning_api.h"
@@ -48,6 +51,57 @@
 #include "extended/region_node.h"
 #include "extended/xrf_checker_api.h"
 
+/* feature nodes of one sequence region are allocated from the same arena,
+   which is replaced when it exceeds this size */
+#define GT_GFF3_PARSER_ARENA_CHUNKSIZE  (64UL << 10)
+#define GT_GFF3_PARSER_ARENA_MAXSIZE    (1UL << 20)
+
+/* in parallel mode the input is read ahead in chunks, which end at a
+   terminator (###) or in front of a change of the seqid once they contain
+   this many lines, but contain at most four times as many lines. The lines of
+   a chunk are preparsed by tasks of this many lines each. */
+#define GT_GFF3_PARSER_BATCH_LINES      4096UL
+#define GT_GFF3_PARSER_BATCH_MAXLINES   (4 * GT_GFF3_PARSER_BATCH_LINES)
+#define GT_GFF3_PARSER_BATCH_GRAIN      256UL
+
+/* The columns of a feature line, split and checked in advance, including its
+   tag/value pairs of attributes. Only lines which would neither cause a
+   warning nor an error are preparsed, all other lines are left for the
+   sequential parser to report. The sequential parser only processes the
+   attributes which relate the feature to others or depend on its state. */
+typedef struct {
+  char *tokens[9],
+       **attributes; /* tags and values in turns */
+  GtUword nof_attributes;
+  GtRange range;
+  float score;
+  GtStrand strand;
+  GtPhase phase;
+  bool score_is_defined,
+       valid;
+} GFF3FeatureFields;
+
+typedef struct GFF3LineBatch GFF3LineBatch;
+
+typedef struct {
+  GFF3LineBatch *batch;
+  GtArray *attributes; /* the attributes of the preparsed lines */
+  GtUword start,
+          end;
+} GFF3BatchTask;
+
+struct GFF3LineBatch {
+  GtStr *lines[GT_GFF3_PARSER_BATCH_MAXLINES]; /* allocated when used */
+  GFF3FeatureFields fields[GT_GFF3_PARSER_BATCH_MAXLINES];
+  GFF3BatchTask tasks[GT_GFF3_PARSER_BATCH_MAXLINES
+                      / GT_GFF3_PARSER_BATCH_GRAIN];
+  GtGFF3Parser *parser;
+  GtThreadPoolGroup *group; /* the reading and preparsing tasks */
+  GtUword size, /* number of lines in the batch */
+          next; /* next line to be parsed */
+  bool pending; /* tasks have been submitted and not waited for */
+};
+
 struct GtGFF3Parser {
   GtFeatureInfo *feature_info;
   GtHashmap *seqid_to_ssr_mapping, /* maps seqids to simple sequence regions */
@@ -59,7 +113,23 @@ struct GtGFF3Parser {
        tidy,
        fasta_parsing, /* parser is in FASTA parsing mode */
        eof_emitted,
-       gvf_mode;
+       gvf_mode,
+       arena_mode,
+       parallel_mode,
+       read_ahead_done, /* EOF or FASTA section reached by the read ahead */
+       has_carried_line;
+  GFF3LineBatch *current_batch, /* lines being parsed */
+                *next_batch; /* lines being preparsed, only in parallel mode */
+  GtStr *carried_line, /* first line of the next batch, read by the last one */
+        *batch_seqid; /* seqid of the last feature line read ahead */
+  GtLineSource *read_ahead_source,
+               *file_source; /* wraps the <GtFile> given to the parser */
+  GtArena *arena; /* current arena, only used in arena mode */
+  GtStr *arena_seqid; /* seqid of the nodes in <arena> */
+  GtSplitter *line_splitter, /* splitters are kept to reuse their buffers */
+             *attribute_splitter,
+             *tag_value_splitter,
+             *parent_splitter;
   GtGenomeNode *gff3_pragma;
   GtWord offset;
   GtMapping *offset_mapping;
@@ -110,6 +180,10 @@ GtGFF3Parser* gt_gff3_parser_new(GtTypeChecker *type_checker)
   parser->type_checker = type_checker ? gt_type_checker_ref(type_checker)
                                       : NULL;
   parser->xrf_checker = NULL;
+  parser->line_splitter = gt_splitter_new();
+  parser->attribute_splitter = gt_splitter_new();
+  parser->tag_value_splitter = gt_splitter_new();
+  parser->parent_splitter = gt_splitter_new();
   return parser;
 }
 
@@ -179,6 +253,76 @@ void gt_gff3_parser_enable_tidy_mode(GtGFF3Parser *parser)
   parser->tidy = true;
 }
 
+void gt_gff3_parser_enable_arena(GtGFF3Parser *parser)
+{
+  gt_assert(parser);
+  parser->arena_mode = true;
+}
+
+static GFF3LineBatch* gff3_line_batch_new(GtGFF3Parser *parser)
+{
+  GFF3LineBatch *batch = gt_calloc(1, sizeof *batch);
+  GtUword i;
+  batch->parser = parser;
+  for (i = 0; i < GT_GFF3_PARSER_BATCH_MAXLINES / GT_GFF3_PARSER_BATCH_GRAIN;
+       i++) {
+    batch->tasks[i].batch = batch;
+    batch->tasks[i].attributes = gt_array_new(sizeof (char*));
+  }
+  batch->group = gt_thread_pool_group_new();
+  return batch;
+}
+
+static void gff3_line_batch_delete(GFF3LineBatch *batch)
+{
+  GtUword i;
+  if (!batch) return;
+  gt_thread_pool_group_wait(batch->group);
+  gt_thread_pool_group_delete(batch->group);
+  for (i = 0; i < GT_GFF3_PARSER_BATCH_MAXLINES / GT_GFF3_PARSER_BATCH_GRAIN;
+       i++) {
+    gt_array_delete(batch->tasks[i].attributes);
+  }
+  for (i = 0; i < GT_GFF3_PARSER_BATCH_MAXLINES; i++)
+    gt_str_delete(batch->lines[i]);
+  gt_free(batch);
+}
+
+void gt_gff3_parser_enable_parallel_mode(GtGFF3Parser *parser)
+{
+  gt_assert(parser && !parser->current_batch);
+  parser->parallel_mode = true;
+  parser->current_batch = gff3_line_batch_new(parser);
+  parser->next_batch = gff3_line_batch_new(parser);
+  parser->carried_line = gt_str_new();
+  parser->batch_seqid = gt_str_new();
+}
+
+static void release_arena(GtGFF3Parser *parser)
+{
+  gt_arena_delete(parser->arena);
+  parser->arena = NULL;
+  gt_str_delete(parser->arena_seqid);
+  parser->arena_seqid = NULL;
+}
+
+/* Return the arena for a new feature node on <seqid>. */
+static GtArena* get_arena(GtGFF3Parser *parser, GtStr *seqid)
+{
+  gt_assert(parser && parser->arena_mode && seqid);
+  if (parser->arena &&
+      (gt_str_cmp(parser->arena_seqid, seqid) ||
+       gt_arena_size(parser->arena) >= GT_GFF3_PARSER_ARENA_MAXSIZE)) {
+    /* the nodes keep the old arena alive as long as they need it */
+    release_arena(parser);
+  }
+  if (!parser->arena) {
+    parser->arena = gt_arena_new(GT_GFF3_PARSER_ARENA_CHUNKSIZE);
+    parser->arena_seqid = gt_str_ref(seqid);
+  }
+  return parser->arena;
+}
+
 static int offset_possible(const GtRange *range, GtWord offset,
                            const char *filename, unsigned int line_number,
                            GtError *err)
@@ -774,7 +918,8 @@ static int process_child(GtGenomeNode *child, GtSplitter *parent_splitter,
       gt_genome_node_delete(child);
       had_err = -1;
     }
-    if (!had_err && gt_genome_node_get_line_number(parent_gf) < last_terminator) {
+    if (!had_err &&
+        gt_genome_node_get_line_number(parent_gf) < last_terminator) {
       gt_error_set(err, "the child with %s \"%s\" on line %u in file "
                    "\"%s\" is separated from its corresponding %s on line %u "
                    "by terminator %s on line %u", GT_GFF_PARENT, parent,
@@ -852,7 +997,7 @@ static int process_parent_attr(char *parent_attr, GtGenomeNode *feature_node,
                                const char *filename, unsigned int line_number,
                                GtError *err)
 {
-  GtSplitter *parent_splitter;
+  GtSplitter *parent_splitter = parser->parent_splitter;
   GtStrArray *missing_parents = NULL;
   bool orphaned_parent = false;
   GtGenomeNode* parent_gf;
@@ -863,7 +1008,7 @@ static int process_parent_attr(char *parent_attr, GtGenomeNode *feature_node,
   gt_error_check(err);
   gt_assert(parent_attr);
 
-  parent_splitter = gt_splitter_new();
+  gt_splitter_reset(parent_splitter);
   gt_splitter_split(parent_splitter, parent_attr, strlen(parent_attr), ',');
   gt_assert(gt_splitter_size(parent_splitter));
 
@@ -906,7 +1051,6 @@ static int process_parent_attr(char *parent_attr, GtGenomeNode *feature_node,
     *is_child = true;
   }
 
-  gt_splitter_delete(parent_splitter);
   gt_str_array_delete(missing_parents);
 
   return had_err;
@@ -1209,13 +1353,122 @@ static bool invalid_uppercase_gvf_attribute(const char *attr_tag)
           strcmp(attr_tag, GT_GVF_ZYGOSITY));
 }
 
-static int parse_attributes(char *attributes, GtGenomeNode *feature_node,
-                            bool *is_child, GtGFF3Parser *parser,
-                            const char *seqid, GtQueue *genome_nodes,
-                            const char *filename, unsigned int line_number,
-                            GtError *err)
+/* Process the attribute <attr_tag>=<attr_value> of <feature_node>, which has
+   been added to it already. The values of the ID and Parent attributes are
+   stored in <id_value> and <parent_value> to be processed later. If the
+   attribute has been <preparsed>, its value has been checked already. */
+static int process_attribute(char *attr_tag, char *attr_value,
+                             GtGenomeNode *feature_node, bool preparsed,
+                             char **id_value, char **parent_value,
+                             GtGFF3Parser *parser, const char *seqid,
+                             const char *filename, unsigned int line_number,
+                             GtError *err)
+{
+  int had_err = 0;
+  gt_error_check(err);
+  if (!strcmp(attr_tag, GT_GFF_ID))
+    *id_value = attr_value; /* process later */
+  else if (!strcmp(attr_tag, GT_GFF_PARENT))
+    *parent_value = attr_value; /* process later */
+  else if (!strcmp(attr_tag, GT_GFF_IS_CIRCULAR)) {
+    SimpleSequenceRegion *ssr;
+    if (strcmp(attr_value, "true")) {
+      gt_error_set(err, "value \"%s\" of %s attribute on line %u in file "
+                   "\"%s\" does not equal \"true\"", attr_value,
+                   GT_GFF_IS_CIRCULAR, line_number, filename);
+      had_err = -1;
+    }
+    ssr = gt_hashmap_get(parser->seqid_to_ssr_mapping, seqid);
+    gt_assert(ssr); /* XXX */
+    gt_assert(!ssr->is_circular); /* XXX */
+    ssr->is_circular = true;
+  }
+  else if (!strcmp(attr_tag, GT_GFF_TARGET) && !preparsed) {
+    /* the value of ``Target'' attributes have a special syntax which is
+       checked here */
+    had_err = gt_gff3_parser_parse_target_attributes(attr_value, NULL, NULL,
+                                                     NULL, NULL, filename,
+                                                     line_number, err);
+    if (had_err && parser->tidy) {
+      GtStrArray *target_ids;
+      GtArray *target_ranges, *target_strands;
+      /* try to tidy up the ``Target'' attributes */
+      gt_error_unset(err);
+      target_ids = gt_str_array_new();
+      target_ranges = gt_array_new(sizeof (GtRange));
+      target_strands = gt_array_new(sizeof (GtStrand));
+      had_err = gt_gff3_parser_parse_all_target_attributes(attr_value, true,
+                                                           target_ids,
+                                                           target_ranges,
+                                                           target_strands,
+                                                           filename,
+                                                           line_number,
+                                                           err);
+      if (!had_err) {
+        GtStr *new_target = gt_str_new();
+        gt_gff3_parser_build_target_str(new_target, target_ids,
+                                        target_ranges, target_strands);
+        gt_feature_node_set_attribute((GtFeatureNode*) feature_node,
+                                      GT_GFF_TARGET,
+                                      gt_str_get(new_target));
+        gt_str_delete(new_target);
+      }
+      gt_array_delete(target_strands);
+      gt_array_delete(target_ranges);
+      gt_str_array_delete(target_ids);
+    }
+  }
+  else if (!strcmp(attr_tag, GT_GFF_DBXREF)
+             || !strcmp(attr_tag, GT_GFF_ONTOLOGY_TERM)) {
+    if (parser->xrf_checker) {
+      if (!gt_xrf_checker_is_valid(parser->xrf_checker, attr_value, err)) {
+        had_err = -1;
+      }
+    }
+  }
+  else if (parser->type_checker && !strcmp(attr_tag, GT_GFF_GAP)) {
+    GtGapStr *gs = NULL;
+    GtRange rng = gt_genome_node_get_range(feature_node);
+    if (gt_type_checker_is_a(parser->type_checker,
+                             gt_symbol("protein_match"),
+                             gt_feature_node_get_type((GtFeatureNode*)
+                                                      feature_node))) {
+      gs = gt_gap_str_new_protein(attr_value, err);
+    } else {
+      gs = gt_gap_str_new_nucleotide(attr_value, err);
+    }
+    if (!gs) {
+      gt_assert(gt_error_is_set(err));
+      had_err = -1;
+    }
+    if (!had_err) {
+      if (gt_range_length(&rng) != gt_gap_str_length_reference(gs)) {
+        gt_error_set(err, "length of aligned reference in %s attribute on "
+                          "line %u in file \"%s\" (" GT_WU ") does not "
+                          "match the length of its %s feature (" GT_WU ")",
+                     GT_GFF_GAP, line_number, filename,
+                     gt_gap_str_length_reference(gs),
+                     gt_feature_node_get_type((GtFeatureNode*)
+                                              feature_node),
+                     gt_range_length(&rng));
+        had_err = -1;
+      }
+    }
+    gt_gap_str_delete(gs);
+  }
+  return had_err;
+}
+
+/* Parse the <attributes> of <feature_node>, or add the ones given in
+   <fields> if its line has been preparsed. */
+static int parse_attributes(char *attributes, const GFF3FeatureFields *fields,
+                            GtGenomeNode *feature_node, bool *is_child,
+                            GtGFF3Parser *parser, const char *seqid,
+                            GtQueue *genome_nodes, const char *filename,
+                            unsigned int line_number, GtError *err)
 {
-  GtSplitter *attribute_splitter, *tmp_splitter, *parent_splitter;
+  GtSplitter *attribute_splitter = parser->attribute_splitter,
+             *tmp_splitter = parser->tag_value_splitter;
   char *id_value = NULL, *parent_value = NULL;
   GtUword i;
   int had_err = 0;
@@ -1223,12 +1476,24 @@ static int parse_attributes(char *attributes, GtGenomeNode *feature_node,
   gt_error_check(err);
   gt_assert(attributes);
 
-  attribute_splitter = gt_splitter_new();
-  tmp_splitter = gt_splitter_new();
-  parent_splitter = gt_splitter_new();
-  gt_splitter_split(attribute_splitter, attributes, strlen(attributes), ';');
+  /* the tags and values of preparsed lines have been checked already */
+  for (i = 0; fields && !had_err && i < fields->nof_attributes; i++) {
+    gt_feature_node_add_attribute((GtFeatureNode*) feature_node,
+                                  fields->attributes[2 * i],
+                                  fields->attributes[2 * i + 1]);
+    had_err = process_attribute(fields->attributes[2 * i],
+                                fields->attributes[2 * i + 1], feature_node,
+                                true, &id_value, &parent_value, parser, seqid,
+                                filename, line_number, err);
+  }
+
+  if (!fields) {
+    gt_splitter_reset(attribute_splitter);
+    gt_splitter_split(attribute_splitter, attributes, strlen(attributes), ';');
+  }
 
-  for (i = 0; !had_err && i < gt_splitter_size(attribute_splitter); i++) {
+  for (i = 0; !fields && !had_err && i < gt_splitter_size(attribute_splitter);
+       i++) {
     const char *old_value;
     bool attr_valid = true;
     char *attr_tag = NULL,
@@ -1355,96 +1620,9 @@ static int parse_attributes(char *attributes, GtGenomeNode *feature_node,
     }
     /* some attributes require special care */
     if (!had_err && attr_valid) {
-      if (!strcmp(attr_tag, GT_GFF_ID))
-        id_value = attr_value; /* process later */
-      else if (!strcmp(attr_tag, GT_GFF_PARENT))
-        parent_value = attr_value; /* process later */
-      else if (!strcmp(attr_tag, GT_GFF_IS_CIRCULAR)) {
-        SimpleSequenceRegion *ssr;
-        if (strcmp(attr_value, "true")) {
-          gt_error_set(err, "value \"%s\" of %s attribute on line %u in file "
-                       "\"%s\" does not equal \"true\"", attr_value,
-                       GT_GFF_IS_CIRCULAR, line_number, filename);
-          had_err = -1;
-        }
-        ssr = gt_hashmap_get(parser->seqid_to_ssr_mapping, seqid);
-        gt_assert(ssr); /* XXX */
-        gt_assert(!ssr->is_circular); /* XXX */
-        ssr->is_circular = true;
-      }
-      else if (!strcmp(attr_tag, GT_GFF_TARGET)) {
-        /* the value of ``Target'' attributes have a special syntax which is
-           checked here */
-        had_err = gt_gff3_parser_parse_target_attributes(attr_value, NULL, NULL,
-                                                         NULL, NULL, filename,
-                                                         line_number, err);
-        if (had_err && parser->tidy) {
-          GtStrArray *target_ids;
-          GtArray *target_ranges, *target_strands;
-          /* try to tidy up the ``Target'' attributes */
-          gt_error_unset(err);
-          target_ids = gt_str_array_new();
-          target_ranges = gt_array_new(sizeof (GtRange));
-          target_strands = gt_array_new(sizeof (GtStrand));
-          had_err = gt_gff3_parser_parse_all_target_attributes(attr_value, true,
-                                                               target_ids,
-                                                               target_ranges,
-                                                               target_strands,
-                                                               filename,
-                                                               line_number,
-                                                               err);
-          if (!had_err) {
-            GtStr *new_target = gt_str_new();
-            gt_gff3_parser_build_target_str(new_target, target_ids,
-                                            target_ranges, target_strands);
-            gt_feature_node_set_attribute((GtFeatureNode*) feature_node,
-                                          GT_GFF_TARGET,
-                                          gt_str_get(new_target));
-            gt_str_delete(new_target);
-          }
-          gt_array_delete(target_strands);
-          gt_array_delete(target_ranges);
-          gt_str_array_delete(target_ids);
-        }
-      }
-      else if (!strcmp(attr_tag, GT_GFF_DBXREF)
-                 || !strcmp(attr_tag, GT_GFF_ONTOLOGY_TERM)) {
-        if (parser->xrf_checker) {
-          if (!gt_xrf_checker_is_valid(parser->xrf_checker, attr_value, err)) {
-            had_err = -1;
-          }
-        }
-      }
-      else if (parser->type_checker && !strcmp(attr_tag, GT_GFF_GAP)) {
-        GtGapStr *gs = NULL;
-        GtRange rng = gt_genome_node_get_range(feature_node);
-        if (gt_type_checker_is_a(parser->type_checker,
-                                 gt_symbol("protein_match"),
-                                 gt_feature_node_get_type((GtFeatureNode*)
-                                                          feature_node))) {
-          gs = gt_gap_str_new_protein(attr_value, err);
-        } else {
-          gs = gt_gap_str_new_nucleotide(attr_value, err);
-        }
-        if (!gs) {
-          gt_assert(gt_error_is_set(err));
-          had_err = -1;
-        }
-        if (!had_err) {
-          if (gt_range_length(&rng) != gt_gap_str_length_reference(gs)) {
-            gt_error_set(err, "length of aligned reference in %s attribute on "
-                              "line %u in file \"%s\" (" GT_WU ") does not "
-                              "match the length of its %s feature (" GT_WU ")",
-                         GT_GFF_GAP, line_number, filename,
-                         gt_gap_str_length_reference(gs),
-                         gt_feature_node_get_type((GtFeatureNode*)
-                                                  feature_node),
-                         gt_range_length(&rng));
-            had_err = -1;
-          }
-        }
-        gt_gap_str_delete(gs);
-      }
+      had_err = process_attribute(attr_tag, attr_value, feature_node, false,
+                                  &id_value, &parent_value, parser, seqid,
+                                  filename, line_number, err);
     }
   }
 
@@ -1475,10 +1653,6 @@ static int parse_attributes(char *attributes, GtGenomeNode *feature_node,
                                   line_number, err);
   }
 
-  gt_splitter_delete(parent_splitter);
-  gt_splitter_delete(tmp_splitter);
-  gt_splitter_delete(attribute_splitter);
-
   return had_err;
 }
 
@@ -1510,14 +1684,292 @@ void chomp_seqid(char *seqid, const char *filename, unsigned int line_number)
   }
 }
 
+/* Undo the splitting of the first <nof_pairs> attributes in <pairs> of an
+   attribute column ending at <end>. */
+static void restore_attributes(char **pairs, GtUword nof_pairs,
+                               const char *end)
+{
+  GtUword i;
+  for (i = 0; i < nof_pairs; i++) {
+    char *value = pairs[2 * i + 1],
+         *value_end = value + strlen(value);
+    value[-1] = '=';
+    if (value_end < end)
+      *value_end = ';';
+  }
+}
+
+/* Split the column <attributes> ending at <end> into its tags and values,
+   which are appended to <pairs>, and set <nof_attributes>. The values of
+   Is_Circular and Target attributes are checked as well. Returns false
+   without changing <attributes> if the sequential parser would report a
+   warning or an error, or if an uppercase tag is not reserved in GFF3. */
+static bool preparse_attributes(GtArray *pairs, GtUword *nof_attributes,
+                                char *attributes, char *end, GtError *err)
+{
+  GtUword first = gt_array_size(pairs), nof_pairs = 0, i;
+  char *token, *token_end, **tags;
+  bool valid = true;
+  for (token = attributes; valid && token <= end; token = token_end + 1) {
+    char *tag = token, *eq = NULL, *ptr;
+    GtUword nof_eqs = 0;
+    if (!(token_end = memchr(token, ';', (size_t) (end - token))))
+      token_end = end;
+    if (token < token_end && token[0] == '.') {
+      /* a single '.' token means there are no attributes */
+      valid = token == attributes && token_end == end;
+      break;
+    }
+    /* leading blanks of the tag are skipped like in parse_attributes() */
+    while (tag < token_end && *tag == ' ')
+      tag++;
+    if (tag == token_end)
+      continue; /* blank attribute */
+    for (ptr = tag; ptr < token_end; ptr++) {
+      if (*ptr == '=' && nof_eqs++ == 0)
+        eq = ptr;
+    }
+    if (nof_eqs != 1 || eq == tag || eq + 1 == token_end) {
+      valid = false;
+      break;
+    }
+    *eq = '\0';
+    *token_end = '\0';
+    gt_array_add(pairs, tag);
+    eq++;
+    gt_array_add(pairs, eq);
+    nof_pairs++;
+  }
+  tags = gt_array_size(pairs) > first ? gt_array_get(pairs, first) : NULL;
+  for (i = 0; valid && i < nof_pairs; i++) {
+    const char *tag = tags[2 * i], *value = tags[2 * i + 1];
+    GtUword j;
+    if (isupper((unsigned char) tag[0]) &&
+        invalid_uppercase_gff3_attribute(tag)) {
+      valid = false;
+    }
+    for (j = 0; valid && j < i; j++) {
+      if (!strcmp(tags[2 * j], tag))
+        valid = false;
+    }
+    if (valid && !strcmp(tag, GT_GFF_IS_CIRCULAR) && strcmp(value, "true"))
+      valid = false;
+    if (valid && !strcmp(tag, GT_GFF_TARGET)) {
+      gt_error_unset(err);
+      if (gt_gff3_parser_parse_target_attributes(value, NULL, NULL, NULL, NULL,
+                                                 "", 0, err)) {
+        valid = false;
+      }
+    }
+  }
+  if (!valid) {
+    if (nof_pairs > 0)
+      restore_attributes(tags, nof_pairs, end);
+    gt_array_set_size(pairs, first);
+    return false;
+  }
+  *nof_attributes = nof_pairs;
+  return true;
+}
+
+/* Split <line> into <fields> and parse its range, score, strand, phase, and
+   attributes, without changing <line> if this fails. The attributes are
+   appended to <pairs>. Used to preparse feature lines in parallel, therefore
+   <fields> are only set valid if the sequential parser would accept the
+   columns without a warning. */
+static void preparse_gff3_feature_line(GFF3FeatureFields *fields, GtStr *line,
+                                       GtArray *pairs, GtError *err)
+{
+  char *cstr = gt_str_get(line), *end = cstr + gt_str_length(line), *ptr;
+  GtUword num_of_tokens = 1, i;
+
+  fields->valid = false;
+  if (cstr == end || cstr[0] == '#' || cstr[0] == '>')
+    return;
+  fields->tokens[0] = cstr;
+  for (ptr = cstr;
+       num_of_tokens <= 9UL && (ptr = memchr(ptr, '\t', (size_t) (end - ptr)));
+       ptr++) {
+    if (num_of_tokens < 9UL)
+      fields->tokens[num_of_tokens] = ptr + 1;
+    num_of_tokens++;
+  }
+  /* an empty seqid or one ending with a blank requires a message */
+  if (num_of_tokens != 9UL || fields->tokens[1] - 1 == cstr ||
+      fields->tokens[1][-2] == ' ') {
+    return;
+  }
+  for (i = 1; i < 9UL; i++)
+    fields->tokens[i][-1] = '\0';
+
+  gt_error_unset(err);
+  if (!gt_parse_range(&fields->range, fields->tokens[3], fields->tokens[4], 0,
+                      "", err) &&
+      fields->range.start > 0 &&
+      !gt_parse_score(&fields->score_is_defined, &fields->score,
+                      fields->tokens[5], 0, "", err) &&
+      !gt_parse_strand(&fields->strand, fields->tokens[6], 0, "", err) &&
+      !gt_parse_phase(&fields->phase, fields->tokens[7], 0, "", err) &&
+      preparse_attributes(pairs, &fields->nof_attributes, fields->tokens[8],
+                          end, err)) {
+    fields->valid = true;
+  }
+  else {
+    /* restore the line for the sequential parser */
+    for (i = 1; i < 9UL; i++)
+      fields->tokens[i][-1] = '\t';
+  }
+}
+
+static void preparse_batch_task(void *data)
+{
+  GFF3BatchTask *task = data;
+  GtError *err = gt_error_new();
+  char **pairs;
+  GtUword i;
+  gt_array_reset(task->attributes);
+  for (i = task->start; i < task->end; i++) {
+    preparse_gff3_feature_line(task->batch->fields + i,
+                               task->batch->lines[i], task->attributes, err);
+  }
+  /* the attributes are stored in the order of the lines */
+  pairs = gt_array_size(task->attributes) > 0
+          ? gt_array_get_space(task->attributes) : NULL;
+  for (i = task->start; i < task->end; i++) {
+    GFF3FeatureFields *fields = task->batch->fields + i;
+    if (fields->valid) {
+      fields->attributes = pairs;
+      pairs += 2 * fields->nof_attributes;
+    }
+  }
+  gt_error_delete(err);
+}
+
+/* Return true if the feature line <line> has another seqid than the last
+   feature line read ahead, which is updated in this case. */
+static bool batch_seqid_changes(GtGFF3Parser *parser, const char *line)
+{
+  const char *tab;
+  if (line[0] == '#' || !(tab = strchr(line, '\t')))
+    return false;
+  if (gt_str_length(parser->batch_seqid) == (GtUword) (tab - line) &&
+      !strncmp(gt_str_get(parser->batch_seqid), line, (size_t) (tab - line))) {
+    return false;
+  }
+  gt_str_reset(parser->batch_seqid);
+  gt_str_append_cstr_nt(parser->batch_seqid, line, (GtUword) (tab - line));
+  return true;
+}
+
+/* Read the next chunk of lines into the batch given as <data> and submit the
+   tasks to preparse them. A chunk ends after a terminator or in front of a
+   line with a new seqid, which is carried over to the next chunk, once it has
+   reached the minimum size. The read ahead stops in front of a FASTA section,
+   which is read directly from the input by the sequential parser. */
+static void read_batch_task(void *data)
+{
+  GFF3LineBatch *batch = data;
+  GtGFF3Parser *parser = batch->parser;
+  GtUword i, numoftasks = 0;
+  batch->size = batch->next = 0;
+  if (parser->has_carried_line) {
+    GtStr *line = batch->lines[0];
+    batch->lines[0] = parser->carried_line;
+    parser->carried_line = line ? line : gt_str_new();
+    parser->has_carried_line = false;
+    batch->fields[batch->size++].valid = false;
+  }
+  while (!parser->read_ahead_done &&
+         batch->size < GT_GFF3_PARSER_BATCH_MAXLINES) {
+    GtStr *line;
+    const char *cstr;
+    if (!batch->lines[batch->size])
+      batch->lines[batch->size] = gt_str_new();
+    line = batch->lines[batch->size];
+    gt_str_reset(line);
+    if (gt_line_source_read_line(parser->read_ahead_source, line) == EOF) {
+      parser->read_ahead_done = true;
+      break;
+    }
+    cstr = gt_str_get(line);
+    if (batch_seqid_changes(parser, cstr) &&
+        batch->size >= GT_GFF3_PARSER_BATCH_LINES) {
+      batch->lines[batch->size] = parser->carried_line;
+      parser->carried_line = line;
+      parser->has_carried_line = true;
+      break;
+    }
+    batch->fields[batch->size++].valid = false;
+    if (cstr[0] == '>' || strcmp(cstr, GT_GFF_FASTA_DIRECTIVE) == 0)
+      parser->read_ahead_done = true;
+    else if (batch->size >= GT_GFF3_PARSER_BATCH_LINES &&
+             strcmp(cstr, GT_GFF_TERMINATOR) == 0) {
+      break;
+    }
+  }
+  for (i = 0; i < batch->size; i += GT_GFF3_PARSER_BATCH_GRAIN) {
+    GFF3BatchTask *task = batch->tasks + numoftasks++;
+    task->start = i;
+    task->end = i + GT_GFF3_PARSER_BATCH_GRAIN < batch->size
+                ? i + GT_GFF3_PARSER_BATCH_GRAIN : batch->size;
+    gt_thread_pool_group_submit(batch->group, preparse_batch_task, task);
+  }
+}
+
+static void submit_read_batch(GtGFF3Parser *parser, GFF3LineBatch *batch,
+                              GtLineSource *source)
+{
+  gt_assert(!batch->pending && batch->next == batch->size);
+  parser->read_ahead_source = source;
+  batch->pending = true;
+  gt_thread_pool_group_submit(batch->group, read_batch_task, batch);
+}
+
+/* Return the next line of the input in <line> and its preparsed columns in
+   <fields> (NULL if not preparsed). In parallel mode the input is read and
+   preparsed by the pool one batch ahead of the sequential parser. */
+static int next_line(GtGFF3Parser *parser, GtStr **line,
+                     GFF3FeatureFields **fields, GtStr *line_buffer,
+                     GtLineSource *source)
+{
+  GFF3LineBatch *batch = parser->current_batch;
+  *fields = NULL;
+  if (parser->parallel_mode && batch->next == batch->size) {
+    if (!parser->next_batch->pending && !parser->read_ahead_done)
+      submit_read_batch(parser, parser->next_batch, source);
+    gt_thread_pool_group_wait(parser->next_batch->group);
+    parser->next_batch->pending = false;
+    if (parser->next_batch->size > 0) {
+      /* continue with the preparsed batch and read the one after it */
+      parser->current_batch = parser->next_batch;
+      parser->next_batch = batch;
+      batch = parser->current_batch;
+      if (!parser->read_ahead_done)
+        submit_read_batch(parser, parser->next_batch, source);
+    }
+  }
+  if (parser->parallel_mode && batch->next < batch->size) {
+    if (batch->fields[batch->next].valid)
+      *fields = batch->fields + batch->next;
+    *line = batch->lines[batch->next++];
+    return 0;
+  }
+  /* read directly */
+  gt_str_reset(line_buffer);
+  *line = line_buffer;
+  return gt_line_source_read_line(source, line_buffer);
+}
+
 static int parse_gff3_feature_line(GtGFF3Parser *parser,
                                    GtQueue *genome_nodes,
                                    GtCstrTable *used_types, char *line,
-                                   size_t line_length, GtStr *filenamestr,
+                                   size_t line_length,
+                                   GFF3FeatureFields *fields,
+                                   GtStr *filenamestr,
                                    unsigned int line_number, GtError *err)
 {
   GtGenomeNode *gn = NULL, *feature_node = NULL;
-  GtSplitter *splitter;
+  GtSplitter *splitter = parser->line_splitter;
   GtStr *seqid_str = NULL;
   GtStrand gt_strand_value;
   float score_value;
@@ -1534,12 +1986,22 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
 
   filename = gt_str_get(filenamestr);
 
-  /* create splitter */
-  splitter = gt_splitter_new();
-
   /* parse */
-  gt_splitter_split(splitter, line, line_length, '\t');
-  if (gt_splitter_size(splitter) != 9) {
+  if (fields) {
+    /* the columns have been split and checked already */
+    tokens = fields->tokens;
+    range = fields->range;
+    score_is_defined = fields->score_is_defined;
+    score_value = fields->score;
+    gt_strand_value = fields->strand;
+    phase_value = fields->phase;
+  }
+  else {
+    gt_splitter_reset(splitter);
+    gt_splitter_split(splitter, line, line_length, '\t');
+    tokens = gt_splitter_get_tokens(splitter);
+  }
+  if (!fields && gt_splitter_size(splitter) != 9) {
     if (parser->tidy && gt_splitter_size(splitter) == 10) {
       gt_warning("line %u in file \"%s\" does not contain 9 tab (\\t) "
                  "separated fields, dropping 10th field",
@@ -1552,7 +2014,6 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
     }
   }
   if (!had_err) {
-    tokens = gt_splitter_get_tokens(splitter);
     seqid      = tokens[0];
     source     = tokens[1];
     type       = tokens[2];
@@ -1567,7 +2028,6 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
   if (!had_err && parser->tidy && (start[0] == '.' || end[0] == '.')) {
     gt_warning("feature \"%s\" on line %u in file \"%s\" has undefined "
                "range, discarding feature", type, line_number, filename);
-    gt_splitter_delete(splitter);
     return 0;
   }
 
@@ -1584,7 +2044,7 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
   }
 
   /* parse the range */
-  if (!had_err) {
+  if (!had_err && !fields) {
     if (parser->strict)
       had_err = gt_parse_range(&range, start, end, line_number, filename, err);
     else if (parser->tidy) {
@@ -1607,19 +2067,19 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
   }
 
   /* parse the score */
-  if (!had_err) {
+  if (!had_err && !fields) {
     had_err = gt_parse_score(&score_is_defined, &score_value, score,
                              line_number, filename, err);
   }
 
   /* parse the strand */
-  if (!had_err) {
+  if (!had_err && !fields) {
     had_err = gt_parse_strand(&gt_strand_value, strand, line_number, filename,
                               err);
   }
 
   /* parse the phase */
-  if (!had_err)
+  if (!had_err && !fields)
     had_err = gt_parse_phase(&phase_value, phase, line_number, filename, err);
 
   if (!had_err)
@@ -1636,8 +2096,16 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
 
   /* create the feature */
   if (!had_err) {
-    feature_node = gt_feature_node_new(seqid_str, type, range.start, range.end,
-                                       gt_strand_value);
+    if (parser->arena_mode) {
+      feature_node = gt_feature_node_new_in_arena(seqid_str, type, range.start,
+                                                  range.end, gt_strand_value,
+                                                  get_arena(parser,
+                                                            seqid_str));
+    }
+    else {
+      feature_node = gt_feature_node_new(seqid_str, type, range.start,
+                                         range.end, gt_strand_value);
+    }
     gt_genome_node_set_origin(feature_node, filenamestr, line_number);
   }
 
@@ -1649,8 +2117,9 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
 
   /* parse the attributes */
   if (!had_err) {
-    had_err = parse_attributes(attributes, feature_node, &is_child, parser,
-                               seqid, genome_nodes, filename, line_number, err);
+    had_err = parse_attributes(attributes, fields, feature_node, &is_child,
+                               parser, seqid, genome_nodes, filename,
+                               line_number, err);
   }
 
   if (!had_err && score_is_defined)
@@ -1668,7 +2137,6 @@ static int parse_gff3_feature_line(GtGFF3Parser *parser,
 
   /* free */
   gt_str_delete(seqid_str);
-  gt_splitter_delete(splitter);
 
   return had_err;
 }
@@ -1753,7 +2221,7 @@ static int parse_first_gff3_line(const char *line, const char *filename,
 static int gff3_parser_parse_fasta_entry(GtQueue *genome_nodes,
                                          const char *line, GtStr *filename,
                                          unsigned int line_number,
-                                         GtFile *fpin, GtError *err)
+                                         GtLineSource *source, GtError *err)
 {
   int had_err = 0;
   gt_error_check(err);
@@ -1767,9 +2235,9 @@ static int gff3_parser_parse_fasta_entry(GtQueue *genome_nodes,
     GtGenomeNode *sequence_node;
     GtStr *sequence = gt_str_new();
     int cc;
-    while ((cc = gt_file_xfgetc(fpin)) != EOF) {
+    while ((cc = gt_line_source_getc(source)) != EOF) {
       if (cc == '>') {
-        gt_file_unget_char(fpin, cc);
+        gt_line_source_unget_char(source, cc);
         break;
       }
       if (cc != '\n' && cc != '\r' && cc != ' ')
@@ -2124,15 +2592,18 @@ static int parse_meta_gff3_line(GtGFF3Parser *parser, GtQueue *genome_nodes,
   return had_err;
 }
 
-int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
-                                      GtQueue *genome_nodes,
-                                      GtCstrTable *used_types,
-                                      GtStr *filenamestr,
-                                      GtUint64 *line_number,
-                                      GtFile *fpin, GtError *err)
+int gt_gff3_parser_parse_genome_nodes_from_source(GtGFF3Parser *parser,
+                                                  int *status_code,
+                                                  GtQueue *genome_nodes,
+                                                  GtCstrTable *used_types,
+                                                  GtStr *filenamestr,
+                                                  GtUint64 *line_number,
+                                                  GtLineSource *source,
+                                                  GtError *err)
 {
   size_t line_length;
-  GtStr *line_buffer;
+  GtStr *line_buffer, *line_str;
+  GFF3FeatureFields *fields;
   char *line;
   const char *filename;
   int rval, had_err = 0;
@@ -2145,9 +2616,10 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
   /* init */
   line_buffer = gt_str_new();
 
-  while ((rval = gt_str_read_next_line_generic(line_buffer, fpin)) != EOF) {
-    line = gt_str_get(line_buffer);
-    line_length = gt_str_length(line_buffer);
+  while ((rval = next_line(parser, &line_str, &fields, line_buffer,
+                           source)) != EOF) {
+    line = gt_str_get(line_str);
+    line_length = gt_str_length(line_str);
     (*line_number)++;
 
     if (*line_number == 1) {
@@ -2157,7 +2629,6 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
       if (had_err == -1) /* error */
         break;
       if (had_err == 1) { /* line processed */
-        gt_str_reset(line_buffer);
         had_err = 0;
         continue;
       }
@@ -2170,7 +2641,7 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
     else if (parser->fasta_parsing || line[0] == '>') {
       parser->fasta_parsing = true;
       had_err = gff3_parser_parse_fasta_entry(genome_nodes, line, filenamestr,
-                                              *line_number, fpin, err);
+                                              *line_number, source, err);
       break;
     }
     else if (line[0] == '#') {
@@ -2183,12 +2654,11 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
     }
     else {
       had_err = parse_gff3_feature_line(parser, genome_nodes, used_types, line,
-                                        line_length, filenamestr, *line_number,
-                                        err);
+                                        line_length, fields, filenamestr,
+                                        *line_number, err);
       if (had_err || (!parser->incomplete_node && gt_queue_size(genome_nodes)))
         break;
     }
-    gt_str_reset(line_buffer);
   }
 
   if (!had_err && rval == EOF && *line_number == 0) {
@@ -2225,6 +2695,29 @@ int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
   return had_err;
 }
 
+int gt_gff3_parser_parse_genome_nodes(GtGFF3Parser *parser, int *status_code,
+                                      GtQueue *genome_nodes,
+                                      GtCstrTable *used_types,
+                                      GtStr *filenamestr,
+                                      GtUint64 *line_number,
+                                      GtFile *fpin, GtError *err)
+{
+  gt_assert(parser);
+  if (parser->file_source &&
+      gt_line_source_get_file(parser->file_source) != fpin) {
+    gt_assert(!parser->parallel_mode);
+    gt_line_source_delete(parser->file_source);
+    parser->file_source = NULL;
+  }
+  if (!parser->file_source)
+    parser->file_source = gt_line_source_new_file(fpin);
+  return gt_gff3_parser_parse_genome_nodes_from_source(parser, status_code,
+                                                       genome_nodes, used_types,
+                                                       filenamestr, line_number,
+                                                       parser->file_source,
+                                                       err);
+}
+
 void gt_gff3_parser_reset(GtGFF3Parser *parser)
 {
   gt_assert(parser);
@@ -2234,6 +2727,19 @@ void gt_gff3_parser_reset(GtGFF3Parser *parser)
   gt_hashmap_reset(parser->seqid_to_ssr_mapping);
   gt_hashmap_reset(parser->source_to_str_mapping);
   gt_orphanage_reset(parser->orphanage);
+  release_arena(parser);
+  if (parser->parallel_mode) {
+    /* discard lines read ahead */
+    gt_thread_pool_group_wait(parser->next_batch->group);
+    parser->next_batch->pending = false;
+    parser->current_batch->size = parser->current_batch->next = 0;
+    parser->next_batch->size = parser->next_batch->next = 0;
+    parser->read_ahead_done = false;
+    parser->has_carried_line = false;
+    gt_str_reset(parser->batch_seqid);
+  }
+  gt_line_source_delete(parser->file_source);
+  parser->file_source = NULL;
   parser->last_terminator = 0;
 }
 
@@ -2247,5 +2753,15 @@ void gt_gff3_parser_delete(GtGFF3Parser *parser)
   gt_orphanage_delete(parser->orphanage);
   gt_type_checker_delete(parser->type_checker);
   gt_xrf_checker_delete(parser->xrf_checker);
+  release_arena(parser);
+  gff3_line_batch_delete(parser->current_batch);
+  gff3_line_batch_delete(parser->next_batch);
+  gt_str_delete(parser->carried_line);
+  gt_str_delete(parser->batch_seqid);
+  gt_line_source_delete(parser->file_source);
+  gt_splitter_delete(parser->line_splitter);
+  gt_splitter_delete(parser->attribute_splitter);
+  gt_splitter_delete(parser->tag_value_splitter);
+  gt_splitter_delete(parser->parent_splitter);
   gt_free(parser);
 }
@@ -18,9 +18,30 @@
 #ifndef GFF3_PARSER_H
 #define GFF3_PARSER_H
 
+#include "core/line_source.h"
 #include "extended/gff3_parser_api.h"
 
 void gt_gff3_parser_enable_strict_mode(GtGFF3Parser*);
+/* Allocate the parsed feature nodes and their attributes from arenas, one per
+   sequence region (see core/arena.h). The nodes are freed in bulk when the
+   last node of an arena is deleted. */
+void gt_gff3_parser_enable_arena(GtGFF3Parser*);
+/* Read the input ahead in batches of lines and split and check the columns of
+   feature lines on the threads of the pool (see core/thread_pool.h), while the
+   sequential parser builds the feature trees. Everything else, including
+   messages and the order of the nodes, is the same as in sequential mode. */
+void gt_gff3_parser_enable_parallel_mode(GtGFF3Parser*);
+/* Like <gt_gff3_parser_parse_genome_nodes()>, but reads the lines from
+   <source>, which avoids reading memory mapped files character by
+   character. */
+int  gt_gff3_parser_parse_genome_nodes_from_source(GtGFF3Parser*,
+                                                   int *status_code,
+                                                   GtQueue *genome_nodes,
+                                                   GtCstrTable *used_types,
+                                                   GtStr *filenamestr,
+                                                   GtUint64 *line_number,
+                                                   GtLineSource *source,
+                                                   GtError*);
 int  gt_gff3_parser_set_offsetfile(GtGFF3Parser*, GtStr*, GtError*);
 int  gt_gff3_parser_parse_target_attributes(const char *values,
                                             GtUword *num_of_targets,
@@ -43,7 +43,7 @@ static int gtf_in_stream_process_file(GtGTFInStream *gtf_in_stream,
 {
   GtGTFParser *gtf_parser;
   GtStr *filenamestr;
-  GtFile *fpin;
+  GtLineSource *source;
   int had_err = 0;
   gt_error_check(err);
   gt_assert(gtf_in_stream);
@@ -51,24 +51,22 @@ static int gtf_in_stream_process_file(GtGTFInStream *gtf_in_stream,
   gtf_parser = gt_gtf_parser_new(gtf_in_stream->type_checker);
 
   /* open input file */
-  if (gtf_in_stream->filename) {
-    if (!(fpin = gt_file_new(gtf_in_stream->filename, "r", err)))
-      had_err = -1;
-  }
-  else
-    fpin = NULL;
+  if (!(source = gt_line_source_new(gtf_in_stream->filename, err)))
+    had_err = -1;
 
   /* parse input file */
   if (!had_err) {
     filenamestr = gt_str_new_cstr(gtf_in_stream->filename
                                   ? gtf_in_stream->filename : "stdin");
-    had_err = gt_gtf_parser_parse(gtf_parser, gtf_in_stream->genome_node_buffer,
-                                  filenamestr, fpin, gtf_in_stream->tidy, err);
+    had_err = gt_gtf_parser_parse(gtf_parser,
+                                  gtf_in_stream->genome_node_buffer,
+                                  filenamestr, source, gtf_in_stream->tidy,
+                                  err);
     gt_str_delete(filenamestr);
   }
 
   /* close input file, if necessary */
-  gt_file_delete(fpin);
+  gt_line_source_delete(source);
 
   /* free */
   gt_gtf_parser_delete(gtf_parser);
@@ -379,8 +379,8 @@ static int delete_genes(GT_UNUSED void *key, void *value, GT_UNUSED void *data,
 }
 
 int gt_gtf_parser_parse(GtGTFParser *parser, GtQueue *genome_nodes,
-                        GtStr *filenamestr, GtFile *fpin, bool be_tolerant,
-                        GtError *err)
+                        GtStr *filenamestr, GtLineSource *line_source,
+                        bool be_tolerant, GtError *err)
 {
   GtStr *seqid_str, *source_str, *line_buffer;
   char *line;
@@ -443,7 +443,7 @@ int gt_gtf_parser_parse(GtGTFParser *parser, GtQueue *genome_nodes,
           }                                                            \
         }
 
-  while (gt_str_read_next_line_generic(line_buffer, fpin) != EOF) {
+  while (gt_line_source_read_line(line_source, line_buffer) != EOF) {
     line = gt_str_get(line_buffer);
     line_length = gt_str_length(line_buffer);
     line_number++;
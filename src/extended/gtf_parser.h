@@ -18,6 +18,7 @@
 #ifndef GTF_PARSER_H
 #define GTF_PARSER_H
 
+#include "core/line_source.h"
 #include "core/queue_api.h"
 #include "extended/type_checker_api.h"
 
@@ -38,7 +39,7 @@ typedef struct GtGTFParser GtGTFParser;
 
 GtGTFParser* gt_gtf_parser_new(GtTypeChecker*);
 int          gt_gtf_parser_parse(GtGTFParser*, GtQueue *genome_nodes,
-                                 GtStr *filenamestr, GtFile*,
+                                 GtStr *filenamestr, GtLineSource*,
                                  bool be_tolerant, GtError*);
 void         gt_gtf_parser_delete(GtGTFParser*);
 
@@ -28,9 +28,12 @@
 #include "core/assert_api.h"
 #ifdef GT_THREADS_ENABLED
 #include "core/thread_api.h"
+#include "core/thread_pool.h"
 #endif
 #include "core/unused_api.h"
 #include "core/divmodmul_api.h"
+#include "core/ensure_api.h"
+#include "core/mathsupport_api.h"
 #include "match/squarededist.h"
 #include "extended/alignment.h"
 #include "extended/maxcoordvalue.h"
@@ -38,6 +41,7 @@
 #include "extended/squarealign.h"
 
 #include "extended/linearalign.h"
+#include "extended/linearalign_simd.h"
 #define LINEAR_EDIST_GAP          ((GtUchar) UCHAR_MAX)
 
 /*------------------------------global linear--------------------------------*/
@@ -114,7 +118,8 @@ static void nextEDtabRtabcolumn(GtUword *EDtabcolumn,
   }
 }
 
-static GtUword evaluateallEDtabRtabcolumns(GtUword *EDtabcolumn,
+static GtUword evaluateallEDtabRtabcolumns(GtLinearalignSimdKernel kernel,
+                                           GtUword *EDtabcolumn,
                                            GtUword *Rtabcolumn,
                                            const GtScoreHandler *scorehandler,
                                            GtUword midcol,
@@ -125,9 +130,15 @@ static GtUword evaluateallEDtabRtabcolumns(GtUword *EDtabcolumn,
                                            GtUword vstart,
                                            GtUword vlen)
 {
-  GtUword gapcost, colindex;
+  GtUword gapcost, colindex, distance;
   gt_assert(scorehandler && EDtabcolumn && Rtabcolumn);
 
+  if (gt_linearalign_simd_global(kernel, EDtabcolumn, Rtabcolumn, &distance,
+                                 scorehandler, midcol, useq, ustart, ulen,
+                                 vseq, vstart, vlen))
+  {
+    return distance;
+  }
   gapcost = gt_scorehandler_get_gapscore(scorehandler);
   firstEDtabRtabcolumn(EDtabcolumn, Rtabcolumn, ulen, gapcost);
 
@@ -227,7 +238,7 @@ static GtUword evaluatelinearcrosspoints(GtLinspaceManagement *spacemanager,
                                          GT_UNUSED GtUword threadidx,
                                          GT_UNUSED GtUword *threadcount);
 
-static void *evaluatelinearcrosspoints_thread_caller(void *data)
+static void evaluatelinearcrosspoints_thread_caller(void *data)
 {
   GtLinearCrosspointthreadinfo *threadinfo =
                                          (GtLinearCrosspointthreadinfo *) data;
@@ -243,7 +254,6 @@ static void *evaluatelinearcrosspoints_thread_caller(void *data)
                                    threadinfo->rowoffset,
                                    threadinfo->threadidx,
                                    threadinfo->threadcount);
-  return NULL;
 }
 #endif
 
@@ -261,7 +271,7 @@ static GtUword evaluatelinearcrosspoints(GtLinspaceManagement *spacemanager,
 {
   GtUword midrow, midcol, distance, *EDtabcolumn = NULL, *Rtabcolumn = NULL;
 #ifdef GT_THREADS_ENABLED
-  GtThread *t1 = NULL, *t2 = NULL;
+  GtThreadPoolGroup *group;
   GtLinearCrosspointthreadinfo threadinfo1, threadinfo2;
 #endif
 
@@ -297,7 +307,8 @@ static GtUword evaluatelinearcrosspoints(GtLinspaceManagement *spacemanager,
     Rtabcolumn = Rtabcolumn + rowoffset + threadidx;
     EDtabcolumn = EDtabcolumn + rowoffset + threadidx;
 
-    distance = evaluateallEDtabRtabcolumns(EDtabcolumn, Rtabcolumn,
+    distance = evaluateallEDtabRtabcolumns(gt_linearalign_simd_kernel_best(),
+                                           EDtabcolumn, Rtabcolumn,
                                            scorehandler, midcol,
                                            useq, ustart, ulen,
                                            vseq, vstart, vlen);
@@ -328,14 +339,16 @@ static GtUword evaluatelinearcrosspoints(GtLinspaceManagement *spacemanager,
     }
     else
     {
+      group = gt_thread_pool_group_new();
       threadinfo1 = set_LinearCrosspointthreadinfo(spacemanager, scorehandler,
                                                    useq, ustart, midrow,
                                                    vseq, vstart, midcol,
                                                    Ctab, rowoffset,
                                                    threadidx, threadcount);
       (*threadcount)++;
-      t1 = gt_thread_new(evaluatelinearcrosspoints_thread_caller,
-                         &threadinfo1, NULL);
+      gt_thread_pool_group_submit(group,
+                                  evaluatelinearcrosspoints_thread_caller,
+                                  &threadinfo1);
 
       threadinfo2 = set_LinearCrosspointthreadinfo(spacemanager, scorehandler,
                                                    useq, ustart + midrow,
@@ -347,15 +360,13 @@ static GtUword evaluatelinearcrosspoints(GtLinspaceManagement *spacemanager,
                                                    threadidx + GT_DIV2(midcol),
                                                    threadcount);
       (*threadcount)++;
-      t2 = gt_thread_new(evaluatelinearcrosspoints_thread_caller,
-                         &threadinfo2, NULL);
-
-      gt_thread_join(t1);
-      (*threadcount)--;
-      gt_thread_join(t2);
-      (*threadcount)--;
-      gt_thread_delete(t1);
-      gt_thread_delete(t2);
+      gt_thread_pool_group_submit(group,
+                                  evaluatelinearcrosspoints_thread_caller,
+                                  &threadinfo2);
+
+      gt_thread_pool_group_wait(group);
+      gt_thread_pool_group_delete(group);
+      (*threadcount) -= 2;
     }
 #endif
     return distance;
@@ -603,7 +614,8 @@ static void nextLStabcolumn(GtWord *Ltabcolumn,
   }
 }
 
-static GtMaxcoordvalue *evaluateallLScolumns(GtLinspaceManagement *spacemanager,
+static GtMaxcoordvalue *evaluateallLScolumns(GtLinearalignSimdKernel kernel,
+                                             GtLinspaceManagement *spacemanager,
                                              const GtScoreHandler *scorehandler,
                                              const GtUchar *useq,
                                              GtUword ustart,
@@ -619,10 +631,16 @@ static GtMaxcoordvalue *evaluateallLScolumns(GtLinspaceManagement *spacemanager,
 
   Ltabcolumn = gt_linspace_management_get_valueTabspace(spacemanager);
   Starttabcolumn = gt_linspace_management_get_rTabspace(spacemanager);
+  max = gt_linspace_management_get_maxspace(spacemanager);
 
+  if (gt_linearalign_simd_local(kernel, Ltabcolumn, Starttabcolumn, max,
+                                scorehandler, useq, ustart, ulen,
+                                vseq, vstart, vlen))
+  {
+    return max;
+  }
   firstLStabcolumn(Ltabcolumn, Starttabcolumn, ulen);
 
-  max = gt_linspace_management_get_maxspace(spacemanager);
   for (colindex = 1UL; colindex <= vlen; colindex++)
   {
     nextLStabcolumn(Ltabcolumn, Starttabcolumn, scorehandler,
@@ -683,7 +701,8 @@ GtWord gt_linearalign_compute_local_generic(GtLinspaceManagement *spacemanager,
                                      sizeof (*Ltabcolumn),
                                      sizeof (*Starttabcolumn));
 
-  max = evaluateallLScolumns(spacemanager, scorehandler,
+  max = evaluateallLScolumns(gt_linearalign_simd_kernel_best(),
+                             spacemanager, scorehandler,
                              useq, ustart, ulen,
                              vseq, vstart, vlen);
 
@@ -866,3 +885,98 @@ void gt_linearalign_check_local(GT_UNUSED bool forward,
   }
   gt_alignment_delete(align);
 }
+
+/*---------------------------------unit test---------------------------------*/
+
+#define LINEARALIGN_TEST_MINLEN 32UL
+#define LINEARALIGN_TEST_MAXLEN 300UL
+
+int gt_linearalign_unit_test(GtError *err)
+{
+  int had_err = 0;
+  const GtWord costs[][3] = {{0, 1, 1}, {0, 4, 3}, {0, 900, 700}},
+               scores[][3] = {{2, -2, -1}, {5, -4, -3}, {300, -500, -200}};
+  GtUchar useq[LINEARALIGN_TEST_MAXLEN], vseq[LINEARALIGN_TEST_MAXLEN];
+  GtUword EDtab[2][LINEARALIGN_TEST_MAXLEN + 1],
+          Rtab[2][LINEARALIGN_TEST_MAXLEN + 1],
+          trial, ulen, vlen, distance[2];
+  GtWord Ltab[LINEARALIGN_TEST_MAXLEN + 1];
+  GtUwordPair Starttab[LINEARALIGN_TEST_MAXLEN + 1];
+  GtLinspaceManagement *spacemanager = gt_linspace_management_new();
+
+  gt_error_check(err);
+  for (trial = 0; !had_err && trial < 30UL; trial++)
+  {
+    const GtWord *cost = costs[trial % 3], *score = scores[trial % 3];
+    GtScoreHandler *costhandler, *scorehandler;
+    GtLinearalignSimdKernel kernel;
+    GtMaxcoordvalue *max;
+    GtWord maxvalue;
+    GtUwordPair maxstart, maxend;
+
+    ulen = LINEARALIGN_TEST_MINLEN
+           + gt_rand_max(LINEARALIGN_TEST_MAXLEN - LINEARALIGN_TEST_MINLEN);
+    vlen = LINEARALIGN_TEST_MINLEN
+           + gt_rand_max(LINEARALIGN_TEST_MAXLEN - LINEARALIGN_TEST_MINLEN);
+    gt_linearalign_simd_random_sequence(useq, ulen);
+    gt_linearalign_simd_random_sequence(vseq, vlen);
+    costhandler = gt_scorehandler_new(cost[0], cost[1], 0, cost[2]);
+    scorehandler = gt_scorehandler_new(score[0], score[1], 0, score[2]);
+    gt_linspace_management_check_local(spacemanager, ulen, vlen,
+                                       sizeof (*Ltab), sizeof (*Starttab));
+
+    distance[0] = evaluateallEDtabRtabcolumns(GT_LINEARALIGN_SIMD_SCALAR,
+                                              EDtab[0], Rtab[0], costhandler,
+                                              GT_DIV2(vlen), useq, 0, ulen,
+                                              vseq, 0, vlen);
+    max = gt_linspace_management_get_maxspace(spacemanager);
+    gt_maxcoordvalue_reset(max);
+    (void) evaluateallLScolumns(GT_LINEARALIGN_SIMD_SCALAR, spacemanager,
+                                scorehandler, useq, 0, ulen, vseq, 0, vlen);
+    memcpy(Ltab, gt_linspace_management_get_valueTabspace(spacemanager),
+           sizeof (*Ltab) * (ulen + 1));
+    memcpy(Starttab, gt_linspace_management_get_rTabspace(spacemanager),
+           sizeof (*Starttab) * (ulen + 1));
+    maxvalue = gt_maxcoordvalue_get_value(max);
+    maxstart = gt_maxcoordvalue_get_start(max);
+    maxend = gt_maxcoordvalue_get_end(max);
+
+    for (kernel = GT_LINEARALIGN_SIMD_SSE41;
+         !had_err && kernel < GT_LINEARALIGN_SIMD_NUMOFKERNELS;
+         kernel++)
+    {
+      if (!gt_linearalign_simd_kernel_is_supported(kernel))
+        continue;
+      distance[1] = evaluateallEDtabRtabcolumns(kernel, EDtab[1], Rtab[1],
+                                                costhandler, GT_DIV2(vlen),
+                                                useq, 0, ulen, vseq, 0, vlen);
+      gt_ensure(distance[0] == distance[1]);
+      gt_ensure(memcmp(EDtab[0], EDtab[1],
+                       sizeof (EDtab[0][0]) * (ulen + 1)) == 0);
+      gt_ensure(memcmp(Rtab[0], Rtab[1],
+                       sizeof (Rtab[0][0]) * (ulen + 1)) == 0);
+      if (!had_err)
+      {
+        gt_maxcoordvalue_reset(max);
+        (void) evaluateallLScolumns(kernel, spacemanager, scorehandler,
+                                    useq, 0, ulen, vseq, 0, vlen);
+        gt_ensure(memcmp(Ltab,
+                         gt_linspace_management_get_valueTabspace(
+                                                                spacemanager),
+                         sizeof (*Ltab) * (ulen + 1)) == 0);
+        gt_ensure(memcmp(Starttab,
+                         gt_linspace_management_get_rTabspace(spacemanager),
+                         sizeof (*Starttab) * (ulen + 1)) == 0);
+        gt_ensure(gt_maxcoordvalue_get_value(max) == maxvalue);
+        gt_ensure(gt_maxcoordvalue_get_start(max).a == maxstart.a &&
+                  gt_maxcoordvalue_get_start(max).b == maxstart.b);
+        gt_ensure(gt_maxcoordvalue_get_end(max).a == maxend.a &&
+                  gt_maxcoordvalue_get_end(max).b == maxend.b);
+      }
+    }
+    gt_scorehandler_delete(costhandler);
+    gt_scorehandler_delete(scorehandler);
+  }
+  gt_linspace_management_delete(spacemanager);
+  return had_err;
+}
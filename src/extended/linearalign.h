@@ -106,4 +106,6 @@ void    gt_linearalign_check_local(GT_UNUSED bool forward,
                                    GtUword ulen,
                                    const GtUchar *vseq,
                                    GtUword vlen);
+
+int     gt_linearalign_unit_test(GtError *err);
 #endif
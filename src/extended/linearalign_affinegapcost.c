@@ -24,6 +24,7 @@
 #include "core/minmax_api.h"
 #ifdef GT_THREADS_ENABLED
 #include "core/thread_api.h"
+#include "core/thread_pool.h"
 #endif
 #include "core/types_api.h"
 #include "extended/affinealign.h"
@@ -367,7 +368,7 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
                                          GtAffineAlignEdge to_edge,
                                          GtUword *threadcount);
 
-static void *evaluateaffinecrosspoints_thread_caller(void *data)
+static void evaluateaffinecrosspoints_thread_caller(void *data)
 {
   GtAffineCrosspointthreadinfo *threadinfo =
                                          (GtAffineCrosspointthreadinfo *) data;
@@ -384,7 +385,6 @@ static void *evaluateaffinecrosspoints_thread_caller(void *data)
                                    threadinfo->from_edge,
                                    threadinfo->to_edge,
                                    threadinfo->threadcount);
-  return NULL;
 }
 #endif
 
@@ -409,7 +409,8 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
   GtAffineAlignRtabentry *Rtabcolumn = NULL;
 
 #ifdef GT_THREADS_ENABLED
-  GtThread *t1 = NULL, *t2 = NULL;
+  GtThreadPoolGroup *group = NULL;
+  GtUword numofsubmitted = 0;
   GtAffineCrosspointthreadinfo threadinfo1, threadinfo2;
 #endif
 
@@ -495,8 +496,11 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
                                                        from_edge, midtype,
                                                        threadcount);
             (*threadcount)++;
-            t1 = gt_thread_new(evaluateaffinecrosspoints_thread_caller,
-                               &threadinfo1, NULL);
+            group = gt_thread_pool_group_new();
+            gt_thread_pool_group_submit(group,
+                                      evaluateaffinecrosspoints_thread_caller,
+                                      &threadinfo1);
+            numofsubmitted++;
           }
 #endif
           break;
@@ -524,8 +528,11 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
                                                       threadcount);
 
            (*threadcount)++;
-           t1 = gt_thread_new(evaluateaffinecrosspoints_thread_caller,
-                               &threadinfo1, NULL);
+           group = gt_thread_pool_group_new();
+           gt_thread_pool_group_submit(group,
+                                       evaluateaffinecrosspoints_thread_caller,
+                                       &threadinfo1);
+           numofsubmitted++;
           }
 #endif
           break;
@@ -567,21 +574,21 @@ static GtUword evaluateaffinecrosspoints(GtLinspaceManagement *spacemanager,
                                                    midtype, to_edge,
                                                    threadcount);
       (*threadcount)++;
-      t2 = gt_thread_new(evaluateaffinecrosspoints_thread_caller,
-                         &threadinfo2, NULL);
+      if (group == NULL)
+      {
+        group = gt_thread_pool_group_new();
+      }
+      gt_thread_pool_group_submit(group,
+                                  evaluateaffinecrosspoints_thread_caller,
+                                  &threadinfo2);
+      numofsubmitted++;
     }
 
-    if (t1 != NULL)
-    {
-      gt_thread_join(t1);
-      (*threadcount)--;
-      gt_thread_delete(t1);
-    }
-    if (t2 != NULL)
+    if (group != NULL)
     {
-      gt_thread_join(t2);
-      (*threadcount)--;
-      gt_thread_delete(t2);
+      gt_thread_pool_group_wait(group);
+      gt_thread_pool_group_delete(group);
+      (*threadcount) -= numofsubmitted;
     }
 
 #endif
@@ -0,0 +1,515 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <limits.h>
+#include <stdint.h>
+#include "core/assert_api.h"
+#include "core/chardef_api.h"
+#include "core/divmodmul_api.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/minmax_api.h"
+#include "core/unused_api.h"
+#include "extended/linearalign_simd.h"
+
+#if defined (__GNUC__) && defined (__x86_64__) && defined (_LP64)
+#define GT_LINEARALIGN_SIMD_X86
+#include <immintrin.h>
+#endif
+
+/* alignments with fewer rows or columns are not worth computing the score
+   profiles */
+#define GT_LINEARALIGN_SIMD_MINLEN      32UL
+/* maximal number of entries of all score profiles of an alignment */
+#define GT_LINEARALIGN_SIMD_MAXPROFILE  (1UL << 25)
+/* the absolute values of all scores and transformed scores must be smaller
+   than these bounds, which leave room for the values of cells outside of the
+   DP matrix */
+#define GT_LINEARALIGN_SIMD_BOUND16     (1L << 12)
+#define GT_LINEARALIGN_SIMD_BOUND32     (1L << 28)
+#define GT_LINEARALIGN_SIMD_NEGINF16\
+        ((int16_t) -GT_MULT2(GT_LINEARALIGN_SIMD_BOUND16))
+#define GT_LINEARALIGN_SIMD_NEGINF32\
+        ((int32_t) -GT_MULT2(GT_LINEARALIGN_SIMD_BOUND32))
+
+static const char *gt_linearalign_simd_kernel_names[] = { "scalar", "sse4.1",
+                                                          "avx2" };
+
+bool gt_linearalign_simd_kernel_is_supported(GtLinearalignSimdKernel kernel)
+{
+  switch (kernel) {
+    case GT_LINEARALIGN_SIMD_SCALAR:
+      return true;
+#ifdef GT_LINEARALIGN_SIMD_X86
+    case GT_LINEARALIGN_SIMD_SSE41:
+      return __builtin_cpu_supports("sse4.1") ? true : false;
+    case GT_LINEARALIGN_SIMD_AVX2:
+      return __builtin_cpu_supports("avx2") ? true : false;
+#endif
+    default:
+      return false;
+  }
+}
+
+GtLinearalignSimdKernel gt_linearalign_simd_kernel_best(void)
+{
+  if (gt_linearalign_simd_kernel_is_supported(GT_LINEARALIGN_SIMD_AVX2))
+    return GT_LINEARALIGN_SIMD_AVX2;
+  if (gt_linearalign_simd_kernel_is_supported(GT_LINEARALIGN_SIMD_SSE41))
+    return GT_LINEARALIGN_SIMD_SSE41;
+  return GT_LINEARALIGN_SIMD_SCALAR;
+}
+
+const char* gt_linearalign_simd_kernel_name(GtLinearalignSimdKernel kernel)
+{
+  gt_assert(kernel < GT_LINEARALIGN_SIMD_NUMOFKERNELS);
+  return gt_linearalign_simd_kernel_names[kernel];
+}
+
+void gt_linearalign_simd_random_sequence(GtUchar *seq, GtUword len)
+{
+  GtUword idx;
+
+  for (idx = 0; idx < len; idx++)
+  {
+    seq[idx] = gt_rand_max(30UL) == 0 ? (GtUchar) GT_WILDCARD
+                                      : (GtUchar) gt_rand_max(3UL);
+  }
+}
+
+#ifdef GT_LINEARALIGN_SIMD_X86
+
+typedef enum {
+  GT_LINEARALIGN_SIMD_NOPROV, /* values only */
+  GT_LINEARALIGN_SIMD_GLOBAL, /* crosspoint rows */
+  GT_LINEARALIGN_SIMD_LOCAL,  /* start coordinates, cut at score 0 */
+  GT_LINEARALIGN_SIMD_BAND    /* crosspoint columns and rows of origin */
+} GtLinearalignSimdMode;
+
+typedef enum {
+  GT_LINEARALIGN_SIMD_NOLANES,
+  GT_LINEARALIGN_SIMD_LANES16,
+  GT_LINEARALIGN_SIMD_LANES32
+} GtLinearalignSimdLanes;
+
+/* Determine the lane width for aligning <useq>[<ustart>..] of length <ulen>
+   and <vseq>[<vstart>..] of length <vlen> with the replacement scores of
+   <scorehandler> and <gapscore>. <costs> requires all values to be non
+   negative. */
+static GtLinearalignSimdLanes gt_linearalign_simd_lanes(
+                                            const GtScoreHandler *scorehandler,
+                                            GtWord gapscore,
+                                            bool costs,
+                                            const GtUchar *useq,
+                                            GtUword ustart,
+                                            GtUword ulen,
+                                            const GtUchar *vseq,
+                                            GtUword vstart,
+                                            GtUword vlen)
+{
+  bool uoccurs[UCHAR_MAX + 1] = {false}, voccurs[UCHAR_MAX + 1] = {false};
+  GtUword idx, numofvchars = 0, factor;
+  GtWord maxabs, minscore = gapscore, bound;
+  unsigned int a, b;
+
+  for (idx = 0; idx < ulen; idx++)
+  {
+    uoccurs[useq[ustart + idx]] = true;
+  }
+  for (idx = 0; idx < vlen; idx++)
+  {
+    if (!voccurs[vseq[vstart + idx]])
+    {
+      voccurs[vseq[vstart + idx]] = true;
+      numofvchars++;
+    }
+  }
+  if (numofvchars * (ulen + 1 + 16) > GT_LINEARALIGN_SIMD_MAXPROFILE)
+  {
+    return GT_LINEARALIGN_SIMD_NOLANES;
+  }
+  maxabs = GT_MAX(1, gapscore < 0 ? -gapscore : gapscore);
+  for (a = 0; a <= UCHAR_MAX; a++)
+  {
+    if (uoccurs[a])
+    {
+      for (b = 0; b <= UCHAR_MAX; b++)
+      {
+        if (voccurs[b])
+        {
+          GtWord score = gt_scorehandler_get_replacement(scorehandler,
+                                                         (GtUchar) a,
+                                                         (GtUchar) b);
+          minscore = GT_MIN(minscore, score);
+          maxabs = GT_MAX(maxabs, score < 0 ? -score : score);
+        }
+      }
+    }
+  }
+  if (costs && minscore < 0)
+  {
+    return GT_LINEARALIGN_SIMD_NOLANES;
+  }
+  /* the values of the cells and the values transformed for the scan are
+     bounded by the number of steps of a path times the maximal score */
+  factor = GT_MULT2(ulen) + vlen + 1;
+  if (factor >= (GtUword) GT_LINEARALIGN_SIMD_BOUND32 ||
+      maxabs >= GT_LINEARALIGN_SIMD_BOUND32)
+  {
+    return GT_LINEARALIGN_SIMD_NOLANES;
+  }
+  bound = (GtWord) factor * maxabs;
+  if (bound < GT_LINEARALIGN_SIMD_BOUND16)
+  {
+    return GT_LINEARALIGN_SIMD_LANES16;
+  }
+  if (bound < GT_LINEARALIGN_SIMD_BOUND32)
+  {
+    return GT_LINEARALIGN_SIMD_LANES32;
+  }
+  return GT_LINEARALIGN_SIMD_NOLANES;
+}
+
+/* SSE4.1, 16 bit lanes */
+#define GT_LAS_FUNC(N)          N##_sse41_16
+#define GT_LAS_TARGET           "sse4.1"
+#define GT_LAS_T                int16_t
+#define GT_LAS_V                __m128i
+#define GT_LAS_LANES            8
+#define GT_LAS_MIN              INT16_MIN
+#define GT_LAS_NEGINF           GT_LINEARALIGN_SIMD_NEGINF16
+#define GT_LAS_LOADU(P)         _mm_loadu_si128((const __m128i *) (P))
+#define GT_LAS_STOREU(P,V)      _mm_storeu_si128((__m128i *) (P), V)
+#define GT_LAS_SET1(X)          _mm_set1_epi16(X)
+#define GT_LAS_ADD(A,B)         _mm_add_epi16(A, B)
+#define GT_LAS_SUB(A,B)         _mm_sub_epi16(A, B)
+#define GT_LAS_MAX(A,B)         _mm_max_epi16(A, B)
+#define GT_LAS_CMPGT(A,B)       _mm_cmpgt_epi16(A, B)
+#define GT_LAS_XOR(A,B)         _mm_xor_si128(A, B)
+#define GT_LAS_BLENDV(A,B,M)    _mm_blendv_epi8(A, B, M)
+#define GT_LAS_SHIFTL(V,N)      _mm_slli_si128(V, 2 * (N))
+#define GT_LAS_LAST(V)          ((int16_t) _mm_extract_epi16(V, 7))
+#include "extended/linearalign_simd.gen"
+#undef GT_LAS_FUNC
+#undef GT_LAS_TARGET
+#undef GT_LAS_T
+#undef GT_LAS_V
+#undef GT_LAS_LANES
+#undef GT_LAS_MIN
+#undef GT_LAS_NEGINF
+#undef GT_LAS_LOADU
+#undef GT_LAS_STOREU
+#undef GT_LAS_SET1
+#undef GT_LAS_ADD
+#undef GT_LAS_SUB
+#undef GT_LAS_MAX
+#undef GT_LAS_CMPGT
+#undef GT_LAS_XOR
+#undef GT_LAS_BLENDV
+#undef GT_LAS_SHIFTL
+#undef GT_LAS_LAST
+
+/* SSE4.1, 32 bit lanes */
+#define GT_LAS_FUNC(N)          N##_sse41_32
+#define GT_LAS_TARGET           "sse4.1"
+#define GT_LAS_T                int32_t
+#define GT_LAS_V                __m128i
+#define GT_LAS_LANES            4
+#define GT_LAS_MIN              INT32_MIN
+#define GT_LAS_NEGINF           GT_LINEARALIGN_SIMD_NEGINF32
+#define GT_LAS_LOADU(P)         _mm_loadu_si128((const __m128i *) (P))
+#define GT_LAS_STOREU(P,V)      _mm_storeu_si128((__m128i *) (P), V)
+#define GT_LAS_SET1(X)          _mm_set1_epi32(X)
+#define GT_LAS_ADD(A,B)         _mm_add_epi32(A, B)
+#define GT_LAS_SUB(A,B)         _mm_sub_epi32(A, B)
+#define GT_LAS_MAX(A,B)         _mm_max_epi32(A, B)
+#define GT_LAS_CMPGT(A,B)       _mm_cmpgt_epi32(A, B)
+#define GT_LAS_XOR(A,B)         _mm_xor_si128(A, B)
+#define GT_LAS_BLENDV(A,B,M)    _mm_blendv_epi8(A, B, M)
+#define GT_LAS_SHIFTL(V,N)      _mm_slli_si128(V, 4 * (N))
+#define GT_LAS_LAST(V)          ((int32_t) _mm_extract_epi32(V, 3))
+#include "extended/linearalign_simd.gen"
+#undef GT_LAS_FUNC
+#undef GT_LAS_TARGET
+#undef GT_LAS_T
+#undef GT_LAS_V
+#undef GT_LAS_LANES
+#undef GT_LAS_MIN
+#undef GT_LAS_NEGINF
+#undef GT_LAS_LOADU
+#undef GT_LAS_STOREU
+#undef GT_LAS_SET1
+#undef GT_LAS_ADD
+#undef GT_LAS_SUB
+#undef GT_LAS_MAX
+#undef GT_LAS_CMPGT
+#undef GT_LAS_XOR
+#undef GT_LAS_BLENDV
+#undef GT_LAS_SHIFTL
+#undef GT_LAS_LAST
+
+/* shift the lanes of a 256 bit vector by <N> bytes across the 128 bit
+   halves */
+#define GT_LAS_AVX2_SHIFTBYTES(V,N)\
+        ((N) == 16 ? _mm256_permute2x128_si256(V, V, 0x08)\
+                   : _mm256_alignr_epi8(V,\
+                                        _mm256_permute2x128_si256(V, V, 0x08),\
+                                        16 - (N)))
+
+/* AVX2, 16 bit lanes */
+#define GT_LAS_FUNC(N)          N##_avx2_16
+#define GT_LAS_TARGET           "avx2"
+#define GT_LAS_T                int16_t
+#define GT_LAS_V                __m256i
+#define GT_LAS_LANES            16
+#define GT_LAS_MIN              INT16_MIN
+#define GT_LAS_NEGINF           GT_LINEARALIGN_SIMD_NEGINF16
+#define GT_LAS_LOADU(P)         _mm256_loadu_si256((const __m256i *) (P))
+#define GT_LAS_STOREU(P,V)      _mm256_storeu_si256((__m256i *) (P), V)
+#define GT_LAS_SET1(X)          _mm256_set1_epi16(X)
+#define GT_LAS_ADD(A,B)         _mm256_add_epi16(A, B)
+#define GT_LAS_SUB(A,B)         _mm256_sub_epi16(A, B)
+#define GT_LAS_MAX(A,B)         _mm256_max_epi16(A, B)
+#define GT_LAS_CMPGT(A,B)       _mm256_cmpgt_epi16(A, B)
+#define GT_LAS_XOR(A,B)         _mm256_xor_si256(A, B)
+#define GT_LAS_BLENDV(A,B,M)    _mm256_blendv_epi8(A, B, M)
+#define GT_LAS_SHIFTL(V,N)      GT_LAS_AVX2_SHIFTBYTES(V, 2 * (N))
+#define GT_LAS_LAST(V)          ((int16_t) _mm256_extract_epi16(V, 15))
+#include "extended/linearalign_simd.gen"
+#undef GT_LAS_FUNC
+#undef GT_LAS_TARGET
+#undef GT_LAS_T
+#undef GT_LAS_V
+#undef GT_LAS_LANES
+#undef GT_LAS_MIN
+#undef GT_LAS_NEGINF
+#undef GT_LAS_LOADU
+#undef GT_LAS_STOREU
+#undef GT_LAS_SET1
+#undef GT_LAS_ADD
+#undef GT_LAS_SUB
+#undef GT_LAS_MAX
+#undef GT_LAS_CMPGT
+#undef GT_LAS_XOR
+#undef GT_LAS_BLENDV
+#undef GT_LAS_SHIFTL
+#undef GT_LAS_LAST
+
+/* AVX2, 32 bit lanes */
+#define GT_LAS_FUNC(N)          N##_avx2_32
+#define GT_LAS_TARGET           "avx2"
+#define GT_LAS_T                int32_t
+#define GT_LAS_V                __m256i
+#define GT_LAS_LANES            8
+#define GT_LAS_MIN              INT32_MIN
+#define GT_LAS_NEGINF           GT_LINEARALIGN_SIMD_NEGINF32
+#define GT_LAS_LOADU(P)         _mm256_loadu_si256((const __m256i *) (P))
+#define GT_LAS_STOREU(P,V)      _mm256_storeu_si256((__m256i *) (P), V)
+#define GT_LAS_SET1(X)          _mm256_set1_epi32(X)
+#define GT_LAS_ADD(A,B)         _mm256_add_epi32(A, B)
+#define GT_LAS_SUB(A,B)         _mm256_sub_epi32(A, B)
+#define GT_LAS_MAX(A,B)         _mm256_max_epi32(A, B)
+#define GT_LAS_CMPGT(A,B)       _mm256_cmpgt_epi32(A, B)
+#define GT_LAS_XOR(A,B)         _mm256_xor_si256(A, B)
+#define GT_LAS_BLENDV(A,B,M)    _mm256_blendv_epi8(A, B, M)
+#define GT_LAS_SHIFTL(V,N)      GT_LAS_AVX2_SHIFTBYTES(V, 4 * (N))
+#define GT_LAS_LAST(V)          ((int32_t) _mm256_extract_epi32(V, 7))
+#include "extended/linearalign_simd.gen"
+#undef GT_LAS_FUNC
+#undef GT_LAS_TARGET
+#undef GT_LAS_T
+#undef GT_LAS_V
+#undef GT_LAS_LANES
+#undef GT_LAS_MIN
+#undef GT_LAS_NEGINF
+#undef GT_LAS_LOADU
+#undef GT_LAS_STOREU
+#undef GT_LAS_SET1
+#undef GT_LAS_ADD
+#undef GT_LAS_SUB
+#undef GT_LAS_MAX
+#undef GT_LAS_CMPGT
+#undef GT_LAS_XOR
+#undef GT_LAS_BLENDV
+#undef GT_LAS_SHIFTL
+#undef GT_LAS_LAST
+#undef GT_LAS_AVX2_SHIFTBYTES
+
+#endif
+
+bool gt_linearalign_simd_global(GT_UNUSED GtLinearalignSimdKernel kernel,
+                                GT_UNUSED GtUword *EDtabcolumn,
+                                GT_UNUSED GtUword *Rtabcolumn,
+                                GT_UNUSED GtUword *distance,
+                                GT_UNUSED const GtScoreHandler *scorehandler,
+                                GT_UNUSED GtUword midcolumn,
+                                GT_UNUSED const GtUchar *useq,
+                                GT_UNUSED GtUword ustart,
+                                GT_UNUSED GtUword ulen,
+                                GT_UNUSED const GtUchar *vseq,
+                                GT_UNUSED GtUword vstart,
+                                GT_UNUSED GtUword vlen)
+{
+#ifdef GT_LINEARALIGN_SIMD_X86
+  GtWord gapcost;
+  GtLinearalignSimdLanes lanes;
+
+  if (kernel == GT_LINEARALIGN_SIMD_SCALAR ||
+      ulen < GT_LINEARALIGN_SIMD_MINLEN || vlen < GT_LINEARALIGN_SIMD_MINLEN)
+  {
+    return false;
+  }
+  gt_assert(gt_linearalign_simd_kernel_is_supported(kernel));
+  gapcost = gt_scorehandler_get_gapscore(scorehandler);
+  lanes = gt_linearalign_simd_lanes(scorehandler, gapcost, true,
+                                    useq, ustart, ulen, vseq, vstart, vlen);
+  if (lanes == GT_LINEARALIGN_SIMD_NOLANES)
+  {
+    return false;
+  }
+  if (kernel == GT_LINEARALIGN_SIMD_AVX2)
+  {
+    *distance = (lanes == GT_LINEARALIGN_SIMD_LANES16
+                   ? gt_linearalign_simd_global_avx2_16
+                   : gt_linearalign_simd_global_avx2_32)
+                (EDtabcolumn, Rtabcolumn, gapcost, midcolumn, scorehandler,
+                 useq, ustart, ulen, vseq, vstart, vlen);
+  } else
+  {
+    *distance = (lanes == GT_LINEARALIGN_SIMD_LANES16
+                   ? gt_linearalign_simd_global_sse41_16
+                   : gt_linearalign_simd_global_sse41_32)
+                (EDtabcolumn, Rtabcolumn, gapcost, midcolumn, scorehandler,
+                 useq, ustart, ulen, vseq, vstart, vlen);
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool gt_linearalign_simd_local(GT_UNUSED GtLinearalignSimdKernel kernel,
+                               GT_UNUSED GtWord *Ltabcolumn,
+                               GT_UNUSED GtUwordPair *Starttabcolumn,
+                               GT_UNUSED GtMaxcoordvalue *max,
+                               GT_UNUSED const GtScoreHandler *scorehandler,
+                               GT_UNUSED const GtUchar *useq,
+                               GT_UNUSED GtUword ustart,
+                               GT_UNUSED GtUword ulen,
+                               GT_UNUSED const GtUchar *vseq,
+                               GT_UNUSED GtUword vstart,
+                               GT_UNUSED GtUword vlen)
+{
+#ifdef GT_LINEARALIGN_SIMD_X86
+  GtWord gapscore;
+  GtLinearalignSimdLanes lanes;
+
+  if (kernel == GT_LINEARALIGN_SIMD_SCALAR ||
+      ulen < GT_LINEARALIGN_SIMD_MINLEN || vlen < GT_LINEARALIGN_SIMD_MINLEN)
+  {
+    return false;
+  }
+  gt_assert(gt_linearalign_simd_kernel_is_supported(kernel));
+  gapscore = gt_scorehandler_get_gapscore(scorehandler);
+  if (gapscore >= 0)
+  {
+    /* the first row would not be cut at score 0 */
+    return false;
+  }
+  lanes = gt_linearalign_simd_lanes(scorehandler, gapscore, false,
+                                    useq, ustart, ulen, vseq, vstart, vlen);
+  if (lanes == GT_LINEARALIGN_SIMD_NOLANES)
+  {
+    return false;
+  }
+  if (kernel == GT_LINEARALIGN_SIMD_AVX2)
+  {
+    (lanes == GT_LINEARALIGN_SIMD_LANES16
+       ? gt_linearalign_simd_local_avx2_16
+       : gt_linearalign_simd_local_avx2_32)
+    (Ltabcolumn, Starttabcolumn, max, gapscore, scorehandler,
+     useq, ustart, ulen, vseq, vstart, vlen);
+  } else
+  {
+    (lanes == GT_LINEARALIGN_SIMD_LANES16
+       ? gt_linearalign_simd_local_sse41_16
+       : gt_linearalign_simd_local_sse41_32)
+    (Ltabcolumn, Starttabcolumn, max, gapscore, scorehandler,
+     useq, ustart, ulen, vseq, vstart, vlen);
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool gt_linearalign_simd_diagonalband(GT_UNUSED GtLinearalignSimdKernel kernel,
+                                      GT_UNUSED GtUword *EDtabcolumn,
+                                      GT_UNUSED GtUword *Rtabcolumn,
+                                      GT_UNUSED GtDiagAlignentry *Diagcolumn,
+                                      GT_UNUSED GtUword *lastcrosspoint,
+                                      GT_UNUSED const GtScoreHandler
+                                        *scorehandler,
+                                      GT_UNUSED GtWord offset,
+                                      GT_UNUSED const GtUchar *useq,
+                                      GT_UNUSED GtUword ustart,
+                                      GT_UNUSED GtUword ulen,
+                                      GT_UNUSED const GtUchar *vseq,
+                                      GT_UNUSED GtUword vstart,
+                                      GT_UNUSED GtUword vlen,
+                                      GT_UNUSED GtWord left_dist,
+                                      GT_UNUSED GtWord right_dist)
+{
+#ifdef GT_LINEARALIGN_SIMD_X86
+  GtWord gapcost;
+  GtLinearalignSimdLanes lanes;
+
+  if (kernel == GT_LINEARALIGN_SIMD_SCALAR ||
+      (GtUword) (right_dist - left_dist) < GT_LINEARALIGN_SIMD_MINLEN ||
+      vlen < GT_LINEARALIGN_SIMD_MINLEN)
+  {
+    return false;
+  }
+  gt_assert(gt_linearalign_simd_kernel_is_supported(kernel));
+  gapcost = gt_scorehandler_get_gapscore(scorehandler);
+  lanes = gt_linearalign_simd_lanes(scorehandler, gapcost, true,
+                                    useq, ustart, ulen, vseq, vstart, vlen);
+  if (lanes == GT_LINEARALIGN_SIMD_NOLANES)
+  {
+    return false;
+  }
+  if (kernel == GT_LINEARALIGN_SIMD_AVX2)
+  {
+    *lastcrosspoint = (lanes == GT_LINEARALIGN_SIMD_LANES16
+                         ? gt_linearalign_simd_diagonalband_avx2_16
+                         : gt_linearalign_simd_diagonalband_avx2_32)
+                      (EDtabcolumn, Rtabcolumn, Diagcolumn, gapcost,
+                       scorehandler, offset, useq, ustart, ulen,
+                       vseq, vstart, vlen, left_dist, right_dist);
+  } else
+  {
+    *lastcrosspoint = (lanes == GT_LINEARALIGN_SIMD_LANES16
+                         ? gt_linearalign_simd_diagonalband_sse41_16
+                         : gt_linearalign_simd_diagonalband_sse41_32)
+                      (EDtabcolumn, Rtabcolumn, Diagcolumn, gapcost,
+                       scorehandler, offset, useq, ustart, ulen,
+                       vseq, vstart, vlen, left_dist, right_dist);
+  }
+  return true;
+#else
+  return false;
+#endif
+}
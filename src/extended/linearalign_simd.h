@@ -0,0 +1,118 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef LINEARALIGN_SIMD_H
+#define LINEARALIGN_SIMD_H
+
+#include <stdbool.h>
+#include "core/types_api.h"
+#include "extended/diagonalbandalign.h"
+#include "extended/maxcoordvalue.h"
+#include "extended/scorehandler.h"
+
+/* Kernels for filling the DP columns of alignments with linear gap costs.
+   The SIMD kernels keep one DP column in 16 or 32 bit lanes; the lane width
+   is chosen for each alignment such that no score can overflow. All cells of
+   a vector are computed in parallel, the dependency on the cell above is
+   resolved by a prefix scan within the vector. The kernels break ties exactly
+   like the scalar implementations, so the results do not depend on the
+   kernel. The SIMD kernels are only available on x86_64 with a compiler
+   supporting function specific target options; which of them the CPU
+   supports is determined at runtime. Alignments with affine gap costs are
+   always computed by the scalar implementations. */
+typedef enum {
+  GT_LINEARALIGN_SIMD_SCALAR,
+  GT_LINEARALIGN_SIMD_SSE41,
+  GT_LINEARALIGN_SIMD_AVX2,
+  GT_LINEARALIGN_SIMD_NUMOFKERNELS
+} GtLinearalignSimdKernel;
+
+/* Return true if <kernel> can be used on the running CPU. */
+bool                    gt_linearalign_simd_kernel_is_supported(
+                                                GtLinearalignSimdKernel kernel);
+/* Return the fastest kernel supported by the running CPU. */
+GtLinearalignSimdKernel gt_linearalign_simd_kernel_best(void);
+/* Return the name of <kernel>. */
+const char*             gt_linearalign_simd_kernel_name(
+                                                GtLinearalignSimdKernel kernel);
+/* Store <len> random DNA symbols with a few wildcards in <seq>, as input for
+   the unit tests comparing the kernels. */
+void                    gt_linearalign_simd_random_sequence(GtUchar *seq,
+                                                            GtUword len);
+
+/* Fill all DP columns of the global alignment of <useq>[<ustart>..] of
+   length <ulen> and <vseq>[<vstart>..] of length <vlen> with the cost values
+   of <scorehandler>, using <kernel>. The last column of distance values is
+   stored in <EDtabcolumn>, the crosspoints of the optimal paths with column
+   <midcolumn> in <Rtabcolumn> and the distance in <distance>. Returns false,
+   without touching the columns, if <kernel> is not applicable to the
+   alignment. */
+bool gt_linearalign_simd_global(GtLinearalignSimdKernel kernel,
+                                GtUword *EDtabcolumn,
+                                GtUword *Rtabcolumn,
+                                GtUword *distance,
+                                const GtScoreHandler *scorehandler,
+                                GtUword midcolumn,
+                                const GtUchar *useq,
+                                GtUword ustart,
+                                GtUword ulen,
+                                const GtUchar *vseq,
+                                GtUword vstart,
+                                GtUword vlen);
+
+/* Fill all DP columns of the local alignment of <useq>[<ustart>..] of length
+   <ulen> and <vseq>[<vstart>..] of length <vlen> with the score values of
+   <scorehandler>, using <kernel>. The last column of scores and start
+   coordinates is stored in <Ltabcolumn> and <Starttabcolumn>, the maximal
+   score and its coordinates are stored in <max>. Returns false, without
+   touching the columns, if <kernel> is not applicable to the alignment. */
+bool gt_linearalign_simd_local(GtLinearalignSimdKernel kernel,
+                               GtWord *Ltabcolumn,
+                               GtUwordPair *Starttabcolumn,
+                               GtMaxcoordvalue *max,
+                               const GtScoreHandler *scorehandler,
+                               const GtUchar *useq,
+                               GtUword ustart,
+                               GtUword ulen,
+                               const GtUchar *vseq,
+                               GtUword vstart,
+                               GtUword vlen);
+
+/* Fill the DP columns 1 to <vlen> of the global alignment within the
+   diagonal band given by <left_dist> and <right_dist>, using <kernel>.
+   <EDtabcolumn> and <Rtabcolumn> must contain the first column, they are
+   overwritten with the last column. The crosspoints of the optimal paths
+   with the middle diagonal of the band are stored in <Diagcolumn>, row
+   indices are shifted by <offset>. The crosspoint of the optimal path is
+   stored in <lastcrosspoint>. Returns false, without touching the columns,
+   if <kernel> is not applicable to the alignment. */
+bool gt_linearalign_simd_diagonalband(GtLinearalignSimdKernel kernel,
+                                      GtUword *EDtabcolumn,
+                                      GtUword *Rtabcolumn,
+                                      GtDiagAlignentry *Diagcolumn,
+                                      GtUword *lastcrosspoint,
+                                      const GtScoreHandler *scorehandler,
+                                      GtWord offset,
+                                      const GtUchar *useq,
+                                      GtUword ustart,
+                                      GtUword ulen,
+                                      const GtUchar *vseq,
+                                      GtUword vstart,
+                                      GtUword vlen,
+                                      GtWord left_dist,
+                                      GtWord right_dist);
+
+#endif
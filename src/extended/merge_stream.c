@@ -46,14 +46,19 @@ struct GtMergeStream {
 #define gt_merge_stream_cast(GS)\
         gt_node_stream_cast(gt_merge_stream_class(), GS)
 
+/* ties are broken by the input index, making the merge stable */
 static int gt_merge_stream_item_compare(const void *a, const void *b)
 {
   GtMergeStreamItem *item1, *item2;
+  int rval;
   gt_assert(a && b);
   item1 = (GtMergeStreamItem*) a;
   item2 = (GtMergeStreamItem*) b;
   gt_assert(item1->gn && item2->gn);
-  return gt_genome_node_compare(&item1->gn, &item2->gn);
+  rval = gt_genome_node_compare(&item1->gn, &item2->gn);
+  if (rval == 0 && item1->input_index != item2->input_index)
+    rval = item1->input_index < item2->input_index ? -1 : 1;
+  return rval;
 }
 
 static int merge_stream_next_in_order(GtNodeStream *ns, GtGenomeNode **gn,
@@ -94,6 +99,8 @@ static int merge_stream_next_in_order(GtNodeStream *ns, GtGenomeNode **gn,
     GtGenomeNode *nextnode = NULL;
     gt_assert(min_item && min_item->gn);
     min_node = min_item->gn;
+    /* the node is passed on, do not delete it on exhausted input streams */
+    min_item->gn = NULL;
     /* get next element from the last stream queried */
     had_err = gt_node_stream_next(*(GtNodeStream**)
                                     gt_array_get(ms->node_streams,
@@ -104,10 +111,8 @@ static int merge_stream_next_in_order(GtNodeStream *ns, GtGenomeNode **gn,
       if (!gt_eof_node_try_cast(nextnode)) {
         min_item->gn = nextnode;
         gt_priority_queue_add(ms->pq, min_item);
-      } else {
-        min_item->gn = NULL;
+      } else
         gt_genome_node_delete(nextnode);
-      }
     }
   }
 
@@ -0,0 +1,71 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/assert_api.h"
+#include "core/class_alloc_lock.h"
+#include "core/fa_api.h"
+#include "extended/genome_node_serializer.h"
+#include "extended/serialized_in_stream.h"
+
+struct GtSerializedInStream {
+  const GtNodeStream parent_instance;
+  FILE *fp;
+  GtGenomeNodeDeserializer *gnd;
+};
+
+#define gt_serialized_in_stream_cast(GS)\
+        gt_node_stream_cast(gt_serialized_in_stream_class(), GS)
+
+static int gt_serialized_in_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
+                                        GtError *err)
+{
+  GtSerializedInStream *sis;
+  gt_error_check(err);
+  sis = gt_serialized_in_stream_cast(ns);
+  return gt_genome_node_deserializer_next(sis->gnd, gn, err);
+}
+
+static void gt_serialized_in_stream_free(GtNodeStream *ns)
+{
+  GtSerializedInStream *sis = gt_serialized_in_stream_cast(ns);
+  gt_genome_node_deserializer_delete(sis->gnd);
+  gt_fa_xfclose(sis->fp);
+}
+
+const GtNodeStreamClass* gt_serialized_in_stream_class(void)
+{
+  static const GtNodeStreamClass *nsc = NULL;
+  gt_class_alloc_lock_enter();
+  if (!nsc) {
+    nsc = gt_node_stream_class_new(sizeof (GtSerializedInStream),
+                                   gt_serialized_in_stream_free,
+                                   gt_serialized_in_stream_next);
+  }
+  gt_class_alloc_lock_leave();
+  return nsc;
+}
+
+GtNodeStream* gt_serialized_in_stream_new(FILE *fp, bool sorted)
+{
+  GtNodeStream *ns = gt_node_stream_create(gt_serialized_in_stream_class(),
+                                           sorted);
+  GtSerializedInStream *sis = gt_serialized_in_stream_cast(ns);
+  gt_assert(fp);
+  rewind(fp);
+  sis->fp = fp;
+  sis->gnd = gt_genome_node_deserializer_new(fp);
+  return ns;
+}
@@ -0,0 +1,35 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef SERIALIZED_IN_STREAM_H
+#define SERIALIZED_IN_STREAM_H
+
+#include <stdio.h>
+#include "extended/node_stream_api.h"
+
+/* Implements the <GtNodeStream> interface. A <GtSerializedInStream> returns
+   the genome nodes written to a file by <gt_genome_node_serialize()>. */
+typedef struct GtSerializedInStream GtSerializedInStream;
+
+const GtNodeStreamClass* gt_serialized_in_stream_class(void);
+
+/* Create a <GtSerializedInStream*> reading the nodes stored in <fp> from its
+   beginning. <fp> must have been opened by the file allocator and is closed
+   when the stream is deleted. If <sorted> is true, the nodes in <fp> must be
+   sorted. */
+GtNodeStream*            gt_serialized_in_stream_new(FILE *fp, bool sorted);
+
+#endif
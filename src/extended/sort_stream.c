@@ -18,79 +18,166 @@
 #include "core/array.h"
 #include "core/assert_api.h"
 #include "core/class_alloc_lock.h"
+#include "core/fa_api.h"
 #include "extended/eof_node_api.h"
 #include "extended/genome_node.h"
+#include "extended/genome_node_serializer.h"
+#include "extended/merge_stream_api.h"
 #include "extended/node_stream_api.h"
+#include "extended/serialized_in_stream.h"
 #include "extended/sort_stream.h"
 
 struct GtSortStream {
   const GtNodeStream parent_instance;
-  GtNodeStream *in_stream;
-  GtUword idx;
-  GtArray *nodes;
+  GtNodeStream *in_stream,
+               *merge_stream;
+  GtUword idx,
+          memlimit,
+          memused;
+  GtArray *nodes,
+          *runs;
+  GtGenomeNode *lookahead;
   bool sorted;
 };
 
 #define gt_sort_stream_cast(GS)\
         gt_node_stream_cast(gt_sort_stream_class(), GS);
 
+/* sort the buffered nodes and write them to a new temporary file */
+static int sort_stream_spill_run(GtSortStream *sort_stream, GtError *err)
+{
+  GtUword i;
+  FILE *fp;
+  int had_err = 0;
+  gt_genome_nodes_sort_stable(sort_stream->nodes);
+  fp = gt_xtmpfp_generic(NULL, GT_TMPFP_AUTOREMOVE | GT_TMPFP_OPENBINARY);
+  for (i = 0; i < gt_array_size(sort_stream->nodes); i++) {
+    GtGenomeNode *node = *(GtGenomeNode**) gt_array_get(sort_stream->nodes, i);
+    if (!had_err)
+      had_err = gt_genome_node_serialize(node, fp, err);
+    gt_genome_node_delete(node);
+  }
+  gt_array_reset(sort_stream->nodes);
+  sort_stream->memused = 0;
+  gt_array_add(sort_stream->runs, fp);
+  return had_err;
+}
+
+/* merge the spilled runs, the order of the runs breaks ties between equal
+   nodes so that the result equals a stable sort of all nodes */
+static void sort_stream_merge_runs(GtSortStream *sort_stream)
+{
+  GtArray *run_streams = gt_array_new(sizeof (GtNodeStream*));
+  GtNodeStream *run_stream;
+  GtUword i;
+  for (i = 0; i < gt_array_size(sort_stream->runs); i++) {
+    run_stream = gt_serialized_in_stream_new(*(FILE**)
+                                             gt_array_get(sort_stream->runs, i),
+                                             true);
+    gt_array_add(run_streams, run_stream);
+  }
+  gt_array_reset(sort_stream->runs);
+  sort_stream->merge_stream = gt_merge_stream_new(run_streams);
+  for (i = 0; i < gt_array_size(run_streams); i++)
+    gt_node_stream_delete(*(GtNodeStream**) gt_array_get(run_streams, i));
+  gt_array_delete(run_streams);
+}
+
+static int sort_stream_fill(GtSortStream *sort_stream, GtError *err)
+{
+  GtGenomeNode *node;
+  int had_err;
+  while (!(had_err = gt_node_stream_next(sort_stream->in_stream, &node,
+                                         err)) && node) {
+    if (gt_eof_node_try_cast(node)) {
+      gt_genome_node_delete(node); /* get rid of EOF nodes */
+      continue;
+    }
+    gt_array_add(sort_stream->nodes, node);
+    if (sort_stream->memlimit > 0) {
+      sort_stream->memused += gt_genome_node_estimate_size(node);
+      if (sort_stream->memused > sort_stream->memlimit &&
+          (had_err = sort_stream_spill_run(sort_stream, err)))
+        break;
+    }
+  }
+  if (!had_err) {
+    if (gt_array_size(sort_stream->runs) > 0) {
+      /* spill the last run as well, so that all runs are merged alike */
+      if (gt_array_size(sort_stream->nodes) > 0)
+        had_err = sort_stream_spill_run(sort_stream, err);
+      if (!had_err)
+        sort_stream_merge_runs(sort_stream);
+    }
+    else
+      gt_genome_nodes_sort_stable(sort_stream->nodes);
+  }
+  return had_err;
+}
+
+/* return the next node in sorted order, or NULL */
+static int sort_stream_next_sorted(GtSortStream *sort_stream,
+                                   GtGenomeNode **gn, GtError *err)
+{
+  *gn = NULL;
+  if (sort_stream->lookahead) {
+    *gn = sort_stream->lookahead;
+    sort_stream->lookahead = NULL;
+    return 0;
+  }
+  if (sort_stream->merge_stream)
+    return gt_node_stream_next(sort_stream->merge_stream, gn, err);
+  if (sort_stream->idx < gt_array_size(sort_stream->nodes)) {
+    *gn = *(GtGenomeNode**) gt_array_get(sort_stream->nodes,
+                                         sort_stream->idx);
+    sort_stream->idx++;
+  }
+  return 0;
+}
+
 static int gt_sort_stream_next(GtNodeStream *ns, GtGenomeNode **gn,
                                GtError *err)
 {
   GtSortStream *sort_stream;
-  GtEOFNode *eofn;
   GtGenomeNode *node;
   int had_err = 0;
   gt_error_check(err);
   sort_stream = gt_sort_stream_cast(ns);
 
   if (!sort_stream->sorted) {
-    while (!(had_err = gt_node_stream_next(sort_stream->in_stream, &node,
-                                           err)) && node) {
-      if ((eofn = gt_eof_node_try_cast(node)))
-        gt_genome_node_delete(node); /* get rid of EOF nodes */
-      else
-        gt_array_add(sort_stream->nodes, node);
-    }
-    if (!had_err) {
-      gt_genome_nodes_sort_stable(sort_stream->nodes);
+    had_err = sort_stream_fill(sort_stream, err);
+    if (!had_err)
       sort_stream->sorted = true;
-    }
   }
 
   if (!had_err) {
     gt_assert(sort_stream->sorted);
-    if (sort_stream->idx < gt_array_size(sort_stream->nodes)) {
-      *gn = *(GtGenomeNode**) gt_array_get(sort_stream->nodes,
-                                           sort_stream->idx);
-      sort_stream->idx++;
-      /* join region nodes with the same sequence ID */
-      if (gt_region_node_try_cast(*gn)) {
-        GtRange range_a, range_b;
-        while (sort_stream->idx < gt_array_size(sort_stream->nodes)) {
-          node = *(GtGenomeNode**) gt_array_get(sort_stream->nodes,
-                                                sort_stream->idx);
-          if (!gt_region_node_try_cast(node) ||
-              gt_str_cmp(gt_genome_node_get_seqid(*gn),
-                         gt_genome_node_get_seqid(node))) {
-            /* the next node is not a region node with the same ID */
-            break;
-          }
-          range_a = gt_genome_node_get_range(*gn);
-          range_b = gt_genome_node_get_range(node);
-          range_a = gt_range_join(&range_a, &range_b);
-          gt_genome_node_set_range(*gn, &range_a);
-          gt_genome_node_delete(node);
-          sort_stream->idx++;
+    had_err = sort_stream_next_sorted(sort_stream, gn, err);
+    /* join region nodes with the same sequence ID */
+    if (!had_err && *gn && gt_region_node_try_cast(*gn)) {
+      GtRange range_a, range_b;
+      while (!(had_err = sort_stream_next_sorted(sort_stream, &node, err)) &&
+             node) {
+        if (!gt_region_node_try_cast(node) ||
+            gt_str_cmp(gt_genome_node_get_seqid(*gn),
+                       gt_genome_node_get_seqid(node))) {
+          /* the next node is not a region node with the same ID */
+          sort_stream->lookahead = node;
+          break;
         }
+        range_a = gt_genome_node_get_range(*gn);
+        range_b = gt_genome_node_get_range(node);
+        range_a = gt_range_join(&range_a, &range_b);
+        gt_genome_node_set_range(*gn, &range_a);
+        gt_genome_node_delete(node);
+      }
+      if (had_err) {
+        gt_genome_node_delete(*gn);
+        *gn = NULL;
       }
-      return 0;
     }
-  }
-
-  if (!had_err) {
-    gt_array_reset(sort_stream->nodes);
-    *gn = NULL;
+    if (!had_err && !*gn)
+      gt_array_reset(sort_stream->nodes);
   }
 
   return had_err;
@@ -105,6 +192,11 @@ static void gt_sort_stream_free(GtNodeStream *ns)
                           gt_array_get(sort_stream->nodes, i));
   }
   gt_array_delete(sort_stream->nodes);
+  for (i = 0; i < gt_array_size(sort_stream->runs); i++)
+    gt_fa_xfclose(*(FILE**) gt_array_get(sort_stream->runs, i));
+  gt_array_delete(sort_stream->runs);
+  gt_genome_node_delete(sort_stream->lookahead);
+  gt_node_stream_delete(sort_stream->merge_stream);
   gt_node_stream_delete(sort_stream->in_stream);
 }
 
@@ -130,5 +222,16 @@ GtNodeStream* gt_sort_stream_new(GtNodeStream *in_stream)
   sort_stream->sorted = false;
   sort_stream->idx = 0;
   sort_stream->nodes = gt_array_new(sizeof (GtGenomeNode*));
+  sort_stream->runs = gt_array_new(sizeof (FILE*));
+  sort_stream->merge_stream = NULL;
+  sort_stream->lookahead = NULL;
+  sort_stream->memlimit = 0;
+  sort_stream->memused = 0;
   return ns;
 }
+
+void gt_sort_stream_set_memlimit(GtSortStream *sort_stream, GtUword memlimit)
+{
+  gt_assert(sort_stream && !sort_stream->sorted);
+  sort_stream->memlimit = memlimit;
+}
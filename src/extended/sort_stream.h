@@ -22,4 +22,11 @@
 
 const GtNodeStreamClass* gt_sort_stream_class(void);
 
+/* Bound the memory used by <sort_stream> to approximately <memlimit> bytes
+   (0 means unlimited, the default). If the buffered nodes exceed the limit,
+   they are sorted and spilled to a temporary file, and the sorted runs are
+   merged on output. The output is the same as without a limit. */
+void                     gt_sort_stream_set_memlimit(GtSortStream *sort_stream,
+                                                     GtUword memlimit);
+
 #endif
@@ -17,6 +17,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include "core/arena.h"
 #include "core/ma_api.h"
 #include "core/ensure_api.h"
 #include "core/unused_api.h"
@@ -29,7 +30,20 @@
    tag\0value\0tag\0value\0\0
 */
 
-GtTagValueMap gt_tag_value_map_new(const char *tag, const char *value)
+/* Resize <map> from <oldsize> to <newsize> bytes, in <arena> if it is not
+   NULL. */
+static GtTagValueMap map_resize(GtTagValueMap map, size_t oldsize,
+                                size_t newsize, GtArena *arena)
+{
+  if (arena) {
+    /* arena blocks cannot shrink, the space is released with the arena */
+    return gt_arena_realloc(arena, map, oldsize, newsize);
+  }
+  return gt_realloc(map, newsize);
+}
+
+static GtTagValueMap tag_value_map_new(const char *tag, const char *value,
+                                       GtArena *arena)
 {
   GtTagValueMap map;
   size_t tag_len, value_len;
@@ -37,13 +51,26 @@ GtTagValueMap gt_tag_value_map_new(const char *tag, const char *value)
   tag_len = strlen(tag);
   value_len = strlen(value);
   gt_assert(tag_len && value_len);
-  map = gt_malloc((tag_len + 1 + value_len + 1 + 1) * sizeof *map);
+  map = map_resize(NULL, 0, (tag_len + 1 + value_len + 1 + 1) * sizeof *map,
+                   arena);
   memcpy(map, tag, tag_len + 1);
   memcpy(map + tag_len + 1, value, value_len + 1);
   map[tag_len + 1 + value_len + 1] = '\0';
   return map;
 }
 
+GtTagValueMap gt_tag_value_map_new(const char *tag, const char *value)
+{
+  return tag_value_map_new(tag, value, NULL);
+}
+
+GtTagValueMap gt_tag_value_map_new_in_arena(const char *tag, const char *value,
+                                            GtArena *arena)
+{
+  gt_assert(arena);
+  return tag_value_map_new(tag, value, arena);
+}
+
 /* Stores map length in <map_len> if the return value equals NULL (i.e., if not
    value has been found) and <map_len> does not equal NULL. */
 static char* get_value(const GtTagValueMap map, const char *tag,
@@ -115,8 +142,8 @@ static size_t get_map_nof_items(const GtTagValueMap map)
   return nof_items;
 }
 
-void gt_tag_value_map_add(GtTagValueMap *map, const char *tag,
-                          const char *value)
+static void tag_value_map_add(GtTagValueMap *map, const char *tag,
+                              const char *value, GtArena *arena)
 {
   size_t tag_len, value_len, map_len = 0;
   GT_UNUSED const char *tag_already_used;
@@ -128,14 +155,29 @@ void gt_tag_value_map_add(GtTagValueMap *map, const char *tag,
   tag_already_used = get_value(*map, tag, &map_len);
   gt_assert(!tag_already_used); /* map does not contain given <tag> already */
   /* allocate additional space */
-  *map = gt_realloc(*map, map_len + tag_len + 1 + value_len + 1 + 1);
+  *map = map_resize(*map, map_len + 1,
+                    map_len + tag_len + 1 + value_len + 1 + 1, arena);
   /* store new tag/value pair */
   memcpy(*map + map_len, tag, tag_len + 1);
   memcpy(*map + map_len + tag_len + 1, value, value_len + 1);
   (*map)[map_len + tag_len + 1 + value_len + 1] = '\0';
 }
 
-void gt_tag_value_map_remove(GtTagValueMap *map, const char *tag)
+void gt_tag_value_map_add(GtTagValueMap *map, const char *tag,
+                          const char *value)
+{
+  tag_value_map_add(map, tag, value, NULL);
+}
+
+void gt_tag_value_map_add_in_arena(GtTagValueMap *map, const char *tag,
+                                   const char *value, GtArena *arena)
+{
+  gt_assert(arena);
+  tag_value_map_add(map, tag, value, arena);
+}
+
+static void tag_value_map_remove(GtTagValueMap *map, const char *tag,
+                                 GtArena *arena)
 {
   size_t tag_len, value_len, map_len;
   char *value;
@@ -150,12 +192,25 @@ void gt_tag_value_map_remove(GtTagValueMap *map, const char *tag)
   /* move memory from end position of value to start position of tag */
   memmove(value - tag_len - 1, value + value_len + 1,
           map_len - ((size_t) value - (size_t) *map + value_len));
-  *map = gt_realloc(*map, map_len - (tag_len + 1 + value_len + 1) + 1);
+  *map = map_resize(*map, map_len + 1,
+                    map_len - (tag_len + 1 + value_len + 1) + 1, arena);
   gt_assert((*map)[map_len - (tag_len + 1 + value_len + 1)] == '\0');
 }
 
-void gt_tag_value_map_set(GtTagValueMap *map, const char *tag,
-                          const char *new_value)
+void gt_tag_value_map_remove(GtTagValueMap *map, const char *tag)
+{
+  tag_value_map_remove(map, tag, NULL);
+}
+
+void gt_tag_value_map_remove_in_arena(GtTagValueMap *map, const char *tag,
+                                      GtArena *arena)
+{
+  gt_assert(arena);
+  tag_value_map_remove(map, tag, arena);
+}
+
+static void tag_value_map_set(GtTagValueMap *map, const char *tag,
+                              const char *new_value, GtArena *arena)
 {
   size_t old_value_len, new_value_len, map_len = 0;
   char *old_value;
@@ -166,7 +221,7 @@ void gt_tag_value_map_set(GtTagValueMap *map, const char *tag,
   /* determine current map length */
   old_value = get_value(*map, tag, &map_len);
   if (!old_value)
-    return gt_tag_value_map_add(map, tag, new_value);
+    return tag_value_map_add(map, tag, new_value, arena);
   /* tag already used -> replace it */
   old_value_len = strlen(old_value);
   map_len = get_map_len(*map);
@@ -174,13 +229,15 @@ void gt_tag_value_map_set(GtTagValueMap *map, const char *tag,
     memcpy(old_value, new_value, new_value_len);
     memmove(old_value + new_value_len, old_value + old_value_len,
             map_len - ((size_t) old_value - (size_t) *map + old_value_len) + 1);
-    *map = gt_realloc(*map, map_len - (old_value_len - new_value_len) + 1);
+    *map = map_resize(*map, map_len + 1,
+                      map_len - (old_value_len - new_value_len) + 1, arena);
   }
   else if (new_value_len == old_value_len) {
     memcpy(old_value, new_value, new_value_len);
   }
   else { /* (new_value_len > old_value_len)  */
-    *map = gt_realloc(*map, map_len + (new_value_len - old_value_len) + 1);
+    *map = map_resize(*map, map_len + 1,
+                      map_len + (new_value_len - old_value_len) + 1, arena);
     /* determine old_value again, realloc() might have moved it */
     old_value = get_value(*map, tag, &map_len);
     gt_assert(old_value);
@@ -191,6 +248,19 @@ void gt_tag_value_map_set(GtTagValueMap *map, const char *tag,
   gt_assert((*map)[map_len - old_value_len + new_value_len] == '\0');
 }
 
+void gt_tag_value_map_set(GtTagValueMap *map, const char *tag,
+                          const char *new_value)
+{
+  tag_value_map_set(map, tag, new_value, NULL);
+}
+
+void gt_tag_value_map_set_in_arena(GtTagValueMap *map, const char *tag,
+                                   const char *new_value, GtArena *arena)
+{
+  gt_assert(arena);
+  tag_value_map_set(map, tag, new_value, arena);
+}
+
 const char* gt_tag_value_map_get(const GtTagValueMap map, const char *tag)
 {
   gt_assert(map && tag && strlen(tag));
@@ -400,6 +470,23 @@ int gt_tag_value_map_unit_test(GtError *err)
     gt_tag_value_map_delete(map);
   }
 
+  /* test maps allocated in an arena */
+  if (!had_err) {
+    GtArena *arena = gt_arena_new(64);
+    map = gt_tag_value_map_new_in_arena("tag 1", "value 1", arena);
+    gt_tag_value_map_add_in_arena(&map, "tag 2", "value 2", arena);
+    gt_tag_value_map_add_in_arena(&map, "tag 3", "value 3", arena);
+    gt_tag_value_map_set_in_arena(&map, "tag 1", "val X", arena);
+    gt_tag_value_map_set_in_arena(&map, "tag 2", "value YYYYYYYYYYYY", arena);
+    gt_tag_value_map_remove_in_arena(&map, "tag 3", arena);
+    gt_ensure(gt_tag_value_map_size(map) == 2);
+    gt_ensure(!strcmp(gt_tag_value_map_get(map, "tag 1"), "val X"));
+    gt_ensure(!strcmp(gt_tag_value_map_get(map, "tag 2"),
+                      "value YYYYYYYYYYYY"));
+    gt_ensure(!gt_tag_value_map_get(map, "tag 3"));
+    gt_arena_delete(arena);
+  }
+
   return had_err;
 }
 
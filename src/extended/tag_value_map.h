@@ -18,8 +18,22 @@
 #ifndef TAG_VALUE_MAP_H
 #define TAG_VALUE_MAP_H
 
+#include "core/arena.h"
 #include "extended/tag_value_map_api.h"
 
+/* The following functions behave like their counterparts without the
+   <_in_arena> suffix, but take the memory of the map from <arena>. Such maps
+   must not be passed to the other modifying functions and must not be
+   deleted, they are freed together with <arena>. */
+GtTagValueMap gt_tag_value_map_new_in_arena(const char *tag, const char *value,
+                                            GtArena *arena);
+void          gt_tag_value_map_add_in_arena(GtTagValueMap*, const char *tag,
+                                            const char *value, GtArena *arena);
+void          gt_tag_value_map_set_in_arena(GtTagValueMap*, const char *tag,
+                                            const char *value, GtArena *arena);
+void          gt_tag_value_map_remove_in_arena(GtTagValueMap*, const char *tag,
+                                               GtArena *arena);
+
 void          gt_tag_value_map_show(const GtTagValueMap);
 int           gt_tag_value_map_unit_test(GtError*);
 
@@ -17,15 +17,18 @@
 
 #include "gtt.h"
 #include "core/alphabet.h"
+#include "core/arena.h"
 #include "core/array.h"
 #include "core/array2dim_api.h"
 #include "core/array2dim_sparse_api.h"
 #include "core/array3dim_api.h"
 #include "core/basename_api.h"
+#include "core/bgzf_reader.h"
 #include "core/bitpackarray.h"
 #include "core/bitpackstring.h"
 #include "core/bittab.h"
 #include "core/bsearch.h"
+#include "core/codec_file.h"
 #include "core/codon_iterator_encseq_api.h"
 #include "core/codon_iterator_simple_api.h"
 #include "core/colorspace.h"
@@ -39,10 +42,13 @@
 #include "core/dlist.h"
 #include "core/dyn_bittab.h"
 #include "core/encseq.h"
+#include "core/encseq_unpack.h"
 #include "core/grep_api.h"
 #include "core/hashmap_api.h"
 #include "core/hashtable.h"
+#include "core/interval_index.h"
 #include "core/interval_tree.h"
+#include "core/line_source.h"
 #include "core/mathsupport_api.h"
 #include "core/md5_seqid_api.h"
 #include "core/quality.h"
@@ -50,28 +56,34 @@
 #include "core/sequence_buffer.h"
 #include "core/splitter.h"
 #include "core/symbol.h"
+#include "core/thread_pool.h"
+#include "core/thread_pool_output.h"
 #include "core/tokenizer.h"
 #include "core/trans_table.h"
 #include "core/translator.h"
 #include "extended/alignment.h"
 #include "extended/anno_db_gfflike_api.h"
 #include "extended/compressed_bitsequence.h"
+#include "extended/diagonalbandalign.h"
 #include "extended/editscript.h"
 #include "extended/elias_gamma.h"
 #include "extended/encdesc.h"
 #include "extended/evaluator.h"
 #include "extended/feature_in_stream.h"
 #include "extended/feature_index.h"
+#include "extended/feature_index_mapped.h"
 #include "extended/feature_index_memory.h"
 #include "extended/feature_node.h"
 #include "extended/feature_node_iterator_api.h"
 #include "extended/genome_node.h"
+#include "extended/genome_node_serializer.h"
 #include "extended/gff3_escaping_api.h"
 #include "extended/golomb.h"
 #include "extended/hmm.h"
 #include "extended/huffcode.h"
 #include "extended/intset.h"
 #include "extended/kmer_database.h"
+#include "extended/linearalign.h"
 #include "extended/luaserialize.h"
 #include "extended/multieoplist.h"
 #include "extended/popcount_tab.h"
@@ -87,6 +99,7 @@
 #include "ltr/gt_ltrdigest.h"
 #include "ltr/gt_ltrharvest.h"
 #include "ltr/ltrdigest_pbs_visitor.h"
+#include "match/bitpar-edist.h"
 #include "match/karlin_altschul_stat.h"
 #include "match/rdj-spmlist.h"
 #include "match/rdj-strgraph.h"
@@ -266,10 +279,8 @@ GtToolbox* gtt_tools(void)
   gt_toolbox_add_tool(tools, "sketch", gt_sketch());
   gt_toolbox_add_tool(tools, "sketch_page", gt_sketch_page());
 #endif
-#if defined (HAVE_MYSQL) || defined (HAVE_SQLITE)
   gt_toolbox_add_tool(tools, "featureindex", gt_featureindex());
   gt_toolbox_add_tool(tools, "mkfeatureindex", gt_mkfeatureindex());
-#endif
 
   return tools;
 }
@@ -282,6 +293,7 @@ GtHashmap* gtt_unit_tests(void)
 
   gt_hashmap_add(unit_tests, "alphabet class", gt_alphabet_unit_test);
   gt_hashmap_add(unit_tests, "alignment class", gt_alignment_unit_test);
+  gt_hashmap_add(unit_tests, "arena class", gt_arena_unit_test);
   gt_hashmap_add(unit_tests, "array class", gt_array_unit_test);
   gt_hashmap_add(unit_tests, "array example", gt_array_example);
   gt_hashmap_add(unit_tests, "array2dim example", gt_array2dim_example);
@@ -289,12 +301,16 @@ GtHashmap* gtt_unit_tests(void)
                                                    gt_array2dim_sparse_example);
   gt_hashmap_add(unit_tests, "array3dim example", gt_array3dim_example);
   gt_hashmap_add(unit_tests, "basename module", gt_basename_unit_test);
+  gt_hashmap_add(unit_tests, "BGZF reader class", gt_bgzf_reader_unit_test);
   gt_hashmap_add(unit_tests, "bit pack array class", gt_bitpackarray_unit_test);
   gt_hashmap_add(unit_tests, "bit pack string module",
                                                     gt_bitPackString_unit_test);
+  gt_hashmap_add(unit_tests, "bit parallel edit distance module",
+                                                     gt_bitpar_edist_unit_test);
   gt_hashmap_add(unit_tests, "bittab class", gt_bittab_unit_test);
   gt_hashmap_add(unit_tests, "bittab example", gt_bittab_example);
   gt_hashmap_add(unit_tests, "bsearch module", gt_bsearch_unit_test);
+  gt_hashmap_add(unit_tests, "codec file class", gt_codec_file_unit_test);
   gt_hashmap_add(unit_tests, "codon iterator class, simple",
                                             gt_codon_iterator_simple_unit_test);
   gt_hashmap_add(unit_tests, "codon iterator class, encoded",
@@ -312,6 +328,8 @@ GtHashmap* gtt_unit_tests(void)
                                                       gt_desc_buffer_unit_test);
   gt_hashmap_add(unit_tests, "disc distri class", gt_disc_distri_unit_test);
   gt_hashmap_add(unit_tests, "dlist class", gt_dlist_unit_test);
+  gt_hashmap_add(unit_tests, "diagonal band alignment module",
+                                                gt_diagonalbandalign_unit_test);
   gt_hashmap_add(unit_tests, "dlist example", gt_dlist_example);
   gt_hashmap_add(unit_tests, "dynamic bittab class", gt_dyn_bittab_unit_test);
   gt_hashmap_add(unit_tests, "editscript class", gt_editscript_unit_test);
@@ -320,14 +338,20 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "encseq builder class",
                                                    gt_encseq_builder_unit_test);
   gt_hashmap_add(unit_tests, "encseq gc module", gt_encseq_gc_unit_test);
+  gt_hashmap_add(unit_tests, "encseq unpack module",
+                                                    gt_encseq_unpack_unit_test);
   gt_hashmap_add(unit_tests, "evaluator class", gt_evaluator_unit_test);
   gt_hashmap_add(unit_tests, "evalue module", gt_evalue_unit_test);
   gt_hashmap_add(unit_tests, "feature node iterator example",
                                              gt_feature_node_iterator_example);
   gt_hashmap_add(unit_tests, "feature node class", gt_feature_node_unit_test);
+  gt_hashmap_add(unit_tests, "mapped feature index class",
+                                             gt_feature_index_mapped_unit_test);
   gt_hashmap_add(unit_tests, "feature in stream class",
                                                 gt_feature_in_stream_unit_test);
   gt_hashmap_add(unit_tests, "genome node class", gt_genome_node_unit_test);
+  gt_hashmap_add(unit_tests, "genome node serializer module",
+                                          gt_genome_node_serializer_unit_test);
   gt_hashmap_add(unit_tests, "gff3 escaping module",
                                                     gt_gff3_escaping_unit_test);
   gt_hashmap_add(unit_tests, "grep module", gt_grep_unit_test);
@@ -336,11 +360,16 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "hashtable class", gt_hashtable_unit_test);
   gt_hashmap_add(unit_tests, "hmm class", gt_hmm_unit_test);
   gt_hashmap_add(unit_tests, "huffman coding class", gt_huffman_unit_test);
+  gt_hashmap_add(unit_tests, "interval index class",
+                 gt_interval_index_unit_test);
   gt_hashmap_add(unit_tests, "interval tree class", gt_interval_tree_unit_test);
   gt_hashmap_add(unit_tests, "intset classes", gt_intset_unit_test);
   gt_hashmap_add(unit_tests, "karlin altschul class",
                                              gt_karlin_altschul_stat_unit_test);
   gt_hashmap_add(unit_tests, "kmer_database class", gt_kmer_database_unit_test);
+  gt_hashmap_add(unit_tests, "line source class", gt_line_source_unit_test);
+  gt_hashmap_add(unit_tests, "linear alignment module",
+                                                      gt_linearalign_unit_test);
   gt_hashmap_add(unit_tests, "Lua serializer module",
                                                    gt_lua_serializer_unit_test);
   gt_hashmap_add(unit_tests, "mathsupport module", gt_mathsupport_unit_test);
@@ -373,6 +402,9 @@ GtHashmap* gtt_unit_tests(void)
   gt_hashmap_add(unit_tests, "symbol module", gt_symbol_unit_test);
   gt_hashmap_add(unit_tests, "tag value map class", gt_tag_value_map_unit_test);
   gt_hashmap_add(unit_tests, "tag value map example", gt_tag_value_map_example);
+  gt_hashmap_add(unit_tests, "thread pool module", gt_thread_pool_unit_test);
+  gt_hashmap_add(unit_tests, "thread pool output class",
+                 gt_thread_pool_output_unit_test);
   gt_hashmap_add(unit_tests, "tokenizer class", gt_tokenizer_unit_test);
   gt_hashmap_add(unit_tests, "translator class", gt_translator_unit_test);
   gt_hashmap_add(unit_tests, "transtable class", gt_trans_table_unit_test);
@@ -0,0 +1,639 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+#include "core/assert_api.h"
+#include "core/chardef_api.h"
+#include "core/divmodmul_api.h"
+#include "core/ensure_api.h"
+#include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/minmax_api.h"
+#include "match/ft-front-generation.h"
+#include "match/ft-front-prune.h"
+#include "match/bitpar-edist.h"
+
+#define GT_BITPAR_EDIST_LOGBLOCKBITS 6
+#define GT_BITPAR_EDIST_BLOCKBITS    (1UL << GT_BITPAR_EDIST_LOGBLOCKBITS)
+#define GT_BITPAR_EDIST_UNDEF        GT_UWORD_MAX
+#define GT_BITPAR_EDIST_NUMOFBLOCKS(LEN)\
+        (((LEN) + GT_BITPAR_EDIST_BLOCKBITS - 1)\
+         >> GT_BITPAR_EDIST_LOGBLOCKBITS)
+
+/* A block of 64 rows of a DP column: bit i of <Pv> (<Mv>) is set if the
+   value in row i is one larger (smaller) than the value in row i-1. */
+typedef struct
+{
+  uint64_t Pv, Mv;
+  GtUword score; /* the value in the row above the block */
+} GtBitparEdistBlock;
+
+struct GtBitparEdist
+{
+  uint64_t *peq;
+  GtBitparEdistBlock *column, *traceblocks;
+  GtUword allocatedblocks,
+          allocatedtraceblocks,
+          allocatedcolumns,
+          *traceoffset,
+          *tracefirstblock,
+          ulen,
+          vlen,
+          band;
+};
+
+GtBitparEdist *gt_bitpar_edist_new(void)
+{
+  GtBitparEdist *bpe = gt_malloc(sizeof *bpe);
+
+  bpe->peq = NULL;
+  bpe->column = NULL;
+  bpe->traceblocks = NULL;
+  bpe->allocatedblocks = 0;
+  bpe->allocatedtraceblocks = 0;
+  bpe->allocatedcolumns = 0;
+  bpe->traceoffset = NULL;
+  bpe->tracefirstblock = NULL;
+  bpe->ulen = bpe->vlen = bpe->band = 0;
+  return bpe;
+}
+
+void gt_bitpar_edist_delete(GtBitparEdist *bpe)
+{
+  if (bpe != NULL)
+  {
+    gt_free(bpe->peq);
+    gt_free(bpe->column);
+    gt_free(bpe->traceblocks);
+    gt_free(bpe->traceoffset);
+    gt_free(bpe->tracefirstblock);
+    gt_free(bpe);
+  }
+}
+
+#if defined (__GNUC__) && defined (__POPCNT__)
+static inline unsigned int gt_bitpar_edist_popcount(uint64_t word)
+{
+  return (unsigned int) __builtin_popcountll(word);
+}
+#else
+static inline unsigned int gt_bitpar_edist_popcount(uint64_t word)
+{
+  word = word - ((word >> 1) & (uint64_t) 0x5555555555555555ULL);
+  word = (word & (uint64_t) 0x3333333333333333ULL) +
+         ((word >> 2) & (uint64_t) 0x3333333333333333ULL);
+  word = (word + (word >> 4)) & (uint64_t) 0x0F0F0F0F0F0F0F0FULL;
+  return (unsigned int) ((word * (uint64_t) 0x0101010101010101ULL) >> 56);
+}
+#endif
+
+/* The value in the last row of <block> minus <block>->score, restricted to
+   the first <bits> rows of the block. */
+static GtUword gt_bitpar_edist_block_value(const GtBitparEdistBlock *block,
+                                           GtUword bits)
+{
+  const uint64_t mask = bits == GT_BITPAR_EDIST_BLOCKBITS
+                          ? ~(uint64_t) 0
+                          : (((uint64_t) 1) << bits) - 1;
+
+  return block->score + gt_bitpar_edist_popcount(block->Pv & mask)
+                      - gt_bitpar_edist_popcount(block->Mv & mask);
+}
+
+/* Advance <block> to the next column, whose character matches the rows
+   with a bit set in <eq>. <hin> is the difference of the values in the
+   row above the block, the corresponding difference for the last row of
+   the block is returned. */
+static inline int gt_bitpar_edist_block_advance(GtBitparEdistBlock *block,
+                                                uint64_t eq,
+                                                int hin)
+{
+  const uint64_t Pv = block->Pv, Mv = block->Mv, Xv = eq | Mv,
+                 hinneg = (uint64_t) (hin < 0), hinpos = (uint64_t) (hin > 0);
+  uint64_t Xh, Ph, Mh;
+  int hout;
+
+  eq |= hinneg;
+  Xh = (((eq & Pv) + Pv) ^ Pv) | eq;
+  Ph = Mv | ~(Xh | Pv);
+  Mh = Pv & Xh;
+  hout = (int) (Ph >> 63) - (int) (Mh >> 63);
+  Ph = (Ph << 1) | hinpos;
+  Mh = (Mh << 1) | hinneg;
+  block->Pv = Mh | ~(Xv | Ph);
+  block->Mv = Ph & Xv;
+  return hout;
+}
+
+/* Set (if <set> is true) or clear the match vectors of the characters of
+   <useq>. Between two computations all match vectors are 0, so that the
+   characters not occurring in <useq> need not be considered. */
+static void gt_bitpar_edist_peq(GtBitparEdist *bpe,
+                                bool set,
+                                const GtUchar *useq,
+                                GtUword ulen)
+{
+  const GtUword numofblocks = GT_BITPAR_EDIST_NUMOFBLOCKS(ulen);
+  GtUword idx;
+
+  if (set && numofblocks > bpe->allocatedblocks)
+  {
+    gt_free(bpe->peq);
+    bpe->allocatedblocks = numofblocks;
+    bpe->peq = gt_calloc((size_t) (UCHAR_MAX + 1) * numofblocks,
+                         sizeof *bpe->peq);
+    bpe->column = gt_realloc(bpe->column,
+                             sizeof *bpe->column * numofblocks);
+  }
+  for (idx = 0; idx < ulen; idx++)
+  {
+    if (GT_ISNOTSPECIAL(useq[idx]))
+    {
+      uint64_t *eq = bpe->peq + (GtUword) useq[idx] * numofblocks
+                              + (idx >> GT_BITPAR_EDIST_LOGBLOCKBITS);
+
+      if (set)
+      {
+        *eq |= ((uint64_t) 1) << (idx & (GT_BITPAR_EDIST_BLOCKBITS - 1));
+      } else
+      {
+        *eq = 0;
+      }
+    }
+  }
+}
+
+/* Compute the DP columns restricted to the blocks containing the cells
+   on the diagonals -<band>..<band>. The cells above the first block are
+   assumed to increase by one from column to column, the cells of a block
+   entering the band are assumed to increase by one from row to row. So
+   each computed value is the cost of some alignment and all alignments of
+   cost at most <band> are considered. That is, the returned value is the
+   edit distance if it does not exceed <band>, and larger otherwise. */
+static GtUword gt_bitpar_edist_band(GtBitparEdist *bpe,
+                                    bool withtrace,
+                                    const GtUchar *vseq,
+                                    GtUword ulen,
+                                    GtUword vlen,
+                                    GtUword band)
+{
+  const GtUword numofblocks = GT_BITPAR_EDIST_NUMOFBLOCKS(ulen);
+  GtUword firstblock = 0, lastblock, idx, colindex, nextfree = 0;
+
+  gt_assert(ulen > 0 && vlen > 0 && ulen <= vlen + band);
+  lastblock = (GT_MIN(ulen, GT_MAX(band, 1UL)) - 1)
+              >> GT_BITPAR_EDIST_LOGBLOCKBITS;
+  for (idx = 0; idx <= lastblock; idx++)
+  {
+    bpe->column[idx].Pv = ~(uint64_t) 0;
+    bpe->column[idx].Mv = 0;
+    bpe->column[idx].score = idx << GT_BITPAR_EDIST_LOGBLOCKBITS;
+  }
+  if (withtrace && vlen + 2 > bpe->allocatedcolumns)
+  {
+    bpe->allocatedcolumns = vlen * 1.2 + 2;
+    bpe->traceoffset = gt_realloc(bpe->traceoffset,
+                                  sizeof *bpe->traceoffset *
+                                  bpe->allocatedcolumns);
+    bpe->tracefirstblock = gt_realloc(bpe->tracefirstblock,
+                                      sizeof *bpe->tracefirstblock *
+                                      bpe->allocatedcolumns);
+  }
+  for (colindex = 1; colindex <= vlen; colindex++)
+  {
+    const uint64_t *eq = bpe->peq + (GtUword) vseq[colindex - 1] * numofblocks;
+    const GtUword nextlastblock = (GT_MIN(ulen, colindex + band) - 1)
+                                  >> GT_BITPAR_EDIST_LOGBLOCKBITS;
+    int hin = 1;
+
+    if (colindex > band + 1)
+    {
+      firstblock = (colindex - band - 1) >> GT_BITPAR_EDIST_LOGBLOCKBITS;
+    }
+    if (nextlastblock > lastblock)
+    {
+      const GtBitparEdistBlock *previous = bpe->column + lastblock;
+
+      gt_assert(nextlastblock == lastblock + 1);
+      lastblock = nextlastblock;
+      bpe->column[lastblock].score
+        = gt_bitpar_edist_block_value(previous,GT_BITPAR_EDIST_BLOCKBITS);
+      bpe->column[lastblock].Pv = ~(uint64_t) 0;
+      bpe->column[lastblock].Mv = 0;
+    }
+    gt_assert(firstblock <= lastblock);
+    if (withtrace)
+    {
+      const GtUword width = lastblock - firstblock + 1;
+
+      if (nextfree + width > bpe->allocatedtraceblocks)
+      {
+        bpe->allocatedtraceblocks = bpe->allocatedtraceblocks * 1.2 + width
+                                    + 32;
+        bpe->traceblocks = gt_realloc(bpe->traceblocks,
+                                      sizeof *bpe->traceblocks *
+                                      bpe->allocatedtraceblocks);
+      }
+      bpe->traceoffset[colindex] = nextfree;
+      bpe->tracefirstblock[colindex] = firstblock;
+    }
+    for (idx = firstblock; idx <= lastblock; idx++)
+    {
+      GtBitparEdistBlock *block = bpe->column + idx;
+
+      /* add -1, 0 or 1 */
+      block->score += (GtUword) (GtWord) hin;
+      hin = gt_bitpar_edist_block_advance(block,eq[idx],hin);
+      if (withtrace)
+      {
+        bpe->traceblocks[nextfree++] = *block;
+      }
+    }
+  }
+  if (withtrace)
+  {
+    bpe->traceoffset[vlen + 1] = nextfree;
+  }
+  gt_assert(lastblock == numofblocks - 1);
+  return gt_bitpar_edist_block_value(bpe->column + lastblock,
+                                     ulen - (lastblock
+                                             << GT_BITPAR_EDIST_LOGBLOCKBITS));
+}
+
+static GtUword gt_bitpar_edist_generic(GtBitparEdist *bpe,
+                                       bool withtrace,
+                                       const GtUchar *useq,
+                                       GtUword ulen,
+                                       const GtUchar *vseq,
+                                       GtUword vlen,
+                                       GtUword maxdistance)
+{
+  const GtUword lengthdiff = ulen > vlen ? ulen - vlen : vlen - ulen,
+                maxlen = GT_MAX(ulen, vlen);
+  GtUword distance;
+
+  gt_assert(bpe != NULL);
+  bpe->ulen = ulen;
+  bpe->vlen = vlen;
+  bpe->band = maxlen;
+  if (ulen == 0 || vlen == 0 || lengthdiff > maxdistance)
+  {
+    return ulen == 0 || vlen == 0 ? maxlen : lengthdiff;
+  }
+  gt_bitpar_edist_peq(bpe,true,useq,ulen);
+  bpe->band = GT_MIN(maxdistance,GT_MAX(lengthdiff,GT_BITPAR_EDIST_BLOCKBITS));
+  while (true)
+  {
+    distance = gt_bitpar_edist_band(bpe,withtrace,vseq,ulen,vlen,bpe->band);
+    if (distance <= bpe->band || bpe->band >= maxdistance ||
+        bpe->band >= maxlen)
+    {
+      break;
+    }
+    bpe->band = bpe->band > maxdistance/2 ? maxdistance : 2 * bpe->band;
+  }
+  gt_bitpar_edist_peq(bpe,false,useq,ulen);
+  return distance;
+}
+
+GtUword gt_bitpar_edist_distance(GtBitparEdist *bpe,
+                                 const GtUchar *useq,
+                                 GtUword ulen,
+                                 const GtUchar *vseq,
+                                 GtUword vlen,
+                                 GtUword maxdistance)
+{
+  return gt_bitpar_edist_generic(bpe,false,useq,ulen,vseq,vlen,maxdistance);
+}
+
+GtUword gt_bitpar_edist_trace_distance(GtBitparEdist *bpe,
+                                       const GtUchar *useq,
+                                       GtUword ulen,
+                                       const GtUchar *vseq,
+                                       GtUword vlen,
+                                       GtUword maxdistance)
+{
+  return gt_bitpar_edist_generic(bpe,true,useq,ulen,vseq,vlen,maxdistance);
+}
+
+/* The value of cell (<row>,<col>) of the stored DP columns, or
+   GT_BITPAR_EDIST_UNDEF if the cell is outside of the band. */
+static GtUword gt_bitpar_edist_value(const GtBitparEdist *bpe,
+                                     GtUword row,
+                                     GtUword col)
+{
+  GtUword blocknum, firstblock;
+
+  if (row == 0 || col == 0)
+  {
+    return row + col;
+  }
+  blocknum = (row - 1) >> GT_BITPAR_EDIST_LOGBLOCKBITS;
+  firstblock = bpe->tracefirstblock[col];
+  if (blocknum < firstblock ||
+      bpe->traceoffset[col] + blocknum - firstblock
+        >= bpe->traceoffset[col + 1])
+  {
+    return GT_BITPAR_EDIST_UNDEF;
+  }
+  return gt_bitpar_edist_block_value(bpe->traceblocks + bpe->traceoffset[col]
+                                                      + blocknum - firstblock,
+                                     row - (blocknum
+                                            << GT_BITPAR_EDIST_LOGBLOCKBITS));
+}
+
+/* Return the largest row r <= <maxrow> such that cell (r,r+<diagonal>)
+   has a value of at most <distance>, i.e. the row reached on <diagonal>
+   in front <distance> of the front based algorithms. As the values
+   increase along a diagonal, an exponential and binary search is used.
+   If there is no such row, GT_BITPAR_EDIST_UNDEF is returned. */
+static GtUword gt_bitpar_edist_furthest(const GtBitparEdist *bpe,
+                                        GtUword distance,
+                                        GtWord diagonal,
+                                        GtUword maxrow)
+{
+  const GtUword absdiagonal = (GtUword) (diagonal < 0 ? -diagonal : diagonal),
+                minrow = diagonal < 0 ? absdiagonal : 0;
+  GtUword lower, upper, step;
+
+  if (absdiagonal > distance ||
+      (diagonal < 0 && absdiagonal > bpe->ulen) ||
+      (diagonal > 0 && absdiagonal > bpe->vlen))
+  {
+    return GT_BITPAR_EDIST_UNDEF;
+  }
+  maxrow = GT_MIN(maxrow,bpe->ulen);
+  if (diagonal > 0)
+  {
+    maxrow = GT_MIN(maxrow,bpe->vlen - absdiagonal);
+  }
+  if (maxrow < minrow)
+  {
+    return GT_BITPAR_EDIST_UNDEF;
+  }
+  if (gt_bitpar_edist_value(bpe,maxrow,maxrow + diagonal) <= distance)
+  {
+    return maxrow;
+  }
+  /* the value in row minrow is absdiagonal */
+  upper = maxrow;
+  for (step = 1UL; /* Nothing */; step *= 2)
+  {
+    if (upper - minrow <= step)
+    {
+      lower = minrow;
+      break;
+    }
+    lower = upper - step;
+    if (gt_bitpar_edist_value(bpe,lower,lower + diagonal) <= distance)
+    {
+      break;
+    }
+    upper = lower;
+  }
+  while (lower + 1 < upper)
+  {
+    const GtUword mid = lower + GT_DIV2(upper - lower);
+
+    if (gt_bitpar_edist_value(bpe,mid,mid + diagonal) <= distance)
+    {
+      lower = mid;
+    } else
+    {
+      upper = mid;
+    }
+  }
+  return lower;
+}
+
+/* The traceback follows gt_front_trace2eoplist_full_front_directed: for
+   each front and diagonal on the path, the three candidate rows of the
+   previous front are recomputed from the DP columns and the edit operation
+   is chosen with the same preferences. */
+void gt_bitpar_edist_trace2eoplist(GtEoplist *eoplist,
+                                   const GtBitparEdist *bpe,
+                                   GtUword distance)
+{
+  const GtUword firstindex = gt_eoplist_length(eoplist);
+  GtWord diagonal = (GtWord) bpe->vlen - (GtWord) bpe->ulen;
+  GtUword row = bpe->ulen;
+  uint8_t preferred_eop = FT_EOP_MISMATCH;
+
+  gt_assert(eoplist != NULL && distance <= bpe->band);
+  while (distance > 0)
+  {
+    const uint8_t fromeop[3] = {FT_EOP_MISMATCH, FT_EOP_INSERTION,
+                                FT_EOP_DELETION};
+    GtUword prevrow = 0, fromrow[3];
+    uint8_t bits = 0;
+    int idx;
+
+    fromrow[1] = gt_bitpar_edist_furthest(bpe,distance - 1,diagonal - 1,row);
+    if (row > 0)
+    {
+      fromrow[0] = gt_bitpar_edist_furthest(bpe,distance - 1,diagonal,
+                                            row - 1);
+      fromrow[2] = gt_bitpar_edist_furthest(bpe,distance - 1,diagonal + 1,
+                                            row - 1);
+    } else
+    {
+      fromrow[0] = fromrow[2] = GT_BITPAR_EDIST_UNDEF;
+    }
+    for (idx = 0; idx < 3; idx++)
+    {
+      if (fromrow[idx] != GT_BITPAR_EDIST_UNDEF)
+      {
+        if (idx != 1)
+        {
+          fromrow[idx]++;
+        }
+        if (bits == 0 || prevrow < fromrow[idx])
+        {
+          bits = fromeop[idx];
+          prevrow = fromrow[idx];
+        } else
+        {
+          if (prevrow == fromrow[idx])
+          {
+            bits |= fromeop[idx];
+          }
+        }
+      }
+    }
+    gt_assert(bits != 0);
+    if (prevrow < row)
+    {
+      gt_eoplist_match_add(eoplist,row - prevrow);
+    }
+    if ((bits & preferred_eop) == 0)
+    {
+      if (bits & FT_EOP_MISMATCH)
+      {
+        preferred_eop = FT_EOP_MISMATCH;
+      } else
+      {
+        preferred_eop = (bits & FT_EOP_INSERTION) ? FT_EOP_INSERTION
+                                                  : FT_EOP_DELETION;
+      }
+    }
+    if (preferred_eop == FT_EOP_MISMATCH)
+    {
+      gt_eoplist_mismatch_add(eoplist);
+      row = prevrow - 1;
+    } else
+    {
+      if (preferred_eop == FT_EOP_INSERTION)
+      {
+        gt_eoplist_insertion_add(eoplist);
+        row = prevrow;
+        diagonal--;
+      } else
+      {
+        gt_eoplist_deletion_add(eoplist);
+        row = prevrow - 1;
+        diagonal++;
+      }
+    }
+    distance--;
+  }
+  gt_assert(diagonal == 0);
+  if (row > 0)
+  {
+    gt_eoplist_match_add(eoplist,row);
+  }
+  gt_eoplist_reverse_end(eoplist,firstindex);
+}
+
+#define BITPAR_EDIST_TEST_MAXLEN 300UL
+
+/* Generate a random sequence <useq> and a sequence <vseq> derived from it
+   by random edit operations. Every fourth pair consists of two unrelated
+   sequences. */
+static void bitpar_edist_random_pair(GtUchar *useq,GtUword *ulen,
+                                     GtUchar *vseq,GtUword *vlen,
+                                     bool unrelated)
+{
+  const GtUword errorpercentage = gt_rand_max(40);
+  GtUword idx;
+
+  *ulen = 1 + gt_rand_max(BITPAR_EDIST_TEST_MAXLEN - 1);
+  for (idx = 0; idx < *ulen; idx++)
+  {
+    useq[idx] = gt_rand_max(99) == 0 ? (GtUchar) GT_WILDCARD
+                                     : (GtUchar) gt_rand_max(3);
+  }
+  if (unrelated)
+  {
+    *vlen = 1 + gt_rand_max(BITPAR_EDIST_TEST_MAXLEN - 1);
+    for (idx = 0; idx < *vlen; idx++)
+    {
+      vseq[idx] = (GtUchar) gt_rand_max(3);
+    }
+    return;
+  }
+  *vlen = 0;
+  for (idx = 0; idx < *ulen && *vlen < BITPAR_EDIST_TEST_MAXLEN; idx++)
+  {
+    if (gt_rand_max(99) < errorpercentage)
+    {
+      /* a mismatch, a deletion or an insertion */
+      switch (gt_rand_max(2))
+      {
+        case 0:
+          vseq[(*vlen)++] = (GtUchar) gt_rand_max(3);
+          break;
+        case 1:
+          break;
+        default:
+          vseq[(*vlen)++] = (GtUchar) gt_rand_max(3);
+          if (*vlen < BITPAR_EDIST_TEST_MAXLEN)
+          {
+            vseq[(*vlen)++] = useq[idx];
+          }
+          break;
+      }
+    } else
+    {
+      vseq[(*vlen)++] = useq[idx];
+    }
+  }
+  if (*vlen == 0)
+  {
+    vseq[(*vlen)++] = (GtUchar) gt_rand_max(3);
+  }
+}
+
+int gt_bitpar_edist_unit_test(GtError *err)
+{
+  int had_err = 0;
+  GtUchar useq[BITPAR_EDIST_TEST_MAXLEN], vseq[BITPAR_EDIST_TEST_MAXLEN];
+  GtBitparEdist *bpe = gt_bitpar_edist_new();
+  GtFullFrontEdistTrace *fet = gt_full_front_edist_trace_new();
+  GtEoplist *eoplist[2];
+  GtUword trial;
+
+  gt_error_check(err);
+  eoplist[0] = gt_eoplist_new();
+  eoplist[1] = gt_eoplist_new();
+  for (trial = 0; !had_err && trial < 100UL; trial++)
+  {
+    GtUword ulen, vlen, distance;
+    char *cigar[2];
+
+    bitpar_edist_random_pair(useq,&ulen,vseq,&vlen,trial % 4 == 0);
+    distance = gt_full_front_edist_trace_distance(fet,useq,ulen,vseq,vlen,
+                                                  GT_UWORD_MAX);
+    gt_eoplist_reset(eoplist[0]);
+    gt_front_trace2eoplist_full_front_directed(eoplist[0],
+                                               gt_full_front_trace_get(fet),
+                                               distance,useq,ulen,vseq,vlen);
+    gt_ensure(gt_bitpar_edist_distance(bpe,useq,ulen,vseq,vlen,
+                                       GT_UWORD_MAX) == distance);
+    gt_ensure(gt_bitpar_edist_distance(bpe,useq,ulen,vseq,vlen,distance)
+              == distance);
+    if (distance > 0)
+    {
+      gt_ensure(gt_bitpar_edist_distance(bpe,useq,ulen,vseq,vlen,
+                                         distance - 1) > distance - 1);
+    }
+    gt_ensure(gt_bitpar_edist_trace_distance(bpe,useq,ulen,vseq,vlen,
+                                             trial % 2 == 0 ? distance
+                                                            : GT_UWORD_MAX)
+              == distance);
+    if (!had_err)
+    {
+      const bool distinguish_mismatch_match = true;
+
+      gt_eoplist_reset(eoplist[1]);
+      gt_bitpar_edist_trace2eoplist(eoplist[1],bpe,distance);
+      cigar[0] = gt_eoplist2cigar_string(eoplist[0],
+                                         distinguish_mismatch_match);
+      cigar[1] = gt_eoplist2cigar_string(eoplist[1],
+                                         distinguish_mismatch_match);
+      gt_ensure(cigar[0] != NULL && cigar[1] != NULL &&
+                strcmp(cigar[0],cigar[1]) == 0);
+      gt_free(cigar[0]);
+      gt_free(cigar[1]);
+    }
+  }
+  gt_eoplist_delete(eoplist[0]);
+  gt_eoplist_delete(eoplist[1]);
+  gt_full_front_edist_trace_delete(fet);
+  gt_bitpar_edist_delete(bpe);
+  return had_err;
+}
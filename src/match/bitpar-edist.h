@@ -0,0 +1,73 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BITPAR_EDIST_H
+#define BITPAR_EDIST_H
+
+#include "core/error_api.h"
+#include "core/types_api.h"
+#include "match/ft-eoplist.h"
+
+/* Global unit cost edit distance of two sequences, computed with the
+   bit-parallel algorithm of Myers in the block based formulation of Hyyrö.
+   The rows of the DP matrix correspond to the characters of the first
+   sequence and are split into blocks of 64 rows, each block of a column is
+   represented by two bit vectors. Only the blocks intersecting the band of
+   diagonals which may contain an alignment not exceeding a given distance
+   are computed, the band is doubled until the distance is determined.
+   Wildcards and separators never match. The workspace is kept in the
+   following opaque type, so that it can be reused for many alignments. */
+typedef struct GtBitparEdist GtBitparEdist;
+
+/* Return a new workspace. */
+GtBitparEdist *gt_bitpar_edist_new(void);
+
+/* Delete the workspace <bpe>. */
+void           gt_bitpar_edist_delete(GtBitparEdist *bpe);
+
+/* Return the unit edit distance of <useq> of length <ulen> and <vseq> of
+   length <vlen>, if it does not exceed <maxdistance>. Otherwise a value
+   larger than <maxdistance> is returned. */
+GtUword        gt_bitpar_edist_distance(GtBitparEdist *bpe,
+                                        const GtUchar *useq,
+                                        GtUword ulen,
+                                        const GtUchar *vseq,
+                                        GtUword vlen,
+                                        GtUword maxdistance);
+
+/* Same as <gt_bitpar_edist_distance()>, but the bit vectors of all columns
+   are kept in <bpe>, so that an optimal alignment can be obtained by
+   <gt_bitpar_edist_trace2eoplist()>. */
+GtUword        gt_bitpar_edist_trace_distance(GtBitparEdist *bpe,
+                                              const GtUchar *useq,
+                                              GtUword ulen,
+                                              const GtUchar *vseq,
+                                              GtUword vlen,
+                                              GtUword maxdistance);
+
+/* Append an optimal alignment of the sequences given to the last call of
+   <gt_bitpar_edist_trace_distance()> to <eoplist>. <distance> is the value
+   returned by this call, it must not exceed the maximal distance given.
+   Among the optimal alignments, the same one is chosen as by the
+   traceback over the full fronts implemented by
+   <gt_front_trace2eoplist_full_front_directed()>. */
+void           gt_bitpar_edist_trace2eoplist(GtEoplist *eoplist,
+                                             const GtBitparEdist *bpe,
+                                             GtUword distance);
+
+int            gt_bitpar_edist_unit_test(GtError *err);
+
+#endif
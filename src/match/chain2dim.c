@@ -24,6 +24,7 @@
 #include "core/ma_api.h"
 #include "core/arraydef_api.h"
 #include "core/logger.h"
+#include "core/radix_sort.h"
 #include "extended/rbtree_api.h"
 #include "extended/ranked_list.h"
 #include "chain2dim.h"
@@ -115,6 +116,8 @@ struct GtChain2Dimmode
                                          chainkind = LOCALCHAININGPERCENTAWAY */
 };
 
+GT_DECLAREARRAYSTRUCT(GtChain2Dimseqpair);
+
 typedef GtUword GtChain2Dimref;
 
 GT_DECLAREARRAYSTRUCT(GtChain2Dimref);
@@ -1389,30 +1392,59 @@ static unsigned int gt_chain2dim_findmaximalscores(
   return retval;
 }
 
+static int gt_chain2dim_compareindex(const void *keya,const void *keyb)
+{
+  if (((const GtUwordPair *) keya)->b < ((const GtUwordPair *) keyb)->b)
+  {
+    return -1;
+  }
+  if (((const GtUwordPair *) keya)->b > ((const GtUwordPair *) keyb)->b)
+  {
+    return 1;
+  }
+  return 0;
+}
+
+/* Sort <len> pairs by their key component <a> using radixsort. The component
+   <b> is the index of the match. As radixsort is not stable, the pairs with
+   equal keys are afterwards ordered by their index, which gives the same
+   order as the stable sorting methods used before. */
+static void gt_chain2dim_stablesort(GtUwordPair *pairs,GtUword len)
+{
+  GtUword start, end;
+
+  gt_radixsort_inplace_GtUwordPair(pairs,len);
+  for (start = 0; start < len; start = end)
+  {
+    for (end = start + 1; end < len && pairs[end].a == pairs[start].a; end++)
+      /* Nothing */ ;
+    if (end - start > 1UL)
+    {
+      qsort(pairs + start,(size_t) (end - start),sizeof *pairs,
+            gt_chain2dim_compareindex);
+    }
+  }
+}
+
 static void makesortedendpointpermutation(GtUword *perm,
                                           GtChain2Dimmatchtable *matchtable,
                                           unsigned int presortdim)
 {
-  GtUword temp, *iptr, *jptr, i;
+  GtUwordPair *pairs;
+  GtUword i;
 
+  pairs = gt_malloc(sizeof *pairs * matchtable->nextfree);
   for (i = 0; i < matchtable->nextfree; i++)
   {
-    perm[i] = i;
+    pairs[i].a = GT_CHAIN2DIM_GETSTOREDENDPOINT(presortdim,i);
+    pairs[i].b = i;
   }
-  for (iptr = perm + 1UL; iptr < perm + matchtable->nextfree; iptr++)
+  gt_chain2dim_stablesort(pairs,matchtable->nextfree);
+  for (i = 0; i < matchtable->nextfree; i++)
   {
-    for (jptr = iptr; jptr > perm; jptr--)
-    {
-      if (GT_CHAIN2DIM_GETSTOREDENDPOINT(presortdim,*(jptr-1)) <=
-          GT_CHAIN2DIM_GETSTOREDENDPOINT(presortdim,*jptr))
-      {
-        break;
-      }
-      temp = *(jptr-1);
-      *(jptr-1) = *jptr;
-      *jptr = temp;
-    }
+    perm[i] = pairs[i].b;
   }
+  gt_free(pairs);
 }
 
 static void fastchainingscores(const GtChain2Dimmode *chainmode,
@@ -1598,9 +1630,26 @@ void gt_chain_possiblysortmatches(GtLogger *logger,
     }
     if (!matchesaresorted)
     {
+      GtUwordPair *pairs;
+      Matchchaininfo *sortedmatches;
+      GtUword idx;
+
       gt_logger_log(logger,"input matches are not yet sorted => sort them");
-      qsort(matchtable->matches,(size_t) matchtable->nextfree,
-            sizeof (*matchtable->matches),qsortcomparefunction);
+      pairs = gt_malloc(sizeof *pairs * matchtable->nextfree);
+      for (idx = 0; idx < matchtable->nextfree; idx++)
+      {
+        pairs[idx].a = matchtable->matches[idx].startpos[presortdim];
+        pairs[idx].b = idx;
+      }
+      gt_chain2dim_stablesort(pairs,matchtable->nextfree);
+      sortedmatches = gt_malloc(sizeof *sortedmatches * matchtable->allocated);
+      for (idx = 0; idx < matchtable->nextfree; idx++)
+      {
+        sortedmatches[idx] = matchtable->matches[pairs[idx].b];
+      }
+      gt_free(pairs);
+      gt_free(matchtable->matches);
+      matchtable->matches = sortedmatches;
     } else
     {
       gt_logger_log(logger,"matches are already sorted w.r.t. dimension %u",
@@ -1609,6 +1658,88 @@ void gt_chain_possiblysortmatches(GtLogger *logger,
   }
 }
 
+static void gt_chain2dim_matchtable_addmatch(GtChain2Dimmatchtable *matchtable,
+                                             const Matchchaininfo *match)
+{
+  GtChain2Dimmatchvalues value;
+
+  value.startpos[0] = match->startpos[0];
+  value.startpos[1] = match->startpos[1];
+  value.endpos[0] = match->endpos[0];
+  value.endpos[1] = match->endpos[1];
+  value.weight = match->weight;
+  gt_chain_matchtable_add(matchtable,&value);
+}
+
+GtChain2Dimseqpair *gt_chain_matchtable_split(
+                                     const GtChain2Dimmatchtable *matchtable,
+                                     const GtUwordPair *seqnumtab,
+                                     GtUword *numofseqpairs)
+{
+  GtArrayGtChain2Dimseqpair seqpairs;
+  GtUwordPair *bydim0, *bydim1;
+  GtUword idx, start0, end0;
+
+  GT_INITARRAY(&seqpairs,GtChain2Dimseqpair);
+  bydim0 = gt_malloc(sizeof *bydim0 * matchtable->nextfree);
+  bydim1 = gt_malloc(sizeof *bydim1 * matchtable->nextfree);
+  for (idx = 0; idx < matchtable->nextfree; idx++)
+  {
+    bydim0[idx].a = seqnumtab[idx].a;
+    bydim0[idx].b = idx;
+  }
+  gt_chain2dim_stablesort(bydim0,matchtable->nextfree);
+  for (start0 = 0; start0 < matchtable->nextfree; start0 = end0)
+  {
+    GtUword width, start1, end1;
+
+    for (end0 = start0 + 1; end0 < matchtable->nextfree &&
+                            bydim0[end0].a == bydim0[start0].a; end0++)
+      /* Nothing */ ;
+    width = end0 - start0;
+    for (idx = 0; idx < width; idx++)
+    {
+      bydim1[idx].a = seqnumtab[bydim0[start0 + idx].b].b;
+      bydim1[idx].b = bydim0[start0 + idx].b;
+    }
+    gt_chain2dim_stablesort(bydim1,width);
+    for (start1 = 0; start1 < width; start1 = end1)
+    {
+      GtChain2Dimseqpair *seqpair;
+
+      for (end1 = start1 + 1; end1 < width &&
+                              bydim1[end1].a == bydim1[start1].a; end1++)
+        /* Nothing */ ;
+      GT_GETNEXTFREEINARRAY(seqpair,&seqpairs,GtChain2Dimseqpair,
+                            seqpairs.allocatedGtChain2Dimseqpair * 0.2 + 32);
+      seqpair->seqnum[0] = bydim0[start0].a;
+      seqpair->seqnum[1] = bydim1[start1].a;
+      seqpair->matchtable = gt_chain_matchtable_new(end1 - start1);
+      for (idx = start1; idx < end1; idx++)
+      {
+        gt_chain2dim_matchtable_addmatch(seqpair->matchtable,
+                                         matchtable->matches + bydim1[idx].b);
+      }
+    }
+  }
+  gt_free(bydim0);
+  gt_free(bydim1);
+  *numofseqpairs = seqpairs.nextfreeGtChain2Dimseqpair;
+  return seqpairs.spaceGtChain2Dimseqpair;
+}
+
+void gt_chain_seqpairs_delete(GtChain2Dimseqpair *seqpairs,
+                              GtUword numofseqpairs)
+{
+  GtUword idx;
+
+  for (idx = 0; idx < numofseqpairs; idx++)
+  {
+    gt_chain_matchtable_delete(seqpairs[idx].matchtable);
+  }
+  gt_free(seqpairs);
+}
+
 static int parselocalchainingparameter(GtChain2Dimmode *chainmode,
                                        const char *option,
                                        const char *lparam,
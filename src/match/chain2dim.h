@@ -74,6 +74,15 @@ typedef void (*GtChain2Dimprocessor)(void *,
                                  const GtChain2Dimmatchtable *,
                                  const GtChain2Dim *);
 
+/* the matches of a pair of sequences, which are chained independently
+   of the matches of other pairs */
+
+typedef struct
+{
+  GtUword seqnum[2];
+  GtChain2Dimmatchtable *matchtable;
+} GtChain2Dimseqpair;
+
 /* the type of value describing how to chain */
 
 typedef struct GtChain2Dimmode GtChain2Dimmode;
@@ -102,6 +111,32 @@ GtChain2Dimmatchtable *gt_chain_analyzeopenformatfile(double weightfactor,
                                                   const char *matchfile,
                                                   GtError *err);
 
+/* the following function reads a file describing matches in open format,
+   where each line begins with the numbers of the two sequences the match
+   refers to. It returns the table of matches for each pair of sequences,
+   ordered by the sequence numbers, and stores their number in
+   <numofseqpairs>. */
+
+GtChain2Dimseqpair *gt_chain_analyzeopenformatfile_seqpairs(
+                                                  double weightfactor,
+                                                  const char *matchfile,
+                                                  GtUword *numofseqpairs,
+                                                  GtError *err);
+
+/* the function to split a table of matches into the tables of the pairs of
+   sequences, where <seqnumtab[i]> holds the sequence numbers of the
+   i-th match. Within a pair, the matches keep their order. */
+
+GtChain2Dimseqpair *gt_chain_matchtable_split(
+                                     const GtChain2Dimmatchtable *matchtable,
+                                     const GtUwordPair *seqnumtab,
+                                     GtUword *numofseqpairs);
+
+/* the destructor for the tables of pairs of sequences */
+
+void gt_chain_seqpairs_delete(GtChain2Dimseqpair *seqpairs,
+                              GtUword numofseqpairs);
+
 /* the function to fill the gap values for all matches */
 
 void gt_chain_fillthegapvalues(GtChain2Dimmatchtable *matchtable);
@@ -19,6 +19,8 @@
 
 #include "core/fa_api.h"
 #include "core/error_api.h"
+#include "core/ma_api.h"
+#include "core/minmax_api.h"
 #include "core/types_api.h"
 #include "chain2dim.h"
 
@@ -52,13 +54,18 @@ static int numberoflinesinfile(GtUword *linenum,
   return 0;
 }
 
-GtChain2Dimmatchtable *gt_chain_analyzeopenformatfile(double weightfactor,
+/* Read the matches of <matchfile>. If <seqnumtab> is not NULL, then each
+   line begins with two sequence numbers, which are stored in a table
+   assigned to <*seqnumtab>. */
+static GtChain2Dimmatchtable *gt_chain_readopenformatfile(
+                                                  double weightfactor,
                                                   const char *matchfile,
+                                                  GtUwordPair **seqnumtab,
                                                   GtError *err)
 {
   GtChain2Dimmatchtable *matchtable;
-  GtUword linenum;
-  GtWord storeinteger[GT_CHAININPUT_READNUMS];
+  GtUword linenum, firstcolumn;
+  GtWord storeinteger[GT_CHAININPUT_READNUMS + 2], *values;
   FILE *matchfp;
   bool haserr = false;
   GtChain2Dimmatchvalues fragment;
@@ -73,17 +80,47 @@ GtChain2Dimmatchtable *gt_chain_analyzeopenformatfile(double weightfactor,
     return NULL;
   }
   matchtable = gt_chain_matchtable_new(linenum);
-  for (linenum = 0; fscanf(matchfp,""GT_WD" "GT_WD" "GT_WD" "GT_WD" "GT_WD"\n",
-                           &storeinteger[0],
-                           &storeinteger[1],
-                           &storeinteger[2],
-                           &storeinteger[3],
-                           &storeinteger[4]) == GT_CHAININPUT_READNUMS;
-                    linenum++)
+  if (seqnumtab != NULL)
+  {
+    *seqnumtab = gt_malloc(sizeof **seqnumtab * GT_MAX(linenum,1UL));
+    firstcolumn = 2UL;
+  } else
+  {
+    firstcolumn = 0;
+  }
+  values = storeinteger + firstcolumn;
+  for (linenum = 0; /* Nothing */; linenum++)
   {
     GtUword countcolumns;
 
-    for (countcolumns = 0; countcolumns < (GtUword) (GT_CHAININPUT_READNUMS-1);
+    if (seqnumtab != NULL)
+    {
+      if (fscanf(matchfp,""GT_WD" "GT_WD" "GT_WD" "GT_WD" "GT_WD" "GT_WD" "
+                         ""GT_WD"\n",
+                 &storeinteger[0],
+                 &storeinteger[1],
+                 &storeinteger[2],
+                 &storeinteger[3],
+                 &storeinteger[4],
+                 &storeinteger[5],
+                 &storeinteger[6]) != GT_CHAININPUT_READNUMS + 2)
+      {
+        break;
+      }
+    } else
+    {
+      if (fscanf(matchfp,""GT_WD" "GT_WD" "GT_WD" "GT_WD" "GT_WD"\n",
+                 &storeinteger[0],
+                 &storeinteger[1],
+                 &storeinteger[2],
+                 &storeinteger[3],
+                 &storeinteger[4]) != GT_CHAININPUT_READNUMS)
+      {
+        break;
+      }
+    }
+    for (countcolumns = 0;
+         countcolumns < firstcolumn + (GtUword) (GT_CHAININPUT_READNUMS-1);
          countcolumns++)
     {
       if (storeinteger[countcolumns] < 0)
@@ -92,24 +129,29 @@ GtChain2Dimmatchtable *gt_chain_analyzeopenformatfile(double weightfactor,
         haserr = true;
       }
     }
-    if (storeinteger[0] > storeinteger[1])
+    if (values[0] > values[1])
     {
       CANNOTPARSELINE("startpos1 <= endpos1 expected");
       haserr = true;
       break;
     }
-    if (storeinteger[2] > storeinteger[3])
+    if (values[2] > values[3])
     {
       CANNOTPARSELINE("startpos2 <= endpos2 expected");
       haserr = true;
       break;
     }
-    fragment.startpos[0] = (GtChain2Dimpostype) storeinteger[0];
-    fragment.endpos[0] = (GtChain2Dimpostype) storeinteger[1];
-    fragment.startpos[1] = (GtChain2Dimpostype) storeinteger[2];
-    fragment.endpos[1] = (GtChain2Dimpostype) storeinteger[3];
+    fragment.startpos[0] = (GtChain2Dimpostype) values[0];
+    fragment.endpos[0] = (GtChain2Dimpostype) values[1];
+    fragment.startpos[1] = (GtChain2Dimpostype) values[2];
+    fragment.endpos[1] = (GtChain2Dimpostype) values[3];
     fragment.weight
-      = (GtChain2Dimscoretype) (weightfactor * (double) storeinteger[4]);
+      = (GtChain2Dimscoretype) (weightfactor * (double) values[4]);
+    if (seqnumtab != NULL)
+    {
+      (*seqnumtab)[linenum].a = (GtUword) storeinteger[0];
+      (*seqnumtab)[linenum].b = (GtUword) storeinteger[1];
+    }
     gt_chain_matchtable_add(matchtable,&fragment);
     /*gt_chain_printchainelem(stdout,&fragment); */
   }
@@ -117,8 +159,53 @@ GtChain2Dimmatchtable *gt_chain_analyzeopenformatfile(double weightfactor,
   if (haserr)
   {
     gt_chain_matchtable_delete(matchtable);
+    if (seqnumtab != NULL)
+    {
+      gt_free(*seqnumtab);
+      *seqnumtab = NULL;
+    }
     return NULL;
   }
-  gt_chain_fillthegapvalues(matchtable);
   return matchtable;
 }
+
+GtChain2Dimmatchtable *gt_chain_analyzeopenformatfile(double weightfactor,
+                                                  const char *matchfile,
+                                                  GtError *err)
+{
+  GtChain2Dimmatchtable *matchtable;
+
+  matchtable = gt_chain_readopenformatfile(weightfactor,matchfile,NULL,err);
+  if (matchtable != NULL)
+  {
+    gt_chain_fillthegapvalues(matchtable);
+  }
+  return matchtable;
+}
+
+GtChain2Dimseqpair *gt_chain_analyzeopenformatfile_seqpairs(
+                                                  double weightfactor,
+                                                  const char *matchfile,
+                                                  GtUword *numofseqpairs,
+                                                  GtError *err)
+{
+  GtChain2Dimmatchtable *matchtable;
+  GtChain2Dimseqpair *seqpairs;
+  GtUwordPair *seqnumtab = NULL;
+  GtUword idx;
+
+  matchtable = gt_chain_readopenformatfile(weightfactor,matchfile,&seqnumtab,
+                                           err);
+  if (matchtable == NULL)
+  {
+    return NULL;
+  }
+  seqpairs = gt_chain_matchtable_split(matchtable,seqnumtab,numofseqpairs);
+  gt_free(seqnumtab);
+  gt_chain_matchtable_delete(matchtable);
+  for (idx = 0; idx < *numofseqpairs; idx++)
+  {
+    gt_chain_fillthegapvalues(seqpairs[idx].matchtable);
+  }
+  return seqpairs;
+}
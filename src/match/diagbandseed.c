@@ -35,6 +35,7 @@
 #include "core/radix_sort.h"
 #include "core/timer_api.h"
 #include "core/spacecalc.h"
+#include "core/unused_api.h"
 #include "core/warning_api.h"
 #include "core/xansi_api.h"
 #include "core/intbits.h"
@@ -56,6 +57,7 @@
 
 #ifdef GT_THREADS_ENABLED
 #include "core/thread_api.h"
+#include "core/thread_pool.h"
 #endif
 
 /* We need to use 6 digits for the micro seconds */
@@ -121,6 +123,7 @@ struct GtDiagbandseedInfo
               *diagband_statistics_arg;
   GtUword maxfreq,
           memlimit,
+          spillmem,
           maxmat;
   unsigned int spacedseedweight,
                seedlength;
@@ -244,6 +247,7 @@ GtDiagbandseedInfo *gt_diagbandseed_info_new(const GtEncseq *aencseq,
                                              const GtEncseq *bencseq,
                                              GtUword maxfreq,
                                              GtUword memlimit,
+                                             GtUword spillmem,
                                              unsigned int spacedseedweight,
                                              unsigned int seedlength,
                                              bool norev,
@@ -270,6 +274,7 @@ GtDiagbandseedInfo *gt_diagbandseed_info_new(const GtEncseq *aencseq,
   info->bencseq = bencseq;
   info->maxfreq = maxfreq;
   info->memlimit = memlimit;
+  info->spillmem = spillmem;
   if (spacedseedweight > 0)
   {
     info->spacedseedweight = spacedseedweight;
@@ -1286,6 +1291,51 @@ const int idx_aseqnum = 0, idx_bseqnum = 1, idx_bpos = 2, idx_apos = 3;
 
 GT_DECLAREARRAYSTRUCT(GtDiagbandseedSeedPair);
 
+/* A sorted run of seed pairs stored in a temporary file. When the runs are
+   merged, each run is read through a buffer. */
+typedef struct
+{
+  FILE *fp;
+  uint8_t *buffer;
+  GtUword remaining, /* number of seed pairs in the file not read yet */
+          buffered,  /* number of seed pairs in the buffer */
+          bufferpos; /* index of the next seed pair in the buffer */
+} GtSeedpairRun;
+
+GT_DECLAREARRAYSTRUCT(GtSeedpairRun);
+
+/* If the seed pairs collected for one part pair exceed <capacity>, they are
+   sorted and written to a temporary file as a run. The run is sorted and
+   written in the background, while the next run is collected. For this,
+   the arrays of the seed pair list are swapped with the arrays stored
+   here. Finally, all runs are merged into chunks of at least <capacity>
+   seed pairs (except for the last chunk), which end at segment boundaries
+   and are processed one after the other. */
+typedef struct
+{
+  GtArrayGtDiagbandseedSeedPair *mlist_struct;
+  GtArrayGtUword *mlist_ulong;
+  GtArrayuint8_t *mlist_bytestring;
+  GtArrayGtSeedpairRun runs;
+  GtUword *heap, /* indexes of runs ordered by their next seed pair */
+          heapsize,
+          capacity,
+          readbufferlength,
+          numofruns,
+          bytes_written,
+          bytes_read,
+          peak_memory;
+  GtDiagbandseedBaseListType splt;
+  size_t sizeofunit;
+  /* the run currently sorted and written */
+  void *job_space;
+  GtUword job_length;
+  FILE *job_fp;
+#ifdef GT_THREADS_ENABLED
+  GtThreadPoolGroup *group;
+#endif
+} GtSeedpairSpill;
+
 typedef struct
 {
   GtArrayGtDiagbandseedSeedPair *mlist_struct;
@@ -1306,6 +1356,7 @@ typedef struct
       bits_unused_in2GtUwords;
   bool maxmat_compute, maxmat_show;
   GtUword amaxlen;
+  GtSeedpairSpill *spill;
 } GtSeedpairlist;
 
 #define GT_DIAGBANDSEED_ENCODE_SEQNUMS(ASEQNUM,BSEQNUM)\
@@ -1418,6 +1469,7 @@ static GtSeedpairlist *gt_seedpairlist_new(GtDiagbandseedBaseListType splt,
   seedpairlist->mlist_struct = NULL;
   seedpairlist->mlist_ulong = NULL;
   seedpairlist->mlist_bytestring = NULL;
+  seedpairlist->spill = NULL;
   if (splt == GT_DIAGBANDSEED_BASE_LIST_UNDEFINED)
   {
     if (seedpairlist->bytes_seedpair <= sizeof (GtUword))
@@ -1466,8 +1518,64 @@ static GtSeedpairlist *gt_seedpairlist_new(GtDiagbandseedBaseListType splt,
   return seedpairlist;
 }
 
+static void gt_seedpairspill_wait(GT_UNUSED GtSeedpairSpill *spill)
+{
+#ifdef GT_THREADS_ENABLED
+  gt_thread_pool_group_wait(spill->group);
+#endif
+}
+
+static void gt_seedpairspill_close_runs(GtSeedpairSpill *spill)
+{
+  GtUword idx;
+
+  gt_seedpairspill_wait(spill);
+  for (idx = 0; idx < spill->runs.nextfreeGtSeedpairRun; idx++)
+  {
+    GtSeedpairRun *run = spill->runs.spaceGtSeedpairRun + idx;
+
+    gt_fa_xfclose(run->fp);
+    gt_free(run->buffer);
+  }
+  spill->runs.nextfreeGtSeedpairRun = 0;
+  spill->heapsize = 0;
+}
+
+static void gt_seedpairspill_delete(GtSeedpairSpill *spill)
+{
+  if (spill != NULL)
+  {
+    gt_seedpairspill_close_runs(spill);
+    if (spill->mlist_struct != NULL)
+    {
+      GT_FREEARRAY(spill->mlist_struct, GtDiagbandseedSeedPair);
+      gt_free(spill->mlist_struct);
+    }
+    if (spill->mlist_ulong != NULL)
+    {
+      GT_FREEARRAY(spill->mlist_ulong, GtUword);
+      gt_free(spill->mlist_ulong);
+    }
+    if (spill->mlist_bytestring != NULL)
+    {
+      GT_FREEARRAY(spill->mlist_bytestring, uint8_t);
+      gt_free(spill->mlist_bytestring);
+    }
+    GT_FREEARRAY(&spill->runs, GtSeedpairRun);
+    gt_free(spill->heap);
+#ifdef GT_THREADS_ENABLED
+    gt_thread_pool_group_delete(spill->group);
+#endif
+    gt_free(spill);
+  }
+}
+
 static void gt_seedpairlist_reset(GtSeedpairlist *seedpairlist)
 {
+  if (seedpairlist->spill != NULL)
+  {
+    gt_seedpairspill_close_runs(seedpairlist->spill);
+  }
   if (seedpairlist->mlist_ulong != NULL)
   {
     seedpairlist->mlist_ulong->nextfreeGtUword = 0;
@@ -1557,6 +1665,7 @@ static void gt_seedpairlist_delete(GtSeedpairlist *seedpairlist)
       GT_FREEARRAY(seedpairlist->mlist_bytestring, uint8_t);
       gt_free(seedpairlist->mlist_bytestring);
     }
+    gt_seedpairspill_delete(seedpairlist->spill);
     gt_free(seedpairlist);
   }
 }
@@ -1609,6 +1718,88 @@ const uint8_t *gt_seedpairlist_mlist_bytestring(
   return seedpairlist->mlist_bytestring->spaceuint8_t;
 }
 
+/* The following functions access the seed pairs independently of their
+   representation, as a sequence of units of
+   <gt_seedpairlist_sizeofunit()> bytes. */
+
+static uint8_t *gt_seedpairlist_space(const GtSeedpairlist *seedpairlist)
+{
+  if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_STRUCT)
+  {
+    return (uint8_t *) seedpairlist->mlist_struct->spaceGtDiagbandseedSeedPair;
+  }
+  if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_ULONG)
+  {
+    return (uint8_t *) seedpairlist->mlist_ulong->spaceGtUword;
+  }
+  return seedpairlist->mlist_bytestring->spaceuint8_t;
+}
+
+static GtUword gt_seedpairlist_allocated(const GtSeedpairlist *seedpairlist)
+{
+  if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_STRUCT)
+  {
+    return seedpairlist->mlist_struct->allocatedGtDiagbandseedSeedPair;
+  }
+  if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_ULONG)
+  {
+    return seedpairlist->mlist_ulong->allocatedGtUword;
+  }
+  return seedpairlist->mlist_bytestring->allocateduint8_t/
+         seedpairlist->bytes_seedpair;
+}
+
+static void gt_seedpairlist_set_length(GtSeedpairlist *seedpairlist,
+                                       GtUword length)
+{
+  gt_assert(length <= gt_seedpairlist_allocated(seedpairlist));
+  if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_STRUCT)
+  {
+    seedpairlist->mlist_struct->nextfreeGtDiagbandseedSeedPair = length;
+  } else
+  {
+    if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_ULONG)
+    {
+      seedpairlist->mlist_ulong->nextfreeGtUword = length;
+    } else
+    {
+      seedpairlist->mlist_bytestring->nextfreeuint8_t
+        = length * seedpairlist->bytes_seedpair;
+    }
+  }
+}
+
+/* set the number of allocated units to <allocated>, which must not be
+   smaller than the current length */
+static void gt_seedpairlist_resize(GtSeedpairlist *seedpairlist,
+                                   GtUword allocated)
+{
+  gt_assert(allocated >= gt_seedpairlist_length(seedpairlist));
+  if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_STRUCT)
+  {
+    seedpairlist->mlist_struct->allocatedGtDiagbandseedSeedPair = allocated;
+    seedpairlist->mlist_struct->spaceGtDiagbandseedSeedPair
+      = gt_realloc(seedpairlist->mlist_struct->spaceGtDiagbandseedSeedPair,
+                   sizeof (GtDiagbandseedSeedPair) * allocated);
+  } else
+  {
+    if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_ULONG)
+    {
+      seedpairlist->mlist_ulong->allocatedGtUword = allocated;
+      seedpairlist->mlist_ulong->spaceGtUword
+        = gt_realloc(seedpairlist->mlist_ulong->spaceGtUword,
+                     sizeof (GtUword) * allocated);
+    } else
+    {
+      seedpairlist->mlist_bytestring->allocateduint8_t
+        = allocated * seedpairlist->bytes_seedpair;
+      seedpairlist->mlist_bytestring->spaceuint8_t
+        = gt_realloc(seedpairlist->mlist_bytestring->spaceuint8_t,
+                     seedpairlist->mlist_bytestring->allocateduint8_t);
+    }
+  }
+}
+
 static void gt_diagbandseed_one_GtUword2bytestring(uint8_t *bytestring,
                                                    GtUword bytestring_length,
                                                    GtUword value)
@@ -1743,37 +1934,40 @@ static void gt_seedpairlist_add(GtSeedpairlist *seedpairlist,
   }
 }
 
-static void gt_diagbandseed_seedpairlist_sort(GtSeedpairlist *seedpairlist)
+/* sort the <mlistlen> seed pairs of type <splt> stored in <space> */
+static void gt_seedpairlist_sort_space(GtDiagbandseedBaseListType splt,
+                                       void *space,
+                                       GtUword mlistlen,
+                                       size_t bytes_seedpair)
 {
-  GtUword mlistlen = gt_seedpairlist_length(seedpairlist);
-
   if (mlistlen > 0)
   {
-    if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_STRUCT)
+    gt_assert(space != NULL);
+    if (splt == GT_DIAGBANDSEED_BASE_LIST_STRUCT)
     {
-      gt_assert(seedpairlist->mlist_struct != NULL);
-      gt_radixsort_inplace_Gtuint64keyPair(
-            (Gtuint64keyPair *) seedpairlist->mlist_struct
-                                            ->spaceGtDiagbandseedSeedPair,
-            mlistlen);
+      gt_radixsort_inplace_Gtuint64keyPair((Gtuint64keyPair *) space,
+                                           mlistlen);
     } else
     {
-      if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_ULONG)
+      if (splt == GT_DIAGBANDSEED_BASE_LIST_ULONG)
       {
-        gt_assert(seedpairlist->mlist_ulong != NULL);
-        gt_radixsort_inplace_ulong(seedpairlist->mlist_ulong->spaceGtUword,
-                                   mlistlen);
+        gt_radixsort_inplace_ulong((GtUword *) space,mlistlen);
       } else
       {
-        gt_assert(seedpairlist->mlist_bytestring != NULL);
-        gt_radixsort_inplace_flba(seedpairlist->mlist_bytestring->spaceuint8_t,
-                                  gt_seedpairlist_length(seedpairlist),
-                                  seedpairlist->bytes_seedpair);
+        gt_radixsort_inplace_flba((uint8_t *) space,mlistlen,bytes_seedpair);
       }
     }
   }
 }
 
+static void gt_diagbandseed_seedpairlist_sort(GtSeedpairlist *seedpairlist)
+{
+  gt_seedpairlist_sort_space(seedpairlist->splt,
+                             gt_seedpairlist_space(seedpairlist),
+                             gt_seedpairlist_length(seedpairlist),
+                             seedpairlist->bytes_seedpair);
+}
+
 static GtUword gt_seedpairlist_a_bseqnum_ulong(
                                           const GtSeedpairlist *seedpairlist,
                                           GtUword encoding)
@@ -1957,6 +2151,435 @@ static void gt_diagbandseed_seedpairlist_out(FILE *stream,
   }
 }
 
+/* Enable spilling of the seed pairs to temporary files, such that at most
+   <spillmem> bytes are used for storing them (except for segments which do
+   not fit into a chunk). One run is collected while the previous run is
+   sorted and written, so each run gets half of the memory. */
+static void gt_seedpairlist_spill_enable(GtSeedpairlist *seedpairlist,
+                                         GtUword spillmem)
+{
+  GtSeedpairSpill *spill = gt_calloc(1,sizeof *spill);
+
+  spill->splt = seedpairlist->splt;
+  spill->sizeofunit = gt_seedpairlist_sizeofunit(seedpairlist);
+  spill->capacity = GT_MAX(spillmem/(2 * spill->sizeofunit),1UL);
+  if (seedpairlist->mlist_struct != NULL)
+  {
+    spill->mlist_struct = gt_malloc(sizeof *spill->mlist_struct);
+    GT_INITARRAY(spill->mlist_struct,GtDiagbandseedSeedPair);
+  }
+  if (seedpairlist->mlist_ulong != NULL)
+  {
+    spill->mlist_ulong = gt_malloc(sizeof *spill->mlist_ulong);
+    GT_INITARRAY(spill->mlist_ulong,GtUword);
+  }
+  if (seedpairlist->mlist_bytestring != NULL)
+  {
+    spill->mlist_bytestring = gt_malloc(sizeof *spill->mlist_bytestring);
+    GT_INITARRAY(spill->mlist_bytestring,uint8_t);
+  }
+  GT_INITARRAY(&spill->runs,GtSeedpairRun);
+#ifdef GT_THREADS_ENABLED
+  spill->group = gt_thread_pool_group_new();
+#endif
+  seedpairlist->spill = spill;
+}
+
+static void gt_seedpairlist_spill_update_peak(GtSeedpairlist *seedpairlist)
+{
+  GtSeedpairSpill *spill = seedpairlist->spill;
+  GtUword idx, memory = gt_seedpairlist_allocated(seedpairlist) *
+                        spill->sizeofunit;
+
+  if (spill->mlist_struct != NULL)
+  {
+    memory += spill->mlist_struct->allocatedGtDiagbandseedSeedPair *
+              sizeof (GtDiagbandseedSeedPair);
+  }
+  if (spill->mlist_ulong != NULL)
+  {
+    memory += spill->mlist_ulong->allocatedGtUword * sizeof (GtUword);
+  }
+  if (spill->mlist_bytestring != NULL)
+  {
+    memory += spill->mlist_bytestring->allocateduint8_t;
+  }
+  for (idx = 0; idx < spill->runs.nextfreeGtSeedpairRun; idx++)
+  {
+    if (spill->runs.spaceGtSeedpairRun[idx].buffer != NULL)
+    {
+      memory += spill->readbufferlength * spill->sizeofunit;
+    }
+  }
+  if (memory > spill->peak_memory)
+  {
+    spill->peak_memory = memory;
+  }
+}
+
+static void gt_seedpairlist_spill_swap(GtSeedpairlist *seedpairlist)
+{
+  GtSeedpairSpill *spill = seedpairlist->spill;
+  GtArrayGtDiagbandseedSeedPair *mlist_struct = seedpairlist->mlist_struct;
+  GtArrayGtUword *mlist_ulong = seedpairlist->mlist_ulong;
+  GtArrayuint8_t *mlist_bytestring = seedpairlist->mlist_bytestring;
+
+  seedpairlist->mlist_struct = spill->mlist_struct;
+  seedpairlist->mlist_ulong = spill->mlist_ulong;
+  seedpairlist->mlist_bytestring = spill->mlist_bytestring;
+  spill->mlist_struct = mlist_struct;
+  spill->mlist_ulong = mlist_ulong;
+  spill->mlist_bytestring = mlist_bytestring;
+}
+
+static void gt_seedpairspill_write_run(void *data)
+{
+  GtSeedpairSpill *spill = (GtSeedpairSpill *) data;
+
+  gt_seedpairlist_sort_space(spill->splt,spill->job_space,spill->job_length,
+                             spill->sizeofunit);
+  gt_xfwrite(spill->job_space,spill->sizeofunit,(size_t) spill->job_length,
+             spill->job_fp);
+}
+
+/* Sort the seed pairs collected so far and write them as a new run in the
+   background. Afterwards the seed pair list is empty. */
+static void gt_seedpairlist_spill_run(GtSeedpairlist *seedpairlist)
+{
+  GtSeedpairSpill *spill = seedpairlist->spill;
+  GtSeedpairRun *run;
+
+  gt_seedpairspill_wait(spill);
+  gt_seedpairlist_spill_update_peak(seedpairlist);
+  spill->job_space = gt_seedpairlist_space(seedpairlist);
+  spill->job_length = gt_seedpairlist_length(seedpairlist);
+  gt_seedpairlist_spill_swap(seedpairlist);
+  gt_seedpairlist_set_length(seedpairlist,0);
+  GT_GETNEXTFREEINARRAY(run,&spill->runs,GtSeedpairRun,16);
+  run->fp = gt_xtmpfp_generic(NULL,GT_TMPFP_OPENBINARY | GT_TMPFP_AUTOREMOVE);
+  run->buffer = NULL;
+  run->remaining = spill->job_length;
+  run->buffered = run->bufferpos = 0;
+  spill->job_fp = run->fp;
+  spill->numofruns++;
+  spill->bytes_written += spill->job_length * spill->sizeofunit;
+#ifdef GT_THREADS_ENABLED
+  gt_thread_pool_group_submit(spill->group,gt_seedpairspill_write_run,spill);
+#else
+  gt_seedpairspill_write_run(spill);
+#endif
+}
+
+/* Make sure that the next seed pair can be added to the seed pair list
+   without exceeding the capacity, by spilling the seed pairs collected so
+   far if necessary. */
+static void gt_seedpairlist_spill_check(GtSeedpairlist *seedpairlist)
+{
+  GtSeedpairSpill *spill = seedpairlist->spill;
+  GtUword length = gt_seedpairlist_length(seedpairlist),
+          allocated = gt_seedpairlist_allocated(seedpairlist);
+
+  if (length >= spill->capacity)
+  {
+    gt_seedpairlist_spill_run(seedpairlist);
+    length = 0;
+    allocated = gt_seedpairlist_allocated(seedpairlist);
+  }
+  if (length == allocated)
+  {
+    gt_seedpairlist_resize(seedpairlist,
+                           GT_MIN(spill->capacity,
+                                  allocated + 256 + 0.2 * allocated));
+  }
+}
+
+static int gt_seedpairspill_unit_cmp(const GtSeedpairSpill *spill,
+                                     const uint8_t *unit1,
+                                     const uint8_t *unit2)
+{
+  if (spill->splt == GT_DIAGBANDSEED_BASE_LIST_STRUCT)
+  {
+    const Gtuint64keyPair *p1 = (const Gtuint64keyPair *) unit1,
+                          *p2 = (const Gtuint64keyPair *) unit2;
+
+    if (p1->uint64_a != p2->uint64_a)
+    {
+      return p1->uint64_a < p2->uint64_a ? -1 : 1;
+    }
+    if (p1->uint64_b != p2->uint64_b)
+    {
+      return p1->uint64_b < p2->uint64_b ? -1 : 1;
+    }
+    return 0;
+  }
+  if (spill->splt == GT_DIAGBANDSEED_BASE_LIST_ULONG)
+  {
+    const GtUword v1 = *(const GtUword *) unit1,
+                  v2 = *(const GtUword *) unit2;
+
+    return v1 < v2 ? -1 : (v1 > v2 ? 1 : 0);
+  }
+  return memcmp(unit1,unit2,spill->sizeofunit);
+}
+
+/* Return true if the seed pairs <unit1> and <unit2> belong to the same
+   segment, i.e. have the same sequence numbers. */
+static bool gt_seedpairlist_same_segment(const GtSeedpairlist *seedpairlist,
+                                         const uint8_t *unit1,
+                                         const uint8_t *unit2)
+{
+  if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_STRUCT)
+  {
+    const GtDiagbandseedSeedPair *sp1 = (const GtDiagbandseedSeedPair *) unit1,
+                                 *sp2 = (const GtDiagbandseedSeedPair *) unit2;
+
+    return sp1->aseqnum == sp2->aseqnum && sp1->bseqnum == sp2->bseqnum;
+  }
+  if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_ULONG)
+  {
+    return gt_seedpairlist_a_bseqnum_ulong(seedpairlist,
+                                           *(const GtUword *) unit1) ==
+           gt_seedpairlist_a_bseqnum_ulong(seedpairlist,
+                                           *(const GtUword *) unit2);
+  }
+  return (gt_diagbandseed_bytestring2GtUword(unit1,sizeof (GtUword)) >>
+          seedpairlist->bits_left_adjust[idx_bseqnum]) ==
+         (gt_diagbandseed_bytestring2GtUword(unit2,sizeof (GtUword)) >>
+          seedpairlist->bits_left_adjust[idx_bseqnum]);
+}
+
+static const uint8_t *gt_seedpairspill_run_head(const GtSeedpairSpill *spill,
+                                                GtUword runidx)
+{
+  const GtSeedpairRun *run = spill->runs.spaceGtSeedpairRun + runidx;
+
+  return run->buffer + run->bufferpos * spill->sizeofunit;
+}
+
+static bool gt_seedpairspill_run_less(const GtSeedpairSpill *spill,
+                                      GtUword heapidx1,
+                                      GtUword heapidx2)
+{
+  return gt_seedpairspill_unit_cmp(spill,
+                          gt_seedpairspill_run_head(spill,
+                                                    spill->heap[heapidx1]),
+                          gt_seedpairspill_run_head(spill,
+                                                    spill->heap[heapidx2])) < 0
+         ? true : false;
+}
+
+static void gt_seedpairspill_heap_swap(GtSeedpairSpill *spill,
+                                       GtUword heapidx1,
+                                       GtUword heapidx2)
+{
+  GtUword tmp = spill->heap[heapidx1];
+
+  spill->heap[heapidx1] = spill->heap[heapidx2];
+  spill->heap[heapidx2] = tmp;
+}
+
+static void gt_seedpairspill_heap_siftdown(GtSeedpairSpill *spill)
+{
+  GtUword parent = 0;
+
+  while (true)
+  {
+    GtUword child = 2 * parent + 1;
+
+    if (child >= spill->heapsize)
+    {
+      break;
+    }
+    if (child + 1 < spill->heapsize &&
+        gt_seedpairspill_run_less(spill,child + 1,child))
+    {
+      child++;
+    }
+    if (!gt_seedpairspill_run_less(spill,child,parent))
+    {
+      break;
+    }
+    gt_seedpairspill_heap_swap(spill,parent,child);
+    parent = child;
+  }
+}
+
+static void gt_seedpairspill_heap_insert(GtSeedpairSpill *spill,
+                                         GtUword runidx)
+{
+  GtUword child = spill->heapsize++;
+
+  spill->heap[child] = runidx;
+  while (child > 0)
+  {
+    const GtUword parent = (child - 1)/2;
+
+    if (!gt_seedpairspill_run_less(spill,child,parent))
+    {
+      break;
+    }
+    gt_seedpairspill_heap_swap(spill,parent,child);
+    child = parent;
+  }
+}
+
+/* Read the next seed pairs of <run> into its buffer. Return false if the
+   run is exhausted. */
+static bool gt_seedpairspill_run_refill(GtSeedpairSpill *spill,
+                                        GtSeedpairRun *run)
+{
+  GT_UNUSED size_t numread;
+
+  if (run->remaining == 0)
+  {
+    return false;
+  }
+  run->buffered = GT_MIN(run->remaining,spill->readbufferlength);
+  numread = gt_xfread(run->buffer,spill->sizeofunit,(size_t) run->buffered,
+                      run->fp);
+  gt_assert(numread == (size_t) run->buffered);
+  run->remaining -= run->buffered;
+  run->bufferpos = 0;
+  spill->bytes_read += run->buffered * spill->sizeofunit;
+  return true;
+}
+
+/* If seed pairs have been spilled, write the remaining seed pairs as the
+   last run and prepare the merging of all runs. The arrays used for the
+   runs being written are freed, and each run gets a buffer, such that the
+   buffers together are of the size of one run. Return true if the seed
+   pairs have been spilled, i.e. they are obtained by
+   <gt_seedpairlist_spill_next_chunk()>. Otherwise the seed pairs remain in
+   the seed pair list. */
+static bool gt_seedpairlist_spill_finish(GtSeedpairlist *seedpairlist)
+{
+  GtSeedpairSpill *spill = seedpairlist->spill;
+  GtUword idx, numofruns;
+
+  if (spill->runs.nextfreeGtSeedpairRun == 0)
+  {
+    gt_seedpairlist_spill_update_peak(seedpairlist);
+    return false;
+  }
+  if (gt_seedpairlist_length(seedpairlist) > 0)
+  {
+    gt_seedpairlist_spill_run(seedpairlist);
+  }
+  gt_seedpairspill_wait(spill);
+  gt_seedpairlist_spill_update_peak(seedpairlist);
+  if (spill->mlist_struct != NULL)
+  {
+    GT_FREEARRAY(spill->mlist_struct,GtDiagbandseedSeedPair);
+  }
+  if (spill->mlist_ulong != NULL)
+  {
+    GT_FREEARRAY(spill->mlist_ulong,GtUword);
+  }
+  if (spill->mlist_bytestring != NULL)
+  {
+    GT_FREEARRAY(spill->mlist_bytestring,uint8_t);
+  }
+  numofruns = spill->runs.nextfreeGtSeedpairRun;
+  spill->readbufferlength = GT_MAX(spill->capacity/numofruns,
+                                   GT_MIN(spill->capacity,1024UL));
+  spill->heap = gt_realloc(spill->heap,sizeof *spill->heap * numofruns);
+  spill->heapsize = 0;
+  for (idx = 0; idx < numofruns; idx++)
+  {
+    GtSeedpairRun *run = spill->runs.spaceGtSeedpairRun + idx;
+    GT_UNUSED bool filled;
+
+    rewind(run->fp);
+    run->buffer = gt_malloc(spill->readbufferlength * spill->sizeofunit);
+    filled = gt_seedpairspill_run_refill(spill,run);
+    gt_assert(filled);
+    gt_seedpairspill_heap_insert(spill,idx);
+  }
+  return true;
+}
+
+static void gt_seedpairlist_append_unit(GtSeedpairlist *seedpairlist,
+                                        const uint8_t *unit)
+{
+  const GtUword length = gt_seedpairlist_length(seedpairlist),
+                allocated = gt_seedpairlist_allocated(seedpairlist);
+  const size_t sizeofunit = seedpairlist->spill->sizeofunit;
+
+  if (length == allocated)
+  {
+    /* only the segment at the end of a chunk may exceed the capacity, so
+       grow in small steps */
+    gt_seedpairlist_resize(seedpairlist,allocated + 256 + allocated/16);
+  }
+  memcpy(gt_seedpairlist_space(seedpairlist) + length * sizeofunit,unit,
+         sizeofunit);
+  gt_seedpairlist_set_length(seedpairlist,length + 1);
+}
+
+/* Fill the seed pair list with the next chunk of the merged runs, i.e. with
+   the next <capacity> seed pairs extended to the end of the segment the last
+   of them belongs to. Return the length of the chunk, which is 0 if all
+   seed pairs have been delivered. */
+static GtUword gt_seedpairlist_spill_next_chunk(GtSeedpairlist *seedpairlist)
+{
+  GtSeedpairSpill *spill = seedpairlist->spill;
+  GtUword length = 0;
+
+  gt_seedpairlist_set_length(seedpairlist,0);
+  while (spill->heapsize > 0)
+  {
+    GtSeedpairRun *run = spill->runs.spaceGtSeedpairRun + spill->heap[0];
+    const uint8_t *unit = run->buffer + run->bufferpos * spill->sizeofunit;
+
+    if (length >= spill->capacity &&
+        !gt_seedpairlist_same_segment(seedpairlist,
+                                      gt_seedpairlist_space(seedpairlist) +
+                                      (length - 1) * spill->sizeofunit,
+                                      unit))
+    {
+      break;
+    }
+    gt_seedpairlist_append_unit(seedpairlist,unit);
+    length++;
+    run->bufferpos++;
+    if (run->bufferpos == run->buffered &&
+        !gt_seedpairspill_run_refill(spill,run))
+    {
+      gt_fa_xfclose(run->fp);
+      run->fp = NULL;
+      gt_free(run->buffer);
+      run->buffer = NULL;
+      spill->heap[0] = spill->heap[--spill->heapsize];
+    }
+    gt_seedpairspill_heap_siftdown(spill);
+  }
+  gt_seedpairlist_spill_update_peak(seedpairlist);
+  if (spill->heapsize == 0)
+  {
+    gt_seedpairspill_close_runs(spill);
+  }
+  return length;
+}
+
+static bool gt_seedpairlist_spill_pending(const GtSeedpairlist *seedpairlist)
+{
+  return seedpairlist->spill != NULL && seedpairlist->spill->heapsize > 0
+         ? true : false;
+}
+
+static void gt_seedpairlist_spill_show(FILE *stream,
+                                       const GtSeedpairlist *seedpairlist)
+{
+  const GtSeedpairSpill *spill = seedpairlist->spill;
+
+  fprintf(stream,"# spilled " GT_WU " sorted runs of seeds: %.2f MB written, "
+                 "%.2f MB read, peak memory for seeds %.2f MB\n",
+          spill->numofruns,
+          GT_MEGABYTES(spill->bytes_written),
+          GT_MEGABYTES(spill->bytes_read),
+          GT_MEGABYTES(spill->peak_memory));
+}
+
 /* Fill a GtDiagbandseedSeedPair list of equal kmers from the iterators. */
 static void gt_diagbandseed_merge(GtSeedpairlist *seedpairlist,
                                   GtUword *histogram,
@@ -2018,8 +2641,13 @@ static void gt_diagbandseed_merge(GtSeedpairlist *seedpairlist,
                   if (histogram == NULL)
                   {
                     /* save SeedPair in seedpairlist */
+                    if (seedpairlist->spill != NULL)
+                    {
+                      gt_seedpairlist_spill_check(seedpairlist);
+                    }
                     gt_seedpairlist_add(seedpairlist,
-                                        knowthesize,
+                                        knowthesize ||
+                                        seedpairlist->spill != NULL,
                                         aptr->seqnum,
                                         bptr->seqnum,
                                         bptr->endpos,
@@ -2228,6 +2856,7 @@ static void gt_diagbandseed_get_seedpairs(GtSeedpairlist *seedpairlist,
 {
   GtTimer *timer = NULL;
   GtUword mlistlen;
+  bool spilled = false;
 
   if (verbose) {
     timer = gt_timer_new();
@@ -2242,8 +2871,11 @@ static void gt_diagbandseed_get_seedpairs(GtSeedpairlist *seedpairlist,
     gt_timer_start(timer);
   }
 
-  /* allocate mlist space according to seed count */
-  gt_seedpairlist_init(seedpairlist,known_size);
+  /* allocate mlist space according to seed count, unless the size of the
+     seed pair list is bounded by spilling */
+  if (seedpairlist->spill == NULL) {
+    gt_seedpairlist_init(seedpairlist,known_size);
+  }
 
   /* create mlist */
   (void) gt_diagbandseed_merge(seedpairlist,
@@ -2256,13 +2888,35 @@ static void gt_diagbandseed_get_seedpairs(GtSeedpairlist *seedpairlist,
                         seedpairdistance,
                         selfcomp);
   mlistlen = gt_seedpairlist_length(seedpairlist);
+  if (seedpairlist->spill != NULL) {
+    const GtSeedpairSpill *spill = seedpairlist->spill;
+    GtUword idx;
+
+    for (idx = 0; idx < spill->runs.nextfreeGtSeedpairRun; idx++) {
+      mlistlen += spill->runs.spaceGtSeedpairRun[idx].remaining;
+    }
+  }
   if (verbose) {
     fprintf(stream, "# ... collected " GT_WU " seeds ", mlistlen);
     gt_timer_show_formatted(timer, GT_DIAGBANDSEED_FMT, stream);
   }
 
-  /* sort mlist */
-  if (mlistlen > 0) {
+  if (seedpairlist->spill != NULL) {
+    if (verbose) {
+      gt_timer_start(timer);
+    }
+    spilled = gt_seedpairlist_spill_finish(seedpairlist);
+  }
+  if (spilled) {
+    /* the runs are merged into chunks, fetch the first one */
+    if (verbose) {
+      fprintf(stream, "# ... sorted " GT_WU " seeds in " GT_WU " runs ",
+              mlistlen, seedpairlist->spill->runs.nextfreeGtSeedpairRun);
+      gt_timer_show_formatted(timer, GT_DIAGBANDSEED_FMT, stream);
+    }
+    (void) gt_seedpairlist_spill_next_chunk(seedpairlist);
+  } else if (mlistlen > 0) {
+    /* sort mlist */
     if (verbose) {
       gt_timer_start(timer);
     }
@@ -3573,116 +4227,34 @@ typedef void (*GtDiagbandseedProcessSegmentFunc)(
                         const GtSeedpairPositions *segment_positions,
                         GtUword segment_length);
 
-/* start seed extension for seeds in mlist */
-static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
-                                         const GtDiagbandseedExtendParams *extp,
-                                          void *processinfo,
-                                          GtQuerymatchoutoptions *querymoutopt,
-                                          const GtEncseq *aencseq,
-                                          const GtSequencePartsInfo *aseqranges,
-                                          GtUword aidx,
-                                          const GtEncseq *bencseq,
-                                          const GtSequencePartsInfo *bseqranges,
-                                          GtUword bidx,
-                                          const GtKarlinAltschulStat
-                                            *karlin_altschul_stat,
-                                          GtArrayGtDiagbandseedMaximalmatch
-                                            *memstore,
-                                          const GtChain2Dimmode *chainmode,
-                                          unsigned int spacedseedweight,
-                                          unsigned int seedlength,
-                                          GtReadmode query_readmode,
-                                          bool verbose,
-                                          FILE *stream,
-                                          const GtStr *diagband_statistics_arg,
-                                          GtDiagbandseedState
-                                            *dbs_state,
-                                          GtSegmentRejectFunc
-                                            segment_reject_func,
-                                          GtSegmentRejectInfo
-                                            *segment_reject_info)
-{
-  const bool forward = query_readmode == GT_READMODE_REVCOMPL ? false : true;
-  /* Although the sequences of the parts processed are shorter, we need to
-     set amaxlen and bmaxlen to the maximum size of all sequences
-     to get the same division into diagonal bands for all parts and thus
-     obtain results independent of the number of parts chosen. */
-  const GtUword mlistlen = gt_seedpairlist_length(seedpairlist),
-                minsegmentlen = (extp->mincoverage - 1) / seedlength + 1;
-  GtTimer *timer = NULL;
-  GtDiagbandStruct *diagband_struct = NULL;
-  GtDiagbandseedExtendSegmentInfo *esi = NULL;
-  GtDiagbandStatistics *diagband_statistics = NULL;
-  GtDiagbandseedProcessSegmentFunc segment_proc_func = NULL;
-  void *segment_proc_info = NULL;
-
-  gt_assert(extp->mincoverage >= seedlength && minsegmentlen >= 1);
-  if (mlistlen == 0 || mlistlen < minsegmentlen ||
-      (!extp->extendgreedy && !extp->extendxdrop))
-  {
-    return;
-  }
-  if (verbose)
-  {
-    timer = gt_timer_new();
-    gt_timer_start(timer);
-  }
-  if (seedpairlist->maxmat_show)
-  {
-    fprintf(stream,"# Fields: s.len, s.seqnum, s.start, strand, q.seqnum, "
-                   "q.start\n");
-  } else
-  {
-    const GtUword bmaxlen = gt_encseq_max_seq_length(bencseq);
-    if (verbose)
-    {
-      gt_diagbandseed_match_header(stream,extp,processinfo,
-                                   spacedseedweight,
-                                   seedlength,
-                                   gt_diagband_struct_num_diagbands(
-                                              seedpairlist->amaxlen,bmaxlen,
-                                              extp->logdiagbandwidth),
-                                   minsegmentlen);
-    }
-    diagband_struct = gt_diagband_struct_new(seedpairlist->amaxlen,bmaxlen,
-                                             extp->logdiagbandwidth);
-    if (gt_str_length(diagband_statistics_arg) == 0)
-    {
-      esi = gt_diagbandseed_extendSI_new(extp,
-                                         processinfo,
-                                         querymoutopt,
-                                         aencseq,
-                                         aseqranges,
-                                         aidx,
-                                         bencseq,
-                                         bseqranges,
-                                         bidx,
-                                         karlin_altschul_stat,
-                                         query_readmode,
-                                         stream,
-                                         dbs_state,
-                                         segment_reject_func,
-                                         segment_reject_info);
-      if (verbose)
-      {
-        if (esi->plainsequence_info.a_byte_sequence != NULL ||
-            esi->plainsequence_info.b_byte_sequence != NULL)
-        {
-          fprintf(stream, "# ... extracted sequences ");
-          gt_timer_show_formatted(timer, GT_DIAGBANDSEED_FMT, stream);
-          gt_timer_start(timer);
-        }
-      }
-      segment_proc_func = gt_diagbandseed_segment2matches;
-      segment_proc_info = esi;
-    } else
-    {
-      diagband_statistics = gt_diagband_statistics_new(diagband_statistics_arg,
-                                                       forward);
-      segment_proc_func = gt_diagband_statistics_add;
-      segment_proc_info = diagband_statistics;
-    }
-  }
+/* Iterate through the segments of the <mlistlen> seed pairs in
+   <seedpairlist>, i.e. through the maximal runs of seed pairs with the same
+   sequence numbers, and process the segments of at least <minsegmentlen>
+   seed pairs. */
+static void gt_diagbandseed_process_segments(
+                                  GtSeedpairlist *seedpairlist,
+                                  GtUword mlistlen,
+                                  GtUword minsegmentlen,
+                                  bool forward,
+                                  const GtDiagbandseedExtendParams *extp,
+                                  const GtEncseq *aencseq,
+                                  const GtSequencePartsInfo *aseqranges,
+                                  const GtEncseq *bencseq,
+                                  const GtSequencePartsInfo *bseqranges,
+                                  GtArrayGtDiagbandseedMaximalmatch *memstore,
+                                  const GtChain2Dimmode *chainmode,
+                                  unsigned int seedlength,
+                                  FILE *stream,
+                                  GtDiagbandseedState *dbs_state,
+                                  GtSegmentRejectFunc segment_reject_func,
+                                  GtSegmentRejectInfo *segment_reject_info,
+                                  GtDiagbandStruct *diagband_struct,
+                                  GtDiagbandseedExtendSegmentInfo *esi,
+                                  GtDiagbandseedProcessSegmentFunc
+                                    segment_proc_func,
+                                  void *segment_proc_info)
+{
+  gt_assert(mlistlen >= minsegmentlen);
   if (seedpairlist->splt == GT_DIAGBANDSEED_BASE_LIST_STRUCT)
   {
     const GtDiagbandseedSeedPair
@@ -3923,6 +4495,149 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
       }
     }
   }
+}
+
+/* start seed extension for seeds in mlist, if the seed pairs have been
+   spilled, the chunks of the merged runs are processed one after the
+   other */
+static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
+                                         const GtDiagbandseedExtendParams *extp,
+                                          void *processinfo,
+                                          GtQuerymatchoutoptions *querymoutopt,
+                                          const GtEncseq *aencseq,
+                                          const GtSequencePartsInfo *aseqranges,
+                                          GtUword aidx,
+                                          const GtEncseq *bencseq,
+                                          const GtSequencePartsInfo *bseqranges,
+                                          GtUword bidx,
+                                          const GtKarlinAltschulStat
+                                            *karlin_altschul_stat,
+                                          GtArrayGtDiagbandseedMaximalmatch
+                                            *memstore,
+                                          const GtChain2Dimmode *chainmode,
+                                          unsigned int spacedseedweight,
+                                          unsigned int seedlength,
+                                          GtReadmode query_readmode,
+                                          bool verbose,
+                                          FILE *stream,
+                                          const GtStr *diagband_statistics_arg,
+                                          GtDiagbandseedState
+                                            *dbs_state,
+                                          GtSegmentRejectFunc
+                                            segment_reject_func,
+                                          GtSegmentRejectInfo
+                                            *segment_reject_info)
+{
+  const bool forward = query_readmode == GT_READMODE_REVCOMPL ? false : true;
+  /* Although the sequences of the parts processed are shorter, we need to
+     set amaxlen and bmaxlen to the maximum size of all sequences
+     to get the same division into diagonal bands for all parts and thus
+     obtain results independent of the number of parts chosen. */
+  const GtUword minsegmentlen = (extp->mincoverage - 1) / seedlength + 1;
+  GtUword mlistlen = gt_seedpairlist_length(seedpairlist), numofseeds = 0;
+  GtTimer *timer = NULL;
+  GtDiagbandStruct *diagband_struct = NULL;
+  GtDiagbandseedExtendSegmentInfo *esi = NULL;
+  GtDiagbandStatistics *diagband_statistics = NULL;
+  GtDiagbandseedProcessSegmentFunc segment_proc_func = NULL;
+  void *segment_proc_info = NULL;
+
+  gt_assert(extp->mincoverage >= seedlength && minsegmentlen >= 1);
+  if (((mlistlen == 0 || mlistlen < minsegmentlen) &&
+       !gt_seedpairlist_spill_pending(seedpairlist)) ||
+      (!extp->extendgreedy && !extp->extendxdrop))
+  {
+    return;
+  }
+  if (verbose)
+  {
+    timer = gt_timer_new();
+    gt_timer_start(timer);
+  }
+  if (seedpairlist->maxmat_show)
+  {
+    fprintf(stream,"# Fields: s.len, s.seqnum, s.start, strand, q.seqnum, "
+                   "q.start\n");
+  } else
+  {
+    const GtUword bmaxlen = gt_encseq_max_seq_length(bencseq);
+    if (verbose)
+    {
+      gt_diagbandseed_match_header(stream,extp,processinfo,
+                                   spacedseedweight,
+                                   seedlength,
+                                   gt_diagband_struct_num_diagbands(
+                                              seedpairlist->amaxlen,bmaxlen,
+                                              extp->logdiagbandwidth),
+                                   minsegmentlen);
+    }
+    diagband_struct = gt_diagband_struct_new(seedpairlist->amaxlen,bmaxlen,
+                                             extp->logdiagbandwidth);
+    if (gt_str_length(diagband_statistics_arg) == 0)
+    {
+      esi = gt_diagbandseed_extendSI_new(extp,
+                                         processinfo,
+                                         querymoutopt,
+                                         aencseq,
+                                         aseqranges,
+                                         aidx,
+                                         bencseq,
+                                         bseqranges,
+                                         bidx,
+                                         karlin_altschul_stat,
+                                         query_readmode,
+                                         stream,
+                                         dbs_state,
+                                         segment_reject_func,
+                                         segment_reject_info);
+      if (verbose)
+      {
+        if (esi->plainsequence_info.a_byte_sequence != NULL ||
+            esi->plainsequence_info.b_byte_sequence != NULL)
+        {
+          fprintf(stream, "# ... extracted sequences ");
+          gt_timer_show_formatted(timer, GT_DIAGBANDSEED_FMT, stream);
+          gt_timer_start(timer);
+        }
+      }
+      segment_proc_func = gt_diagbandseed_segment2matches;
+      segment_proc_info = esi;
+    } else
+    {
+      diagband_statistics = gt_diagband_statistics_new(diagband_statistics_arg,
+                                                       forward);
+      segment_proc_func = gt_diagband_statistics_add;
+      segment_proc_info = diagband_statistics;
+    }
+  }
+  do
+  {
+    if (mlistlen >= minsegmentlen)
+    {
+      gt_diagbandseed_process_segments(seedpairlist,
+                                       mlistlen,
+                                       minsegmentlen,
+                                       forward,
+                                       extp,
+                                       aencseq,
+                                       aseqranges,
+                                       bencseq,
+                                       bseqranges,
+                                       memstore,
+                                       chainmode,
+                                       seedlength,
+                                       stream,
+                                       dbs_state,
+                                       segment_reject_func,
+                                       segment_reject_info,
+                                       diagband_struct,
+                                       esi,
+                                       segment_proc_func,
+                                       segment_proc_info);
+    }
+    numofseeds += mlistlen;
+  } while (seedpairlist->spill != NULL &&
+           (mlistlen = gt_seedpairlist_spill_next_chunk(seedpairlist)) > 0);
   if (diagband_struct != NULL)
   {
     if (verbose)
@@ -3939,7 +4654,7 @@ static void gt_diagbandseed_process_seeds(GtSeedpairlist *seedpairlist,
                                    seedpairlist->aseqrange_start + 1) *
                                   (seedpairlist->bseqrange_end -
                                    seedpairlist->bseqrange_start + 1);
-      gt_diagbandseed_dbs_state_update(dbs_state,mlistlen,numseqpairs);
+      gt_diagbandseed_dbs_state_update(dbs_state,numofseeds,numseqpairs);
 #ifndef _WIN32
       dbs_state->total_process_seeds_usec
         += gt_timer_elapsed_usec(timer);
@@ -4189,6 +4904,10 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
   seedpairlist = gt_seedpairlist_new(arg->splt,aseqranges,aidx,bseqranges,bidx,
                                      arg->maxmat,amaxlen);
   sizeofunit = gt_seedpairlist_sizeofunit(seedpairlist);
+  if (arg->spillmem < GT_UWORD_MAX)
+  {
+    gt_seedpairlist_spill_enable(seedpairlist,arg->spillmem);
+  }
   if (seedpairlist->maxmat_compute && !seedpairlist->maxmat_show)
   {
     memstore = gt_malloc(sizeof *memstore);
@@ -4486,6 +5205,10 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
                                   segment_reject_func,
                                   segment_reject_info);
   }
+  if (!had_err && arg->verbose && seedpairlist->spill != NULL)
+  {
+    gt_seedpairlist_spill_show(stream,seedpairlist);
+  }
   /* Clean up */
   gt_seedpairlist_delete(seedpairlist);
   if (memstore != NULL)
@@ -4522,6 +5245,184 @@ static int gt_diagbandseed_algorithm(const GtDiagbandseedInfo *arg,
 }
 
 #ifdef GT_THREADS_ENABLED
+/* A pair of parts to be processed by one call of
+   <gt_diagbandseed_algorithm()>, together with an estimate of the work
+   needed for it, namely the product of the lengths of both parts.
+   The output for the part pair is written by the processing thread to its
+   own <stream>, starting at <outoffset>. It is copied to stdout after all
+   part pairs are processed, in the order in which they were added. */
+typedef struct
+{
+  GtUword aidx, bidx, order, outoffset, outlength;
+  double workload;
+  FILE *stream;
+} GtDiagbandseedPartPair;
+
+/* The part pairs are ordered by decreasing workload and handed out one by
+   one to the threads asking for more work. So the large part pairs are
+   started first and the small ones fill the gaps at the end, instead of
+   fixing the part pairs of each thread in advance. */
+typedef struct
+{
+  GtArray *partpairs;
+  GtUword next;
+  bool stop;
+  GtMutex *mutex;
+} GtDiagbandseedWorkQueue;
+
+static GtDiagbandseedWorkQueue *gt_diagbandseed_work_queue_new(void)
+{
+  GtDiagbandseedWorkQueue *queue = gt_malloc(sizeof *queue);
+
+  queue->partpairs = gt_array_new(sizeof (GtDiagbandseedPartPair));
+  queue->next = 0;
+  queue->stop = false;
+  queue->mutex = gt_mutex_new();
+  return queue;
+}
+
+static void gt_diagbandseed_work_queue_delete(GtDiagbandseedWorkQueue *queue)
+{
+  if (queue != NULL)
+  {
+    gt_array_delete(queue->partpairs);
+    gt_mutex_delete(queue->mutex);
+    gt_free(queue);
+  }
+}
+
+static void gt_diagbandseed_work_queue_add(GtDiagbandseedWorkQueue *queue,
+                                           const GtSequencePartsInfo
+                                             *aseqranges,
+                                           GtUword aidx,
+                                           const GtSequencePartsInfo
+                                             *bseqranges,
+                                           GtUword bidx)
+{
+  GtDiagbandseedPartPair partpair;
+
+  partpair.aidx = aidx;
+  partpair.bidx = bidx;
+  partpair.order = gt_array_size(queue->partpairs);
+  partpair.outoffset = partpair.outlength = 0;
+  partpair.stream = NULL;
+  partpair.workload
+    = (double) gt_sequence_parts_info_partlength(
+                 aseqranges,
+                 gt_sequence_parts_info_start_get(aseqranges,aidx),
+                 gt_sequence_parts_info_end_get(aseqranges,aidx)) *
+      (double) gt_sequence_parts_info_partlength(
+                 bseqranges,
+                 gt_sequence_parts_info_start_get(bseqranges,bidx),
+                 gt_sequence_parts_info_end_get(bseqranges,bidx));
+  gt_array_add(queue->partpairs,partpair);
+}
+
+static int gt_diagbandseed_partpair_cmp(const void *va,const void *vb)
+{
+  const GtDiagbandseedPartPair *a = va, *b = vb;
+
+  if (a->workload != b->workload)
+  {
+    return a->workload > b->workload ? -1 : 1;
+  }
+  if (a->aidx != b->aidx)
+  {
+    return a->aidx < b->aidx ? -1 : 1;
+  }
+  if (a->bidx != b->bidx)
+  {
+    return a->bidx < b->bidx ? -1 : 1;
+  }
+  return 0;
+}
+
+static int gt_diagbandseed_partpair_order_cmp(const void *va,const void *vb)
+{
+  const GtDiagbandseedPartPair *a = va, *b = vb;
+
+  if (a->order != b->order)
+  {
+    return a->order < b->order ? -1 : 1;
+  }
+  return 0;
+}
+
+/* Sort the part pairs added and rewind <queue>, return the number of part
+   pairs. */
+static GtUword gt_diagbandseed_work_queue_start(GtDiagbandseedWorkQueue
+                                                  *queue)
+{
+  gt_array_sort(queue->partpairs,gt_diagbandseed_partpair_cmp);
+  queue->next = 0;
+  queue->stop = false;
+  return gt_array_size(queue->partpairs);
+}
+
+/* Return the next part pair to process or NULL if there is none left or
+   another thread has failed. */
+static GtDiagbandseedPartPair *gt_diagbandseed_work_queue_next(
+                                            GtDiagbandseedWorkQueue *queue)
+{
+  GtDiagbandseedPartPair *partpair = NULL;
+
+  gt_mutex_lock(queue->mutex);
+  if (!queue->stop && queue->next < gt_array_size(queue->partpairs))
+  {
+    partpair = gt_array_get(queue->partpairs,queue->next++);
+  }
+  gt_mutex_unlock(queue->mutex);
+  return partpair;
+}
+
+static void gt_diagbandseed_work_queue_stop(GtDiagbandseedWorkQueue *queue)
+{
+  gt_mutex_lock(queue->mutex);
+  queue->stop = true;
+  gt_mutex_unlock(queue->mutex);
+}
+
+/* Copy the output of all processed part pairs of <queue> to stdout, in the
+   order in which the part pairs were added. So the output does not depend
+   on the number of threads or on which thread processed which part pair. */
+static void gt_diagbandseed_work_queue_output(GtDiagbandseedWorkQueue *queue)
+{
+  char buffer[BUFSIZ];
+  GtUword idx;
+
+  gt_array_sort(queue->partpairs,gt_diagbandseed_partpair_order_cmp);
+  for (idx = 0; idx < gt_array_size(queue->partpairs); idx++)
+  {
+    const GtDiagbandseedPartPair *partpair
+      = gt_array_get(queue->partpairs,idx);
+    GtUword remain = partpair->outlength;
+
+    if (remain == 0)
+    {
+      continue;
+    }
+    gt_assert(partpair->stream != NULL);
+    gt_xfseek(partpair->stream,(GtWord) partpair->outoffset,SEEK_SET);
+    while (remain > 0)
+    {
+      size_t len = (size_t) GT_MIN(remain,(GtUword) sizeof buffer);
+
+      len = gt_xfread(buffer,sizeof *buffer,len,partpair->stream);
+      gt_assert(len > 0);
+      gt_xfwrite(buffer,sizeof *buffer,len,stdout);
+      remain -= (GtUword) len;
+    }
+    gt_xfseek(partpair->stream,0,SEEK_END);
+  }
+}
+
+static void gt_diagbandseed_work_queue_reset(GtDiagbandseedWorkQueue *queue)
+{
+  gt_array_reset(queue->partpairs);
+  queue->next = 0;
+  queue->stop = false;
+}
+
 typedef struct
 {
   const GtDiagbandseedInfo *arg;
@@ -4530,11 +5431,13 @@ typedef struct
   const GtEncseq *aencseq, *bencseq;
   const GtSequencePartsInfo *aseqranges,
                             *bseqranges;
-  GtSegmentRejectFunc segment_reject_func;
-  GtArray *combinations;
+  GtDiagbandseedWorkQueue *queue;
   int had_err;
   GtError *err;
   const GtKarlinAltschulStat *karlin_altschul_stat;
+  /* accumulated over all calls of <gt_diagbandseed_thread_algorithm()> */
+  GtUword num_partpairs;
+  GtUword busy_usec;
 } GtDiagbandseedThreadInfo;
 
 static void gt_diagbandseed_thread_info_set(GtDiagbandseedThreadInfo *ti,
@@ -4547,7 +5450,7 @@ static void gt_diagbandseed_thread_info_set(GtDiagbandseedThreadInfo *ti,
                                      const GtSequencePartsInfo *bseqranges,
                                      const GtKarlinAltschulStat
                                        *karlin_altschul_stat,
-                                     GtArray *combinations,
+                                     GtDiagbandseedWorkQueue *queue,
                                      GtError *err)
 {
   gt_assert(ti != NULL);
@@ -4559,40 +5462,125 @@ static void gt_diagbandseed_thread_info_set(GtDiagbandseedThreadInfo *ti,
   ti->bencseq = bencseq;
   ti->bseqranges = bseqranges;
   ti->karlin_altschul_stat = karlin_altschul_stat;
-  ti->combinations = gt_array_clone(combinations);
+  ti->queue = queue;
   ti->had_err = 0;
   ti->err = err;
 }
 
-static void *gt_diagbandseed_thread_algorithm(void *thread_info)
+static void gt_diagbandseed_thread_algorithm(void *thread_info)
 {
   GtDiagbandseedThreadInfo *info = (GtDiagbandseedThreadInfo *)thread_info;
-  if (gt_array_size(info->combinations) > 0) {
-    const GtUwordPair *last = gt_array_get_last(info->combinations),
-                      *comb;
-
-    for (comb = gt_array_get_first(info->combinations); comb <= last; comb++) {
-      info->had_err = gt_diagbandseed_algorithm(
-                           info->arg,
-                           info->alist,
-                           info->stream,
-                           info->aencseq,
-                           info->aseqranges,
-                           comb->a,
-                           info->bencseq,
-                           info->bseqranges,
-                           comb->b,
-                           info->karlin_altschul_stat,
-                           NULL,
-                           NULL,
-                           info->err);
-      if (info->had_err) break;
+  GtDiagbandseedPartPair *partpair;
+  GtTimer *timer = gt_timer_new();
+
+  gt_timer_start(timer);
+  while (!info->had_err &&
+         (partpair = gt_diagbandseed_work_queue_next(info->queue)) != NULL)
+  {
+    partpair->stream = info->stream;
+    partpair->outoffset = (GtUword) ftell(info->stream);
+    info->had_err = gt_diagbandseed_algorithm(
+                         info->arg,
+                         info->alist,
+                         info->stream,
+                         info->aencseq,
+                         info->aseqranges,
+                         partpair->aidx,
+                         info->bencseq,
+                         info->bseqranges,
+                         partpair->bidx,
+                         info->karlin_altschul_stat,
+                         NULL,
+                         NULL,
+                         info->err);
+    partpair->outlength = (GtUword) ftell(info->stream) - partpair->outoffset;
+    info->num_partpairs++;
+    if (info->had_err)
+    {
+      gt_diagbandseed_work_queue_stop(info->queue);
     }
   }
-  gt_array_delete(info->combinations);
-  return NULL;
+#ifndef _WIN32
+  info->busy_usec += (GtUword) gt_timer_elapsed_usec(timer);
+#endif
+  gt_timer_delete(timer);
+}
+
+/* Process the part pairs in <queue> with up to <gt_jobs> threads, each
+   writing to its own stream from <stream_tab>. The main thread is one of
+   them. Afterwards the output is copied to stdout in part pair order. */
+static int gt_diagbandseed_run_threads(GtDiagbandseedThreadInfo *tinfo,
+                                       FILE **stream_tab,
+                                       GtDiagbandseedWorkQueue *queue,
+                                       const GtDiagbandseedInfo *arg,
+                                       const GtKmerPosList *alist,
+                                       const GtSequencePartsInfo *aseqranges,
+                                       const GtSequencePartsInfo *bseqranges,
+                                       const GtKarlinAltschulStat
+                                         *karlin_altschul_stat,
+                                       GtError *err)
+{
+  const GtUword num_partpairs = gt_diagbandseed_work_queue_start(queue);
+  const unsigned int num_threads
+    = (unsigned int) GT_MIN((GtUword) gt_jobs,num_partpairs);
+  GtThreadPoolGroup *group;
+  unsigned int tidx;
+  int had_err = 0;
+
+  if (num_threads == 0)
+  {
+    return 0;
+  }
+  for (tidx = 0; tidx < num_threads; tidx++)
+  {
+    gt_diagbandseed_thread_info_set(tinfo + tidx,
+                                    arg,
+                                    alist,
+                                    stream_tab[tidx],
+                                    arg->aencseq,
+                                    aseqranges,
+                                    arg->bencseq,
+                                    bseqranges,
+                                    karlin_altschul_stat,
+                                    queue,
+                                    err);
+  }
+  group = gt_thread_pool_group_new();
+  for (tidx = 1; tidx < num_threads; tidx++)
+  {
+    gt_thread_pool_group_submit(group, gt_diagbandseed_thread_algorithm,
+                                tinfo + tidx);
+  }
+  gt_diagbandseed_thread_algorithm(tinfo);
+  gt_thread_pool_group_wait(group);
+  gt_thread_pool_group_delete(group);
+  for (tidx = 0; tidx < num_threads && !had_err; tidx++)
+  {
+    had_err = tinfo[tidx].had_err;
+  }
+  if (!had_err)
+  {
+    gt_diagbandseed_work_queue_output(queue);
+  }
+  return had_err;
+}
+
+#ifndef _WIN32
+static void gt_diagbandseed_thread_times_show(
+                                  const GtDiagbandseedThreadInfo *tinfo)
+{
+  unsigned int tidx;
+
+  for (tidx = 0; tidx < gt_jobs; tidx++)
+  {
+    printf("# TIME thread %u processed " GT_WU " part pairs in "
+           GT_WD ".%06ld seconds\n",tidx,tinfo[tidx].num_partpairs,
+           GT_USEC2SEC(tinfo[tidx].busy_usec),
+           GT_USECREMAIN(tinfo[tidx].busy_usec));
+  }
 }
 #endif
+#endif
 
 static int gt_diagbandseed_write_kmers(const GtKmerPosList *kmerpos_list,
                                        const char *path,
@@ -4698,14 +5686,15 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
   GtKarlinAltschulStat *karlin_altschul_stat = NULL;
   GtDiagbandseedState *dbs_state = NULL;
 #ifdef GT_THREADS_ENABLED
-  GtDiagbandseedThreadInfo *tinfo = gt_malloc(gt_jobs * sizeof *tinfo);
+  GtDiagbandseedThreadInfo *tinfo = gt_calloc(gt_jobs, sizeof *tinfo);
+  GtDiagbandseedWorkQueue *queue = gt_diagbandseed_work_queue_new();
   FILE **stream_tab;
   unsigned int tidx;
 
-  /* create output streams */
+  /* create output streams, the output is copied to stdout in part pair
+     order after processing */
   stream_tab = gt_malloc(gt_jobs * sizeof *stream_tab);
-  stream_tab[0] = stdout;
-  for (tidx = 1; !had_err && tidx < gt_jobs; tidx++) {
+  for (tidx = 0; gt_jobs > 1 && tidx < gt_jobs; tidx++) {
     stream_tab[tidx]
       = gt_xtmpfp_generic(NULL, GT_TMPFP_OPENBINARY | GT_TMPFP_AUTOREMOVE);
   }
@@ -4889,86 +5878,23 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
       }
 #ifdef GT_THREADS_ENABLED
     } else if (!arg->use_kmerfile) {
-      const GtUword num_runs = bpick ? 1 : bnumseqranges - bidx;
-      const GtUword num_runs_per_thread = (num_runs - 1) / gt_jobs + 1;
-      const GtUword num_threads = (num_runs - 1) / num_runs_per_thread + 1;
-      GtArray *combinations = gt_array_new(sizeof (GtUwordPair));
-      GtArray *threads = gt_array_new(sizeof (GtThread *));
-
       gt_assert(bidx < bnumseqranges);
-      gt_assert(num_threads <= gt_jobs);
-      gt_assert(!bpick || num_threads == 1);
-
-      /* start additional threads */
-      for (tidx = 1; !had_err && tidx < num_threads; tidx++) {
-        GtThread *thread;
-        GtUword idx;
-        bidx += num_runs_per_thread;
-        const GtUword end = GT_MIN(bidx + num_runs_per_thread, bnumseqranges);
-
-        for (idx = bidx; idx < end; idx++) {
-          GtUwordPair comb = {aidx, idx};
-          gt_array_add(combinations, comb);
-        }
-        gt_diagbandseed_thread_info_set(tinfo + tidx,
-                                        arg,
-                                        use_alist ? alist : NULL,
-                                        stream_tab[tidx],
-                                        arg->aencseq,
-                                        aseqranges,
-                                        arg->bencseq,
-                                        bseqranges,
-                                        karlin_altschul_stat,
-                                        combinations,
-                                        err);
-        gt_array_reset(combinations);
-        if ((thread = gt_thread_new(gt_diagbandseed_thread_algorithm,
-                                    tinfo + tidx, err)) != NULL) {
-          gt_array_add(threads, thread);
-        } else {
-          had_err = -1;
-        }
-      }
-
-      /* start main thread */
-      if (!had_err) {
-        GtUword idx;
-        bidx = self ? aidx : 0;
-        for (idx = bidx;
-             idx < GT_MIN(bidx + num_runs_per_thread, bnumseqranges);
-             ++idx) {
-          if (!bpick || pick->b == idx) {
-            GtUwordPair comb = {aidx, idx};
-            gt_array_add(combinations, comb);
-          }
-        }
-        gt_diagbandseed_thread_info_set(tinfo,
-                                        arg,
-                                        use_alist ? alist : NULL,
-                                        stream_tab[0],
-                                        arg->aencseq,
-                                        aseqranges,
-                                        arg->bencseq,
-                                        bseqranges,
-                                        karlin_altschul_stat,
-                                        combinations,
-                                        err);
-        gt_diagbandseed_thread_algorithm(tinfo);
-      }
-
-      /* clean up */
-      for (tidx = 0; tidx < gt_array_size(threads); tidx++) {
-        GtThread *thread = *(GtThread**) gt_array_get(threads, tidx);
-        if (!had_err) {
-          gt_thread_join(thread);
+      gt_diagbandseed_work_queue_reset(queue);
+      for (/* Nothing */; bidx < bnumseqranges; bidx++) {
+        if (!bpick || pick->b == bidx) {
+          gt_diagbandseed_work_queue_add(queue,aseqranges,aidx,
+                                         bseqranges,bidx);
         }
-        gt_thread_delete(thread);
       }
-      gt_array_delete(threads);
-      for (tidx = 0; tidx < num_threads && !had_err; tidx++) {
-        had_err = tinfo[tidx].had_err;
-      }
-      gt_array_delete(combinations);
+      had_err = gt_diagbandseed_run_threads(tinfo,
+                                            stream_tab,
+                                            queue,
+                                            arg,
+                                            use_alist ? alist : NULL,
+                                            aseqranges,
+                                            bseqranges,
+                                            karlin_altschul_stat,
+                                            err);
     }
 #endif
     if (use_alist) {
@@ -4977,13 +5903,8 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
     gt_kmerpos_encode_info_delete(aencode_info);
   }
 #ifdef GT_THREADS_ENABLED
-  if (gt_jobs > 1 && arg->use_kmerfile) {
-    GtArray *combinations[gt_jobs];
-    GtArray *threads = gt_array_new(sizeof (GtThread *));
-    GtUword counter = 0;
-    for (tidx = 0; tidx < gt_jobs; tidx++) {
-      combinations[tidx] = gt_array_new(sizeof (GtUwordPair));
-    }
+  if (!had_err && gt_jobs > 1 && arg->use_kmerfile) {
+    gt_diagbandseed_work_queue_reset(queue);
     for (aidx = 0; aidx < anumseqranges; aidx++) {
       if (apick && pick->a != aidx)
       {
@@ -4991,76 +5912,34 @@ int gt_diagbandseed_run(const GtDiagbandseedInfo *arg,
       }
       for (bidx = self ? aidx : 0; bidx < bnumseqranges; bidx++) {
         if (!bpick || pick->b == bidx) {
-          GtUwordPair comb = {aidx, bidx};
-          gt_array_add(combinations[counter++ % gt_jobs], comb);
+          gt_diagbandseed_work_queue_add(queue,aseqranges,aidx,
+                                         bseqranges,bidx);
         }
       }
     }
-
-    for (tidx = 1; !had_err && tidx < gt_jobs; tidx++) {
-      GtThread *thread;
-      gt_diagbandseed_thread_info_set(tinfo + tidx,
-                                      arg,
-                                      NULL,
-                                      stream_tab[tidx],
-                                      arg->aencseq,
-                                      aseqranges,
-                                      arg->bencseq,
-                                      bseqranges,
-                                      karlin_altschul_stat,
-                                      combinations[tidx],
-                                      err);
-      if ((thread = gt_thread_new(gt_diagbandseed_thread_algorithm,
-                                  tinfo + tidx, err)) != NULL) {
-        gt_array_add(threads, thread);
-      } else {
-        had_err = -1;
-      }
-    }
-    /* start main thread */
-    if (!had_err) {
-      gt_diagbandseed_thread_info_set(tinfo,
-                                      arg,
-                                      NULL,
-                                      stream_tab[0],
-                                      arg->aencseq,
-                                      aseqranges,
-                                      arg->bencseq,
-                                      bseqranges,
-                                      karlin_altschul_stat,
-                                      combinations[0],
-                                      err);
-      gt_diagbandseed_thread_algorithm(tinfo);
-    }
-
-    /* clean up */
-    for (tidx = 0; tidx < gt_array_size(threads); tidx++) {
-      GtThread *thread = *(GtThread**) gt_array_get(threads, tidx);
-      if (!had_err) {
-        gt_thread_join(thread);
-      }
-      gt_thread_delete(thread);
-    }
-    for (tidx = 0; tidx < gt_array_size(threads) && !had_err; tidx++) {
-      had_err = tinfo[tidx].had_err;
-    }
-    gt_array_delete(threads);
-    for (tidx = 0; tidx < gt_jobs; tidx++) {
-      gt_array_delete(combinations[tidx]);
-    }
-  }
-  gt_free(tinfo);
-
-  /* print the threads' output to stdout */
-  for (tidx = 1; tidx < gt_jobs; tidx++) {
-    int cc;
-    rewind(stream_tab[tidx]);
-    while ((cc = fgetc(stream_tab[tidx])) != EOF) {
-      putchar(cc);
-    }
+    had_err = gt_diagbandseed_run_threads(tinfo,
+                                          stream_tab,
+                                          queue,
+                                          arg,
+                                          NULL,
+                                          aseqranges,
+                                          bseqranges,
+                                          karlin_altschul_stat,
+                                          err);
+  }
+  gt_diagbandseed_work_queue_delete(queue);
+
+  for (tidx = 0; gt_jobs > 1 && tidx < gt_jobs; tidx++) {
     gt_fa_xfclose(stream_tab[tidx]);
   }
   gt_free(stream_tab);
+#ifndef _WIN32
+  if (!had_err && gt_jobs > 1 && (arg->verbose || arg->extp->benchmark))
+  {
+    gt_diagbandseed_thread_times_show(tinfo);
+  }
+#endif
+  gt_free(tinfo);
 
 #endif
   if (arg->verbose)
@@ -51,6 +51,7 @@ GtDiagbandseedInfo *gt_diagbandseed_info_new(const GtEncseq *aencseq,
                                              const GtEncseq *bencseq,
                                              GtUword maxfreq,
                                              GtUword memlimit,
+                                             GtUword spillmem,
                                              unsigned int spacedseedweight,
                                              unsigned int seedlength,
                                              bool norev,
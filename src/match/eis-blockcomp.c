@@ -38,6 +38,7 @@
 #include "core/log.h"
 #include "core/minmax_api.h"
 #include "core/str_api.h"
+#include "core/thread_api.h"
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
 #include "eis-blockcomp-construct.h"
@@ -54,6 +55,8 @@ struct onDiskBlockCompIdx
                                 * if an mmap of the whole index
                                 * isn't possible also for reading */
   GtStr *idxFN;                /**< stores the filename of idxFP */
+  GtMutex *idxFPLock;          /**< serializes the seeks and reads on
+                                * idxFP of concurrent queries */
   char *idxMMap;               /**< if mmapping of the constant- and
                                 * variable-width strings succeeded,
                                 * stores the base of the
@@ -926,27 +929,35 @@ fetchSuperBlock(const struct blockCompositionSeq *seqIdx,
   else
   {
     FILE *idxFP;
-    GT_UNUSED int ret;
+    GT_UNUSED size_t ret;
     size_t superBlockCWDiskSize = superBlockCWMaxReadSize(seqIdx);
     BitOffset bucketOffset = bucketNum * superBlockCWBits(seqIdx);
     BitOffset varDataOffset;
+    bool failed;
     idxFP = seqIdx->externalData.idxFP;
-    if (fseeko(idxFP, seqIdx->externalData.cwDataPos
-              + bucketOffset / bitElemBits * sizeof (BitElem), SEEK_SET))
-      fetchSuperBlockErrRet();
-    if (fread(retval->cwData, 1, superBlockCWDiskSize, idxFP)
-       != superBlockCWDiskSize)
-      fetchSuperBlockErrRet();
-    retval->cwIdxMemBase = bucketOffset%bitElemBits;
-    varDataOffset = sBlockGetVarIdxOffset(retval, seqIdx);
-    if (fseeko(idxFP, seqIdx->externalData.varDataPos
-              + varDataOffset/bitElemBits * sizeof (BitElem), SEEK_SET))
-      fetchSuperBlockErrRet();
-    retval->varDataMemBase = varDataOffset%bitElemBits;
-    ret = fread(retval->varData, sizeof (BitElem),
-                superBlockVarMaxReadSize(seqIdx),
-                idxFP);
-    if (ferror(idxFP))
+    /* queries may run concurrently, but share the file position */
+    gt_mutex_lock(seqIdx->externalData.idxFPLock);
+    failed = fseeko(idxFP, seqIdx->externalData.cwDataPos
+                    + bucketOffset / bitElemBits * sizeof (BitElem), SEEK_SET)
+             || fread(retval->cwData, 1, superBlockCWDiskSize, idxFP)
+                != superBlockCWDiskSize;
+    if (!failed)
+    {
+      retval->cwIdxMemBase = bucketOffset%bitElemBits;
+      varDataOffset = sBlockGetVarIdxOffset(retval, seqIdx);
+      failed = fseeko(idxFP, seqIdx->externalData.varDataPos
+                      + varDataOffset/bitElemBits * sizeof (BitElem),
+                      SEEK_SET) != 0;
+      if (!failed)
+      {
+        retval->varDataMemBase = varDataOffset%bitElemBits;
+        ret = fread(retval->varData, sizeof (BitElem),
+                    superBlockVarMaxReadSize(seqIdx), idxFP);
+        failed = ferror(idxFP) != 0;
+      }
+    }
+    gt_mutex_unlock(seqIdx->externalData.idxFPLock);
+    if (failed)
       fetchSuperBlockErrRet();
   }
   return retval;
@@ -1309,6 +1320,29 @@ blockCompSeqPosPairRank(struct encIdxSeq *eSeqIdx, Symbol eSym,
   return rankCounts;
 }
 
+#ifdef __GNUC__
+#define blockCompSeqPrefetchAddr(addr) __builtin_prefetch(addr)
+#else
+#define blockCompSeqPrefetchAddr(addr)
+#endif
+
+/* fetches the start of the constant width data of the bucket holding
+ * pos, which is read first by any rank query */
+static void
+blockCompSeqPrefetch(const struct encIdxSeq *eSeqIdx, GtUword pos)
+{
+  const struct blockCompositionSeq *seqIdx;
+  gt_assert(eSeqIdx && eSeqIdx->classInfo == &blockCompositionSeqClass);
+  seqIdx = constEncIdxSeq2blockCompositionSeq(eSeqIdx);
+  if (seqIdxUsesMMap(seqIdx) && pos <= seqIdx->baseClass.seqLen)
+  {
+    BitOffset bucketOffset = bucketNumFromPos(seqIdx, pos)
+      * superBlockCWBits(seqIdx);
+    blockCompSeqPrefetchAddr(seqIdx->externalData.idxMMap
+                             + bucketOffset / bitElemBits * sizeof (BitElem));
+  }
+}
+
 static void
 blockCompSeqExpose(struct encIdxSeq *eSeqIdx, GtUword pos, int flags,
                    struct extBitsRetrieval *retval, union EISHint *hint)
@@ -1699,6 +1733,7 @@ openOnDiskData(const char *projectName, struct onDiskBlockCompIdx *idx,
   gt_str_append_cstr(bdxName, ".bdx");
   idx->idxFP = gt_fa_fopen(gt_str_get(bdxName), mode, err);
   idx->idxFN = gt_str_ref(bdxName);
+  idx->idxFPLock = gt_mutex_new();
   gt_str_delete(bdxName);
   if (!idx->idxFP)
     return 0;
@@ -1730,6 +1765,8 @@ destructOnDiskBlockCompIdx(struct onDiskBlockCompIdx *idx)
     gt_fa_xfclose(idx->idxFP);
   if (idx->idxFN)
     gt_str_delete(idx->idxFN);
+  if (idx->idxFPLock)
+    gt_mutex_delete(idx->idxFPLock);
 }
 
 static inline void
@@ -2747,4 +2784,5 @@ static const struct encIdxSeqClass blockCompositionSeqClass =
   .seekToHeader = seekToHeader,
   .printPosDiags = printBlockEncPosDiags,
   .printExtPosDiags = displayBlockEncBlock,
+  .prefetch = blockCompSeqPrefetch,
 };
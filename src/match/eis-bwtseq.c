@@ -19,6 +19,7 @@
 #include "match/dataalign.h"
 #include "core/error_api.h"
 #include "core/log.h"
+#include "core/minmax_api.h"
 #include "core/str_api.h"
 #include "core/undef_api.h"
 #include "core/unused_api.h"
@@ -145,6 +146,26 @@ gt_deleteBWTSeq(BWTSeq *bwtSeq)
   gt_free(bwtSeq);
 }
 
+BWTSeq *
+gt_newBWTSeqView(const BWTSeq *bwtSeq)
+{
+  BWTSeq *view;
+  gt_assert(bwtSeq);
+  view = gt_malloc(sizeof (*view));
+  *view = *bwtSeq;
+  view->hint = newEISHint(bwtSeq->seqIdx);
+  return view;
+}
+
+void
+gt_deleteBWTSeqView(BWTSeq *view)
+{
+  if (!view)
+    return;
+  deleteEISHint(view->seqIdx, view->hint);
+  gt_free(view);
+}
+
 typedef struct
 {
   const Mbtab **mbtab;
@@ -159,13 +180,65 @@ static const Mbtab *gt_prebwt_next(GtPrebwtstate *prebwt,unsigned int cc)
   return prebwt->mbtab[prebwt->depth] + prebwt->code;
 }
 
+static inline void
+initMatchBound(const BWTSeq *bwtSeq, Symbol sym, struct matchBound *match,
+               GtPrebwtstate *prebwt)
+{
+  unsigned int cc;
+  const Mbtab *mbptr;
+
+  gt_assert(GT_ISNOTSPECIAL(sym));
+  cc = (unsigned int) sym;
+  prebwt->mbtab = gt_bwtseq2mbtab((const FMindex *) bwtSeq);
+  if (prebwt->mbtab != NULL)
+  {
+    prebwt->numofchars = gt_bwtseq2numofchars((const FMindex *) bwtSeq);
+    prebwt->maxdepth = gt_bwtseq2maxdepth((const FMindex *) bwtSeq);
+    prebwt->code = 0;
+    prebwt->depth = 0;
+    mbptr = gt_prebwt_next(prebwt,cc);
+    match->start = mbptr->lowerbound;
+    match->end = mbptr->upperbound;
+  } else
+  {
+    prebwt->numofchars = GT_UNDEF_UINT;
+    prebwt->maxdepth = GT_UNDEF_UINT;
+    prebwt->code = 0;
+    prebwt->depth = GT_UNDEF_UINT;
+    match->start = bwtSeq->count[cc];
+    match->end   = bwtSeq->count[cc + 1];
+  }
+}
+
+static inline void
+extendMatchBound(const BWTSeq *bwtSeq, Symbol sym, struct matchBound *match,
+                 GtPrebwtstate *prebwt)
+{
+  unsigned int cc;
+
+  gt_assert(GT_ISNOTSPECIAL(sym));
+  cc = (unsigned int) sym;
+  if (prebwt->mbtab != NULL && prebwt->depth < prebwt->maxdepth)
+  {
+    const Mbtab *mbptr = gt_prebwt_next(prebwt,cc);
+    match->start = mbptr->lowerbound;
+    match->end = mbptr->upperbound;
+  } else
+  {
+    GtUwordPair occPair;
+
+    occPair = BWTSeqTransformedPosPairOcc(bwtSeq, (Symbol) cc, match->start,
+                                          match->end);
+    match->start = bwtSeq->count[cc] + occPair.a;
+    match->end   = bwtSeq->count[cc] + occPair.b;
+  }
+}
+
 static inline void
 getMatchBound(const BWTSeq *bwtSeq, const Symbol *query, size_t queryLen,
               struct matchBound *match, bool forward)
 {
   const Symbol *qptr, *qend;
-  unsigned int cc;
-  const Mbtab *mbptr;
   GtPrebwtstate prebwt;
 
   gt_assert(bwtSeq && query);
@@ -178,47 +251,121 @@ getMatchBound(const BWTSeq *bwtSeq, const Symbol *query, size_t queryLen,
     qptr = query + queryLen - 1;
     qend = query - 1;
   }
-  gt_assert(GT_ISNOTSPECIAL(*qptr));
-  cc = (unsigned int) *qptr;
-  prebwt.mbtab = gt_bwtseq2mbtab((const FMindex *) bwtSeq);
-  if (prebwt.mbtab != NULL)
-  {
-    prebwt.numofchars = gt_bwtseq2numofchars((const FMindex *) bwtSeq);
-    prebwt.maxdepth = gt_bwtseq2maxdepth((const FMindex *) bwtSeq);
-    prebwt.code = 0;
-    prebwt.depth = 0;
-    mbptr = gt_prebwt_next(&prebwt,cc);
-    match->start = mbptr->lowerbound;
-    match->end = mbptr->upperbound;
-  } else
-  {
-    prebwt.numofchars = GT_UNDEF_UINT;
-    prebwt.maxdepth = GT_UNDEF_UINT;
-    prebwt.code = 0;
-    prebwt.depth = GT_UNDEF_UINT;
-    match->start = bwtSeq->count[cc];
-    match->end   = bwtSeq->count[cc + 1];
-  }
+  initMatchBound(bwtSeq, *qptr, match, &prebwt);
   qptr = forward ? (qptr+1) : (qptr-1);
   while (match->start < match->end && qptr != qend)
   {
-    GtUwordPair occPair;
+    extendMatchBound(bwtSeq, *qptr, match, &prebwt);
+    qptr = forward ? (qptr+1) : (qptr-1);
+  }
+}
+
+/* number of queries whose backward search steps are interleaved */
+#define MATCH_BATCH_WIDTH 32
+
+struct matchBatchQuery
+{
+  const Symbol *qptr, *qend;
+  GtPrebwtstate prebwt;
+  struct matchBound match;
+};
+
+static inline bool
+matchBatchQueryIsActive(const struct matchBatchQuery *mbq)
+{
+  return mbq->match.start < mbq->match.end && mbq->qptr != mbq->qend;
+}
 
-    gt_assert(GT_ISNOTSPECIAL(*qptr));
-    cc = (unsigned int) *qptr;
-    if (prebwt.mbtab != NULL && prebwt.depth < prebwt.maxdepth)
+static inline void
+prefetchMatchBound(const BWTSeq *bwtSeq, const struct matchBound *match)
+{
+  EISPrefetch(bwtSeq->seqIdx, match->start);
+  EISPrefetch(bwtSeq->seqIdx, match->end);
+}
+
+void
+gt_BWTSeqMatchBoundBatch(const BWTSeq *bwtSeq, const Symbol *const *queries,
+                         const size_t *queryLens, size_t numQueries,
+                         bool forward, struct matchBound *bounds)
+{
+  struct matchBatchQuery window[MATCH_BATCH_WIDTH];
+  size_t base;
+
+  gt_assert(bwtSeq && (numQueries == 0 || (queries && queryLens && bounds)));
+  for (base = 0; base < numQueries; base += MATCH_BATCH_WIDTH)
+  {
+    size_t idx, width = GT_MIN(numQueries - base, MATCH_BATCH_WIDTH),
+      numActive = 0;
+    /* start all searches of the window, the steps answered by the
+     * bucket table do not access the index */
+    for (idx = 0; idx < width; ++idx)
     {
-      mbptr = gt_prebwt_next(&prebwt,cc);
-      match->start = mbptr->lowerbound;
-      match->end = mbptr->upperbound;
-    } else
+      struct matchBatchQuery *mbq = window + idx;
+      const Symbol *query = queries[base + idx];
+      gt_assert(query && queryLens[base + idx] > 0);
+      if (forward)
+      {
+        mbq->qptr = query;
+        mbq->qend = query + queryLens[base + idx];
+      } else
+      {
+        mbq->qptr = query + queryLens[base + idx] - 1;
+        mbq->qend = query - 1;
+      }
+      initMatchBound(bwtSeq, *mbq->qptr, &mbq->match, &mbq->prebwt);
+      mbq->qptr = forward ? (mbq->qptr+1) : (mbq->qptr-1);
+      while (matchBatchQueryIsActive(mbq) && mbq->prebwt.mbtab != NULL
+             && mbq->prebwt.depth < mbq->prebwt.maxdepth)
+      {
+        extendMatchBound(bwtSeq, *mbq->qptr, &mbq->match, &mbq->prebwt);
+        mbq->qptr = forward ? (mbq->qptr+1) : (mbq->qptr-1);
+      }
+      if (matchBatchQueryIsActive(mbq))
+      {
+        prefetchMatchBound(bwtSeq, &mbq->match);
+        ++numActive;
+      }
+    }
+    /* advance each search by one symbol per round, so that the index
+     * blocks prefetched for a search have arrived when it is its turn
+     * again */
+    while (numActive > 0)
     {
-      occPair = BWTSeqTransformedPosPairOcc(bwtSeq, (Symbol) cc, match->start,
-                                            match->end);
-      match->start = bwtSeq->count[cc] + occPair.a;
-      match->end   = bwtSeq->count[cc] + occPair.b;
+      for (idx = 0; idx < width; ++idx)
+      {
+        struct matchBatchQuery *mbq = window + idx;
+        if (!matchBatchQueryIsActive(mbq))
+          continue;
+        extendMatchBound(bwtSeq, *mbq->qptr, &mbq->match, &mbq->prebwt);
+        mbq->qptr = forward ? (mbq->qptr+1) : (mbq->qptr-1);
+        if (matchBatchQueryIsActive(mbq))
+          prefetchMatchBound(bwtSeq, &mbq->match);
+        else
+          --numActive;
+      }
     }
-    qptr = forward ? (qptr+1) : (qptr-1);
+    for (idx = 0; idx < width; ++idx)
+      bounds[base + idx] = window[idx].match;
+  }
+}
+
+void
+gt_BWTSeqMatchCountBatch(const BWTSeq *bwtSeq, const Symbol *const *queries,
+                         const size_t *queryLens, size_t numQueries,
+                         bool forward, GtUword *counts)
+{
+  struct matchBound bounds[MATCH_BATCH_WIDTH];
+  size_t base;
+
+  gt_assert(bwtSeq && (numQueries == 0 || counts));
+  for (base = 0; base < numQueries; base += MATCH_BATCH_WIDTH)
+  {
+    size_t idx, width = GT_MIN(numQueries - base, MATCH_BATCH_WIDTH);
+    gt_BWTSeqMatchBoundBatch(bwtSeq, queries + base, queryLens + base, width,
+                             forward, bounds);
+    for (idx = 0; idx < width; ++idx)
+      counts[base + idx] = bounds[idx].end < bounds[idx].start
+        ? 0 : bounds[idx].end - bounds[idx].start;
   }
 }
 
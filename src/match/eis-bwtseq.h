@@ -106,6 +106,25 @@ gt_loadBWTSeq(const char *projectName, int BWTOptFlags, GtLogger *verbosity,
 void
 gt_deleteBWTSeq(BWTSeq *bwtseq);
 
+/**
+ * \brief Create a view of a BWT sequence object which shares all
+ * index data with it but keeps its own query caches. Queries on
+ * different views of the same object may run concurrently.
+ *
+ * Warning: the view becomes invalid once bwtSeq has been deleted.
+ * @param bwtSeq reference of object to create view of
+ * @return reference to new view, to be passed to gt_deleteBWTSeqView
+ */
+BWTSeq *
+gt_newBWTSeqView(const BWTSeq *bwtSeq);
+
+/**
+ * \brief Deallocate a view created by gt_newBWTSeqView.
+ * @param view reference of view to delete
+ */
+void
+gt_deleteBWTSeqView(BWTSeq *view);
+
 /**
  * \brief Query BWT sequence object for availability of added
  * information to locate matches.
@@ -301,6 +320,35 @@ GtUword
 gt_BWTSeqMatchCount(const BWTSeq *bwtSeq, const Symbol *query, size_t queryLen,
                  bool forward);
 
+/**
+ * \brief Given a batch of query strings, find the interval of matches
+ * of each query. The backward search steps of the queries are
+ * interleaved, and while one query is advanced, the index blocks
+ * needed for the next step of the others are prefetched.
+ * @param bwtSeq reference of object to query
+ * @param queries queries[i] is the i-th symbol string to search matches
+ * for, each of length at least 1
+ * @param queryLens queryLens[i] is the length of queries[i]
+ * @param numQueries number of queries in batch
+ * @param forward direction of processing the queries
+ * @param bounds bounds[i] is set to the match interval of queries[i],
+ * which is empty if bounds[i].start >= bounds[i].end
+ */
+void
+gt_BWTSeqMatchBoundBatch(const BWTSeq *bwtSeq, const Symbol *const *queries,
+                         const size_t *queryLens, size_t numQueries,
+                         bool forward, struct matchBound *bounds);
+
+/**
+ * \brief Given a batch of query strings, find number of matches of
+ * each query, see gt_BWTSeqMatchBoundBatch.
+ * @param counts counts[i] is set to the number of matches of queries[i]
+ */
+void
+gt_BWTSeqMatchCountBatch(const BWTSeq *bwtSeq, const Symbol *const *queries,
+                         const size_t *queryLens, size_t numQueries,
+                         bool forward, GtUword *counts);
+
 /**
  * \brief Given a pair of limiting positions in the suffix array and a
  * symbol, compute the interval reached by matching one symbol further.
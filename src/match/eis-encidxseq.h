@@ -366,6 +366,16 @@ newEISHint(const EISeq *seq);
 static inline void
 deleteEISHint(EISeq *seq, EISHint hint);
 
+/**
+ * \brief Issue a prefetch of the index data accessed first by a rank
+ * query for position pos, so that the query can later be answered
+ * without waiting for main memory.
+ * @param seq sequence index object to query
+ * @param pos position of a later rank query
+ */
+static inline void
+EISPrefetch(const EISeq *seq, GtUword pos);
+
 /**
  * Possible outcome of index integrity check.
  */
@@ -18,6 +18,7 @@
 #include "core/divmodmul_api.h"
 #include "core/encseq_metadata.h"
 #include "core/log_api.h"
+#include "core/minmax_api.h"
 #include "eis-bwtseq-construct.h"
 #include "eis-bwtseq-priv.h"
 #include "eis-bwtseq.h"
@@ -462,7 +463,7 @@ bool gt_pck_exactpatternmatching(const FMindex *fmindex,
                                  const GtUchar *pattern,
                                  GtUword patternlength,
                                  GtUword totallength,
-                                 const GtUchar *dbsubstring,
+                                 GT_UNUSED const GtUchar *dbsubstring,
                                  ProcessIdxMatch processmatch,
                                  void *processmatchinfo)
 {
@@ -476,7 +477,7 @@ bool gt_pck_exactpatternmatching(const FMindex *fmindex,
   numofmatches = gt_EMINumMatchesTotal(bsemi);
   match.dbabsolute = true;
   match.dblen = patternlength;
-  match.dbsubstring = dbsubstring;
+  match.dbsubstring = pattern;
   match.querystartpos = 0;
   match.querylen = patternlength;
   match.distance = 0;
@@ -495,6 +496,55 @@ bool gt_pck_exactpatternmatching(const FMindex *fmindex,
   return numofmatches > 0 ? true : false;
 }
 
+FMindex *gt_pck_view_new(const FMindex *fmindex)
+{
+  return (FMindex *) gt_newBWTSeqView((const BWTSeq *) fmindex);
+}
+
+void gt_pck_view_delete(FMindex *view)
+{
+  gt_deleteBWTSeqView((BWTSeq *) view);
+}
+
+void *gt_voidpackedindexview_new(const void *fmindex)
+{
+  return (void *) gt_pck_view_new((const FMindex *) fmindex);
+}
+
+void gt_voidpackedindexview_delete(void *view)
+{
+  gt_pck_view_delete((FMindex *) view);
+}
+
+#define GT_PCK_BATCHSIZE 64
+
+void gt_pck_exactpatternbounds_batch(const FMindex *fmindex,
+                                     const GtUchar * const *patterns,
+                                     const GtUword *patternlengths,
+                                     GtUword numofpatterns,
+                                     Mbtab *bounds)
+{
+  struct matchBound matchbounds[GT_PCK_BATCHSIZE];
+  size_t querylengths[GT_PCK_BATCHSIZE];
+  GtUword base, idx, width;
+
+  for (base = 0; base < numofpatterns; base += width)
+  {
+    width = GT_MIN(numofpatterns - base,(GtUword) GT_PCK_BATCHSIZE);
+    for (idx = 0; idx < width; idx++)
+    {
+      querylengths[idx] = (size_t) patternlengths[base + idx];
+    }
+    gt_BWTSeqMatchBoundBatch((const BWTSeq *) fmindex,patterns + base,
+                             querylengths,(size_t) width,true,matchbounds);
+    for (idx = 0; idx < width; idx++)
+    {
+      bounds[base + idx].lowerbound = matchbounds[idx].start;
+      bounds[base + idx].upperbound = matchbounds[idx].end;
+    }
+  }
+}
+
 GtUword gt_voidpackedindex_totallength_get(const FMindex *fmindex)
 {
   GtUword bwtlen = BWTSeqLength((const BWTSeq *) fmindex);
@@ -114,6 +114,19 @@ bool gt_pck_exactpatternmatching(const FMindex *fmindex,
                                  ProcessIdxMatch processmatch,
                                  void *processmatchinfo);
 
+/* Return a view of <fmindex> sharing all index data, but with its own
+   caches, so that it can be queried by another thread. The view must be
+   deleted by <gt_pck_view_delete> before <fmindex>. */
+FMindex *gt_pck_view_new(const FMindex *fmindex);
+
+void gt_pck_view_delete(FMindex *view);
+
+/* the same with void pointers, as required by the other index based
+   methods */
+void *gt_voidpackedindexview_new(const void *fmindex);
+
+void gt_voidpackedindexview_delete(void *view);
+
 GtUword gt_voidpackedfindfirstmatchconvert(const FMindex *fmindex,
                                                  GtUword witnessbound,
                                                  GtUword matchlength);
@@ -135,6 +148,18 @@ unsigned int gt_bwtseq2numofchars(const FMindex *fmindex);
 
 const Mbtab **gt_bwtseq2mbtab(const FMindex *fmindex);
 
+/* For each i in the range from 0 to <numofpatterns>-1, store in <bounds>[i]
+   the bounds of the interval of exact matches of <patterns>[i] of length
+   <patternlengths>[i] > 0. The interval is empty if the lowerbound is not
+   smaller than the upperbound. The searches are interleaved, which hides
+   the latency of the memory accesses to the index. The matches can be
+   enumerated by a <Bwtseqpositioniterator>. */
+void gt_pck_exactpatternbounds_batch(const FMindex *fmindex,
+                                     const GtUchar * const *patterns,
+                                     const GtUword *patternlengths,
+                                     GtUword numofpatterns,
+                                     Mbtab *bounds);
+
 /* this does currently not work, only for the root interval. This is due to the
  * sorting of the special chars, might be changed in future.
  * Only reliable information:
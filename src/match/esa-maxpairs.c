@@ -19,6 +19,8 @@
 #include "core/unused_api.h"
 #include "core/minmax_api.h"
 #include "core/arraydef_api.h"
+#include "core/thread_pool.h"
+#include "sarr-def.h"
 #include "esa-seqread.h"
 #include "esa-lcpintervals.h"
 #include "esa-maxpairs.h"
@@ -77,7 +79,9 @@ typedef struct  /* global information */
   GtReadmode readmode;
   GtProcessmaxpairs processmaxpairs;
   const GtMaxfreqcollect *maxfreqcollect;
-  GtUword nextmaxfreq;
+  GtUword nextmaxfreq,
+          lboffset; /* added to the left bounds of the lcp-intervals when
+                       only a part of the suffix array is traversed */
   void *processmaxpairsinfo;
 } GtBUstate_maxpairs;
 
@@ -369,7 +373,7 @@ static int processbranchingedge_maxpairs(bool firstsucc,
   {
     if (binaryfindlcpinterval(state->maxfreqcollect->arr.spaceLcpinterval,
                               state->maxfreqcollect->arr.nextfreeLcpinterval,
-                              fatherdepth,fatherlb))
+                              fatherdepth,fatherlb + state->lboffset))
     {
       return 0;
     }
@@ -377,7 +381,7 @@ static int processbranchingedge_maxpairs(bool firstsucc,
     gt_assert(!linearfindlcpinterval(
                               state->maxfreqcollect->arr.spaceLcpinterval,
                               state->maxfreqcollect->arr.nextfreeLcpinterval,
-                              fatherdepth,fatherlb));
+                              fatherdepth,fatherlb + state->lboffset));
 #endif
   }
   state->initialized = false;
@@ -475,23 +479,23 @@ static GtUword gt_ssar_ssli_nonspecials(const Sequentialsuffixarrayreader *ssar,
 
 #include "esa-bottomup-maxpairs.inc"
 
-int gt_enumeratemaxpairs_generic(Sequentialsuffixarrayreader *ssar,
+static GtBUstate_maxpairs *gt_BUstate_maxpairs_new(
+                                 const Sequentialsuffixarrayreader *ssar,
                                  GtSainSufLcpIterator *suflcpiterator,
                                  unsigned int searchlength,
                                  GtProcessmaxpairs processmaxpairs,
-                                 void *processmaxpairsinfo,
-                                 GtError *err)
+                                 void *processmaxpairsinfo)
 {
   unsigned int base;
   GtArrayGtUword *ptr;
   GtBUstate_maxpairs *state;
-  bool haserr = false;
 
   state = gt_malloc(sizeof (*state));
   state->searchlength = searchlength;
   state->processmaxpairs = processmaxpairs;
   state->processmaxpairsinfo = processmaxpairsinfo;
   state->nextmaxfreq = 0;
+  state->lboffset = 0;
   state->initialized = false;
   if (ssar != NULL)
   {
@@ -523,10 +527,14 @@ int gt_enumeratemaxpairs_generic(Sequentialsuffixarrayreader *ssar,
     ptr = &state->poslist[base];
     GT_INITARRAY(ptr,GtUword);
   }
-  if (gt_esa_bottomup_maxpairs(ssar, suflcpiterator,  state, err) != 0)
-  {
-    haserr = true;
-  }
+  return state;
+}
+
+static void gt_BUstate_maxpairs_delete(GtBUstate_maxpairs *state)
+{
+  unsigned int base;
+  GtArrayGtUword *ptr;
+
   GT_FREEARRAY(&state->uniquechar,GtUword);
   for (base = 0; base < state->alphabetsize; base++)
   {
@@ -535,6 +543,25 @@ int gt_enumeratemaxpairs_generic(Sequentialsuffixarrayreader *ssar,
   }
   gt_free(state->poslist);
   gt_free(state);
+}
+
+int gt_enumeratemaxpairs_generic(Sequentialsuffixarrayreader *ssar,
+                                 GtSainSufLcpIterator *suflcpiterator,
+                                 unsigned int searchlength,
+                                 GtProcessmaxpairs processmaxpairs,
+                                 void *processmaxpairsinfo,
+                                 GtError *err)
+{
+  GtBUstate_maxpairs *state;
+  bool haserr = false;
+
+  state = gt_BUstate_maxpairs_new(ssar,suflcpiterator,searchlength,
+                                  processmaxpairs,processmaxpairsinfo);
+  if (gt_esa_bottomup_maxpairs(ssar, suflcpiterator,  state, err) != 0)
+  {
+    haserr = true;
+  }
+  gt_BUstate_maxpairs_delete(state);
   return haserr ? -1 : 0;
 }
 
@@ -568,6 +595,121 @@ int gt_enumeratemaxpairs_sain(GtSainSufLcpIterator *suflcpiterator,
                                       err);
 }
 
+typedef struct
+{
+  const Sequentialsuffixarrayreader *ssar;
+  unsigned int searchlength;
+  GtProcessmaxpairs processmaxpairs;
+  void **processmaxpairsinfotab;
+  const GtUword *partbounds;
+  GtError **errtab;
+  bool *haserrtab;
+} GtMaxpairsPartsinfo;
+
+static void gt_enumeratemaxpairs_range(GtUword start,GtUword end,void *data)
+{
+  const GtMaxpairsPartsinfo *partsinfo = (const GtMaxpairsPartsinfo *) data;
+  GtUword part;
+
+  for (part = start; part < end; part++)
+  {
+    const GtUword left = partsinfo->partbounds[part],
+                  width = partsinfo->partbounds[part+1] - left;
+    Sequentialsuffixarrayreader ssarpart;
+    GtBUstate_maxpairs *state;
+
+    if (width == 0)
+    {
+      continue;
+    }
+    gt_Sequentialsuffixarrayreader_part(&ssarpart,partsinfo->ssar,left,width);
+    state = gt_BUstate_maxpairs_new(&ssarpart,NULL,partsinfo->searchlength,
+                                    partsinfo->processmaxpairs,
+                                    partsinfo->processmaxpairsinfotab[part]);
+    state->lboffset = left;
+    if (gt_esa_bottomup_maxpairs(&ssarpart,NULL,state,
+                                 partsinfo->errtab[part]) != 0)
+    {
+      partsinfo->haserrtab[part] = true;
+    }
+    gt_BUstate_maxpairs_delete(state);
+  }
+}
+
+/* As no lcp-interval of depth at least <searchlength> contains two
+   consecutive suffixes with an lcp-value smaller than <searchlength>, the
+   suffix array is split at such positions into parts of about equal size,
+   which are independent subtrees of the lcp-interval tree as far as
+   maximal pairs are concerned. */
+static void gt_maxpairs_partbounds(GtUword *partbounds,
+                                   GtUword numofparts,
+                                   const Suffixarray *suffixarray,
+                                   GtUword nonspecials,
+                                   unsigned int searchlength)
+{
+  GtUword part;
+
+  partbounds[0] = 0;
+  for (part = 1; part < numofparts; part++)
+  {
+    GtUword bound = GT_MAX(partbounds[part-1],
+                           (nonspecials/numofparts) * part);
+
+    while (bound > 0 && bound < nonspecials &&
+           lcptable_get(suffixarray,bound) >= (GtUword) searchlength)
+    {
+      bound++;
+    }
+    partbounds[part] = bound;
+  }
+  partbounds[numofparts] = nonspecials;
+}
+
+int gt_enumeratemaxpairs_parts(Sequentialsuffixarrayreader *ssar,
+                               unsigned int searchlength,
+                               GtProcessmaxpairs processmaxpairs,
+                               void **processmaxpairsinfotab,
+                               GtUword numofparts,
+                               GtError *err)
+{
+  GtMaxpairsPartsinfo partsinfo;
+  GtUword *partbounds, part;
+  bool haserr = false;
+
+  gt_assert(ssar != NULL && !ssar->scanfile && numofparts > 0);
+  partbounds = gt_malloc(sizeof *partbounds * (numofparts + 1));
+  gt_maxpairs_partbounds(partbounds,numofparts,ssar->suffixarray,
+                         gt_Sequentialsuffixarrayreader_nonspecials(ssar),
+                         searchlength);
+  partsinfo.ssar = ssar;
+  partsinfo.searchlength = searchlength;
+  partsinfo.processmaxpairs = processmaxpairs;
+  partsinfo.processmaxpairsinfotab = processmaxpairsinfotab;
+  partsinfo.partbounds = partbounds;
+  partsinfo.errtab = gt_malloc(sizeof *partsinfo.errtab * numofparts);
+  partsinfo.haserrtab = gt_calloc((size_t) numofparts,
+                                  sizeof *partsinfo.haserrtab);
+  for (part = 0; part < numofparts; part++)
+  {
+    partsinfo.errtab[part] = gt_error_new();
+  }
+  gt_thread_pool_parallel_for(0,numofparts,1UL,gt_enumeratemaxpairs_range,
+                              &partsinfo);
+  for (part = 0; part < numofparts; part++)
+  {
+    if (!haserr && partsinfo.haserrtab[part])
+    {
+      gt_error_set(err,"%s",gt_error_get(partsinfo.errtab[part]));
+      haserr = true;
+    }
+    gt_error_delete(partsinfo.errtab[part]);
+  }
+  gt_free(partsinfo.errtab);
+  gt_free(partsinfo.haserrtab);
+  gt_free(partbounds);
+  return haserr ? -1 : 0;
+}
+
 static int collectmaxfreqintervals(void *data,const Lcpinterval *lcpitv)
 {
   GtMaxfreqcollect *maxfreqcollect = (GtMaxfreqcollect *) data;
@@ -629,14 +771,15 @@ void showcollectedintervals(const Lcpinterval *itvtab,GtUword num)
   }
 }
 
-int gt_callenummaxpairs(const char *indexname,
-                        unsigned int userdefinedleastlength,
-                        GtUword maxfreq,
-                        bool scanfile,
-                        GtProcessmaxpairs processmaxpairs,
-                        void *processmaxpairsinfo,
-                        GtLogger *logger,
-                        GtError *err)
+static int gt_callenummaxpairs_generic(const char *indexname,
+                                       unsigned int userdefinedleastlength,
+                                       GtUword maxfreq,
+                                       bool scanfile,
+                                       GtProcessmaxpairs processmaxpairs,
+                                       void **processmaxpairsinfotab,
+                                       GtUword numofparts,
+                                       GtLogger *logger,
+                                       GtError *err)
 {
   bool haserr = false;
   Sequentialsuffixarrayreader *ssar = NULL;
@@ -683,13 +826,27 @@ int gt_callenummaxpairs(const char *indexname,
       gt_assert(ssar != NULL);
       ssar->extrainfo = &maxfreqcollect;
     }
-    if (gt_enumeratemaxpairs(ssar,
-                             userdefinedleastlength,
-                             processmaxpairs,
-                             processmaxpairsinfo,
-                             err) != 0)
+    if (numofparts == 0)
     {
-      haserr = true;
+      if (gt_enumeratemaxpairs(ssar,
+                               userdefinedleastlength,
+                               processmaxpairs,
+                               processmaxpairsinfotab[0],
+                               err) != 0)
+      {
+        haserr = true;
+      }
+    } else
+    {
+      if (gt_enumeratemaxpairs_parts(ssar,
+                                     userdefinedleastlength,
+                                     processmaxpairs,
+                                     processmaxpairsinfotab,
+                                     numofparts,
+                                     err) != 0)
+      {
+        haserr = true;
+      }
     }
   }
   GT_FREEARRAY(&maxfreqcollect.arr,Lcpinterval);
@@ -699,3 +856,44 @@ int gt_callenummaxpairs(const char *indexname,
   }
   return haserr ? -1 : 0;
 }
+
+int gt_callenummaxpairs(const char *indexname,
+                        unsigned int userdefinedleastlength,
+                        GtUword maxfreq,
+                        bool scanfile,
+                        GtProcessmaxpairs processmaxpairs,
+                        void *processmaxpairsinfo,
+                        GtLogger *logger,
+                        GtError *err)
+{
+  return gt_callenummaxpairs_generic(indexname,
+                                     userdefinedleastlength,
+                                     maxfreq,
+                                     scanfile,
+                                     processmaxpairs,
+                                     &processmaxpairsinfo,
+                                     0,
+                                     logger,
+                                     err);
+}
+
+int gt_callenummaxpairs_parts(const char *indexname,
+                              unsigned int userdefinedleastlength,
+                              GtUword maxfreq,
+                              GtProcessmaxpairs processmaxpairs,
+                              void **processmaxpairsinfotab,
+                              GtUword numofparts,
+                              GtLogger *logger,
+                              GtError *err)
+{
+  gt_assert(numofparts > 0);
+  return gt_callenummaxpairs_generic(indexname,
+                                     userdefinedleastlength,
+                                     maxfreq,
+                                     false,
+                                     processmaxpairs,
+                                     processmaxpairsinfotab,
+                                     numofparts,
+                                     logger,
+                                     err);
+}
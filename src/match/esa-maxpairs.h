@@ -54,6 +54,19 @@ int gt_enumeratemaxpairs_sain(GtSainSufLcpIterator *suflcpiterator,
                               void *processmaxpairsinfo,
                               GtError *err);
 
+/* Enumerate the maximal pairs of length at least <searchlength> in
+   independent parts of the mapped suffix array of <ssar>, using the
+   threads of the pool. The pairs of the <i>-th part are delivered to
+   <processmaxpairs> with <processmaxpairsinfotab[i]>. Concatenating the
+   results of the parts in order gives the result of
+   <gt_enumeratemaxpairs>. */
+int gt_enumeratemaxpairs_parts(Sequentialsuffixarrayreader *ssar,
+                               unsigned int searchlength,
+                               GtProcessmaxpairs processmaxpairs,
+                               void **processmaxpairsinfotab,
+                               GtUword numofparts,
+                               GtError *err);
+
 int gt_callenummaxpairs(const char *indexname,
                         unsigned int userdefinedleastlength,
                         GtUword maxfreq,
@@ -63,4 +76,15 @@ int gt_callenummaxpairs(const char *indexname,
                         GtLogger *logger,
                         GtError *err);
 
+/* Like <gt_callenummaxpairs>, but maps the index and enumerates the
+   maximal pairs in <numofparts> parts, see <gt_enumeratemaxpairs_parts>. */
+int gt_callenummaxpairs_parts(const char *indexname,
+                              unsigned int userdefinedleastlength,
+                              GtUword maxfreq,
+                              GtProcessmaxpairs processmaxpairs,
+                              void **processmaxpairsinfotab,
+                              GtUword numofparts,
+                              GtLogger *logger,
+                              GtError *err);
+
 #endif
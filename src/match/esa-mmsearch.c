@@ -767,10 +767,11 @@ GtQuerysubstringmatchiterator *gt_querysubstringmatchiterator_new(
   qsmi->mmsi_defined = false;
   if (query_files == NULL || gt_str_array_size(query_files) == 0)
   {
-    gt_assert(query_encseq != NULL);
     qsmi->seqit = NULL;
     qsmi->query_encseq_numofsequences
-      = (uint64_t) gt_encseq_num_of_sequences(query_encseq);
+      = query_encseq == NULL
+          ? 0
+          : (uint64_t) gt_encseq_num_of_sequences(query_encseq);
   } else
   {
     gt_assert(query_encseq == NULL);
@@ -786,6 +787,25 @@ GtQuerysubstringmatchiterator *gt_querysubstringmatchiterator_new(
   return qsmi;
 }
 
+void gt_querysubstringmatchiterator_set_query(
+                                     GtQuerysubstringmatchiterator *qsmi,
+                                     uint64_t queryunitnum,
+                                     const GtUchar *query,
+                                     GtUword query_seqlen,
+                                     const char *desc)
+{
+  gt_assert(qsmi != NULL && qsmi->seqit == NULL &&
+            qsmi->queryrep.encseq == NULL && query_seqlen > 0);
+  qsmi->queryunitnum = queryunitnum;
+  qsmi->query_for_seqit = query;
+  qsmi->desc = (char *) desc;
+  qsmi->query_seqlen = query_seqlen;
+  qsmi->queryrep.sequence = query;
+  qsmi->queryrep.seqlen = query_seqlen;
+  qsmi->querysubstring.currentoffset = 0;
+  qsmi->mmsi_defined = false;
+}
+
 void gt_querysubstringmatchiterator_delete(GtQuerysubstringmatchiterator *qsmi)
 {
   if (qsmi != NULL)
@@ -872,9 +892,10 @@ int gt_querysubstringmatchiterator_next(GtQuerysubstringmatchiterator *qsmi,
         qsmi->queryrep.sequence = qsmi->query_for_seqit;
       } else
       {
-        if (qsmi->queryunitnum == qsmi->query_encseq_numofsequences)
+        if (qsmi->queryrep.encseq == NULL ||
+            qsmi->queryunitnum == qsmi->query_encseq_numofsequences)
         {
-          return 1;
+          return 1; /* no more sequences */
         }
         qsmi->queryrep.startpos = gt_encseq_seqstartpos(qsmi->queryrep.encseq,
                                                         qsmi->queryunitnum);
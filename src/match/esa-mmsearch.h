@@ -72,6 +72,17 @@ GtQuerysubstringmatchiterator *gt_querysubstringmatchiterator_new(
                                      unsigned int userdefinedleastlength,
                                      GtError *err);
 
+/* If neither <query_files> nor <query_encseq> are given to
+   <gt_querysubstringmatchiterator_new>, then the query sequences are
+   supplied one at a time by the following function. The sequence and its
+   description must stay valid while the matches are enumerated. */
+void gt_querysubstringmatchiterator_set_query(
+                                     GtQuerysubstringmatchiterator *qsmi,
+                                     uint64_t queryunitnum,
+                                     const GtUchar *query,
+                                     GtUword query_seqlen,
+                                     const char *desc);
+
 void gt_querysubstringmatchiterator_delete(GtQuerysubstringmatchiterator *qsmi);
 
 GtUword gt_querysubstringmatchiterator_dbstart(
@@ -222,3 +222,38 @@ unsigned int gt_Sequentialsuffixarrayreader_prefixlength(
   gt_assert(ssar != NULL && ssar->suffixarray != NULL);
   return ssar->suffixarray->prefixlength;
 }
+
+void gt_Sequentialsuffixarrayreader_part(Sequentialsuffixarrayreader *part,
+                                         const Sequentialsuffixarrayreader
+                                           *ssar,
+                                         GtUword start,
+                                         GtUword width)
+{
+  const Suffixarray *suffixarray;
+  GtUword left = 0, right;
+
+  gt_assert(ssar != NULL && !ssar->scanfile &&
+            start + width <= ssar->nonspecials);
+  *part = *ssar;
+  part->nonspecials = width;
+  part->nextsuftabindex = start;
+  part->nextlcptabindex = start + 1;
+  suffixarray = ssar->suffixarray;
+  right = suffixarray->numoflargelcpvalues.defined
+            ? suffixarray->numoflargelcpvalues.valueunsignedlong
+            : 0;
+  /* first large lcp-value at position start+1 or later */
+  while (left < right)
+  {
+    GtUword mid = left + GT_DIV2(right - left);
+
+    if (suffixarray->llvtab[mid].position <= start)
+    {
+      left = mid + 1;
+    } else
+    {
+      right = mid;
+    }
+  }
+  part->largelcpindex = left;
+}
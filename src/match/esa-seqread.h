@@ -248,4 +248,14 @@ GtUword gt_Sequentialsuffixarrayreader_maxbranchdepth(
 unsigned int gt_Sequentialsuffixarrayreader_prefixlength(
               const Sequentialsuffixarrayreader *ssar);
 
+/* Initialize <part> to read the suffixes <start>..<start>+<width>-1 of the
+   mapped suffix array of <ssar>. The lcp-values read are those of the
+   positions <start>+1..<start>+<width>. <part> shares the suffix array with
+   <ssar> and must not be freed. */
+void gt_Sequentialsuffixarrayreader_part(Sequentialsuffixarrayreader *part,
+                                         const Sequentialsuffixarrayreader
+                                           *ssar,
+                                         GtUword start,
+                                         GtUword width);
+
 #endif
@@ -32,6 +32,7 @@
 #include "core/minmax_api.h"
 #ifdef GT_THREADS_ENABLED
 #include "core/thread_api.h"
+#include "core/thread_pool.h"
 #endif
 #include "firstcodes-buf.h"
 #include "firstcodes-spacelog.h"
@@ -474,10 +475,9 @@ typedef struct
   GtFirstcodesintervalprocess_end itvprocess_end;
   void *itvprocessdata;
   GtError *err;
-  GtThread *thread;
 } GtSortRemainingThreadinfo;
 
-static void *gt_firstcodes_thread_caller_sortremaining(void *data)
+static void gt_firstcodes_thread_caller_sortremaining(void *data)
 {
   GtSortRemainingThreadinfo *threadinfo = (GtSortRemainingThreadinfo *) data;
 
@@ -500,7 +500,6 @@ static void *gt_firstcodes_thread_caller_sortremaining(void *data)
   {
     gt_assert(false);
   }
-  return NULL;
 }
 
 static int gt_firstcodes_thread_sortremaining(
@@ -528,7 +527,7 @@ static int gt_firstcodes_thread_sortremaining(
   unsigned int t;
   GtUword GT_UNUSED sum = 0, *endindexes;
   GtSortRemainingThreadinfo *threadinfo;
-  bool haserr = false;
+  GtThreadPoolGroup *group = gt_thread_pool_group_new();
 
   gt_assert(threads >= 2U);
   endindexes = gt_evenly_divide_part(fct,partminindex,partmaxindex,widthofpart,
@@ -577,26 +576,16 @@ static int gt_firstcodes_thread_sortremaining(
                                      threadinfo[t].sumofwidth,
                                      threadinfo[t].sumofwidth - lb);
     sum += threadinfo[t].sumofwidth - lb;
-    threadinfo[t].thread
-      = gt_thread_new (gt_firstcodes_thread_caller_sortremaining,
-                       threadinfo + t,err);
-    if (threadinfo[t].thread == NULL)
-    {
-      haserr = true;
-    }
-  }
-  gt_assert (haserr || sum == widthofpart);
-  for (t=0; t<threads; t++)
-  {
-    if (!haserr)
-    {
-      gt_thread_join(threadinfo[t].thread);
-    }
-    gt_thread_delete(threadinfo[t].thread);
+    gt_thread_pool_group_submit(group,
+                                gt_firstcodes_thread_caller_sortremaining,
+                                threadinfo + t);
   }
+  gt_assert(sum == widthofpart);
+  gt_thread_pool_group_wait(group);
+  gt_thread_pool_group_delete(group);
   gt_free(threadinfo);
   gt_free(endindexes);
-  return haserr ? -1 : 0;
+  return 0;
 }
 #endif
 
@@ -13,6 +13,7 @@
 #include "match/ft-polish.h"
 #include "match/ft-eoplist.h"
 #include "match/ft-front-prune.h"
+#include "match/bitpar-edist.h"
 
 #define DELETION_CHAR    'D'
 #define INSERTION_CHAR   'I'
@@ -50,6 +51,7 @@ struct GtEoplist
   GtArrayint trace;
   const GtFtPolishing_info *pol_info;
   GtFullFrontEdistTrace *fet_segment;
+  GtBitparEdist *bitpar_edist;
 };
 
 void gt_eoplist_reset(GtEoplist *eoplist)
@@ -78,6 +80,7 @@ GtEoplist *gt_eoplist_new(void)
   eoplist->pol_info = NULL;
   GT_INITARRAY(&eoplist->trace,int);
   eoplist->fet_segment = gt_full_front_edist_trace_new();
+  eoplist->bitpar_edist = gt_bitpar_edist_new();
   gt_eoplist_reset(eoplist);
   return eoplist;
 }
@@ -180,6 +183,7 @@ void gt_eoplist_delete(GtEoplist *eoplist)
   {
     GT_FREEARRAY(&eoplist->trace,int);
     gt_full_front_edist_trace_delete(eoplist->fet_segment);
+    gt_bitpar_edist_delete(eoplist->bitpar_edist);
     gt_free(eoplist->spaceuint8_t);
     gt_free(eoplist);
   }
@@ -586,14 +590,75 @@ void gt_eoplist_read_trace(GtEoplist *eoplist,
   }
 }
 
+/* The time for computing the full fronts of a segment grows with the
+   square of its distance, the time for the bit parallel computation with
+   the product of its length and the width of the band, which is at least
+   one machine word. Beyond the following distance the latter is faster.
+   The bound was determined by aligning random segments of length 50 to 3200
+   with error rates from 1% to 30%: up to a length of about 800 the break
+   even point is close to sqrt(1.5 * (aligned_u + aligned_v)), for longer
+   segments it grows linearly with about (aligned_u + aligned_v)/34. */
+static GtUword gt_eoplist_segment_maxfrontdistance(GtUword aligned_u,
+                                                   GtUword aligned_v)
+{
+  const GtUword sumlen = aligned_u + aligned_v;
+
+  return GT_MAX((GtUword) sqrt(1.5 * sumlen), sumlen/34);
+}
+
+GtUword gt_eoplist_segment_align(GtEoplist *eoplist,
+                                 const GtUchar *useq,
+                                 GtUword ulen,
+                                 const GtUchar *vseq,
+                                 GtUword vlen,
+                                 GtUword expected_distance)
+{
+  const GtUword maxfrontdistance
+    = gt_eoplist_segment_maxfrontdistance(ulen,vlen);
+  GtUword distance;
+
+  gt_assert(eoplist != NULL);
+  /* if the expected distance is too high, the computation of the fronts is
+     not even tried */
+  distance = expected_distance > maxfrontdistance
+               ? maxfrontdistance + 1
+               : gt_full_front_edist_trace_distance(eoplist->fet_segment,
+                                                    useq,
+                                                    ulen,
+                                                    vseq,
+                                                    vlen,
+                                                    maxfrontdistance);
+  if (distance <= maxfrontdistance)
+  {
+    gt_front_trace2eoplist_full_front_directed(eoplist,
+                                               gt_full_front_trace_get(
+                                                   eoplist->fet_segment),
+                                               distance,
+                                               useq,
+                                               ulen,
+                                               vseq,
+                                               vlen);
+  } else
+  {
+    distance = gt_bitpar_edist_trace_distance(eoplist->bitpar_edist,
+                                              useq,
+                                              ulen,
+                                              vseq,
+                                              vlen,
+                                              GT_UWORD_MAX);
+    gt_bitpar_edist_trace2eoplist(eoplist,eoplist->bitpar_edist,distance);
+  }
+  return distance;
+}
+
 void gt_eoplist_trace2cigar(GtEoplist *eoplist,bool dtrace,GtUword trace_delta)
 {
-  GtUword idx, offset_u = 0, offset_v = 0;
+  GtUword idx, offset_u = 0, offset_v = 0, previous_distance = 0;
 
   gt_assert(eoplist != NULL && eoplist->trace.nextfreeint > 0);
   for (idx = 0; idx < eoplist->trace.nextfreeint; idx++)
   {
-    GtUword this_distance, aligned_u, aligned_v;
+    GtUword aligned_u, aligned_v;
 
     if (dtrace)
     {
@@ -606,19 +671,13 @@ void gt_eoplist_trace2cigar(GtEoplist *eoplist,bool dtrace,GtUword trace_delta)
     }
     gt_assert(offset_u < eoplist->ulen);
     aligned_u = GT_MIN(trace_delta,eoplist->ulen - offset_u);
-    this_distance = gt_full_front_edist_trace_distance(eoplist->fet_segment,
-                                                       eoplist->useq + offset_u,
-                                                       aligned_u,
-                                                       eoplist->vseq + offset_v,
-                                                       aligned_v);
-    gt_front_trace2eoplist_full_front_directed(eoplist,
-                                               gt_full_front_trace_get(
-                                                   eoplist->fet_segment),
-                                               this_distance,
-                                               eoplist->useq + offset_u,
-                                               aligned_u,
-                                               eoplist->vseq + offset_v,
-                                               aligned_v);
+    /* the distance of the previous segment predicts the error rate */
+    previous_distance = gt_eoplist_segment_align(eoplist,
+                                                 eoplist->useq + offset_u,
+                                                 aligned_u,
+                                                 eoplist->vseq + offset_v,
+                                                 aligned_v,
+                                                 previous_distance);
     offset_u += aligned_u;
     offset_v += aligned_v;
   }
@@ -1321,6 +1380,21 @@ void gt_eoplist_verify(const GtEoplist *eoplist,
             edist,sumdist);
     exit(GT_EXIT_PROGRAMMING_ERROR);
   }
+  if (eoplist->useq != NULL)
+  {
+    /* no alignment can be cheaper than an optimal one */
+    const GtUword optimal_edist
+      = gt_bitpar_edist_distance(eoplist->bitpar_edist,
+                                 eoplist->useq,eoplist->ulen,
+                                 eoplist->vseq,eoplist->vlen,edist);
+
+    if (optimal_edist > edist)
+    {
+      fprintf(stderr,"edist = " GT_WU " is smaller than the edit distance "
+                     "of the aligned sequences\n",edist);
+      exit(GT_EXIT_PROGRAMMING_ERROR);
+    }
+  }
 }
 
 void gt_eoplist_display_seed_in_alignment_set(GtEoplist *eoplist)
@@ -201,6 +201,18 @@ void gt_eoplist_read_trace(GtEoplist *eoplist,
 
 void gt_eoplist_trace2cigar(GtEoplist *eoplist,bool dtrace,GtUword trace_delta);
 
+/* Append an optimal alignment of <useq> of length <ulen> and <vseq> of
+   length <vlen> to <eoplist> and return its unit edit distance. Segments
+   with a small distance are aligned over the full fronts, the others with
+   the bit parallel method. If <expected_distance> already exceeds the
+   distance up to which the fronts are faster, they are not tried. */
+GtUword gt_eoplist_segment_align(GtEoplist *eoplist,
+                                 const GtUchar *useq,
+                                 GtUword ulen,
+                                 const GtUchar *vseq,
+                                 GtUword vlen,
+                                 GtUword expected_distance);
+
 char *gt_eoplist2cigar_string(const GtEoplist *eoplist,
                               bool distinguish_mismatch_match);
 
@@ -1017,7 +1017,8 @@ GtUword gt_full_front_edist_trace_distance(GtFullFrontEdistTrace *fet,
                                            const GtUchar *useq,
                                            GtUword ulen,
                                            const GtUchar *vseq,
-                                           GtUword vlen)
+                                           GtUword vlen,
+                                           GtUword maxdistance)
 {
   const GtUword sumseqlength = ulen + vlen;
   GtUword distance;
@@ -1026,6 +1027,11 @@ GtUword gt_full_front_edist_trace_distance(GtFullFrontEdistTrace *fet,
   for (distance = 0; distance <= sumseqlength; distance++)
   {
     GtFtFrontvalue *basefront;
+
+    if (distance > maxdistance)
+    {
+      return distance;
+    }
     if (2 * distance >= fet->allocatedGtFtFrontvalue)
     {
       fet->allocatedGtFtFrontvalue = fet->allocatedGtFtFrontvalue * 1.2 + 32;
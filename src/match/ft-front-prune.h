@@ -69,10 +69,14 @@ void gt_full_front_edist_trace_delete(GtFullFrontEdistTrace *fet);
 
 GtFrontTrace *gt_full_front_trace_get(GtFullFrontEdistTrace *fet);
 
+/* Compute the fronts of the unit edit distance of <useq> and <vseq> and
+   return the distance. If it exceeds <maxdistance>, the computation stops
+   and <maxdistance>+1 is returned. */
 GtUword gt_full_front_edist_trace_distance(GtFullFrontEdistTrace *fet,
                                            const GtUchar *useq,
                                            GtUword ulen,
                                            const GtUchar *vseq,
-                                           GtUword vlen);
+                                           GtUword vlen,
+                                           GtUword maxdistance);
 
 #endif
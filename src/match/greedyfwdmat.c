@@ -27,8 +27,13 @@
 #include "core/encseq.h"
 #include "core/format64.h"
 #include "core/ma_api.h"
+#include "core/minmax_api.h"
+#include "core/str_api.h"
+#include "core/thread_pool.h"
+#include "core/xansi_api.h"
 #include "optionargmode.h"
 #include "greedyfwdmat.h"
+#include "querybatch.h"
 #include "initbasepower.h"
 
 typedef struct
@@ -40,21 +45,17 @@ typedef struct
                       maxlength;
 } Rangespecinfo;
 
-typedef void (*Preprocessgmatchlength)(uint64_t,
+typedef void (*Preprocessgmatchlength)(GtStr *,
+                                       uint64_t,
                                        const char *,
                                        void *);
-typedef void (*Processgmatchlength)(const GtAlphabet *,
+typedef void (*Processgmatchlength)(GtStr *,
+                                    const GtAlphabet *,
                                     const GtUchar *,
                                     GtUword,
                                     GtUword,
                                     GtUword,
                                     void *);
-typedef void (*Postprocessgmatchlength)(const GtAlphabet *,
-                                        uint64_t,
-                                        const char *,
-                                        const GtUchar *,
-                                        GtUword,
-                                        void *);
 
 typedef struct
 {
@@ -62,9 +63,10 @@ typedef struct
   GtUword totallength;
   const GtAlphabet *alphabet;
   Greedygmatchforwardfunction gmatchforward;
+  Greedygmatchnewviewfunction newindexview;
+  Greedygmatchdeleteviewfunction deleteindexview;
   Preprocessgmatchlength preprocessgmatchlength;
   Processgmatchlength processgmatchlength;
-  Postprocessgmatchlength postprocessgmatchlength;
   void *processinfo;
   const GtEncseq *encseq;
 } Substringinfo;
@@ -99,22 +101,19 @@ static void checkifsequenceisthere(const GtEncseq *encseq,
 }
 #endif
 
-static void gmatchposinsinglesequence(Substringinfo *substringinfo,
-                                      uint64_t unitnum,
+/* process the positions <firstpos> to <endpos>-1 of the query */
+static void gmatchposinsinglesequence(const Substringinfo *substringinfo,
+                                      const void *genericindex,
+                                      GtStr *outbuf,
                                       const GtUchar *query,
                                       GtUword querylen,
-                                      const char *desc)
+                                      GtUword firstpos,
+                                      GtUword endpos)
 {
   const GtUchar *qptr;
-  GtUword gmatchlength, remaining;
+  GtUword gmatchlength;
   GtUword witnessposition, *wptr;
 
-  if (substringinfo->preprocessgmatchlength != NULL)
-  {
-    substringinfo->preprocessgmatchlength(unitnum,
-                                          desc,
-                                          substringinfo->processinfo);
-  }
   if (((Rangespecinfo *) substringinfo->processinfo)->showsubjectpos ||
       substringinfo->encseq != NULL)
   {
@@ -123,9 +122,9 @@ static void gmatchposinsinglesequence(Substringinfo *substringinfo,
   {
     wptr = NULL;
   }
-  for (qptr = query, remaining = querylen; remaining > 0; qptr++, remaining--)
+  for (qptr = query + firstpos; qptr < query + endpos; qptr++)
   {
-    gmatchlength = substringinfo->gmatchforward(substringinfo->genericindex,
+    gmatchlength = substringinfo->gmatchforward(genericindex,
                                                 0,
                                                 0,
                                                 substringinfo->totallength,
@@ -144,7 +143,8 @@ static void gmatchposinsinglesequence(Substringinfo *substringinfo,
                                qptr);
       }
 #endif
-      substringinfo->processgmatchlength(substringinfo->alphabet,
+      substringinfo->processgmatchlength(outbuf,
+                                         substringinfo->alphabet,
                                          query,
                                          gmatchlength,
                                          (GtUword) (qptr-query),
@@ -154,30 +154,29 @@ static void gmatchposinsinglesequence(Substringinfo *substringinfo,
                                          substringinfo->processinfo);
     }
   }
-  if (substringinfo->postprocessgmatchlength != NULL)
-  {
-    substringinfo->postprocessgmatchlength(substringinfo->alphabet,
-                                           unitnum,
-                                           desc,
-                                           query,
-                                           querylen,
-                                           substringinfo->processinfo);
-  }
 }
 
-static void showunitnum(uint64_t unitnum,
+static void showunitnum(GtStr *outbuf,
+                        uint64_t unitnum,
                         const char *desc,
                         GT_UNUSED void *info)
 {
-  printf("unit " Formatuint64_t, PRINTuint64_tcast(unitnum));
+  char unitnumbuf[32];
+
+  (void) snprintf(unitnumbuf,sizeof unitnumbuf,"unit " Formatuint64_t,
+                  PRINTuint64_tcast(unitnum));
+  gt_str_append_cstr(outbuf,unitnumbuf);
   if (desc != NULL && desc[0] != '\0')
   {
-    printf(" (%s)",desc);
+    gt_str_append_cstr(outbuf," (");
+    gt_str_append_cstr(outbuf,desc);
+    gt_str_append_char(outbuf,')');
   }
-  printf("\n");
+  gt_str_append_char(outbuf,'\n');
 }
 
-static void showifinlengthrange(const GtAlphabet *alphabet,
+static void showifinlengthrange(GtStr *outbuf,
+                                const GtAlphabet *alphabet,
                                 const GtUchar *start,
                                 GtUword gmatchlength,
                                 GtUword querystart,
@@ -193,27 +192,181 @@ static void showifinlengthrange(const GtAlphabet *alphabet,
   {
     if (rangespecinfo->showquerypos)
     {
-      printf(""GT_WU" ",querystart);
+      gt_str_append_uword(outbuf,querystart);
+      gt_str_append_char(outbuf,' ');
     }
-    printf(""GT_WU"",gmatchlength);
+    gt_str_append_uword(outbuf,gmatchlength);
     if (rangespecinfo->showsubjectpos)
     {
-      printf(" "GT_WU"",subjectpos);
+      gt_str_append_char(outbuf,' ');
+      gt_str_append_uword(outbuf,subjectpos);
     }
     if (rangespecinfo->showsequence)
     {
-      (void) putchar(' ');
-      gt_alphabet_decode_seq_to_fp(alphabet,stdout,start + querystart,
-                                   gmatchlength);
+      const GtUchar *characters = gt_alphabet_characters(alphabet);
+      GtUword idx;
+
+      gt_str_append_char(outbuf,' ');
+      for (idx = querystart; idx < querystart + gmatchlength; idx++)
+      {
+        gt_str_append_char(outbuf,(char) characters[(int) start[idx]]);
+      }
     }
-    (void) putchar('\n');
+    gt_str_append_char(outbuf,'\n');
   }
 }
 
+/* Number of query positions processed by one task. */
+#define GFM_TASKLENGTH    4096UL
+
+/* Number of tasks whose output is collected before it is written. */
+#define GFM_TASKSPERROUND 256UL
+
+/* The query sequences of a batch are concatenated and the positions of
+   the concatenation are split into tasks of <GFM_TASKLENGTH> positions.
+   The output of a task is collected in its own buffer. */
+typedef struct
+{
+  const Substringinfo *substringinfo;
+  GtQuerybatch *querybatch;
+  GtUword numoftasks, firsttask;
+  GtStr *outbufs[GFM_TASKSPERROUND];
+  GtThreadPoolScratch *indexviews;
+} Gfmbatchinfo;
+
+static const void *gfm_indexview(Gfmbatchinfo *batchinfo)
+{
+  const Substringinfo *substringinfo = batchinfo->substringinfo;
+  void **indexview;
+
+  if (substringinfo->newindexview == NULL)
+  {
+    return substringinfo->genericindex;
+  }
+  indexview = (void **) gt_thread_pool_scratch_get(batchinfo->indexviews);
+  if (*indexview == NULL)
+  {
+    *indexview = substringinfo->newindexview(substringinfo->genericindex);
+  }
+  return *indexview;
+}
+
+/* the first query with positions at or after <pos>, or which is empty
+   and starts at <pos> */
+static GtUword gfm_firstquery(const Gfmbatchinfo *batchinfo,GtUword pos)
+{
+  const GtQuerybatchQuery *queries
+    = gt_querybatch_queries(batchinfo->querybatch);
+  GtUword left = 0, right = gt_querybatch_size(batchinfo->querybatch);
+
+  while (left < right)
+  {
+    GtUword mid = left + (right - left)/2;
+
+    if (queries[mid].offset + GT_MAX(queries[mid].length,1UL) > pos)
+    {
+      right = mid;
+    } else
+    {
+      left = mid + 1;
+    }
+  }
+  return left;
+}
+
+static void gfm_matchtasks(GtUword start,GtUword end,void *data)
+{
+  Gfmbatchinfo *batchinfo = (Gfmbatchinfo *) data;
+  const Substringinfo *substringinfo = batchinfo->substringinfo;
+  const void *genericindex = gfm_indexview(batchinfo);
+  const GtQuerybatch *querybatch = batchinfo->querybatch;
+  const GtUword numofqueries = gt_querybatch_size(querybatch),
+                sumoflengths = gt_querybatch_total_length(querybatch);
+  GtUword tasknum;
+
+  for (tasknum = start; tasknum < end; tasknum++)
+  {
+    GtStr *outbuf = batchinfo->outbufs[tasknum - batchinfo->firsttask];
+    const GtUword taskstart = tasknum * GFM_TASKLENGTH,
+                  taskend = GT_MIN(taskstart + GFM_TASKLENGTH,sumoflengths);
+    const bool lasttask = (tasknum + 1 == batchinfo->numoftasks);
+    GtUword qnum;
+
+    for (qnum = gfm_firstquery(batchinfo,taskstart); qnum < numofqueries;
+         qnum++)
+    {
+      const GtQuerybatchQuery *query = gt_querybatch_queries(querybatch)
+                                       + qnum;
+      GtUword firstpos, endpos;
+
+      if (query->offset > taskend || (query->offset == taskend && !lasttask))
+      {
+        break;
+      }
+      if (query->offset >= taskstart)
+      {
+        substringinfo->preprocessgmatchlength(outbuf,
+                                              query->unitnum,
+                                              gt_querybatch_description(
+                                                                  querybatch,
+                                                                  query),
+                                              substringinfo->processinfo);
+      }
+      firstpos = GT_MAX(taskstart,query->offset) - query->offset;
+      endpos = GT_MIN(taskend,query->offset + query->length) - query->offset;
+      if (firstpos < endpos)
+      {
+        gmatchposinsinglesequence(substringinfo,
+                                  genericindex,
+                                  outbuf,
+                                  gt_querybatch_sequence(querybatch,query),
+                                  query->length,
+                                  firstpos,
+                                  endpos);
+      }
+    }
+  }
+}
+
+static void gfm_batchflush(Gfmbatchinfo *batchinfo)
+{
+  const GtUword sumoflengths
+    = gt_querybatch_total_length(batchinfo->querybatch);
+  GtUword first, tasknum;
+
+  if (gt_querybatch_size(batchinfo->querybatch) == 0)
+  {
+    return;
+  }
+  batchinfo->numoftasks = sumoflengths == 0
+                            ? 1UL
+                            : (sumoflengths + GFM_TASKLENGTH - 1)/
+                              GFM_TASKLENGTH;
+  for (first = 0; first < batchinfo->numoftasks; first += GFM_TASKSPERROUND)
+  {
+    const GtUword last = GT_MIN(first + GFM_TASKSPERROUND,
+                                batchinfo->numoftasks);
+
+    batchinfo->firsttask = first;
+    gt_thread_pool_parallel_for(first,last,1UL,gfm_matchtasks,batchinfo);
+    for (tasknum = first; tasknum < last; tasknum++)
+    {
+      GtStr *outbuf = batchinfo->outbufs[tasknum - first];
+
+      gt_xfwrite(gt_str_get_mem(outbuf),sizeof (char),
+                 (size_t) gt_str_length(outbuf),stdout);
+      gt_str_reset(outbuf);
+    }
+  }
+  gt_querybatch_reset(batchinfo->querybatch);
+}
+
 int gt_findsubquerygmatchforward(const GtEncseq *encseq,
                               const void *genericindex,
                               GtUword totallength,
                               Greedygmatchforwardfunction gmatchforward,
+                              Greedygmatchnewviewfunction newindexview,
+                              Greedygmatchdeleteviewfunction deleteindexview,
                               const GtAlphabet *alphabet,
                               const GtStrArray *queryfilenames,
                               Definedunsignedlong minlength,
@@ -225,15 +378,17 @@ int gt_findsubquerygmatchforward(const GtEncseq *encseq,
 {
   Substringinfo substringinfo;
   Rangespecinfo rangespecinfo;
+  Gfmbatchinfo batchinfo;
   bool haserr = false;
   GtSeqIterator *seqit;
   const GtUchar *query;
-  GtUword querylen;
+  GtUword querylen, idx;
   char *desc = NULL;
   int retval;
   uint64_t unitnum;
 
   gt_error_check(err);
+  gt_assert((newindexview == NULL) == (deleteindexview == NULL));
   substringinfo.genericindex = genericindex;
   substringinfo.totallength = totallength;
   rangespecinfo.minlength = minlength;
@@ -243,16 +398,24 @@ int gt_findsubquerygmatchforward(const GtEncseq *encseq,
   rangespecinfo.showsubjectpos = showsubjectpos;
   substringinfo.preprocessgmatchlength = showunitnum;
   substringinfo.processgmatchlength = showifinlengthrange;
-  substringinfo.postprocessgmatchlength = NULL;
   substringinfo.alphabet = alphabet;
   substringinfo.processinfo = &rangespecinfo;
   substringinfo.gmatchforward = gmatchforward;
+  substringinfo.newindexview = newindexview;
+  substringinfo.deleteindexview = deleteindexview;
   substringinfo.encseq = encseq;
   seqit = gt_seq_iterator_sequence_buffer_new(queryfilenames, err);
   if (!seqit)
     haserr = true;
   if (!haserr)
   {
+    batchinfo.substringinfo = &substringinfo;
+    batchinfo.querybatch = gt_querybatch_new();
+    for (idx = 0; idx < GFM_TASKSPERROUND; idx++)
+    {
+      batchinfo.outbufs[idx] = gt_str_new();
+    }
+    batchinfo.indexviews = gt_thread_pool_scratch_new(sizeof (void *));
     gt_seq_iterator_set_symbolmap(seqit, gt_alphabet_symbolmap(alphabet));
     for (unitnum = 0; /* Nothing */; unitnum++)
     {
@@ -270,12 +433,34 @@ int gt_findsubquerygmatchforward(const GtEncseq *encseq,
       {
         break;
       }
-      gmatchposinsinglesequence(&substringinfo,
-                                unitnum,
-                                query,
-                                querylen,
-                                desc);
+      gt_querybatch_add(batchinfo.querybatch,unitnum,query,querylen,desc);
+      if (gt_querybatch_is_full(batchinfo.querybatch))
+      {
+        gfm_batchflush(&batchinfo);
+      }
+    }
+    /* the queries preceding an erroneous query are reported */
+    gfm_batchflush(&batchinfo);
+    if (deleteindexview != NULL)
+    {
+      for (idx = 0; idx < (GtUword) gt_thread_pool_scratch_size(
+                                               batchinfo.indexviews); idx++)
+      {
+        void *indexview = *(void **) gt_thread_pool_scratch_get_by_id(
+                                                  batchinfo.indexviews,
+                                                  (unsigned int) idx);
+        if (indexview != NULL)
+        {
+          deleteindexview(indexview);
+        }
+      }
+    }
+    gt_thread_pool_scratch_delete(batchinfo.indexviews);
+    for (idx = 0; idx < GFM_TASKSPERROUND; idx++)
+    {
+      gt_str_delete(batchinfo.outbufs[idx]);
     }
+    gt_querybatch_delete(batchinfo.querybatch);
     gt_seq_iterator_delete(seqit);
   }
   return haserr ? -1 : 0;
@@ -35,10 +35,17 @@ typedef GtUword (*Greedygmatchforwardfunction) (const void *,
                                                       const GtUchar *,
                                                       const GtUchar *);
 
+/* If the index is modified when it is searched, then a view of it is
+   created for each thread matching the query sequences. */
+typedef void *(*Greedygmatchnewviewfunction) (const void *);
+typedef void (*Greedygmatchdeleteviewfunction) (void *);
+
 int gt_findsubquerygmatchforward(const GtEncseq *encseq,
                               const void *genericindex,
                               GtUword totallength,
                               Greedygmatchforwardfunction gmatchforward,
+                              Greedygmatchnewviewfunction newindexview,
+                              Greedygmatchdeleteviewfunction deleteindexview,
                               const GtAlphabet *alphabet,
                               const GtStrArray *queryfilenames,
                               Definedunsignedlong minlength,
@@ -80,6 +80,7 @@ struct GtIndexOptions
            *optionalgbounds,
            *optionparts,
            *optionmemlimit,
+           *optionsain,
            *optiondifferencecover,
            *optionuserdefinedsortmaxdepth,
            *optionkys;
@@ -112,6 +113,7 @@ static GtIndexOptions* gt_index_options_new(void)
   oi->optionoutsuftab = NULL;
   oi->optionparts = NULL;
   oi->optionprefixlength = NULL;
+  oi->optionsain = NULL;
   oi->optionspmopt = NULL;
   oi->optionstorespecialcodes = NULL;
   oi->outbcktab = false;
@@ -335,6 +337,10 @@ gt_index_options_register_generic_output(GtOptionParser *op,
                                 &idxo->outbcktab,
                                 false);
     gt_option_parser_add_option(op, idxo->optionoutbcktab);
+    if (idxo->optionsain != NULL)
+    {
+      gt_option_exclude(idxo->optionsain, idxo->optionoutbcktab);
+    }
   } else {
     idxo->optionoutsuftab
       = idxo->optionoutlcptab = idxo->optionoutbwttab = NULL;
@@ -456,6 +462,19 @@ static GtIndexOptions* gt_index_options_register_generic_create(
                            idxo->memlimit, NULL);
     gt_option_parser_add_option(op, idxo->optionmemlimit);
     gt_option_exclude(idxo->optionmemlimit, idxo->optionparts);
+
+    idxo->optionsain = gt_option_new_bool("sain",
+                                          "sort all suffixes by induced "
+                                          "suffix sorting (in parallel, if "
+                                          "more than one thread is used)",
+                                          &idxo->sfxstrategy.withsain,
+                                          false);
+    gt_option_parser_add_option(op, idxo->optionsain);
+    gt_option_exclude(idxo->optionsain, idxo->optionspmopt);
+    gt_option_exclude(idxo->optionsain, idxo->optionmemlimit);
+    gt_option_exclude(idxo->optionsain, idxo->optionparts);
+    gt_option_exclude(idxo->optionsain, idxo->optiondifferencecover);
+    gt_option_exclude(idxo->optionsain, idxo->optionuserdefinedsortmaxdepth);
   }
 
   idxo->option = gt_option_new_bool("iterscan",
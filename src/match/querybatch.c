@@ -0,0 +1,140 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <string.h>
+#include "core/arraydef_api.h"
+#include "core/assert_api.h"
+#include "core/ma_api.h"
+#include "match/querybatch.h"
+
+/* Number of query residues read before they are matched in parallel. */
+#define GT_QUERYBATCH_LENGTH   (1UL << 22)
+
+/* Maximal number of query sequences read before they are matched. */
+#define GT_QUERYBATCH_QUERIES  4096UL
+
+GT_DECLAREARRAYSTRUCT(GtQuerybatchQuery);
+
+struct GtQuerybatch
+{
+  GtArrayGtQuerybatchQuery queries;
+  GtArrayGtUchar sequences;
+  GtArraychar descriptions;
+};
+
+GtQuerybatch *gt_querybatch_new(void)
+{
+  GtQuerybatch *querybatch = gt_malloc(sizeof *querybatch);
+
+  GT_INITARRAY(&querybatch->queries,GtQuerybatchQuery);
+  GT_INITARRAY(&querybatch->sequences,GtUchar);
+  GT_INITARRAY(&querybatch->descriptions,char);
+  return querybatch;
+}
+
+void gt_querybatch_delete(GtQuerybatch *querybatch)
+{
+  if (querybatch != NULL)
+  {
+    GT_FREEARRAY(&querybatch->queries,GtQuerybatchQuery);
+    GT_FREEARRAY(&querybatch->sequences,GtUchar);
+    GT_FREEARRAY(&querybatch->descriptions,char);
+    gt_free(querybatch);
+  }
+}
+
+void gt_querybatch_add(GtQuerybatch *querybatch,
+                       uint64_t unitnum,
+                       const GtUchar *query,
+                       GtUword querylen,
+                       const char *desc)
+{
+  GtQuerybatchQuery *newquery;
+  const GtUword desclen = (desc == NULL) ? 0 : (GtUword) strlen(desc);
+
+  gt_assert(querybatch != NULL);
+  GT_GETNEXTFREEINARRAY(newquery,&querybatch->queries,GtQuerybatchQuery,
+                        GT_QUERYBATCH_QUERIES);
+  newquery->offset = querybatch->sequences.nextfreeGtUchar;
+  newquery->length = querylen;
+  newquery->descoffset = querybatch->descriptions.nextfreechar;
+  newquery->unitnum = unitnum;
+  GT_CHECKARRAYSPACE_GENERIC(&querybatch->sequences,GtUchar,querylen,
+                             querylen + querybatch->sequences.allocatedGtUchar);
+  memcpy(querybatch->sequences.spaceGtUchar +
+         querybatch->sequences.nextfreeGtUchar,query,
+         sizeof *query * querylen);
+  querybatch->sequences.nextfreeGtUchar += querylen;
+  GT_CHECKARRAYSPACE_GENERIC(&querybatch->descriptions,char,desclen + 1,
+                             desclen + 1 +
+                             querybatch->descriptions.allocatedchar);
+  if (desclen > 0)
+  {
+    memcpy(querybatch->descriptions.spacechar +
+           querybatch->descriptions.nextfreechar,desc,sizeof *desc * desclen);
+  }
+  querybatch->descriptions.spacechar[querybatch->descriptions.nextfreechar +
+                                     desclen] = '\0';
+  querybatch->descriptions.nextfreechar += desclen + 1;
+}
+
+bool gt_querybatch_is_full(const GtQuerybatch *querybatch)
+{
+  gt_assert(querybatch != NULL);
+  return querybatch->sequences.nextfreeGtUchar >= GT_QUERYBATCH_LENGTH ||
+         querybatch->queries.nextfreeGtQuerybatchQuery
+           == GT_QUERYBATCH_QUERIES;
+}
+
+void gt_querybatch_reset(GtQuerybatch *querybatch)
+{
+  gt_assert(querybatch != NULL);
+  querybatch->queries.nextfreeGtQuerybatchQuery = 0;
+  querybatch->sequences.nextfreeGtUchar = 0;
+  querybatch->descriptions.nextfreechar = 0;
+}
+
+GtUword gt_querybatch_size(const GtQuerybatch *querybatch)
+{
+  gt_assert(querybatch != NULL);
+  return querybatch->queries.nextfreeGtQuerybatchQuery;
+}
+
+const GtQuerybatchQuery *gt_querybatch_queries(const GtQuerybatch *querybatch)
+{
+  gt_assert(querybatch != NULL);
+  return querybatch->queries.spaceGtQuerybatchQuery;
+}
+
+GtUword gt_querybatch_total_length(const GtQuerybatch *querybatch)
+{
+  gt_assert(querybatch != NULL);
+  return querybatch->sequences.nextfreeGtUchar;
+}
+
+const GtUchar *gt_querybatch_sequence(const GtQuerybatch *querybatch,
+                                      const GtQuerybatchQuery *query)
+{
+  gt_assert(querybatch != NULL && query != NULL);
+  return querybatch->sequences.spaceGtUchar + query->offset;
+}
+
+const char *gt_querybatch_description(const GtQuerybatch *querybatch,
+                                      const GtQuerybatchQuery *query)
+{
+  gt_assert(querybatch != NULL && query != NULL);
+  return querybatch->descriptions.spacechar + query->descoffset;
+}
@@ -0,0 +1,76 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef QUERYBATCH_H
+#define QUERYBATCH_H
+
+#include <stdbool.h>
+#include <inttypes.h>
+#include "core/types_api.h"
+
+/* A batch of query sequences read from a sequence iterator, which are
+   matched in parallel once the batch is full. The sequences and their
+   descriptions are copied, as the buffers of the iterator are reused. */
+typedef struct GtQuerybatch GtQuerybatch;
+
+typedef struct
+{
+  GtUword offset,     /* of the sequence in the concatenation of the batch */
+          length,
+          descoffset;
+  uint64_t unitnum;   /* number of the sequence in the query files */
+} GtQuerybatchQuery;
+
+GtQuerybatch*            gt_querybatch_new(void);
+void                     gt_querybatch_delete(GtQuerybatch *querybatch);
+
+/* Add the sequence <query> of length <querylen> with description <desc>
+   (which may be NULL) as sequence <unitnum> to <querybatch>. */
+void                     gt_querybatch_add(GtQuerybatch *querybatch,
+                                           uint64_t unitnum,
+                                           const GtUchar *query,
+                                           GtUword querylen,
+                                           const char *desc);
+
+/* Return true if the batch has reached the number of sequences or the total
+   length after which it is to be matched. */
+bool                     gt_querybatch_is_full(const GtQuerybatch *querybatch);
+
+/* Remove all sequences from <querybatch>. */
+void                     gt_querybatch_reset(GtQuerybatch *querybatch);
+
+GtUword                  gt_querybatch_size(const GtQuerybatch *querybatch);
+
+/* Return the array of the <gt_querybatch_size()> queries, ordered by their
+   offsets. */
+const GtQuerybatchQuery* gt_querybatch_queries(const GtQuerybatch
+                                                 *querybatch);
+
+/* Return the sum of the lengths of the sequences in <querybatch>. */
+GtUword                  gt_querybatch_total_length(const GtQuerybatch
+                                                      *querybatch);
+
+const GtUchar*           gt_querybatch_sequence(const GtQuerybatch
+                                                  *querybatch,
+                                                const GtQuerybatchQuery
+                                                  *query);
+
+const char*              gt_querybatch_description(const GtQuerybatch
+                                                     *querybatch,
+                                                   const GtQuerybatchQuery
+                                                     *query);
+
+#endif
@@ -221,27 +221,100 @@ void gt_querymatchoutoptions_delete(
   }
 }
 
+static void gt_querymatchoutoptions_set_sequences(GtQuerymatchoutoptions
+                                             *querymatchoutoptions,
+                                           GtUword dbstart_relative,
+                                           GtUword dblen,
+                                           GtUword querystart,
+                                           GtUword querylen,
+                                           bool withcorrection)
+{
+  gt_assert(querymatchoutoptions != NULL);
+
+  if (withcorrection)
+  {
+    gt_eoplist_set_sequences(querymatchoutoptions->eoplist,
+                             querymatchoutoptions->useqbuffer +
+                               querymatchoutoptions->correction_info.uoffset,
+                             dbstart_relative +
+                               querymatchoutoptions->correction_info.uoffset,
+                             querymatchoutoptions->correction_info.ulen,
+                             querymatchoutoptions->vseqbuffer +
+                               querymatchoutoptions->correction_info.voffset,
+                             querystart +
+                               querymatchoutoptions->correction_info.voffset,
+                             querymatchoutoptions->correction_info.vlen);
+  } else
+  {
+    gt_eoplist_set_sequences(querymatchoutoptions->eoplist,
+                             querymatchoutoptions->useqbuffer,
+                             dbstart_relative,
+                             dblen,
+                             querymatchoutoptions->vseqbuffer,
+                             querystart,
+                             querylen);
+  }
+}
+
+/* Set the sequences of the eoplist to the aligned substrings of the
+   sequences extracted by <gt_querymatchoutoptions_extract_seq()> and
+   verify the alignment against them, including the check that its distance
+   is not larger than their edit distance. */
 static void gt_querymtch_alignment_verification(
             GtQuerymatchoutoptions *querymatchoutoptions,
-            GtUword dbstart,
+            GtUword dbstart_relative,
             GtUword dblen,
-            GtUword abs_querystart,
+            GtUword querystart,
             GtUword querylen,
-            GtUword sumdist)
+            bool verify_alignment)
 {
-  if (querymatchoutoptions->eoplist_reader_verify == NULL)
+  gt_querymatchoutoptions_set_sequences(querymatchoutoptions,
+                                        dbstart_relative,
+                                        dblen,
+                                        querystart,
+                                        querylen,
+                                        true);
+  if (verify_alignment)
   {
-    querymatchoutoptions->eoplist_reader_verify = gt_eoplist_reader_new();
+    if (querymatchoutoptions->eoplist_reader_verify == NULL)
+    {
+      querymatchoutoptions->eoplist_reader_verify = gt_eoplist_reader_new();
+    }
+    gt_eoplist_verify(querymatchoutoptions->eoplist,
+                      querymatchoutoptions->eoplist_reader_verify,
+                      querymatchoutoptions->correction_info.sumdist);
   }
-  gt_eoplist_set_sequences(querymatchoutoptions->eoplist,NULL,
-                           dbstart,
-                           dblen,
-                           NULL,
-                           abs_querystart,
-                           querylen);
-  gt_eoplist_verify(querymatchoutoptions->eoplist,
-                    querymatchoutoptions->eoplist_reader_verify,
-                    sumdist);
+}
+
+/* If the ends of the alignment need not be polished, the extension only
+   determines the end point given by <best_polished_point>. Then an optimal
+   alignment of the substrings of length <best_polished_point->row> and
+   <best_polished_point->alignedlen - best_polished_point->row>, beginning
+   at <useq> and <vseq>, is computed over the full fronts or with the bit
+   parallel method, depending on the distance of the extension. It is
+   appended to the eoplist in reverse order, like the traceback over the
+   fronts of the extension does, and its distance is returned. */
+static GtUword gt_querymatchoutoptions_extension2eoplist(
+                                GtQuerymatchoutoptions *querymatchoutoptions,
+                                const GtFtPolished_point *best_polished_point,
+                                const GtUchar *useq,
+                                const GtUchar *vseq)
+{
+  const GtUword previous_eoplistlen
+    = gt_eoplist_length(querymatchoutoptions->eoplist);
+  GtUword distance;
+
+  gt_assert(best_polished_point->alignedlen >= best_polished_point->row);
+  distance = gt_eoplist_segment_align(querymatchoutoptions->eoplist,
+                                      useq,
+                                      best_polished_point->row,
+                                      vseq,
+                                      best_polished_point->alignedlen -
+                                        best_polished_point->row,
+                                      best_polished_point->distance);
+  gt_assert(distance <= best_polished_point->distance);
+  gt_eoplist_reverse_end(querymatchoutoptions->eoplist,previous_eoplistlen);
+  return distance;
 }
 
 void gt_querymatchoutoptions_seededmatch2eoplist(
@@ -268,10 +341,16 @@ void gt_querymatchoutoptions_seededmatch2eoplist(
   GtUword pol_size;
   GtSeqpaircoordinates *coords;
   GtUword leftcolumn, rightcolumn;
+  GtFrontTrace *front_trace;
 
   gt_assert(querymatchoutoptions != NULL &&
-            querymatchoutoptions->pol_info != NULL);
+            querymatchoutoptions->pol_info != NULL &&
+            querymatchoutoptions->useqbuffer != NULL &&
+            querymatchoutoptions->vseqbuffer != NULL);
   pol_size = GT_MULT2(querymatchoutoptions->pol_info->cut_depth);
+  front_trace = querymatchoutoptions->always_polished_ends
+                  ? querymatchoutoptions->front_trace
+                  : NULL;
   gt_eoplist_reset(querymatchoutoptions->eoplist);
   ustart = db_seedpos_rel + seedlen;
   vstart = query_seedpos_rel + seedlen;
@@ -283,7 +362,7 @@ void gt_querymatchoutoptions_seededmatch2eoplist(
   {
     gt_align_front_prune_edist(true,
                                &right_best_polished_point,
-                               querymatchoutoptions->front_trace,
+                               front_trace,
                                dbes,
                                queryes,
                                query_readmode,
@@ -296,11 +375,11 @@ void gt_querymatchoutoptions_seededmatch2eoplist(
                                ulen,
                                query_seqstart + vstart,
                                vlen);
-    if (querymatchoutoptions->front_trace != NULL)
+    if (front_trace != NULL)
     {
       front_trace2eoplist(querymatchoutoptions->always_polished_ends,
                           querymatchoutoptions->eoplist,
-                          querymatchoutoptions->front_trace,
+                          front_trace,
                           &right_best_polished_point,
                           pol_size,
                           querymatchoutoptions->pol_info->match_score,
@@ -309,7 +388,17 @@ void gt_querymatchoutoptions_seededmatch2eoplist(
                           ulen,
                           NULL,
                           vlen);
-      front_trace_reset(querymatchoutoptions->front_trace,ulen+vlen);
+      front_trace_reset(front_trace,ulen+vlen);
+    } else
+    {
+      right_best_polished_point.distance
+        = gt_querymatchoutoptions_extension2eoplist(
+                                querymatchoutoptions,
+                                &right_best_polished_point,
+                                querymatchoutoptions->useqbuffer +
+                                  (ustart - dbstart_relative),
+                                querymatchoutoptions->vseqbuffer +
+                                  (vstart - querystart_rel));
     }
   }
   gt_eoplist_match_add(querymatchoutoptions->eoplist,seedlen);
@@ -319,7 +408,7 @@ void gt_querymatchoutoptions_seededmatch2eoplist(
     vlen = query_seedpos_rel - querystart_rel;
     gt_align_front_prune_edist(false,
                                &left_best_polished_point,
-                               querymatchoutoptions->front_trace,
+                               front_trace,
                                dbes,
                                queryes,
                                query_readmode,
@@ -332,13 +421,13 @@ void gt_querymatchoutoptions_seededmatch2eoplist(
                                ulen,
                                query_seqstart + querystart_rel,
                                vlen);
-    if (querymatchoutoptions->front_trace != NULL)
+    if (front_trace != NULL)
     {
       GtUword previous_eoplistlen
         = gt_eoplist_length(querymatchoutoptions->eoplist);
       front_trace2eoplist(querymatchoutoptions->always_polished_ends,
                           querymatchoutoptions->eoplist,
-                          querymatchoutoptions->front_trace,
+                          front_trace,
                           &left_best_polished_point,
                           pol_size,
                           querymatchoutoptions->pol_info->match_score,
@@ -348,7 +437,18 @@ void gt_querymatchoutoptions_seededmatch2eoplist(
                           NULL,
                           vlen);
       gt_eoplist_reverse_end(querymatchoutoptions->eoplist,previous_eoplistlen);
-      front_trace_reset(querymatchoutoptions->front_trace,ulen+vlen);
+      front_trace_reset(front_trace,ulen+vlen);
+    } else
+    {
+      left_best_polished_point.distance
+        = gt_querymatchoutoptions_extension2eoplist(
+                                querymatchoutoptions,
+                                &left_best_polished_point,
+                                querymatchoutoptions->useqbuffer + ulen -
+                                  left_best_polished_point.row,
+                                querymatchoutoptions->vseqbuffer + vlen -
+                                  (left_best_polished_point.alignedlen -
+                                   left_best_polished_point.row));
     }
   }
   coords = &querymatchoutoptions->correction_info;
@@ -369,15 +469,12 @@ void gt_querymatchoutoptions_seededmatch2eoplist(
   coords->sum_max_mismatches = left_best_polished_point.max_mismatches +
                                right_best_polished_point.max_mismatches;
   gt_eoplist_reverse_end(querymatchoutoptions->eoplist,0);
-  if (verify_alignment)
-  {
-    gt_querymtch_alignment_verification(querymatchoutoptions,
-                                        db_seqstart + dbstart_relative,
-                                        coords->ulen,
-                                        query_seqstart + querystart_rel,
-                                        coords->vlen,
-                                        coords->sumdist);
-  }
+  gt_querymtch_alignment_verification(querymatchoutoptions,
+                                      dbstart_relative,
+                                      dblen,
+                                      querystart_rel,
+                                      querylen,
+                                      verify_alignment);
   gt_eoplist_set_seedoffset(querymatchoutoptions->eoplist,
                             db_seedpos_rel - dbstart_relative,
                             seedlen);
@@ -385,6 +482,7 @@ void gt_querymatchoutoptions_seededmatch2eoplist(
 
 void gt_frontprune2eoplist(GtQuerymatchoutoptions *querymatchoutoptions,
                            const GtSeqorEncseq *dbes,
+                           GtUword dbstart_relative,
                            GtUword dbstart,
                            GtUword dblen,
                            const GtSeqorEncseq *queryes,
@@ -398,16 +496,23 @@ void gt_frontprune2eoplist(GtQuerymatchoutoptions *querymatchoutoptions,
   GtFtPolished_point right_best_polished_point = {0,0,0,0,0};
   GtUword pol_size;
   GtSeqpaircoordinates *coords;
+  GtFrontTrace *front_trace;
   const bool greedyextension = true, rightextension = true;
 
   gt_assert(querymatchoutoptions != NULL &&
-            querymatchoutoptions->pol_info != NULL);
+            querymatchoutoptions->pol_info != NULL &&
+            querymatchoutoptions->front_trace != NULL &&
+            querymatchoutoptions->useqbuffer != NULL &&
+            querymatchoutoptions->vseqbuffer != NULL);
   pol_size = GT_MULT2(querymatchoutoptions->pol_info->cut_depth);
+  front_trace = querymatchoutoptions->always_polished_ends
+                  ? querymatchoutoptions->front_trace
+                  : NULL;
   gt_eoplist_reset(querymatchoutoptions->eoplist);
   gt_assert(dblen > 0 && querylen > 0);
   gt_align_front_prune_edist(rightextension,
                              &right_best_polished_point,
-                             querymatchoutoptions->front_trace,
+                             front_trace,
                              dbes,
                              queryes,
                              query_readmode,
@@ -420,20 +525,30 @@ void gt_frontprune2eoplist(GtQuerymatchoutoptions *querymatchoutoptions,
                              dblen,
                              query_seqstart + querystart,
                              querylen);
-  gt_assert(querymatchoutoptions->front_trace != NULL);
-  front_trace2eoplist(querymatchoutoptions->always_polished_ends,
-                      querymatchoutoptions->eoplist,
-                      querymatchoutoptions->front_trace,
-                      &right_best_polished_point,
-                      pol_size,
-                      querymatchoutoptions->pol_info->match_score,
-                      querymatchoutoptions->pol_info->difference_score,
-                      NULL,
-                      dblen,
-                      NULL,
-                      querylen);
+  if (front_trace != NULL)
+  {
+    front_trace2eoplist(querymatchoutoptions->always_polished_ends,
+                        querymatchoutoptions->eoplist,
+                        front_trace,
+                        &right_best_polished_point,
+                        pol_size,
+                        querymatchoutoptions->pol_info->match_score,
+                        querymatchoutoptions->pol_info->difference_score,
+                        NULL,
+                        dblen,
+                        NULL,
+                        querylen);
+    front_trace_reset(front_trace,dblen+querylen);
+  } else
+  {
+    right_best_polished_point.distance
+      = gt_querymatchoutoptions_extension2eoplist(
+                                querymatchoutoptions,
+                                &right_best_polished_point,
+                                querymatchoutoptions->useqbuffer,
+                                querymatchoutoptions->vseqbuffer);
+  }
   gt_eoplist_reverse_end(querymatchoutoptions->eoplist,0);
-  front_trace_reset(querymatchoutoptions->front_trace,dblen+querylen);
   coords = &querymatchoutoptions->correction_info;
   coords->uoffset = 0;
   coords->ulen = right_best_polished_point.row;
@@ -442,50 +557,12 @@ void gt_frontprune2eoplist(GtQuerymatchoutoptions *querymatchoutoptions,
                  right_best_polished_point.row;
   coords->sumdist = right_best_polished_point.distance;
   coords->sum_max_mismatches = right_best_polished_point.max_mismatches;
-  if (verify_alignment)
-  {
-    gt_querymtch_alignment_verification(querymatchoutoptions,
-                                        dbstart,
-                                        coords->ulen,
-                                        query_seqstart + querystart,
-                                        coords->vlen,
-                                        coords->sumdist);
-  }
-}
-
-static void gt_querymatchoutoptions_set_sequences(GtQuerymatchoutoptions
-                                             *querymatchoutoptions,
-                                           GtUword dbstart_relative,
-                                           GtUword dblen,
-                                           GtUword querystart,
-                                           GtUword querylen,
-                                           bool withcorrection)
-{
-  gt_assert(querymatchoutoptions != NULL);
-
-  if (withcorrection)
-  {
-    gt_eoplist_set_sequences(querymatchoutoptions->eoplist,
-                             querymatchoutoptions->useqbuffer +
-                               querymatchoutoptions->correction_info.uoffset,
-                             dbstart_relative +
-                               querymatchoutoptions->correction_info.uoffset,
-                             querymatchoutoptions->correction_info.ulen,
-                             querymatchoutoptions->vseqbuffer +
-                               querymatchoutoptions->correction_info.voffset,
-                             querystart +
-                               querymatchoutoptions->correction_info.voffset,
-                             querymatchoutoptions->correction_info.vlen);
-  } else
-  {
-    gt_eoplist_set_sequences(querymatchoutoptions->eoplist,
-                             querymatchoutoptions->useqbuffer,
-                             dbstart_relative,
-                             dblen,
-                             querymatchoutoptions->vseqbuffer,
-                             querystart,
-                             querylen);
-  }
+  gt_querymtch_alignment_verification(querymatchoutoptions,
+                                      dbstart_relative,
+                                      dblen,
+                                      querystart,
+                                      querylen,
+                                      verify_alignment);
 }
 
 void gt_querymatchoutoptions_extract_seq(GtQuerymatchoutoptions
@@ -706,3 +783,10 @@ GtEoplist *gt_querymatchoutoptions_eoplist(const GtQuerymatchoutoptions
   }
   return NULL;
 }
+
+bool gt_querymatchoutoptions_optimal_extensions(const GtQuerymatchoutoptions
+                                                  *querymatchoutoptions)
+{
+  gt_assert(querymatchoutoptions != NULL);
+  return !querymatchoutoptions->always_polished_ends;
+}
@@ -66,6 +66,7 @@ void gt_querymatchoutoptions_delete(
 
 void gt_frontprune2eoplist(GtQuerymatchoutoptions *querymatchoutoptions,
                            const GtSeqorEncseq *dbes,
+                           GtUword dbstart_relative,
                            GtUword dbstart,
                            GtUword dblen,
                            const GtSeqorEncseq *queryes,
@@ -144,4 +145,11 @@ void gt_querymatchoutoptions_seededmatch2eoplist(
 GtEoplist *gt_querymatchoutoptions_eoplist(const GtQuerymatchoutoptions
                                              *querymatchoutoptions);
 
+/* Return true if the alignments of the extensions are optimal alignments of
+   the extended regions instead of the alignments of the extensions with
+   polished ends. Their distance may then be smaller than the distance
+   reported by a greedy extension. */
+bool gt_querymatchoutoptions_optimal_extensions(const GtQuerymatchoutoptions
+                                                  *querymatchoutoptions);
+
 #endif
@@ -25,7 +25,6 @@
 #include "querymatch-align.h"
 #include "karlin_altschul_stat.h"
 #include "ft-eoplist.h"
-#include "revcompl.h"
 
 struct GtQuerymatch
 {
@@ -848,7 +847,6 @@ static void gt_querymatch_alignment_prepare(GtQuerymatch *querymatch,
                                             const GtSeqorEncseq *queryes,
                                             bool greedyextension)
 {
-  bool seeded_alignment;
   GtUword abs_querystart_fwdstrand;
 
   gt_assert(querymatch != NULL);
@@ -857,6 +855,19 @@ static void gt_querymatch_alignment_prepare(GtQuerymatch *querymatch,
     return;
   }
   gt_assert(queryes != NULL);
+  abs_querystart_fwdstrand = querymatch->query_seqstart +
+                             querymatch->querystart_fwdstrand;
+  gt_querymatchoutoptions_extract_seq(querymatch->ref_querymatchoutoptions,
+                                      dbes,
+                                      querymatch->dbstart_relative,
+                                      gt_querymatch_dbstart(querymatch),
+                                      gt_querymatch_dblen(querymatch),
+                                      querymatch->query_readmode,
+                                      queryes,
+                                      querymatch->querystart,
+                                      abs_querystart_fwdstrand,
+                                      querymatch->querylen,
+                                      false);
   if (querymatch->distance > 0)
   {
     gt_querymatchoutoptions_seededmatch2eoplist(
@@ -876,27 +887,12 @@ static void gt_querymatch_alignment_prepare(GtQuerymatch *querymatch,
                         querymatch->seedlen,
                         querymatch->verify_alignment,
                         greedyextension);
-    seeded_alignment = true;
-  } else
-  {
-    seeded_alignment = false;
-  }
-  abs_querystart_fwdstrand = querymatch->query_seqstart +
-                             querymatch->querystart_fwdstrand;
-  gt_querymatchoutoptions_extract_seq(querymatch->ref_querymatchoutoptions,
-                                      dbes,
-                                      querymatch->dbstart_relative,
-                                      gt_querymatch_dbstart(querymatch),
-                                      gt_querymatch_dblen(querymatch),
-                                      querymatch->query_readmode,
-                                      queryes,
-                                      querymatch->querystart,
-                                      abs_querystart_fwdstrand,
-                                      querymatch->querylen,
-                                      seeded_alignment);
-  if (seeded_alignment && !greedyextension)
-  {
-    gt_querymatch_applycorrection(querymatch);
+    if (!greedyextension ||
+        gt_querymatchoutoptions_optimal_extensions(
+                                   querymatch->ref_querymatchoutoptions))
+    {
+      gt_querymatch_applycorrection(querymatch);
+    }
   }
 }
 
@@ -1254,11 +1250,14 @@ void gt_querymatch_extract_sequence_pair(GtSequencepairbuffer *seqpairbuf,
   }
   gt_encseq_extract_encoded(db_encseq, seqpairbuf->a_sequence, apos_ab,
                             apos_ab + dblen - 1);
-  gt_encseq_extract_encoded(query_encseq, seqpairbuf->b_sequence, bpos_ab,
-                            bpos_ab + querylen - 1);
   if (query_readmode == GT_READMODE_REVCOMPL)
   {
-    gt_inplace_reverse_complement(seqpairbuf->b_sequence,querylen);
+    gt_encseq_extract_encoded_rc(query_encseq, seqpairbuf->b_sequence, bpos_ab,
+                                 bpos_ab + querylen - 1);
+  } else
+  {
+    gt_encseq_extract_encoded(query_encseq, seqpairbuf->b_sequence, bpos_ab,
+                              bpos_ab + querylen - 1);
   }
   seqpairbuf->a_len = dblen;
   seqpairbuf->b_len = querylen;
@@ -1276,7 +1275,7 @@ static void gt_querymatch_seed_alignment(GtQuerymatch *querymatch,
                                 querymatch->query_seqlen);
 }
 
-static void gt_querymatch_full_alignment(const GtQuerymatch *querymatch,
+static void gt_querymatch_full_alignment(GtQuerymatch *querymatch,
                                          GtSeqorEncseq *db_seqorencseq,
                                          GtSeqorEncseq *query_seqorencseq)
 {
@@ -1284,17 +1283,6 @@ static void gt_querymatch_full_alignment(const GtQuerymatch *querymatch,
   {
     const GtReadmode query_readmode = gt_querymatch_query_readmode(querymatch);
 
-    gt_frontprune2eoplist(querymatch->ref_querymatchoutoptions,
-                          db_seqorencseq,
-                          gt_querymatch_dbstart(querymatch),
-                          gt_querymatch_dblen(querymatch),
-                          query_seqorencseq,
-                          query_readmode,
-                          querymatch->query_seqstart,
-                          querymatch->query_seqlen,
-                          querymatch->querystart,
-                          gt_querymatch_querylen(querymatch),
-                          querymatch->verify_alignment);
     gt_querymatchoutoptions_extract_seq(querymatch->ref_querymatchoutoptions,
                                         db_seqorencseq,
                                         querymatch->dbstart_relative,
@@ -1306,7 +1294,25 @@ static void gt_querymatch_full_alignment(const GtQuerymatch *querymatch,
                                         querymatch->query_seqstart +
                                           querymatch->querystart_fwdstrand,
                                         gt_querymatch_querylen(querymatch),
-                                        true);
+                                        false);
+    gt_frontprune2eoplist(querymatch->ref_querymatchoutoptions,
+                          db_seqorencseq,
+                          querymatch->dbstart_relative,
+                          gt_querymatch_dbstart(querymatch),
+                          gt_querymatch_dblen(querymatch),
+                          query_seqorencseq,
+                          query_readmode,
+                          querymatch->query_seqstart,
+                          querymatch->query_seqlen,
+                          querymatch->querystart,
+                          gt_querymatch_querylen(querymatch),
+                          querymatch->verify_alignment);
+    if (querymatch->distance > 0 &&
+        gt_querymatchoutoptions_optimal_extensions(
+                                   querymatch->ref_querymatchoutoptions))
+    {
+      gt_querymatch_applycorrection(querymatch);
+    }
   }
 }
 
@@ -33,6 +33,7 @@
 #include "core/minmax_api.h"
 #ifdef GT_THREADS_ENABLED
 #include "core/thread_api.h"
+#include "core/thread_pool.h"
 #endif
 #include "match/firstcodes-buf.h"
 #include "match/firstcodes-spacelog.h"
@@ -665,10 +666,9 @@ typedef struct
   GtRandomcodesintervalprocess_end itvprocess_end;
   void *itvprocessdata;
   GtError *err;
-  GtThread *thread;
 } GtRandomcodesSortRemainingThreadinfo;
 
-static void *gt_randomcodes_thread_caller_sortremaining(void *data)
+static void gt_randomcodes_thread_caller_sortremaining(void *data)
 {
   GtRandomcodesSortRemainingThreadinfo *threadinfo =
     (GtRandomcodesSortRemainingThreadinfo *) data;
@@ -693,7 +693,6 @@ static void *gt_randomcodes_thread_caller_sortremaining(void *data)
   {
     gt_assert(false);
   }
-  return NULL;
 }
 
 static int gt_randomcodes_thread_sortremaining(
@@ -722,7 +721,7 @@ static int gt_randomcodes_thread_sortremaining(
   unsigned int t;
   GtUword GT_UNUSED sum = 0, *endindexes;
   GtRandomcodesSortRemainingThreadinfo *threadinfo;
-  bool haserr = false;
+  GtThreadPoolGroup *group = gt_thread_pool_group_new();
 
   gt_assert(threads >= 2U);
   endindexes = gt_randomcodes_evenly_divide_part(rct, partminindex,
@@ -769,26 +768,16 @@ static int gt_randomcodes_thread_sortremaining(
                   t, threadinfo[t].minindex, threadinfo[t].maxindex, lb,
                   threadinfo[t].sumofwidth, threadinfo[t].sumofwidth - lb);
     sum += threadinfo[t].sumofwidth - lb;
-    threadinfo[t].thread
-      = gt_thread_new (gt_randomcodes_thread_caller_sortremaining,
-                       threadinfo + t, err);
-    if (threadinfo[t].thread == NULL)
-    {
-      haserr = true;
-    }
-  }
-  gt_assert (haserr || sum == widthofpart);
-  for (t=0; t<threads; t++)
-  {
-    if (!haserr)
-    {
-      gt_thread_join(threadinfo[t].thread);
-    }
-    gt_thread_delete(threadinfo[t].thread);
+    gt_thread_pool_group_submit(group,
+                                gt_randomcodes_thread_caller_sortremaining,
+                                threadinfo + t);
   }
+  gt_assert(sum == widthofpart);
+  gt_thread_pool_group_wait(group);
+  gt_thread_pool_group_delete(group);
   gt_free(threadinfo);
   gt_free(endindexes);
-  return haserr ? -1 : 0;
+  return 0;
 }
 #endif
 
@@ -85,6 +85,7 @@ struct GtBUstate_spm {
   /* function called when results are found, and its data pointer: */
   GtSpmproc proc;
   void* procdata;
+  bool close_procdata;
   GtUword nofvalidspm;
   GtUword nof_transitive_withrc;
   GtUword nof_transitive_other;
@@ -92,6 +93,7 @@ struct GtBUstate_spm {
   /* varlen contained reads detection */
   GtUword shortest;
   FILE *cntfile;
+  GtBitsequence *contained;
   GtUword nof_contained;
 
   GtUword spaceforbucketprocessing;
@@ -439,8 +441,11 @@ static inline int processleafedge_spmvar(bool firstsucc,
       {
         GtUword readnum = GT_READJOINER_READNUM(seqnum,
             state->first_revcompl, state->nofreads);
-        (void)fwrite(&(readnum), sizeof (GtUword), (size_t)1,
-            state->cntfile);
+        if (state->contained != NULL)
+          GT_SETIBIT(state->contained, readnum);
+        else
+          (void)fwrite(&(readnum), sizeof (GtUword), (size_t)1,
+              state->cntfile);
         state->nof_contained++;
       }
     }
@@ -621,7 +626,8 @@ static void showstatistics_spm(GtBUstate_spmeq *state)
 
 static GtBUstate_spm *gt_spmfind_state_new(bool eqlen, const GtEncseq *encseq,
     GtUword minmatchlength, GtUword w_maxsize, bool elimtrans,
-    bool showspm, const char *indexname, unsigned int threadnum,
+    bool showspm, GtSpmproc proc, void *procdata, GtBitsequence *contained,
+    const char *indexname, unsigned int threadnum,
     GtLogger *default_logger, GtLogger *verbose_logger, GtError *err)
 {
   GtBUstate_spmeq *state = gt_calloc((size_t)1, sizeof (*state));
@@ -642,6 +648,11 @@ static GtBUstate_spm *gt_spmfind_state_new(bool eqlen, const GtEncseq *encseq,
   {
     state->read_length = gt_encseq_seqlength(encseq, 0);
   }
+  else if (contained != NULL)
+  {
+    state->read_length = 0;
+    state->contained = contained;
+  }
   else
   {
     GtStr *suffix = gt_str_new();
@@ -686,7 +697,12 @@ static GtBUstate_spm *gt_spmfind_state_new(bool eqlen, const GtEncseq *encseq,
         state->elimtrans ? "true" : "false");
   }
 
-  if (showspm)
+  if (proc != NULL)
+  {
+    state->proc = proc;
+    state->procdata = procdata;
+  }
+  else if (showspm)
   {
     state->proc = gt_spmproc_show_ascii;
     state->procdata = NULL;
@@ -704,6 +720,7 @@ static GtBUstate_spm *gt_spmfind_state_new(bool eqlen, const GtEncseq *encseq,
     gt_str_delete(suffix);
     if (state->procdata == NULL)
       exit(-1);
+    state->close_procdata = true;
     if (state->first_revcompl > UINT32_MAX ||
         (state->first_revcompl == 0 && state->nofreads > UINT32_MAX))
     {
@@ -746,8 +763,20 @@ GtBUstate_spmeq *gt_spmfind_eqlen_state_new(const GtEncseq *encseq,
     GtLogger *default_logger, GtLogger *verbose_logger, GtError *err)
 {
   return (GtBUstate_spmeq *)gt_spmfind_state_new(true, encseq, minmatchlength,
-      w_maxsize, elimtrans, showspm, indexname, threadnum, default_logger,
-      verbose_logger, err);
+      w_maxsize, elimtrans, showspm, NULL, NULL, NULL, indexname, threadnum,
+      default_logger, verbose_logger, err);
+}
+
+GtBUstate_spmeq *gt_spmfind_eqlen_state_new_with_proc(const GtEncseq *encseq,
+    GtUword minmatchlength, GtUword w_maxsize, bool elimtrans,
+    GtSpmproc proc, void *procdata, const char *indexname,
+    unsigned int threadnum, GtLogger *default_logger,
+    GtLogger *verbose_logger, GtError *err)
+{
+  gt_assert(proc != NULL);
+  return (GtBUstate_spmeq *)gt_spmfind_state_new(true, encseq, minmatchlength,
+      w_maxsize, elimtrans, false, proc, procdata, NULL, indexname, threadnum,
+      default_logger, verbose_logger, err);
 }
 
 GtBUstate_spmvar *gt_spmfind_varlen_state_new(const GtEncseq *encseq,
@@ -756,8 +785,20 @@ GtBUstate_spmvar *gt_spmfind_varlen_state_new(const GtEncseq *encseq,
     GtLogger *default_logger, GtLogger *verbose_logger, GtError *err)
 {
   return (GtBUstate_spmvar *)gt_spmfind_state_new(false, encseq, minmatchlength,
-      w_maxsize, elimtrans, showspm, indexname, threadnum, default_logger,
-      verbose_logger, err);
+      w_maxsize, elimtrans, showspm, NULL, NULL, NULL, indexname, threadnum,
+      default_logger, verbose_logger, err);
+}
+
+GtBUstate_spmvar *gt_spmfind_varlen_state_new_with_proc(
+    const GtEncseq *encseq, GtUword minmatchlength, GtUword w_maxsize,
+    bool elimtrans, GtSpmproc proc, void *procdata, GtBitsequence *contained,
+    const char *indexname, unsigned int threadnum,
+    GtLogger *default_logger, GtLogger *verbose_logger, GtError *err)
+{
+  gt_assert(proc != NULL && contained != NULL);
+  return (GtBUstate_spmvar *)gt_spmfind_state_new(false, encseq, minmatchlength,
+      w_maxsize, elimtrans, false, proc, procdata, contained, indexname,
+      threadnum, default_logger, verbose_logger, err);
 }
 
 static GtUword gt_spmfind_nof_trans_spm(GtBUstate_spm *state)
@@ -824,9 +865,10 @@ static void gt_spmfind_state_delete(bool eqlen, GtBUstate_spm *state)
       gt_str_delete(path);
       gt_GtArrayGtBUItvinfo_delete_spmvar(
           (GtArrayGtBUItvinfo_spmvar *)state->stack, state);
-      gt_fa_fclose(state->cntfile);
+      if (state->cntfile != NULL)
+        gt_fa_fclose(state->cntfile);
     }
-    if (state->procdata != NULL)
+    if (state->close_procdata)
       /*@ignore@*/
       gt_fa_fclose((FILE*)state->procdata);
       /*@end@*/
@@ -21,6 +21,8 @@
 #include <stdint.h>
 #include "core/error_api.h"
 #include "core/encseq_api.h"
+#include "core/intbits.h"
+#include "match/rdj-spmproc.h"
 #include "match/seqnumrelpos.h"
 
 /*
@@ -37,6 +39,14 @@ GtBUstate_spmeq *gt_spmfind_eqlen_state_new(const GtEncseq *encseq,
     bool showspm, const char *indexname, unsigned int threadnum,
     GtLogger *default_logger, GtLogger *verbose_logger, GtError *err);
 
+/* as above, but each SPM is passed to proc with procdata, instead of
+ * being shown or saved to file */
+GtBUstate_spmeq *gt_spmfind_eqlen_state_new_with_proc(const GtEncseq *encseq,
+    GtUword minmatchlength, GtUword w_maxsize, bool elimtrans,
+    GtSpmproc proc, void *procdata, const char *indexname,
+    unsigned int threadnum, GtLogger *default_logger,
+    GtLogger *verbose_logger, GtError *err);
+
 void gt_spmfind_eqlen_state_delete(GtBUstate_spmeq *state);
 
 int gt_spmfind_eqlen_process(void *data,
@@ -53,6 +63,15 @@ GtBUstate_spmvar *gt_spmfind_varlen_state_new(const GtEncseq *encseq,
     bool showspm, const char *indexname, unsigned int threadnum,
     GtLogger *default_logger, GtLogger *verbose_logger, GtError *err);
 
+/* as above, but each SPM is passed to proc with procdata, and the bits of
+ * the contained reads are set in contained (one bit for each read),
+ * instead of saving them to file */
+GtBUstate_spmvar *gt_spmfind_varlen_state_new_with_proc(
+    const GtEncseq *encseq, GtUword minmatchlength, GtUword w_maxsize,
+    bool elimtrans, GtSpmproc proc, void *procdata, GtBitsequence *contained,
+    const char *indexname, unsigned int threadnum,
+    GtLogger *default_logger, GtLogger *verbose_logger, GtError *err);
+
 void gt_spmfind_varlen_state_delete(GtBUstate_spmvar *state);
 
 int gt_spmfind_varlen_process(void *data,
@@ -15,6 +15,8 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include "core/assert_api.h"
+#include "core/ma_api.h"
 #include "core/unused_api.h"
 #include "match/rdj-spmproc.h"
 /* for unit test: */
@@ -84,6 +86,78 @@ void gt_spmproc_a_skip(GtUword suffix_seqnum,
   }
 }
 
+typedef struct {
+  GtUword suffix_seqnum, prefix_seqnum, length;
+  bool suffixseq_direct, prefixseq_direct;
+} GtSpmprocQueueElem;
+
+struct GtSpmprocQueue {
+  GtSpmprocQueueElem *space;
+  GtUword nextfree, allocated;
+  GtSpmproc outproc;
+  void *outdata;
+  GtMutex *mutex;
+};
+
+GtSpmprocQueue *gt_spmproc_queue_new(GtUword size, GtSpmproc outproc,
+  void *outdata, GtMutex *mutex)
+{
+  GtSpmprocQueue *queue = gt_malloc(sizeof (*queue));
+
+  gt_assert(size > 0 && outproc != NULL);
+  queue->space = gt_malloc(sizeof (*queue->space) * size);
+  queue->nextfree = 0;
+  queue->allocated = size;
+  queue->outproc = outproc;
+  queue->outdata = outdata;
+  queue->mutex = mutex;
+  return queue;
+}
+
+void gt_spmproc_queue_flush(GtSpmprocQueue *queue)
+{
+  GtUword i;
+
+  gt_assert(queue != NULL);
+  if (queue->nextfree == 0)
+    return;
+  gt_mutex_lock(queue->mutex);
+  for (i = 0; i < queue->nextfree; i++)
+  {
+    const GtSpmprocQueueElem *e = queue->space + i;
+    queue->outproc(e->suffix_seqnum, e->prefix_seqnum, e->length,
+                   e->suffixseq_direct, e->prefixseq_direct, queue->outdata);
+  }
+  gt_mutex_unlock(queue->mutex);
+  queue->nextfree = 0;
+}
+
+void gt_spmproc_queue_add(GtUword suffix_seqnum, GtUword prefix_seqnum,
+  GtUword length, bool suffixseq_direct, bool prefixseq_direct,
+  void *data)
+{
+  GtSpmprocQueue *queue = data;
+  GtSpmprocQueueElem *e;
+
+  if (queue->nextfree == queue->allocated)
+    gt_spmproc_queue_flush(queue);
+  e = queue->space + queue->nextfree++;
+  e->suffix_seqnum = suffix_seqnum;
+  e->prefix_seqnum = prefix_seqnum;
+  e->length = length;
+  e->suffixseq_direct = suffixseq_direct;
+  e->prefixseq_direct = prefixseq_direct;
+}
+
+void gt_spmproc_queue_delete(GtSpmprocQueue *queue)
+{
+  if (queue == NULL)
+    return;
+  gt_spmproc_queue_flush(queue);
+  gt_free(queue->space);
+  gt_free(queue);
+}
+
 /* unit test */
 
 static void outproc(GT_UNUSED GtUword suffix_seqnum,
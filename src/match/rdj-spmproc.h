@@ -21,6 +21,7 @@
 #include <stdbool.h>
 #include "core/intbits.h"            /* GtBitsequence */
 #include "core/error_api.h"          /* GtError */
+#include "core/thread_api.h"         /* GtMutex */
 
 /* Prototype for functions processing exact/approximate overlaps */
 
@@ -73,4 +74,25 @@ void gt_spmproc_a_skip(GtUword suffix_seqnum,
 
 int gt_spmproc_skip_unit_test(GtError *err);
 
+/*
+Collects the SPMs found by one thread in a queue of bounded size and
+passes them on to the Spmproc outproc when the queue is full or flushed.
+outproc is called holding the mutex, which is shared by all queues with
+the same outproc, so that outproc need not be thread safe.
+The void* data of gt_spmproc_queue_add must be of type GtSpmprocQueue.
+*/
+typedef struct GtSpmprocQueue GtSpmprocQueue;
+
+GtSpmprocQueue *gt_spmproc_queue_new(GtUword size, GtSpmproc outproc,
+  void *outdata, GtMutex *mutex);
+
+void gt_spmproc_queue_add(GtUword suffix_seqnum, GtUword prefix_seqnum,
+  GtUword length, bool suffixseq_direct, bool prefixseq_direct,
+  void *data);
+
+void gt_spmproc_queue_flush(GtSpmprocQueue *queue);
+
+/* flushes the queue before deleting it */
+void gt_spmproc_queue_delete(GtSpmprocQueue *queue);
+
 #endif
@@ -741,7 +741,7 @@ int gt_strgraph_load_spm_from_file(GtStrgraph *strgraph,
     skipdata.out.e.data = strgraph;
     skipdata.skipped_counter = 0;
   }
-  strgraph->load_self_spm = load_self_spm;
+  gt_strgraph_begin_add(strgraph, load_self_spm);
   for (i = 0; i < nspmfiles; i++)
   {
     gt_str_append_cstr(filename, indexname);
@@ -755,12 +755,24 @@ int gt_strgraph_load_spm_from_file(GtStrgraph *strgraph,
   }
   gt_str_delete(filename);
   if (!had_err)
-    gt_strgraph_mark_empty_edges(strgraph);
+    gt_strgraph_end_add(strgraph);
   return had_err;
 }
 
 /* --- construction --- */
 
+void gt_strgraph_begin_add(GtStrgraph *strgraph, bool load_self_spm)
+{
+  gt_assert(strgraph != NULL);
+  strgraph->load_self_spm = load_self_spm;
+}
+
+void gt_strgraph_end_add(GtStrgraph *strgraph)
+{
+  gt_assert(strgraph != NULL);
+  gt_strgraph_mark_empty_edges(strgraph);
+}
+
 void gt_strgraph_set_encseq(GtStrgraph *strgraph, const GtEncseq *encseq)
 {
   gt_assert(strgraph != NULL);
@@ -65,10 +65,18 @@ int gt_strgraph_load_spm_from_file(GtStrgraph *strgraph,
 void gt_strgraph_allocate_graph(GtStrgraph *strgraph, GtUword fixlen,
     const GtEncseq *encseq);
 
+/* when the SPMs are not loaded from file, but passed directly to
+ * gt_spmproc_strgraph_add, they must be enclosed by calls to the
+ * following two functions; the edges counted but not added
+ * are marked as reduced by gt_strgraph_end_add */
+void gt_strgraph_begin_add(GtStrgraph *strgraph, bool load_self_spm);
+
 void gt_spmproc_strgraph_add(GtUword suffix_readnum,
     GtUword prefix_readnum, GtUword length,
     bool suffixseq_direct, bool prefixseq_direct, void *graph);
 
+void gt_strgraph_end_add(GtStrgraph *strgraph);
+
 /* --- log information --- */
 
 void gt_strgraph_show_limits(void);
@@ -37,6 +37,7 @@
 #include "sfx-shortreadsort.h"
 #ifdef GT_THREADS_ENABLED
 #include "core/thread_api.h"
+#include "core/thread_pool.h"
 #endif
 
 #define ACCESSCHARRAND(POS)    gt_encseq_get_encoded_char(bsr->encseq,\
@@ -1655,10 +1656,9 @@ typedef struct
   GtUword totalwidth;
   GtBentsedgresources *bsr;
   unsigned int thread_num;
-  GtThread *thread;
 } GtBentsedg_partition_thread_info;
 
-static void *gt_bentsedg_partition_thread_caller(void *data)
+static void gt_bentsedg_partition_thread_caller(void *data)
 {
   GtCodetype code;
   GtBentsedg_partition_thread_info *thinfo
@@ -1682,7 +1682,6 @@ static void *gt_bentsedg_partition_thread_caller(void *data)
                                (GtUword) thinfo->prefixlength);
     }
   }
-  return NULL;
 }
 
 void gt_threaded_partition_sortallbuckets(GtSuffixsortspace *suffixsortspace,
@@ -1699,7 +1698,7 @@ void gt_threaded_partition_sortallbuckets(GtSuffixsortspace *suffixsortspace,
                        GtLogger *logger)
 {
   unsigned int tp, thread_parts;
-  bool haserr = false;
+  GtThreadPoolGroup *group = gt_thread_pool_group_new();
   GtBentsedg_partition_thread_info *th_tab;
   GtSuffixsortspace **sssp_tab;
 
@@ -1708,7 +1707,7 @@ void gt_threaded_partition_sortallbuckets(GtSuffixsortspace *suffixsortspace,
   gt_assert(thread_parts > 1U);
   th_tab = gt_malloc(sizeof *th_tab * thread_parts);
   sssp_tab = gt_malloc(sizeof *sssp_tab * thread_parts);
-  for (tp = 0; !haserr && tp < thread_parts; tp++)
+  for (tp = 0; tp < thread_parts; tp++)
   {
     th_tab[tp].thread_num = tp;
     th_tab[tp].numofchars = numofchars;
@@ -1736,21 +1735,11 @@ void gt_threaded_partition_sortallbuckets(GtSuffixsortspace *suffixsortspace,
       = processunsortedsuffixrange;
     th_tab[tp].bsr->processunsortedsuffixrangeinfo
       = processunsortedsuffixrangeinfo;
-    th_tab[tp].thread
-      = gt_thread_new (gt_bentsedg_partition_thread_caller,th_tab + tp,NULL);
-    if (th_tab[tp].thread == NULL)
-    {
-      haserr = true;
-    }
-  }
-  for (tp = 0; tp < thread_parts; tp++)
-  {
-    if (!haserr)
-    {
-      gt_thread_join(th_tab[tp].thread);
-    }
-    gt_thread_delete(th_tab[tp].thread);
+    gt_thread_pool_group_submit(group,gt_bentsedg_partition_thread_caller,
+                                th_tab + tp);
   }
+  gt_thread_pool_group_wait(group);
+  gt_thread_pool_group_delete(group);
   for (tp = 0; tp < thread_parts; tp++)
   {
     bentsedgresources_delete(th_tab[tp].bsr, logger);
@@ -1758,7 +1747,6 @@ void gt_threaded_partition_sortallbuckets(GtSuffixsortspace *suffixsortspace,
   gt_suffixsortspace_delete_cloned(sssp_tab,thread_parts);
   gt_free(sssp_tab);
   gt_free(th_tab);
-  gt_assert(!haserr);
 }
 #else
 
@@ -1949,10 +1937,9 @@ typedef struct
   unsigned int prefixlength, thread_num;
   GtBentsedgIterator *bs_it; /* shared, _next-function needs a mutex */
   GtBentsedgSynchronizer *bs_sync; /* shared _process-function needs a mutex */
-  GtThread *thread;
 } GtBentsedg_stream_thread_info;
 
-static void *gt_bentsedg_stream_thread_caller(void *data)
+static void gt_bentsedg_stream_thread_caller(void *data)
 {
   GtBentsedg_stream_thread_info *thinfo
     = (GtBentsedg_stream_thread_info *) data;
@@ -1980,7 +1967,6 @@ static void *gt_bentsedg_stream_thread_caller(void *data)
     gt_bendsedgSynchronizer_process(thinfo->bs_sync,bucketnumber);
     gt_mutex_unlock(thinfo->bs_sync->mutex);
   }
-  return NULL;
 }
 
 void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
@@ -2001,7 +1987,7 @@ void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
   GtBentsedgIterator *bs_it;
   GtBentsedgSynchronizer *bs_sync;
   unsigned int tp;
-  bool haserr = false;
+  GtThreadPoolGroup *group = gt_thread_pool_group_new();
   GtBentsedg_stream_thread_info *th_tab;
   GtSuffixsortspace **sssp_tab;
 
@@ -2010,7 +1996,7 @@ void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
   sssp_tab = gt_malloc(sizeof *sssp_tab * gt_jobs);
   bs_it = gt_BentsedgIterator_new(mincode,maxcode,sumofwidth,numofchars,bcktab);
   bs_sync = gt_bendsedgSynchronizer_new();
-  for (tp = 0; !haserr && tp < gt_jobs; tp++)
+  for (tp = 0; tp < gt_jobs; tp++)
   {
     th_tab[tp].thread_num = tp;
     th_tab[tp].prefixlength = prefixlength;
@@ -2035,21 +2021,11 @@ void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
       = processunsortedsuffixrangeinfo;
     th_tab[tp].bs_it = bs_it;
     th_tab[tp].bs_sync = bs_sync;
-    th_tab[tp].thread
-      = gt_thread_new (gt_bentsedg_stream_thread_caller,th_tab + tp,NULL);
-    if (th_tab[tp].thread == NULL)
-    {
-      haserr = true;
-    }
-  }
-  for (tp = 0; tp < gt_jobs; tp++)
-  {
-    if (!haserr)
-    {
-      gt_thread_join(th_tab[tp].thread);
-    }
-    gt_thread_delete(th_tab[tp].thread);
+    gt_thread_pool_group_submit(group,gt_bentsedg_stream_thread_caller,
+                                th_tab + tp);
   }
+  gt_thread_pool_group_wait(group);
+  gt_thread_pool_group_delete(group);
   for (tp = 0; tp < gt_jobs; tp++)
   {
     bentsedgresources_delete(th_tab[tp].bsr, logger);
@@ -2059,7 +2035,6 @@ void gt_threaded_stream_sortallbuckets(GtSuffixsortspace *suffixsortspace,
   gt_bendsedgSynchronizer_delete(bs_sync);
   gt_free(sssp_tab);
   gt_free(th_tab);
-  gt_assert(!haserr);
 }
 #endif
 #endif
@@ -463,11 +463,17 @@ void gt_Outlcpinfo_delete(GtOutlcpinfo *outlcpinfo)
         outlcpinfo->lcpsubtab.lcp2file->countoutputlcpvalues <
         outlcpinfo->numsuffixes2output)
     {
+      GtUword many = outlcpinfo->numsuffixes2output -
+                     outlcpinfo->lcpsubtab.lcp2file->countoutputlcpvalues;
+
+      if (outlcpinfo->lcpsubtab.distlcpvalues != NULL)
+      {
+        gt_disc_distri_add_multi(outlcpinfo->lcpsubtab.distlcpvalues,0,
+                                 (GtUint64) many);
+      }
       outlcpinfo->lcpsubtab.lcp2file->countoutputlcpvalues
-        += outmany0lcpvalues(outlcpinfo->numsuffixes2output -
-                             outlcpinfo->lcpsubtab.lcp2file
-                                                  ->countoutputlcpvalues,
-                             outlcpinfo->lcpsubtab.lcp2file->outfplcptab);
+        += outmany0lcpvalues(many,outlcpinfo->lcpsubtab.lcp2file
+                                             ->outfplcptab);
     }
     gt_assert(outlcpinfo->swallow_tail_lcpvalues ||
               outlcpinfo->lcpsubtab.lcp2file->countoutputlcpvalues ==
@@ -720,6 +726,22 @@ void gt_Outlcpinfo_postbucket(GtOutlcpinfo *outlcpinfo,
                                       bcktab);
       if (outlcpinfo->lcpsubtab.lcp2file != NULL)
       {
+        GtUword idx;
+
+        /* these values bypass <outlcpvalues()>, so they are accounted
+           here, such that the average lcp value is that of the whole
+           table, as computed by <gt_lcptab_phialgorithm2file()> */
+        for (idx = 0; idx < bucketspec->specialsinbucket; idx++)
+        {
+          GtUword lcpvalue
+            = (GtUword) outlcpinfo->lcpsubtab.lcp2file->smalllcpvalues[idx];
+
+          outlcpinfo->lcpsubtab.lcptabsum += (double) lcpvalue;
+          if (outlcpinfo->lcpsubtab.distlcpvalues != NULL)
+          {
+            gt_disc_distri_add(outlcpinfo->lcpsubtab.distlcpvalues,lcpvalue);
+          }
+        }
         outsmalllcpvalues(outlcpinfo->lcpsubtab.lcp2file,
                           bucketspec->specialsinbucket);
       } else
@@ -17,6 +17,8 @@
 
 #include <stdio.h>
 #include "core/chardef_api.h"
+#include "core/disc_distri_api.h"
+#include "core/fa_api.h"
 #include "core/ma_api.h"
 #include "core/encseq.h"
 #include "core/range_api.h"
@@ -24,7 +26,12 @@
 #include "core/logger.h"
 #include "core/minmax_api.h"
 #include "core/compact_ulong_store.h"
+#include "core/thread_api.h"
+#include "core/thread_pool.h"
+#include "core/xansi_api.h"
+#include "esa-fileend.h"
 #include "esa-seqread.h"
+#include "lcpoverflow.h"
 #include "sarr-def.h"
 #include "sfx-linlcp.h"
 
@@ -616,3 +623,298 @@ int gt_lcptab_lightweightcheck(const char *esaindexname,
   gt_compact_ulong_store_delete(lcptab);
   return haserr ? -1 : 0;
 }
+
+/* minimum number of sequence positions per segment of the parallel
+   Phi-algorithm, as each segment starts with lcp value 0 */
+#define GT_PHILCP_MINSEGMENTLENGTH (1UL << 16)
+/* number of lcp values gathered in parallel before they are written */
+#define GT_PHILCP_OUTWINDOW (1UL << 20)
+
+typedef struct
+{
+  const GtEncseq *encseq;
+  GtReadmode readmode;
+  const ESASuffixptr *ulongsuftab;
+  const unsigned int *uintsuftab;
+  GtUword totallength,
+          partwidth,
+          suftab0,
+          segmentlength,
+          windowstart;
+  bool bitwisecmp;
+  GtUword *phitab; /* overlaid by the permuted lcp values */
+  uint8_t *smalllcpvalues;
+} GtPhilcpinfo;
+
+static inline GtUword gt_philcp_suftab_get(const GtPhilcpinfo *philcpinfo,
+                                           GtUword idx)
+{
+  return philcpinfo->ulongsuftab != NULL
+           ? ESASUFFIXPTRGET(philcpinfo->ulongsuftab,idx)
+           : (GtUword) philcpinfo->uintsuftab[idx];
+}
+
+static void gt_philcp_fill_phitab(GtUword start,GtUword end,void *data)
+{
+  GtPhilcpinfo *philcpinfo = data;
+  GtUword idx, previousvalue;
+
+  gt_assert(start > 0);
+  previousvalue = gt_philcp_suftab_get(philcpinfo,start-1);
+  for (idx = start; idx < end; idx++)
+  {
+    GtUword currentvalue = gt_philcp_suftab_get(philcpinfo,idx);
+
+    philcpinfo->phitab[currentvalue] = previousvalue;
+    previousvalue = currentvalue;
+  }
+}
+
+static GtUword gt_philcp_charbychar(const GtPhilcpinfo *philcpinfo,
+                                    GtUword pos1,
+                                    GtUword pos2,
+                                    GtUword lcpvalue)
+{
+  const GtUword lastoffset = philcpinfo->totallength - GT_MAX(pos1,pos2);
+
+  while (lcpvalue < lastoffset)
+  {
+    GtUchar cc1 = gt_encseq_get_encoded_char(philcpinfo->encseq,
+                                             pos1 + lcpvalue,
+                                             philcpinfo->readmode),
+            cc2 = gt_encseq_get_encoded_char(philcpinfo->encseq,
+                                             pos2 + lcpvalue,
+                                             philcpinfo->readmode);
+
+    if (cc1 != cc2 || GT_ISSPECIAL(cc1))
+    {
+      break;
+    }
+    lcpvalue++;
+  }
+  return lcpvalue;
+}
+
+/* computes the permuted lcp values of all positions in a segment of the
+   sequence. The inequality plcp[pos+1] >= plcp[pos] - 1 is only exploited
+   inside a segment, so the segments are independent of each other. */
+static void gt_philcp_segments(GtUword start,GtUword end,void *data)
+{
+  GtPhilcpinfo *philcpinfo = data;
+  GtEncseqReader *scanreader, *esr1 = NULL, *esr2 = NULL;
+  GtUword segment;
+
+  scanreader = gt_encseq_create_reader_with_readmode(philcpinfo->encseq,
+                                                     philcpinfo->readmode,0);
+  if (philcpinfo->bitwisecmp)
+  {
+    esr1 = gt_encseq_create_reader_with_readmode(philcpinfo->encseq,
+                                                 philcpinfo->readmode,0);
+    esr2 = gt_encseq_create_reader_with_readmode(philcpinfo->encseq,
+                                                 philcpinfo->readmode,0);
+  }
+  for (segment = start; segment < end; segment++)
+  {
+    GtUword pos, lcpvalue = 0,
+            segmentstart = segment * philcpinfo->segmentlength,
+            segmentend = GT_MIN(segmentstart + philcpinfo->segmentlength,
+                                philcpinfo->totallength);
+
+    gt_encseq_reader_reinit_with_readmode(scanreader,philcpinfo->encseq,
+                                          philcpinfo->readmode,segmentstart);
+    for (pos = segmentstart; pos < segmentend; pos++)
+    {
+      GtUchar cc = gt_encseq_reader_next_encoded_char(scanreader);
+
+      if (GT_ISSPECIAL(cc) || pos == philcpinfo->suftab0)
+      {
+        philcpinfo->phitab[pos] = 0;
+        lcpvalue = 0;
+        continue;
+      }
+      if (philcpinfo->bitwisecmp)
+      {
+        GtCommonunits commonunits;
+
+        (void) gt_encseq_compare_viatwobitencoding(&commonunits,
+                                                   philcpinfo->encseq,
+                                                   philcpinfo->encseq,
+                                                   philcpinfo->readmode,
+                                                   esr1,
+                                                   esr2,
+                                                   pos,
+                                                   philcpinfo->phitab[pos],
+                                                   lcpvalue,
+                                                   0);
+        lcpvalue = commonunits.finaldepth;
+      } else
+      {
+        lcpvalue = gt_philcp_charbychar(philcpinfo,pos,
+                                        philcpinfo->phitab[pos],lcpvalue);
+      }
+      philcpinfo->phitab[pos] = lcpvalue;
+      if (lcpvalue > 0)
+      {
+        lcpvalue--;
+      }
+    }
+  }
+  gt_encseq_reader_delete(scanreader);
+  gt_encseq_reader_delete(esr1);
+  gt_encseq_reader_delete(esr2);
+}
+
+static void gt_philcp_gather(GtUword start,GtUword end,void *data)
+{
+  GtPhilcpinfo *philcpinfo = data;
+  GtUword idx;
+
+  for (idx = start; idx < end; idx++)
+  {
+    GtUword lcpvalue = 0;
+
+    if (idx > 0 && idx < philcpinfo->partwidth)
+    {
+      lcpvalue = philcpinfo->phitab[gt_philcp_suftab_get(philcpinfo,idx)];
+    }
+    philcpinfo->smalllcpvalues[idx - philcpinfo->windowstart]
+      = lcpvalue < (GtUword) LCPOVERFLOW ? (uint8_t) lcpvalue
+                                         : (uint8_t) LCPOVERFLOW;
+  }
+}
+
+int gt_lcptab_phialgorithm2file(GtLcptabsummary *summary,
+                                const char *indexname,
+                                const GtEncseq *encseq,
+                                GtReadmode readmode,
+                                const ESASuffixptr *ulongsuftab,
+                                const unsigned int *uintsuftab,
+                                GtUword numofsuffixes2output,
+                                bool withdistribution,
+                                GtLogger *logger,
+                                GtError *err)
+{
+  bool haserr = false;
+  FILE *outfplcptab = NULL, *outfpllvtab = NULL;
+  GtPhilcpinfo philcpinfo;
+  GtDiscDistri *distlcpvalues = NULL;
+  GtUword numofsegments = 1UL, windowstart;
+
+  gt_error_check(err);
+  gt_assert((ulongsuftab == NULL) != (uintsuftab == NULL));
+  summary->numoflargelcpvalues = summary->maxbranchdepth = 0;
+  summary->lcptabsum = 0.0;
+  outfplcptab = gt_fa_fopen_with_suffix(indexname,GT_LCPTABSUFFIX,"wb",err);
+  if (outfplcptab == NULL)
+  {
+    haserr = true;
+  }
+  if (!haserr)
+  {
+    outfpllvtab = gt_fa_fopen_with_suffix(indexname,GT_LARGELCPTABSUFFIX,"wb",
+                                          err);
+    if (outfpllvtab == NULL)
+    {
+      haserr = true;
+    }
+  }
+  if (haserr)
+  {
+    gt_fa_fclose(outfplcptab);
+    return -1;
+  }
+  philcpinfo.encseq = encseq;
+  philcpinfo.readmode = readmode;
+  philcpinfo.ulongsuftab = ulongsuftab;
+  philcpinfo.uintsuftab = uintsuftab;
+  philcpinfo.totallength = gt_encseq_total_length(encseq);
+  gt_assert(gt_encseq_specialcharacters(encseq) <= philcpinfo.totallength);
+  philcpinfo.partwidth = philcpinfo.totallength -
+                         gt_encseq_specialcharacters(encseq);
+  gt_assert(numofsuffixes2output <= philcpinfo.totallength + 1);
+  philcpinfo.bitwisecmp = gt_encseq_bitwise_cmp_ok(encseq);
+  philcpinfo.phitab = NULL;
+  if (philcpinfo.partwidth > 0)
+  {
+    philcpinfo.suftab0 = gt_philcp_suftab_get(&philcpinfo,0);
+    if (gt_jobs > 1U)
+    {
+      numofsegments = GT_MIN((GtUword) gt_jobs * 4,
+                             1UL + philcpinfo.totallength/
+                                   GT_PHILCP_MINSEGMENTLENGTH);
+    }
+    philcpinfo.segmentlength = (philcpinfo.totallength + numofsegments - 1)/
+                               numofsegments;
+    numofsegments = (philcpinfo.totallength + philcpinfo.segmentlength - 1)/
+                    philcpinfo.segmentlength;
+    gt_logger_log(logger,"compute lcp table with Phi-algorithm for "
+                         GT_WU" segments using %u threads",numofsegments,
+                         gt_jobs);
+    philcpinfo.phitab = gt_malloc(sizeof (*philcpinfo.phitab) *
+                                  philcpinfo.totallength);
+    if (philcpinfo.partwidth > 1UL)
+    {
+      gt_thread_pool_parallel_for(1UL,philcpinfo.partwidth,0,
+                                  gt_philcp_fill_phitab,&philcpinfo);
+    }
+    gt_thread_pool_parallel_for(0,numofsegments,1UL,gt_philcp_segments,
+                                &philcpinfo);
+  }
+  if (withdistribution)
+  {
+    distlcpvalues = gt_disc_distri_new();
+  }
+  philcpinfo.smalllcpvalues
+    = gt_malloc(sizeof (*philcpinfo.smalllcpvalues) *
+                GT_MIN(GT_PHILCP_OUTWINDOW,
+                       GT_MAX(numofsuffixes2output,1UL)));
+  for (windowstart = 0; windowstart < numofsuffixes2output;
+       windowstart += GT_PHILCP_OUTWINDOW)
+  {
+    GtUword idx, windowend = GT_MIN(windowstart + GT_PHILCP_OUTWINDOW,
+                                    numofsuffixes2output);
+
+    philcpinfo.windowstart = windowstart;
+    gt_thread_pool_parallel_for(windowstart,windowend,0,gt_philcp_gather,
+                                &philcpinfo);
+    for (idx = windowstart; idx < windowend; idx++)
+    {
+      GtUword lcpvalue
+        = (GtUword) philcpinfo.smalllcpvalues[idx - windowstart];
+
+      if (lcpvalue == (GtUword) LCPOVERFLOW)
+      {
+        Largelcpvalue largelcpvalue;
+
+        lcpvalue = philcpinfo.phitab[gt_philcp_suftab_get(&philcpinfo,idx)];
+        largelcpvalue.position = idx;
+        largelcpvalue.value = lcpvalue;
+        gt_xfwrite(&largelcpvalue,sizeof (largelcpvalue),(size_t) 1,
+                   outfpllvtab);
+        summary->numoflargelcpvalues++;
+      }
+      if (summary->maxbranchdepth < lcpvalue)
+      {
+        summary->maxbranchdepth = lcpvalue;
+      }
+      summary->lcptabsum += (double) lcpvalue;
+      if (distlcpvalues != NULL)
+      {
+        gt_disc_distri_add(distlcpvalues,lcpvalue);
+      }
+    }
+    gt_xfwrite(philcpinfo.smalllcpvalues,
+               sizeof (*philcpinfo.smalllcpvalues),
+               (size_t) (windowend - windowstart),outfplcptab);
+  }
+  gt_free(philcpinfo.smalllcpvalues);
+  gt_free(philcpinfo.phitab);
+  if (distlcpvalues != NULL)
+  {
+    gt_disc_distri_show(distlcpvalues,NULL);
+    gt_disc_distri_delete(distlcpvalues);
+  }
+  gt_fa_fclose(outfplcptab);
+  gt_fa_fclose(outfpllvtab);
+  return 0;
+}
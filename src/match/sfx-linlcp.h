@@ -20,8 +20,16 @@
 
 #include "core/encseq.h"
 #include "core/compact_ulong_store.h"
+#include "core/logger.h"
 #include "match/sarr-def.h"
 
+typedef struct
+{
+  GtUword numoflargelcpvalues,
+          maxbranchdepth;
+  double lcptabsum;
+} GtLcptabsummary;
+
 GtCompactUlongStore *gt_lcp9_manzini(GtCompactUlongStore *spacefortab,
                                      const GtEncseq *encseq,
                                      GtReadmode readmode,
@@ -51,4 +59,24 @@ int gt_lcptab_lightweightcheck(const char *esaindexname,
                                GtLogger *logger,
                                GtError *err);
 
+/* Computes the lcp table for the suffix array of <encseq> in <readmode>
+   with the Phi-algorithm and writes its first <numofsuffixes2output>
+   entries to the files <indexname>.lcp and <indexname>.llv, in the format
+   used by the suffixerator. The suffix array is either given by
+   <ulongsuftab> or by <uintsuftab>; the other pointer must be <NULL>.
+   The permuted lcp values are computed for <gt_jobs> segments of the
+   sequence in parallel. The values required for the .prj file are stored
+   in <summary>. If <withdistribution> is true, the distribution of the
+   lcp values is shown on stdout. */
+int gt_lcptab_phialgorithm2file(GtLcptabsummary *summary,
+                                const char *indexname,
+                                const GtEncseq *encseq,
+                                GtReadmode readmode,
+                                const ESASuffixptr *ulongsuftab,
+                                const unsigned int *uintsuftab,
+                                GtUword numofsuffixes2output,
+                                bool withdistribution,
+                                GtLogger *logger,
+                                GtError *err);
+
 #endif
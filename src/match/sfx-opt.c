@@ -118,10 +118,12 @@ static GtOPrval parse_options(int *parsed_args,
   }
 
   if (oprval == GT_OPTION_PARSER_OK &&
-      gt_jobs > 1 && gt_index_options_outlcptab_value(so->idxopts)) {
-    /* LCP table generation is not implemented in multithreaded
-       operation */
-    gt_error_set(err, "option -lcp cannot be used when using >1 threads");
+      gt_jobs > 1 && gt_index_options_outlcptab_value(so->idxopts) &&
+      !gt_index_options_sfxstrategy_value(so->idxopts).withsain) {
+    /* LCP table generation is only implemented in multithreaded
+       operation when sorting by induced suffix sorting */
+    gt_error_set(err, "option -lcp requires option -sain when using >1 "
+                      "threads");
     oprval = GT_OPTION_PARSER_ERROR;
   }
 
@@ -33,15 +33,18 @@
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
 #include "core/mathsupport_api.h"
+#include "core/minmax_api.h"
 #include "esa-fileend.h"
 #include "esa-shulen.h"
 #include "giextract.h"
 #include "intcode-def.h"
 #include "sfx-apfxlen.h"
 #include "sfx-lcpvalues.h"
+#include "sfx-linlcp.h"
 #include "sfx-opt.h"
 #include "sfx-outprj.h"
 #include "sfx-run.h"
+#include "sfx-sain.h"
 #include "sfx-suffixer.h"
 #include "sfx-suffixgetset.h"
 
@@ -72,6 +75,8 @@ typedef struct
   const GtEncseq *encseq;
   Definedunsignedlong longest;
   GtOutlcpinfo *outlcpinfo;
+  GtLcptabsummary lcptabsummary; /* if lcptab is not computed via
+                                    outlcpinfo */
   GtBUstate_shulen *bustate_shulen;
 } Outfileinfo;
 
@@ -120,7 +125,9 @@ static int initoutfileinfo(Outfileinfo *outfileinfo,
 {
   bool haserr = false;
 
-  if (so->outlcptab)
+  /* with induced suffix sorting the lcp table is computed after sorting */
+  if (so->outlcptab &&
+      !gt_index_options_sfxstrategy_value(so->idxopts).withsain)
   {
 
     gt_assert(gt_str_get(so->indexname) != NULL || so->genomediff);
@@ -316,6 +323,140 @@ static int suffixeratorwithoutput(Outfileinfo *outfileinfo,
   return haserr ? -1 : 0;
 }
 
+#define GT_SAIN_OUTBUFSIZE 4096UL
+
+static int sainwithoutput(Outfileinfo *outfileinfo,
+                          const GtEncseq *encseq,
+                          GtReadmode readmode,
+                          const Suffixeratoroptions *so,
+                          const Sfxstrategy *sfxstrategy,
+                          GtTimer *sfxprogress,
+                          GtLogger *logger,
+                          GtError *err)
+{
+  GtUsainindextype *suftab;
+  GtUword idx, numberofsuffixes,
+          totallength = gt_encseq_total_length(encseq);
+  const bool swallow_tail = gt_index_options_swallow_tail_value(so->idxopts);
+
+  if (gt_sain_checkmaxsequencelength(totallength,true,err) != 0)
+  {
+    return -1;
+  }
+  if (sfxprogress != NULL)
+  {
+    gt_timer_show_progress(sfxprogress, "sorting suffixes by induced "
+                                        "suffix sorting", stdout);
+  }
+  suftab = gt_sain_encseq_sortsuffixes(encseq,readmode,false,false,logger,
+                                       sfxprogress);
+  numberofsuffixes = totallength + 1;
+  for (idx = 0; idx < numberofsuffixes; idx++)
+  {
+    if (suftab[idx] == 0)
+    {
+      outfileinfo->longest.defined = true;
+      outfileinfo->longest.valueunsignedlong = idx;
+      break;
+    }
+  }
+  gt_assert(outfileinfo->longest.defined);
+  if (sfxprogress != NULL)
+  {
+    gt_timer_show_progress(sfxprogress, "writing suffix array", stdout);
+  }
+  if (outfileinfo->outfpsuftab != NULL)
+  {
+    GtUword numofoutsuffixes = swallow_tail
+                                 ? totallength -
+                                   gt_encseq_specialcharacters(encseq)
+                                 : numberofsuffixes;
+
+    if (sfxstrategy->compressedoutput)
+    {
+      GtBitbuffer *bitbuffer
+        = gt_bitbuffer_FILE_new(outfileinfo->outfpsuftab,
+                                gt_determinebitspervalue(totallength));
+
+      gt_bitbuffer_write_uint32tab_FILE(bitbuffer,suftab,numofoutsuffixes);
+      gt_bitbuffer_delete(bitbuffer);
+    } else
+    {
+      if (sfxstrategy->suftabuint || sizeof (GtUword) == sizeof (*suftab))
+      {
+        gt_xfwrite(suftab,sizeof (*suftab),(size_t) numofoutsuffixes,
+                   outfileinfo->outfpsuftab);
+      } else
+      {
+        GtUword outbuf[GT_SAIN_OUTBUFSIZE], start;
+
+        for (start = 0; start < numofoutsuffixes;
+             start += GT_SAIN_OUTBUFSIZE)
+        {
+          GtUword end = GT_MIN(start + GT_SAIN_OUTBUFSIZE, numofoutsuffixes);
+
+          for (idx = start; idx < end; idx++)
+          {
+            outbuf[idx - start] = (GtUword) suftab[idx];
+          }
+          gt_xfwrite(outbuf,sizeof (*outbuf),(size_t) (end - start),
+                     outfileinfo->outfpsuftab);
+        }
+      }
+    }
+  }
+  if (outfileinfo->outfpbwttab != NULL)
+  {
+    GtUchar outbuf[GT_SAIN_OUTBUFSIZE];
+    GtUword start;
+
+    for (start = 0; start < numberofsuffixes; start += GT_SAIN_OUTBUFSIZE)
+    {
+      GtUword end = GT_MIN(start + GT_SAIN_OUTBUFSIZE, numberofsuffixes);
+
+      for (idx = start; idx < end; idx++)
+      {
+        outbuf[idx - start]
+          = suftab[idx] == 0 ? (GtUchar) GT_UNDEFBWTCHAR
+                             : gt_encseq_get_encoded_char(encseq,
+                                                          (GtUword)
+                                                          suftab[idx] - 1,
+                                                          readmode);
+      }
+      gt_xfwrite(outbuf,sizeof (*outbuf),(size_t) (end - start),
+                 outfileinfo->outfpbwttab);
+    }
+  }
+  outfileinfo->numberofallsortedsuffixes = numberofsuffixes;
+  if (so->outlcptab)
+  {
+    if (sfxprogress != NULL)
+    {
+      gt_timer_show_progress(sfxprogress, "computing lcp table", stdout);
+    }
+    if (gt_lcptab_phialgorithm2file(&outfileinfo->lcptabsummary,
+                                    gt_str_get(so->indexname),
+                                    encseq,
+                                    readmode,
+                                    NULL,
+                                    suftab,
+                                    swallow_tail
+                                      ? totallength -
+                                        gt_encseq_specialcharacters(encseq)
+                                      : numberofsuffixes,
+                                    gt_index_options_lcpdist_value(
+                                                                so->idxopts),
+                                    logger,
+                                    err) != 0)
+    {
+      gt_free(suftab);
+      return -1;
+    }
+  }
+  gt_free(suftab);
+  return 0;
+}
+
 static int detpfxlen(unsigned int *prefixlength,
                      const Suffixeratoroptions *so,
                      unsigned int numofchars,
@@ -560,6 +701,11 @@ int gt_runsuffixerator(bool doesa,
   }
   prefixlength = gt_index_options_prefixlength_value(so->idxopts);
   sfxstrategy = gt_index_options_sfxstrategy_value(so->idxopts);
+  if (!haserr && sfxstrategy.withsain && so->genomediff)
+  {
+    gt_error_set(err,"option -sain cannot be used for genomediff");
+    haserr = true;
+  }
   if (!haserr)
   {
     if (gt_index_options_outsuftab_value(so->idxopts)
@@ -600,6 +746,9 @@ int gt_runsuffixerator(bool doesa,
   outfileinfo.numberofallsortedsuffixes = 0;
   outfileinfo.longest.defined = false;
   outfileinfo.longest.valueunsignedlong = 0;
+  outfileinfo.lcptabsummary.numoflargelcpvalues = 0;
+  outfileinfo.lcptabsummary.maxbranchdepth = 0;
+  outfileinfo.lcptabsummary.lcptabsum = 0.0;
   outfileinfo.bustate_shulen = NULL;
   outfileinfo.encseq = NULL;
   if (!haserr)
@@ -619,7 +768,22 @@ int gt_runsuffixerator(bool doesa,
     {
       if (doesa)
       {
-        if (suffixeratorwithoutput(
+        if (sfxstrategy.withsain)
+        {
+          if (sainwithoutput(&outfileinfo,
+                             encseq,
+                             readmode,
+                             so,
+                             &sfxstrategy,
+                             sfxprogress,
+                             logger,
+                             err) != 0)
+          {
+            haserr = true;
+          }
+        } else
+        {
+          if (suffixeratorwithoutput(
                                &outfileinfo,
                                encseq,
                                readmode,
@@ -632,8 +796,9 @@ int gt_runsuffixerator(bool doesa,
                                so->showprogress,
                                logger,
                                err) != 0)
-        {
-          haserr = true;
+          {
+            haserr = true;
+          }
         }
       } else
       {
@@ -669,8 +834,12 @@ int gt_runsuffixerator(bool doesa,
 
     if (outfileinfo.outlcpinfo == NULL)
     {
-      numoflargelcpvalues = maxbranchdepth = 0;
-      averagelcp = 0.0;
+      numoflargelcpvalues = outfileinfo.lcptabsummary.numoflargelcpvalues;
+      maxbranchdepth = outfileinfo.lcptabsummary.maxbranchdepth;
+      averagelcp = outfileinfo.numberofallsortedsuffixes == 0
+                     ? 0.0
+                     : outfileinfo.lcptabsummary.lcptabsum/
+                       outfileinfo.numberofallsortedsuffixes;
     } else
     {
       numoflargelcpvalues
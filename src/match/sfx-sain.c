@@ -20,6 +20,8 @@
 #include "core/unused_api.h"
 #include "core/timer_api.h"
 #include "core/mathsupport_api.h"
+#include "core/thread_api.h"
+#include "core/thread_pool.h"
 #include "sfx-lwcheck.h"
 #include "bare-encseq.h"
 #include "sfx-sain.h"
@@ -49,6 +51,14 @@ typedef enum
 
 typedef signed int GtSsainindextype;
 
+/* Sequences shorter than this are always sorted sequentially. The parallel
+   steps split the sequence into blocks of at least
+   GT_SAIN_PARALLEL_MINBLOCKLENGTH positions and the suffix table into
+   blocks of GT_SAIN_INDUCEBLOCKSIZE entries. */
+#define GT_SAIN_PARALLEL_MINLENGTH      16384UL
+#define GT_SAIN_PARALLEL_MINBLOCKLENGTH 4096UL
+#define GT_SAIN_INDUCEBLOCKSIZE         65536UL
+
 typedef struct
 {
   GtUword totallength,
@@ -81,6 +91,97 @@ static bool gt_sain_decideforfastmethod(GtUword maxvalue,
          ? true : false;
 }
 
+static GtUword gt_sain_numofblocks(GtUword len,GtUword numofchars)
+{
+  GtUword numofblocks;
+
+  if (gt_jobs <= 1U || len < GT_SAIN_PARALLEL_MINLENGTH)
+  {
+    return 1UL;
+  }
+  numofblocks = GT_MIN(GT_MULT4((GtUword) gt_jobs),
+                    len/GT_SAIN_PARALLEL_MINBLOCKLENGTH);
+  /* each block has its own counter for each character */
+  numofblocks = GT_MIN(numofblocks,len/numofchars);
+  return numofblocks > 0 ? numofblocks : 1UL;
+}
+
+typedef struct
+{
+  const GtUchar *plainseq;
+  const GtUsainindextype *array;
+  GtUword len, numofchars, blocklength;
+  GtUsainindextype *counts;
+} GtSainCountinfo;
+
+static void gt_sain_countblocks(GtUword start,GtUword end,void *data)
+{
+  GtSainCountinfo *countinfo = (GtSainCountinfo *) data;
+  GtUword blocknum;
+
+  for (blocknum = start; blocknum < end; blocknum++)
+  {
+    GtUword idx, lo = blocknum * countinfo->blocklength,
+            hi = GT_MIN(lo + countinfo->blocklength,countinfo->len);
+    GtUsainindextype *counts = countinfo->counts +
+                               blocknum * countinfo->numofchars;
+
+    if (countinfo->plainseq != NULL)
+    {
+      for (idx = lo; idx < hi; idx++)
+      {
+        counts[countinfo->plainseq[idx]]++;
+      }
+    } else
+    {
+      for (idx = lo; idx < hi; idx++)
+      {
+        counts[countinfo->array[idx]]++;
+      }
+    }
+  }
+}
+
+/* count the characters of <plainseq> or <array> in parallel and add
+   the counts to <bucketsize>. Returns false if the sequence is too short
+   to be processed in parallel. */
+static bool gt_sain_parallel_bucketcount(GtUsainindextype *bucketsize,
+                                         const GtUchar *plainseq,
+                                         const GtUsainindextype *array,
+                                         GtUword len,
+                                         GtUword numofchars)
+{
+  GtSainCountinfo countinfo;
+  GtUword numofblocks = gt_sain_numofblocks(len,numofchars), blocknum,
+          charidx;
+
+  if (numofblocks == 1UL)
+  {
+    return false;
+  }
+  countinfo.plainseq = plainseq;
+  countinfo.array = array;
+  countinfo.len = len;
+  countinfo.numofchars = numofchars;
+  countinfo.blocklength = (len + numofblocks - 1)/numofblocks;
+  numofblocks = (len + countinfo.blocklength - 1)/countinfo.blocklength;
+  countinfo.counts = gt_calloc((size_t) (numofblocks * numofchars),
+                               sizeof *countinfo.counts);
+  gt_thread_pool_parallel_for(0,numofblocks,1UL,gt_sain_countblocks,
+                              &countinfo);
+  for (blocknum = 0; blocknum < numofblocks; blocknum++)
+  {
+    const GtUsainindextype *counts = countinfo.counts + blocknum * numofchars;
+
+    for (charidx = 0; charidx < numofchars; charidx++)
+    {
+      bucketsize[charidx] += counts[charidx];
+    }
+  }
+  gt_free(countinfo.counts);
+  return true;
+}
+
 static void gt_sain_allocate_tmpspace(GtSainseq *sainseq,
                                       GtUword maxvalue,
                                       GtUword len)
@@ -153,9 +254,14 @@ static GtSainseq *gt_sainseq_new_from_plainseq(const GtUchar *plainseq,
   sainseq->bare_encseq = NULL;
   sainseq->readmode = GT_READMODE_FORWARD;
   gt_sain_allocate_tmpspace(sainseq,len+1,len);
-  for (cptr = sainseq->seq.plainseq; cptr < sainseq->seq.plainseq + len; cptr++)
+  if (!gt_sain_parallel_bucketcount(sainseq->bucketsize,plainseq,NULL,len,
+                                    sainseq->numofchars))
   {
-    sainseq->bucketsize[*cptr]++;
+    for (cptr = sainseq->seq.plainseq; cptr < sainseq->seq.plainseq + len;
+         cptr++)
+    {
+      sainseq->bucketsize[*cptr]++;
+    }
   }
   return sainseq;
 }
@@ -268,10 +374,14 @@ static GtSainseq *gt_sainseq_new_from_array(GtUsainindextype *arr,
   {
     sainseq->bucketsize[charidx] = 0;
   }
-  for (cptr = arr; cptr < arr + sainseq->totallength; cptr++)
+  if (!gt_sain_parallel_bucketcount(sainseq->bucketsize,NULL,arr,len,
+                                    numofchars))
   {
-    gt_assert((GtUword) *cptr < numofchars);
-    sainseq->bucketsize[*cptr]++;
+    for (cptr = arr; cptr < arr + sainseq->totallength; cptr++)
+    {
+      gt_assert((GtUword) *cptr < numofchars);
+      sainseq->bucketsize[*cptr]++;
+    }
   }
   return sainseq;
 }
@@ -666,10 +776,406 @@ static void gt_sain_induceStypes2fromspecialranges(const GtSainseq *sainseq,
 
 #include "match/sfx-sain.inc"
 
+static bool gt_sain_useparallel(const GtSainseq *sainseq)
+{
+  return gt_jobs > 1U && sainseq->totallength >= GT_SAIN_PARALLEL_MINLENGTH
+         ? true : false;
+}
+
+typedef struct
+{
+  const GtSainseq *sainseq;
+  GtUsainindextype *suftab,
+                   *fillptrs; /* numofchars entries for each block */
+  const GtUword *blockbounds,
+                *nextcc;
+  const bool *nextisStype;
+  bool fill;
+} GtSainSstarblocks;
+
+/* Scan the positions of a block from right to left, given the character and
+   the type of the position following the block. In the first run the
+   Sstar suffixes of each block are counted, in the second run they are
+   inserted into the buckets starting at the fill pointers of the block. */
+static void gt_sain_Sstarblocks_scan(GtUword start,GtUword end,void *data)
+{
+  GtSainSstarblocks *blocks = (GtSainSstarblocks *) data;
+  const GtSainseq *sainseq = blocks->sainseq;
+  GtUword blocknum;
+
+  for (blocknum = start; blocknum < end; blocknum++)
+  {
+    GtUword position, nextcc = blocks->nextcc[blocknum],
+            lo = blocks->blockbounds[blocknum],
+            hi = blocks->blockbounds[blocknum+1];
+    GtUsainindextype *fillptr = blocks->fillptrs +
+                                blocknum * sainseq->numofchars;
+    bool nextisStype = blocks->nextisStype[blocknum];
+    GtEncseqReader *esr = NULL;
+
+    if (sainseq->seqtype == GT_SAIN_ENCSEQ)
+    {
+      esr = gt_encseq_create_reader_with_readmode(sainseq->seq.encseq,
+                              gt_readmode_inverse_direction(sainseq->readmode),
+                              sainseq->totallength - hi);
+    }
+    for (position = hi; position > lo; /* Nothing */)
+    {
+      GtUword currentcc;
+      bool currentisStype;
+
+      position--;
+      if (esr != NULL)
+      {
+        GtUchar cc = gt_encseq_reader_next_encoded_char(esr);
+
+        currentcc = GT_ISSPECIAL(cc) ? GT_UNIQUEINT(position) : (GtUword) cc;
+      } else
+      {
+        currentcc = gt_sainseq_getchar(sainseq,position);
+      }
+      currentisStype = (currentcc < nextcc ||
+                        (currentcc == nextcc && nextisStype)) ? true : false;
+      if (!currentisStype && nextisStype)
+      {
+        if (blocks->fill)
+        {
+          blocks->suftab[--fillptr[nextcc]] = (GtUsainindextype) position;
+        } else
+        {
+          fillptr[nextcc]++;
+        }
+      }
+      nextisStype = currentisStype;
+      nextcc = currentcc;
+    }
+    gt_encseq_reader_delete(esr);
+  }
+}
+
+/* Return true if the suffix at <position> is of type S. The type of
+   position <limit> is known to be <limittype>. */
+static bool gt_sain_isStype(const GtSainseq *sainseq,GtUword position,
+                            GtUword limit,bool limittype)
+{
+  GtUword idx, cc = gt_sainseq_getchar(sainseq,position);
+
+  for (idx = position + 1; idx < sainseq->totallength; idx++)
+  {
+    GtUword nextcc = gt_sainseq_getchar(sainseq,idx);
+
+    if (cc != nextcc)
+    {
+      return cc < nextcc ? true : false;
+    }
+    if (idx == limit)
+    {
+      return limittype;
+    }
+  }
+  return true;
+}
+
+static GtUword gt_sain_parallel_insertSstarsuffixes(GtSainseq *sainseq,
+                                                    GtUsainindextype *suftab)
+{
+  GtSainSstarblocks blocks;
+  GtUword numofblocks, blocklength, blocknum, charidx, countSstartype = 0,
+          *blockbounds, *nextcc;
+  GtUsainindextype *fillptrs;
+  bool *nextisStype;
+
+  numofblocks = gt_sain_numofblocks(sainseq->totallength,sainseq->numofchars);
+  blocklength = (sainseq->totallength + numofblocks - 1)/numofblocks;
+  numofblocks = (sainseq->totallength + blocklength - 1)/blocklength;
+  blockbounds = gt_malloc(sizeof *blockbounds * (numofblocks + 1));
+  nextcc = gt_malloc(sizeof *nextcc * numofblocks);
+  nextisStype = gt_malloc(sizeof *nextisStype * numofblocks);
+  fillptrs = gt_calloc((size_t) (numofblocks * sainseq->numofchars),
+                       sizeof *fillptrs);
+  for (blocknum = 0; blocknum < numofblocks; blocknum++)
+  {
+    blockbounds[blocknum] = blocknum * blocklength;
+  }
+  blockbounds[numofblocks] = sainseq->totallength;
+  /* determine the types at the block boundaries from right to left, such
+     that a run of equal characters is never scanned twice */
+  nextcc[numofblocks-1] = GT_UNIQUEINT(sainseq->totallength);
+  nextisStype[numofblocks-1] = true;
+  for (blocknum = numofblocks - 1; blocknum > 0; blocknum--)
+  {
+    nextcc[blocknum-1] = gt_sainseq_getchar(sainseq,blockbounds[blocknum]);
+    nextisStype[blocknum-1] = gt_sain_isStype(sainseq,blockbounds[blocknum],
+                                              blockbounds[blocknum+1],
+                                              nextisStype[blocknum]);
+  }
+  blocks.sainseq = sainseq;
+  blocks.suftab = suftab;
+  blocks.fillptrs = fillptrs;
+  blocks.blockbounds = blockbounds;
+  blocks.nextcc = nextcc;
+  blocks.nextisStype = nextisStype;
+  blocks.fill = false;
+  gt_thread_pool_parallel_for(0,numofblocks,1UL,gt_sain_Sstarblocks_scan,
+                              &blocks);
+  /* the sequential algorithm fills the buckets from their end while
+     scanning the sequence from right to left, so the rightmost block
+     obtains the rightmost entries of each bucket */
+  gt_sain_endbuckets(sainseq);
+  for (charidx = 0; charidx < sainseq->numofchars; charidx++)
+  {
+    GtUsainindextype fillptr = sainseq->bucketfillptr[charidx], count;
+
+    for (blocknum = numofblocks; blocknum > 0; blocknum--)
+    {
+      GtUsainindextype *blockfillptr
+        = fillptrs + (blocknum - 1) * sainseq->numofchars + charidx;
+
+      count = *blockfillptr;
+      *blockfillptr = fillptr;
+      fillptr -= count;
+    }
+    count = sainseq->bucketfillptr[charidx] - fillptr;
+    if (sainseq->sstarfirstcharcount != NULL)
+    {
+      sainseq->sstarfirstcharcount[charidx] += count;
+    }
+    countSstartype += (GtUword) count;
+    sainseq->bucketfillptr[charidx] = fillptr;
+  }
+  blocks.fill = true;
+  gt_thread_pool_parallel_for(0,numofblocks,1UL,gt_sain_Sstarblocks_scan,
+                              &blocks);
+  gt_free(blockbounds);
+  gt_free(nextcc);
+  gt_free(nextisStype);
+  gt_free(fillptrs);
+  gt_assert(GT_MULT2(countSstartype) <= sainseq->totallength);
+  return countSstartype;
+}
+
+typedef struct
+{
+  const GtSainseq *sainseq;
+  const GtSsainindextype *suftab;
+  GtSsainindextype *positions;
+  GtUsainindextype *ccs;
+  bool *marks,
+       ltype;
+  GtUword offset;
+} GtSainInduceblock;
+
+/* Determine the character preceding each suffix of a block of the suffix
+   table and whether the suffix induced from it is to be marked. This is
+   the random access to the sequence, which dominates the induction. */
+static void gt_sain_induceblock_prepare(GtUword start,GtUword end,void *data)
+{
+  GtSainInduceblock *block = (GtSainInduceblock *) data;
+  const GtSainseq *sainseq = block->sainseq;
+  GtUword idx;
+
+  for (idx = start; idx < end; idx++)
+  {
+    GtSsainindextype position = block->suftab[idx];
+    const GtUword bidx = idx - block->offset;
+
+    block->positions[bidx] = position;
+    if (position > 0)
+    {
+      GtUword currentcc = gt_sainseq_getchar(sainseq,(GtUword) --position);
+
+      if (currentcc < sainseq->numofchars)
+      {
+        block->ccs[bidx] = (GtUsainindextype) currentcc;
+        if (block->ltype)
+        {
+          block->marks[bidx]
+            = (position > 0 &&
+               gt_sainseq_getchar(sainseq,(GtUword) (position-1)) < currentcc)
+              ? true : false;
+        } else
+        {
+          block->marks[bidx]
+            = (position == 0 ||
+               gt_sainseq_getchar(sainseq,(GtUword) (position-1)) > currentcc)
+              ? true : false;
+        }
+      } else
+      {
+        block->ccs[bidx] = (GtUsainindextype) sainseq->numofchars;
+      }
+    }
+  }
+}
+
+/* Return the character preceding the suffix <position> > 0 and store in
+   <mark> whether the induced suffix is to be marked, using the prepared
+   values of <block> if they refer to the same suffix. */
+static GtUword gt_sain_induceblock_getchar(const GtSainInduceblock *block,
+                                           GtUword idx,
+                                           GtSsainindextype position,
+                                           bool *mark)
+{
+  const GtSainseq *sainseq = block->sainseq;
+  GtUword currentcc;
+
+  if (block->positions[idx - block->offset] == position)
+  {
+    *mark = block->marks[idx - block->offset];
+    return (GtUword) block->ccs[idx - block->offset];
+  }
+  currentcc = gt_sainseq_getchar(sainseq,(GtUword) --position);
+  if (currentcc < sainseq->numofchars)
+  {
+    if (block->ltype)
+    {
+      *mark = (position > 0 &&
+               gt_sainseq_getchar(sainseq,(GtUword) (position-1)) < currentcc)
+              ? true : false;
+    } else
+    {
+      *mark = (position == 0 ||
+               gt_sainseq_getchar(sainseq,(GtUword) (position-1)) > currentcc)
+              ? true : false;
+    }
+  }
+  return currentcc;
+}
+
+static void gt_sain_induceblock_init(GtSainInduceblock *block,
+                                     const GtSainseq *sainseq,
+                                     const GtSsainindextype *suftab,
+                                     bool ltype)
+{
+  block->sainseq = sainseq;
+  block->suftab = suftab;
+  block->ltype = ltype;
+  block->offset = 0;
+  block->positions = gt_malloc(sizeof *block->positions *
+                               GT_SAIN_INDUCEBLOCKSIZE);
+  block->ccs = gt_malloc(sizeof *block->ccs * GT_SAIN_INDUCEBLOCKSIZE);
+  block->marks = gt_malloc(sizeof *block->marks * GT_SAIN_INDUCEBLOCKSIZE);
+}
+
+static void gt_sain_induceblock_wrap(GtSainInduceblock *block)
+{
+  gt_free(block->positions);
+  gt_free(block->ccs);
+  gt_free(block->marks);
+}
+
+/* The final inductions scan the suffix table block by block. The
+   characters needed for the entries of a block are determined in parallel,
+   while the entries are moved to their buckets sequentially. Entries
+   written into a block after its preparation are recognized by comparing
+   them with the prepared positions. */
+static void gt_sain_parallel_induceLtypesuffixes2(const GtSainseq *sainseq,
+                                                  GtSsainindextype *suftab,
+                                                  GtUword nonspecialentries)
+{
+  GtUword blockstart, lastupdatecc = 0;
+  GtUsainindextype *fillptr = sainseq->bucketfillptr;
+  GtSsainindextype *suftabptr, *bucketptr = NULL;
+  GtSainInduceblock block;
+
+  gt_sain_induceblock_init(&block,sainseq,suftab,true);
+  for (blockstart = 0; blockstart < nonspecialentries;
+       blockstart += GT_SAIN_INDUCEBLOCKSIZE)
+  {
+    const GtUword blockend = GT_MIN(blockstart + GT_SAIN_INDUCEBLOCKSIZE,
+                                    nonspecialentries);
+
+    block.offset = blockstart;
+    gt_thread_pool_parallel_for(blockstart,blockend,0,
+                                gt_sain_induceblock_prepare,&block);
+    for (suftabptr = suftab + blockstart; suftabptr < suftab + blockend;
+         suftabptr++)
+    {
+      GtSsainindextype position = *suftabptr;
+
+      *suftabptr = ~position;
+      if (position > 0)
+      {
+        bool mark = false;
+        GtUword currentcc
+          = gt_sain_induceblock_getchar(&block,(GtUword) (suftabptr - suftab),
+                                        position,&mark);
+
+        if (currentcc < sainseq->numofchars)
+        {
+          position--;
+          gt_assert(currentcc > 0);
+          GT_SAINUPDATEBUCKETPTR(currentcc);
+          gt_assert(bucketptr != NULL && suftabptr < bucketptr);
+          *bucketptr++ = mark ? ~position : position;
+        }
+      }
+    }
+  }
+  gt_sain_induceblock_wrap(&block);
+}
+
+static void gt_sain_parallel_induceStypesuffixes2(const GtSainseq *sainseq,
+                                                  GtSsainindextype *suftab,
+                                                  GtUword nonspecialentries)
+{
+  GtUword blockend, lastupdatecc = 0;
+  GtUsainindextype *fillptr = sainseq->bucketfillptr;
+  GtSsainindextype *suftabptr, *bucketptr = NULL;
+  GtSainInduceblock block;
+
+  gt_sain_special_singleSinduction2(sainseq,
+                                    suftab,
+                                    (GtSsainindextype) sainseq->totallength,
+                                    nonspecialentries);
+  if (sainseq->seqtype == GT_SAIN_ENCSEQ ||
+      sainseq->seqtype == GT_SAIN_BARE_ENCSEQ)
+  {
+    gt_sain_induceStypes2fromspecialranges(sainseq,suftab,nonspecialentries);
+  }
+  gt_sain_induceblock_init(&block,sainseq,suftab,false);
+  for (blockend = nonspecialentries; blockend > 0; blockend = block.offset)
+  {
+    block.offset = blockend > GT_SAIN_INDUCEBLOCKSIZE
+                     ? blockend - GT_SAIN_INDUCEBLOCKSIZE : 0;
+    gt_thread_pool_parallel_for(block.offset,blockend,0,
+                                gt_sain_induceblock_prepare,&block);
+    for (suftabptr = suftab + blockend - 1;
+         suftabptr >= suftab + block.offset; suftabptr--)
+    {
+      GtSsainindextype position;
+
+      if ((position = *suftabptr) > 0)
+      {
+        bool mark = false;
+        GtUword currentcc
+          = gt_sain_induceblock_getchar(&block,(GtUword) (suftabptr - suftab),
+                                        position,&mark);
+
+        if (currentcc < sainseq->numofchars)
+        {
+          position--;
+          GT_SAINUPDATEBUCKETPTR(currentcc);
+          gt_assert(bucketptr != NULL && bucketptr - 1 < suftabptr);
+          *(--bucketptr) = mark ? ~position : position;
+        }
+      } else
+      {
+        *suftabptr = ~position;
+      }
+    }
+  }
+  gt_sain_induceblock_wrap(&block);
+}
+
 static GtUword gt_sain_insertSstarsuffixes(GtSainseq *sainseq,
                                            GtUsainindextype *suftab,
                                            GtLogger *logger)
 {
+  if (gt_sain_useparallel(sainseq))
+  {
+    return gt_sain_parallel_insertSstarsuffixes(sainseq,suftab);
+  }
   switch (sainseq->seqtype)
   {
     case GT_SAIN_PLAINSEQ:
@@ -932,6 +1438,11 @@ static void gt_sain_induceLtypesuffixes2(const GtSainseq *sainseq,
                                          GtSsainindextype *suftab,
                                          GtUword nonspecialentries)
 {
+  if (gt_sain_useparallel(sainseq))
+  {
+    gt_sain_parallel_induceLtypesuffixes2(sainseq,suftab,nonspecialentries);
+    return;
+  }
   switch (sainseq->seqtype)
   {
     case GT_SAIN_PLAINSEQ:
@@ -954,6 +1465,11 @@ static void gt_sain_induceStypesuffixes2(const GtSainseq *sainseq,
                                          GtSsainindextype *suftab,
                                          GtUword nonspecialentries)
 {
+  if (gt_sain_useparallel(sainseq))
+  {
+    gt_sain_parallel_induceStypesuffixes2(sainseq,suftab,nonspecialentries);
+    return;
+  }
   switch (sainseq->seqtype)
   {
     case GT_SAIN_PLAINSEQ:
@@ -1388,7 +1904,9 @@ static void gt_sain_rec_sortsuffixes(unsigned int level,
 {
   GtUword countSstartype;
 
-  GT_SAIN_SHOWTIMER("insert Sstar suffixes");
+  GT_SAIN_SHOWTIMER(gt_sain_useparallel(sainseq)
+                      ? "parallel insert Sstar suffixes"
+                      : "insert Sstar suffixes");
   countSstartype = gt_sain_insertSstarsuffixes(sainseq,suftab,logger);
   gt_logger_log(logger,"level %u: sort sequence of length "GT_WU" over "
                        ""GT_WU" symbols (%.2f)",
@@ -1396,6 +1914,10 @@ static void gt_sain_rec_sortsuffixes(unsigned int level,
           (double) sainseq->numofchars/sainseq->totallength);
   gt_logger_log(logger,"Sstar-type: "GT_WU" (%.2f)",countSstartype,
                  (double) countSstartype/sainseq->totallength);
+  if (gt_sain_useparallel(sainseq))
+  {
+    gt_logger_log(logger,"level %u: use %u threads",level,gt_jobs);
+  }
   if (countSstartype > 0)
   {
     GtUword numberofnames;
@@ -1504,11 +2026,15 @@ static void gt_sain_rec_sortsuffixes(unsigned int level,
                                        nonspecialentries);
   }
   gt_sain_startbuckets(sainseq);
-  GT_SAIN_SHOWTIMER("final induce L suffixes");
+  GT_SAIN_SHOWTIMER(gt_sain_useparallel(sainseq)
+                      ? "parallel final induce L suffixes"
+                      : "final induce L suffixes");
   gt_sain_induceLtypesuffixes2(sainseq,(GtSsainindextype *) suftab,
                                nonspecialentries);
   gt_sain_endbuckets(sainseq);
-  GT_SAIN_SHOWTIMER("final induce S suffixes");
+  GT_SAIN_SHOWTIMER(gt_sain_useparallel(sainseq)
+                      ? "parallel final induce S suffixes"
+                      : "final induce S suffixes");
   gt_sain_induceStypesuffixes2(sainseq,(GtSsainindextype *) suftab,
                                nonspecialentries);
   if (intermediatecheck && nonspecialentries > 0)
@@ -47,7 +47,8 @@ typedef struct
        noshortreadsort,
        outsuftabonfile,
        compressedoutput,
-       withradixsort;
+       withradixsort,
+       withsain; /* sort by induced suffix sorting instead of bucket sort */
 } Sfxstrategy;
 
  /*@unused@*/ static inline void defaultsfxstrategy(Sfxstrategy *sfxstrategy,
@@ -71,6 +72,7 @@ typedef struct
   sfxstrategy->noshortreadsort = false;
   sfxstrategy->compressedoutput = false;
   sfxstrategy->withradixsort = false;
+  sfxstrategy->withsain = false;
   sfxstrategy->userdefinedsortmaxdepth = 0;
 }
 
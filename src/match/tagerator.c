@@ -25,10 +25,15 @@
 #include "core/ma_api.h"
 #include "core/seq_iterator_sequence_buffer_api.h"
 #include "core/str_array.h"
+#include "core/str_api.h"
+#include "core/thread_pool.h"
+#include "core/timer_api.h"
 #include "core/unused_api.h"
+#include "core/xansi_api.h"
 #include "apmeoveridx.h"
 #include "dist-short.h"
 #include "echoseq.h"
+#include "eis-voiditf.h"
 #include "esa-map.h"
 #include "idx-limdfs.h"
 #include "mssufpat.h"
@@ -67,6 +72,7 @@ typedef struct
   GtUword *eqsvector;
   const TgrTagwithlength *twlptr;
   const GtEncseq *encseq;
+  GtStr *outbuf;
 } TgrShowmatchinfo;
 
 #define ADDTABULATOR\
@@ -75,18 +81,36 @@ typedef struct
           firstitem = false;\
         } else\
         {\
-          (void) putchar('\t');\
+          gt_str_append_char(outbuf,'\t');\
         }
 
-static void tgr_showmatch(void *processinfo,const GtIdxMatch *match)
+static void tgr_appendsequence(GtStr *outbuf,
+                               const GtAlphabet *alpha,
+                               const GtUchar *sequence,
+                               GtUword len)
+{
+  GtUword idx;
+  const GtUchar *characters = (alpha == NULL)
+                                ? (const GtUchar *) "acgt"
+                                : gt_alphabet_characters(alpha);
+
+  for (idx = 0; idx < len; idx++)
+  {
+    gt_str_append_char(outbuf,(char) characters[(int) sequence[idx]]);
+  }
+}
+
+static void tgr_formatmatch(GtStr *outbuf,
+                            const TgrShowmatchinfo *showmatchinfo,
+                            bool rcmatch,
+                            const GtIdxMatch *match)
 {
-  TgrShowmatchinfo *showmatchinfo = (TgrShowmatchinfo *) processinfo;
   bool firstitem = true;
 
   gt_assert(showmatchinfo->tageratoroptions != NULL);
   if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_DBLENGTH)
   {
-    printf(""GT_WU"",match->dblen);
+    gt_str_append_uword(outbuf,match->dblen);
     firstitem = false;
   }
   if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_DBSTARTPOS)
@@ -94,7 +118,7 @@ static void tgr_showmatch(void *processinfo,const GtIdxMatch *match)
     ADDTABULATOR;
     if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_DBABSPOS)
     {
-      printf(""GT_WU"",match->dbstartpos);
+      gt_str_append_uword(outbuf,match->dbstartpos);
     } else
     {
       GtUword seqstartpos,
@@ -102,27 +126,29 @@ static void tgr_showmatch(void *processinfo,const GtIdxMatch *match)
                                                   match->dbstartpos);
       seqstartpos = gt_encseq_seqstartpos(showmatchinfo->encseq, seqnum);
       gt_assert(seqstartpos <= match->dbstartpos);
-      printf(""GT_WU"\t"GT_WU"",seqnum, match->dbstartpos - seqstartpos);
+      gt_str_append_uword(outbuf,seqnum);
+      gt_str_append_char(outbuf,'\t');
+      gt_str_append_uword(outbuf,match->dbstartpos - seqstartpos);
     }
   }
   if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_DBSEQUENCE)
   {
     ADDTABULATOR;
     gt_assert(match->dbsubstring != NULL);
-    gt_alphabet_decode_seq_to_fp(showmatchinfo->alpha,
-                                 stdout,
-                                 match->dbsubstring,
-                                 (GtUword) match->dblen);
+    tgr_appendsequence(outbuf,
+                       showmatchinfo->alpha,
+                       match->dbsubstring,
+                       (GtUword) match->dblen);
   }
   if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_STRAND)
   {
     ADDTABULATOR;
-    printf("%c",ISRCDIR(showmatchinfo->twlptr) ? '-' : '+');
+    gt_str_append_char(outbuf,rcmatch ? '-' : '+');
   }
   if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_EDIST)
   {
     ADDTABULATOR;
-    printf(""GT_WU"",match->distance);
+    gt_str_append_uword(outbuf,match->distance);
   }
   if (showmatchinfo->tageratoroptions->maxintervalwidth > 0)
   {
@@ -144,20 +170,19 @@ static void tgr_showmatch(void *processinfo,const GtIdxMatch *match)
         if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_TAGSTARTPOS)
         {
           ADDTABULATOR;
-          printf(""GT_WU"",match->querylen - suffixlength);
+          gt_str_append_uword(outbuf,match->querylen - suffixlength);
         }
         if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_TAGLENGTH)
         {
           ADDTABULATOR;
-          printf(""GT_WU"",suffixlength);
+          gt_str_append_uword(outbuf,suffixlength);
         }
         if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_TAGSUFFIXSEQ)
         {
           ADDTABULATOR;
-          gt_alphabet_decode_seq_to_fp(NULL,
-                                       stdout,showmatchinfo->tagptr +
-                                       (match->querylen - suffixlength),
-                                       suffixlength);
+          tgr_appendsequence(outbuf,NULL,showmatchinfo->tagptr +
+                                         (match->querylen - suffixlength),
+                             suffixlength);
         }
       }
     } else
@@ -165,29 +190,70 @@ static void tgr_showmatch(void *processinfo,const GtIdxMatch *match)
       if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_TAGSTARTPOS)
       {
         ADDTABULATOR;
-        printf("0");
+        gt_str_append_char(outbuf,'0');
       }
       if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_TAGLENGTH)
       {
         ADDTABULATOR;
-        printf(""GT_WU"",match->querylen);
+        gt_str_append_uword(outbuf,match->querylen);
       }
       if (showmatchinfo->tageratoroptions->outputmode & TAGOUT_TAGSUFFIXSEQ)
       {
         ADDTABULATOR;
-        gt_alphabet_decode_seq_to_fp(NULL,
-                                     stdout,
-                                     showmatchinfo->tagptr,
-                                     match->querylen);
+        tgr_appendsequence(outbuf,NULL,showmatchinfo->tagptr,
+                           match->querylen);
       }
     }
   }
   if (!firstitem)
   {
-    printf("\n");
+    gt_str_append_char(outbuf,'\n');
   }
 }
 
+static void tgr_showmatch(void *processinfo,const GtIdxMatch *match)
+{
+  TgrShowmatchinfo *showmatchinfo = (TgrShowmatchinfo *) processinfo;
+
+  tgr_formatmatch(showmatchinfo->outbuf,showmatchinfo,
+                  ISRCDIR(showmatchinfo->twlptr),match);
+  gt_xfwrite(gt_str_get_mem(showmatchinfo->outbuf),sizeof (char),
+             (size_t) gt_str_length(showmatchinfo->outbuf),stdout);
+  gt_str_reset(showmatchinfo->outbuf);
+}
+
+static void tgr_formattag(GtStr *outbuf,
+                          const TageratorOptions *tageratoroptions,
+                          const GtAlphabet *alpha,
+                          uint64_t tagnumber,
+                          const GtUchar *transformedtag,
+                          GtUword taglen)
+{
+  bool firstitem = true;
+
+  gt_str_append_char(outbuf,'#');
+  if (tageratoroptions->outputmode & TAGOUT_TAGNUM)
+  {
+    char buffer[32];
+
+    (void) snprintf(buffer,sizeof buffer,"\t" Formatuint64_t,
+                    PRINTuint64_tcast(tagnumber));
+    gt_str_append_cstr(outbuf,buffer);
+    firstitem = false;
+  }
+  if (tageratoroptions->outputmode & TAGOUT_TAGLENGTH)
+  {
+    ADDTABULATOR;
+    gt_str_append_uword(outbuf,taglen);
+  }
+  if (tageratoroptions->outputmode & TAGOUT_TAGSEQ)
+  {
+    ADDTABULATOR;
+    tgr_appendsequence(outbuf,alpha,transformedtag,taglen);
+  }
+  gt_str_append_char(outbuf,'\n');
+}
+
 typedef struct
 {
   TgrSimplematch *spaceTgrSimplematch;
@@ -535,9 +601,214 @@ static void searchoverstrands(const TageratorOptions *tageratoroptions,
   }
 }
 
+/* Number of tags read before they are searched in parallel. */
+#define TGR_TAGBATCHSIZE 4096
+
+/* Number of tags searched by one task. */
+#define TGR_TAGTASKSIZE  256
+
+typedef struct
+{
+  GtUchar transformedtag[MAXTAGSIZE],
+          rctransformedtag[MAXTAGSIZE];
+  GtUword taglen;
+  uint64_t tagnumber;
+  GtStr *outbuf;
+} TgrBatchtag;
+
+typedef struct
+{
+  const TageratorOptions *tageratoroptions;
+  const FMindex *packedindex;
+  GtUword totallength;
+  const GtAlphabet *alpha;
+  const GtEncseq *encseq;
+  TgrBatchtag *tags;
+} TgrBatchsearchinfo;
+
+/* Exact matching of tags in a packed index does not need the limdfs
+   machinery, so many tags can be searched together. */
+static bool tgr_usebatchsearch(const TageratorOptions *tageratoroptions)
+{
+  return !tageratoroptions->withesa &&
+         !tageratoroptions->doonline &&
+         !tageratoroptions->docompare &&
+         tageratoroptions->userdefinedmaxdistance == 0 &&
+         (tageratoroptions->maxintervalwidth == 0 || !tageratoroptions->skpp);
+}
+
+static void tgr_batchsearchtags(GtUword start,GtUword end,void *data)
+{
+  const TgrBatchsearchinfo *bsi = (const TgrBatchsearchinfo *) data;
+  const TageratorOptions *tageratoroptions = bsi->tageratoroptions;
+  const GtUchar *patterns[2 * TGR_TAGTASKSIZE];
+  GtUword idx, patternnum, numofpatterns = 0,
+          patternlengths[2 * TGR_TAGTASKSIZE];
+  Mbtab bounds[2 * TGR_TAGTASKSIZE];
+  FMindex *view;
+  TgrShowmatchinfo showmatchinfo;
+  GtIdxMatch match;
+  int try;
+
+  gt_assert(end - start <= (GtUword) TGR_TAGTASKSIZE);
+  for (idx = start; idx < end; idx++)
+  {
+    if (!tageratoroptions->nofwdmatch)
+    {
+      patterns[numofpatterns] = bsi->tags[idx].transformedtag;
+      patternlengths[numofpatterns++] = bsi->tags[idx].taglen;
+    }
+    if (!tageratoroptions->norcmatch)
+    {
+      patterns[numofpatterns] = bsi->tags[idx].rctransformedtag;
+      patternlengths[numofpatterns++] = bsi->tags[idx].taglen;
+    }
+  }
+  view = gt_pck_view_new(bsi->packedindex);
+  gt_pck_exactpatternbounds_batch(view,patterns,patternlengths,numofpatterns,
+                                  bounds);
+  showmatchinfo.tageratoroptions = tageratoroptions;
+  showmatchinfo.alphasize = gt_alphabet_num_of_chars(bsi->alpha);
+  showmatchinfo.alpha = bsi->alpha;
+  showmatchinfo.eqsvector = NULL;
+  showmatchinfo.twlptr = NULL;
+  showmatchinfo.encseq = bsi->encseq;
+  showmatchinfo.outbuf = NULL;
+  match.dbabsolute = true;
+  match.querystartpos = 0;
+  match.distance = 0;
+  match.alignment = NULL;
+  patternnum = 0;
+  for (idx = start; idx < end; idx++)
+  {
+    TgrBatchtag *tag = bsi->tags + idx;
+
+    tgr_formattag(tag->outbuf,tageratoroptions,bsi->alpha,tag->tagnumber,
+                  tag->transformedtag,tag->taglen);
+    for (try = 0; try < 2; try++)
+    {
+      if ((try == 0 && !tageratoroptions->nofwdmatch) ||
+          (try == 1 && !tageratoroptions->norcmatch))
+      {
+        showmatchinfo.tagptr = patterns[patternnum];
+        match.dbsubstring = patterns[patternnum];
+        match.dblen = match.querylen = tag->taglen;
+        if (bounds[patternnum].lowerbound < bounds[patternnum].upperbound)
+        {
+          GtUword pos;
+          Bwtseqpositioniterator *bspi
+            = gt_Bwtseqpositioniterator_new(view,
+                                            bounds[patternnum].lowerbound,
+                                            bounds[patternnum].upperbound);
+
+          while (gt_Bwtseqpositioniterator_next(&pos,bspi))
+          {
+            gt_assert(bsi->totallength >= pos + tag->taglen);
+            match.dbstartpos = bsi->totallength - (pos + tag->taglen);
+            tgr_formatmatch(tag->outbuf,&showmatchinfo,try == 1 ? true : false,
+                            &match);
+          }
+          gt_Bwtseqpositioniterator_delete(bspi);
+        }
+        patternnum++;
+      }
+    }
+  }
+  gt_assert(patternnum == numofpatterns);
+  gt_pck_view_delete(view);
+}
+
+static void tgr_batchsearchflush(TgrBatchsearchinfo *bsi,GtUword numoftags)
+{
+  GtUword idx;
+
+  gt_thread_pool_parallel_for(0,numoftags,(GtUword) TGR_TAGTASKSIZE,
+                              tgr_batchsearchtags,bsi);
+  for (idx = 0; idx < numoftags; idx++)
+  {
+    GtStr *outbuf = bsi->tags[idx].outbuf;
+
+    gt_xfwrite(gt_str_get_mem(outbuf),sizeof (char),
+               (size_t) gt_str_length(outbuf),stdout);
+    gt_str_reset(outbuf);
+  }
+}
+
+/* Search the tags delivered by <seqit> in batches, and output the matches
+   in the order of the tags. */
+static int tgr_batchsearch(const TageratorOptions *tageratoroptions,
+                           const Genericindex *genericindex,
+                           const GtAlphabet *alpha,
+                           GtSeqIterator *seqit,
+                           uint64_t *numoftags,
+                           GtError *err)
+{
+  TgrBatchsearchinfo bsi;
+  const GtUchar *symbolmap = gt_alphabet_symbolmap(alpha), *currenttag;
+  GtUword idx, nextfree = 0, taglen;
+  uint64_t tagnumber;
+  char *desc = NULL;
+  bool haserr = false;
+
+  bsi.tageratoroptions = tageratoroptions;
+  bsi.packedindex = genericindex_get_packedindex(genericindex);
+  bsi.totallength = genericindex_get_totallength(genericindex);
+  bsi.alpha = alpha;
+  bsi.encseq = genericindex_getencseq(genericindex);
+  bsi.tags = gt_calloc((size_t) TGR_TAGBATCHSIZE,sizeof *bsi.tags);
+  for (tagnumber = 0; /* Nothing */; tagnumber++)
+  {
+    TgrBatchtag *tag;
+    int retval = gt_seq_iterator_next(seqit, &currenttag, &taglen, &desc,
+                                      err);
+    if (retval != 1)
+    {
+      if (retval < 0)
+      {
+        haserr = true;
+      }
+      break;
+    }
+    tag = bsi.tags + nextfree;
+    if (dotransformtag(tag->transformedtag,
+                       symbolmap,
+                       currenttag,
+                       taglen,
+                       tagnumber,
+                       tageratoroptions->replacewildcard,
+                       err) != 0)
+    {
+      haserr = true;
+      break;
+    }
+    gt_copy_reverse_complement(tag->rctransformedtag,tag->transformedtag,
+                               taglen);
+    tag->taglen = taglen;
+    tag->tagnumber = tagnumber;
+    if (tag->outbuf == NULL)
+    {
+      tag->outbuf = gt_str_new();
+    }
+    if (++nextfree == (GtUword) TGR_TAGBATCHSIZE)
+    {
+      tgr_batchsearchflush(&bsi,nextfree);
+      nextfree = 0;
+    }
+  }
+  /* the matches of the tags preceding an erroneous tag are reported */
+  tgr_batchsearchflush(&bsi,nextfree);
+  for (idx = 0; idx < (GtUword) TGR_TAGBATCHSIZE; idx++)
+  {
+    gt_str_delete(bsi.tags[idx].outbuf);
+  }
+  gt_free(bsi.tags);
+  *numoftags = tagnumber;
+  return haserr ? -1 : 0;
+}
+
 int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
 {
-  bool haserr = false, firstitem;
+  bool haserr = false;
   int retval;
   Myersonlineresources *mor = NULL;
   Genericindex *genericindex = NULL;
@@ -596,6 +867,8 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
     ArrayTgrSimplematch storeonline, storeoffline;
     const AbstractDfstransformer *dfst;
     GtSeqIterator *seqit = NULL;
+    GtTimer *timer = NULL;
+    bool usebatchsearch = tgr_usebatchsearch(tageratoroptions);
 
     if (tageratoroptions->userdefinedmaxdistance >= 0)
     {
@@ -610,6 +883,7 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
     alpha = gt_encseq_alphabet(encseq);
     symbolmap = gt_alphabet_symbolmap(alpha);
     numofchars = gt_alphabet_num_of_chars(alpha);
+    showmatchinfo.outbuf = gt_str_new();
     if (tageratoroptions->docompare)
     {
       processmatch = tgr_storematch;
@@ -639,7 +913,8 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
                                     processmatch,
                                     processmatchinfoonline);
     }
-    if (!tageratoroptions->doonline || tageratoroptions->docompare)
+    if ((!tageratoroptions->doonline || tageratoroptions->docompare) &&
+        !usebatchsearch)
     {
       GtUword maxpathlength;
 
@@ -675,7 +950,20 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
     {
       haserr = true;
     }
-    if (!haserr)
+    if (!haserr && tageratoroptions->benchmark)
+    {
+      timer = gt_timer_new();
+      gt_timer_start(timer);
+    }
+    if (!haserr && usebatchsearch)
+    {
+      if (tgr_batchsearch(tageratoroptions,genericindex,alpha,seqit,
+                          &tagnumber,err) != 0)
+      {
+        haserr = true;
+      }
+      gt_seq_iterator_delete(seqit);
+    } else if (!haserr)
     {
       for (tagnumber = 0; !haserr; tagnumber++)
       {
@@ -699,25 +987,11 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
         gt_copy_reverse_complement(twl.rctransformedtag,twl.transformedtag,
                                    twl.taglen);
         twl.tagptr = twl.transformedtag;
-        firstitem = true;
-        printf("#");
-        if (tageratoroptions->outputmode & TAGOUT_TAGNUM)
-        {
-          printf("\t" Formatuint64_t,PRINTuint64_tcast(tagnumber));
-          firstitem = false;
-        }
-        if (tageratoroptions->outputmode & TAGOUT_TAGLENGTH)
-        {
-          ADDTABULATOR;
-          printf(""GT_WU"",twl.taglen);
-        }
-        if (tageratoroptions->outputmode & TAGOUT_TAGSEQ)
-        {
-          ADDTABULATOR;
-          gt_alphabet_decode_seq_to_fp(alpha,stdout,twl.transformedtag,
-                                       twl.taglen);
-        }
-        printf("\n");
+        tgr_formattag(showmatchinfo.outbuf,tageratoroptions,alpha,tagnumber,
+                      twl.transformedtag,twl.taglen);
+        gt_xfwrite(gt_str_get_mem(showmatchinfo.outbuf),sizeof (char),
+                   (size_t) gt_str_length(showmatchinfo.outbuf),stdout);
+        gt_str_reset(showmatchinfo.outbuf);
         storeoffline.nextfreeTgrSimplematch = 0;
         storeonline.nextfreeTgrSimplematch = 0;
         if (tageratoroptions->userdefinedmaxdistance > 0 &&
@@ -748,9 +1022,22 @@ int gt_runtagerator(const TageratorOptions *tageratoroptions,GtError *err)
       }
       gt_seq_iterator_delete(seqit);
     }
+    if (timer != NULL)
+    {
+      double seconds;
+
+      gt_timer_stop(timer);
+      seconds = (double) gt_timer_elapsed_usec(timer) / 1000000.0;
+      printf("# searched " Formatuint64_t " tags in %.2f seconds "
+             "(%.0f tags per second)\n",
+             PRINTuint64_tcast(tagnumber),seconds,
+             seconds > 0.0 ? (double) tagnumber / seconds : 0.0);
+      gt_timer_delete(timer);
+    }
     GT_FREEARRAY(&storeonline,TgrSimplematch);
     GT_FREEARRAY(&storeoffline,TgrSimplematch);
     gt_free(showmatchinfo.eqsvector);
+    gt_str_delete(showmatchinfo.outbuf);
     if (limdfsresources != NULL)
     {
       gt_freeLimdfsresources(&limdfsresources,dfst);
@@ -23,6 +23,8 @@
 
 #define MERSUFFIX     ".mer"
 #define COUNTSSUFFIX  ".mct"
+#define BUCKETSUFFIX  ".mbd"
+#define MPHSUFFIX     ".mph"
 #define EXTRAINTEGERS 2
 
 #define MERBYTES(SL)  (GT_DIV4(SL) + ((GT_MOD4(SL) == 0) ? 0 : 1UL))
@@ -28,10 +28,10 @@
 #include "core/unused_api.h"
 #include "core/xansi_api.h"
 #include "core/ma_api.h"
+#include "tyr-basic.h"
 #include "tyr-map.h"
 #include "tyr-mersplit.h"
 
-#define BUCKETSUFFIX                     ".mbd"
 #define MAXUCHARVALUEWITHBITS(BITNUM)    ((1 << (BITNUM)) - 1)
 #define ISBOUNDDEFINED(UDB,IDX)          GT_ISIBITSET(UDB,IDX)
 #define SETDEFINEDBOUND(UDB,IDX)         GT_SETIBIT(UDB,IDX)
@@ -0,0 +1,573 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "core/array_api.h"
+#include "core/assert_api.h"
+#include "core/fa_api.h"
+#include "core/ma_api.h"
+#include "core/minmax_api.h"
+#include "core/undef_api.h"
+#include "core/xansi_api.h"
+#include "tyr-basic.h"
+#include "tyr-mph.h"
+
+/* The hash function is constructed level by level as described by
+   Limasset et al. (BBHash, 2017): at each level the remaining mers are
+   hashed into a bit vector of GAMMA times their number of bits, and the mers
+   whose bit is not hit by any other mer are finished there. The hash value of
+   a mer is the number of set bits in front of its bit in the concatenation
+   of all levels. Mers remaining after MAXLEVELS levels are stored in a table
+   sorted by their base hash value.
+
+   Layout of the <.mph> file, all numbers are <uint64_t>:
+   - numofmers, numoflevels, numoffallback, numofbits (of all levels),
+     bitspernumber
+   - the size of each level in bits, a multiple of 64
+   - the bit vectors of all levels
+   - for each block of RANKBLOCKBITS bits, the number of set bits in front
+   - numoffallback pairs of hash value and mer number, sorted
+   - the mer number of each hash value, packed into bitspernumber bits */
+
+#define GAMMA           2
+#define MAXLEVELS       32
+#define RANKBLOCKBITS   512
+#define RANKBLOCKWORDS  (RANKBLOCKBITS/64)
+#define HEADERWORDS     5
+
+#ifdef __GNUC__
+#define TYRMPH_PREFETCH(ADDR) __builtin_prefetch(ADDR)
+#else
+#define TYRMPH_PREFETCH(ADDR) /* Nothing */
+#endif
+
+struct Tyrmphinfo
+{
+  void *mappedmphfileptr;
+  const GtUchar *mertable;
+  GtUword merbytes;
+  uint64_t numofmers,
+           numoflevels,
+           numoffallback,
+           numofbits,
+           bitspernumber,
+           leveloffset[MAXLEVELS+1];
+  const uint64_t *levelsize,
+                 *bits,
+                 *rankblocks,
+                 *fallback,
+                 *mernumbers;
+};
+
+static uint64_t tyrmph_mix(uint64_t key)
+{
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  key *= 0xc4ceb9fe1a85ec53ULL;
+  key ^= key >> 33;
+  return key;
+}
+
+static uint64_t tyrmph_basehash(GtUword merbytes,const GtUchar *bytecode)
+{
+  uint64_t hashvalue = (uint64_t) merbytes, chunk;
+  GtUword idx;
+
+  for (idx = 0; idx + sizeof chunk <= merbytes; idx += sizeof chunk)
+  {
+    memcpy(&chunk,bytecode + idx,sizeof chunk);
+    hashvalue = tyrmph_mix(hashvalue ^ chunk);
+  }
+  if (idx < merbytes)
+  {
+    chunk = 0;
+    memcpy(&chunk,bytecode + idx,(size_t) (merbytes - idx));
+    hashvalue = tyrmph_mix(hashvalue ^ chunk);
+  }
+  return hashvalue;
+}
+
+static uint64_t tyrmph_levelposition(uint64_t hashvalue,uint64_t level,
+                                     uint64_t levelsize)
+{
+  return tyrmph_mix(hashvalue + (level + 1) * 0x9e3779b97f4a7c15ULL)
+         % levelsize;
+}
+
+#define TYRMPH_ISSET(BITS,POS)  (((BITS)[(POS) >> 6] >> ((POS) & 63)) & 1)
+#define TYRMPH_SET(BITS,POS)    (BITS)[(POS) >> 6] |= (1ULL << ((POS) & 63))
+
+static unsigned int tyrmph_popcount(uint64_t word)
+{
+#ifdef __GNUC__
+  return (unsigned int) __builtin_popcountll(word);
+#else
+  unsigned int count;
+
+  for (count = 0; word != 0; count++)
+  {
+    word &= word - 1;
+  }
+  return count;
+#endif
+}
+
+static uint64_t tyrmph_rank(const Tyrmphinfo *tyrmphinfo,uint64_t position)
+{
+  uint64_t word, rank = tyrmphinfo->rankblocks[position/RANKBLOCKBITS];
+
+  for (word = position/RANKBLOCKBITS * RANKBLOCKWORDS; word < position >> 6;
+       word++)
+  {
+    rank += tyrmph_popcount(tyrmphinfo->bits[word]);
+  }
+  if ((position & 63) > 0)
+  {
+    rank += tyrmph_popcount(tyrmphinfo->bits[word]
+                            & ((1ULL << (position & 63)) - 1));
+  }
+  return rank;
+}
+
+static uint64_t tyrmph_getnumber(const uint64_t *numbers,uint64_t width,
+                                 uint64_t idx)
+{
+  uint64_t bitpos = idx * width, word = bitpos >> 6,
+           shift = bitpos & 63, value = numbers[word] >> shift;
+
+  if (shift + width > 64)
+  {
+    value |= numbers[word+1] << (64 - shift);
+  }
+  return width == 64 ? value : (value & ((1ULL << width) - 1));
+}
+
+static void tyrmph_setnumber(uint64_t *numbers,uint64_t width,uint64_t idx,
+                             uint64_t value)
+{
+  uint64_t bitpos = idx * width, word = bitpos >> 6, shift = bitpos & 63;
+
+  numbers[word] |= value << shift;
+  if (shift + width > 64)
+  {
+    numbers[word+1] |= value >> (64 - shift);
+  }
+}
+
+uint64_t gt_tyrmphinfo_hash(const Tyrmphinfo *tyrmphinfo,
+                            const GtUchar *bytecode)
+{
+  return tyrmph_basehash(tyrmphinfo->merbytes,bytecode);
+}
+
+void gt_tyrmphinfo_prefetch(const Tyrmphinfo *tyrmphinfo,uint64_t hashvalue)
+{
+  if (tyrmphinfo->numoflevels > 0)
+  {
+    uint64_t position = tyrmph_levelposition(hashvalue,0,
+                                             tyrmphinfo->levelsize[0]);
+    TYRMPH_PREFETCH(tyrmphinfo->bits + (position >> 6));
+    TYRMPH_PREFETCH(tyrmphinfo->rankblocks + position/RANKBLOCKBITS);
+  }
+}
+
+GtUword gt_tyrmphinfo_mernumber(const Tyrmphinfo *tyrmphinfo,
+                                uint64_t hashvalue,
+                                const GtUchar *bytecode)
+{
+  uint64_t level, left, right;
+
+  for (level = 0; level < tyrmphinfo->numoflevels; level++)
+  {
+    uint64_t position = tyrmphinfo->leveloffset[level]
+                        + tyrmph_levelposition(hashvalue,level,
+                                               tyrmphinfo->levelsize[level]);
+    if (TYRMPH_ISSET(tyrmphinfo->bits,position))
+    {
+      return (GtUword) tyrmph_getnumber(tyrmphinfo->mernumbers,
+                                        tyrmphinfo->bitspernumber,
+                                        tyrmph_rank(tyrmphinfo,position));
+    }
+  }
+  /* leftmost fallback entry with the given hash value */
+  left = 0;
+  right = tyrmphinfo->numoffallback;
+  while (left < right)
+  {
+    uint64_t mid = left + (right - left)/2;
+    if (tyrmphinfo->fallback[2 * mid] < hashvalue)
+    {
+      left = mid + 1;
+    } else
+    {
+      right = mid;
+    }
+  }
+  for (/* Nothing */; left < tyrmphinfo->numoffallback &&
+                      tyrmphinfo->fallback[2 * left] == hashvalue; left++)
+  {
+    GtUword mernumber = (GtUword) tyrmphinfo->fallback[2 * left + 1];
+    if (memcmp(tyrmphinfo->mertable + mernumber * tyrmphinfo->merbytes,
+               bytecode,(size_t) tyrmphinfo->merbytes) == 0)
+    {
+      return mernumber;
+    }
+  }
+  return GT_UNDEF_UWORD;
+}
+
+const GtUchar *gt_searchinmerhash(const Tyrindex *tyrindex,
+                                  const Tyrmphinfo *tyrmphinfo,
+                                  const GtUchar *bytecode)
+{
+  GtUword mernumber, merbytes = gt_tyrindex_merbytes(tyrindex);
+  const GtUchar *mer;
+
+  mernumber = gt_tyrmphinfo_mernumber(tyrmphinfo,
+                                      gt_tyrmphinfo_hash(tyrmphinfo,bytecode),
+                                      bytecode);
+  if (mernumber == GT_UNDEF_UWORD)
+  {
+    return NULL;
+  }
+  mer = gt_tyrindex_mertable(tyrindex) + mernumber * merbytes;
+  return memcmp(mer,bytecode,(size_t) merbytes) == 0 ? mer : NULL;
+}
+
+static int tyrmph_comparefallback(const void *a,const void *b)
+{
+  const uint64_t *fa = a, *fb = b;
+
+  if (fa[0] != fb[0])
+  {
+    return fa[0] < fb[0] ? -1 : 1;
+  }
+  if (fa[1] != fb[1])
+  {
+    return fa[1] < fb[1] ? -1 : 1;
+  }
+  return 0;
+}
+
+int gt_constructmerhash(const char *tyrindexname,bool verbose,GtError *err)
+{
+  Tyrindex *tyrindex;
+  GtArray *levelbits;
+  uint64_t *bits = NULL, *collisions = NULL, *rankblocks = NULL,
+           *fallback = NULL, *mernumbers = NULL, header[HEADERWORDS],
+           levelsize[MAXLEVELS], numofmers, numoflevels = 0, numofbits = 0,
+           numofremaining, level, idx, bitspernumber, numofrankblocks,
+           numofnumberwords, numofsetbits;
+  GtUword *remaining = NULL, merbytes;
+  const GtUchar *mertable;
+  FILE *mphfp = NULL;
+  bool haserr = false;
+
+  gt_error_check(err);
+  tyrindex = gt_tyrindex_new(tyrindexname,err);
+  if (tyrindex == NULL)
+  {
+    return -1;
+  }
+  if (gt_tyrindex_isempty(tyrindex))
+  {
+    gt_tyrindex_delete(&tyrindex);
+    return 0;
+  }
+  mertable = gt_tyrindex_mertable(tyrindex);
+  merbytes = gt_tyrindex_merbytes(tyrindex);
+  numofmers = (uint64_t) gt_tyrindex_ptr2number(tyrindex,
+                                                gt_tyrindex_lastmer(tyrindex))
+              + 1;
+  levelbits = gt_array_new(sizeof (uint64_t));
+  remaining = gt_malloc(sizeof *remaining * GT_MAX(numofmers,1UL));
+  for (idx = 0; idx < numofmers; idx++)
+  {
+    remaining[idx] = (GtUword) idx;
+  }
+  numofremaining = numofmers;
+  while (numofremaining > 0 && numoflevels < MAXLEVELS)
+  {
+    uint64_t size = GT_MAX(64ULL, (GAMMA * numofremaining + 63) & ~63ULL),
+             words = size >> 6, kept = 0;
+
+    collisions = gt_realloc(collisions,sizeof *collisions * words);
+    memset(collisions,0,sizeof *collisions * words);
+    bits = gt_realloc(bits,sizeof *bits * words);
+    memset(bits,0,sizeof *bits * words);
+    for (idx = 0; idx < numofremaining; idx++)
+    {
+      uint64_t position
+        = tyrmph_levelposition(tyrmph_basehash(merbytes,mertable +
+                                               remaining[idx] * merbytes),
+                               numoflevels,size);
+      if (TYRMPH_ISSET(bits,position))
+      {
+        TYRMPH_SET(collisions,position);
+      } else
+      {
+        TYRMPH_SET(bits,position);
+      }
+    }
+    for (idx = 0; idx < numofremaining; idx++)
+    {
+      uint64_t position
+        = tyrmph_levelposition(tyrmph_basehash(merbytes,mertable +
+                                               remaining[idx] * merbytes),
+                               numoflevels,size);
+      if (TYRMPH_ISSET(collisions,position))
+      {
+        remaining[kept++] = remaining[idx];
+      }
+    }
+    for (idx = 0; idx < words; idx++)
+    {
+      bits[idx] &= ~collisions[idx];
+      gt_array_add(levelbits,bits[idx]);
+    }
+    levelsize[numoflevels++] = size;
+    numofbits += size;
+    numofremaining = kept;
+  }
+  gt_free(bits);
+  gt_free(collisions);
+  bits = gt_array_get_space(levelbits);
+
+  /* the remaining mers are found by binary search on their hash value */
+  fallback = gt_malloc(sizeof *fallback * 2 * GT_MAX(numofremaining,1ULL));
+  for (idx = 0; idx < numofremaining; idx++)
+  {
+    fallback[2 * idx] = tyrmph_basehash(merbytes,
+                                        mertable + remaining[idx] * merbytes);
+    fallback[2 * idx + 1] = (uint64_t) remaining[idx];
+  }
+  qsort(fallback,(size_t) numofremaining,2 * sizeof *fallback,
+        tyrmph_comparefallback);
+  gt_free(remaining);
+
+  numofrankblocks = (numofbits + RANKBLOCKBITS - 1)/RANKBLOCKBITS;
+  rankblocks = gt_malloc(sizeof *rankblocks * GT_MAX(numofrankblocks,1ULL));
+  for (idx = 0, numofsetbits = 0; idx < numofrankblocks; idx++)
+  {
+    uint64_t word;
+
+    rankblocks[idx] = numofsetbits;
+    for (word = idx * RANKBLOCKWORDS;
+         word < GT_MIN((idx + 1) * RANKBLOCKWORDS,numofbits >> 6); word++)
+    {
+      numofsetbits += tyrmph_popcount(bits[word]);
+    }
+  }
+  gt_assert(numofsetbits + numofremaining == numofmers);
+
+  bitspernumber = 1;
+  while (bitspernumber < 64 && (numofmers >> bitspernumber) > 0)
+  {
+    bitspernumber++;
+  }
+  numofnumberwords = ((numofmers - numofremaining) * bitspernumber + 63) >> 6;
+  mernumbers = gt_calloc((size_t) GT_MAX(numofnumberwords,1ULL),
+                         sizeof *mernumbers);
+  {
+    Tyrmphinfo tyrmphinfo;
+    uint64_t offset = 0;
+
+    tyrmphinfo.numoflevels = numoflevels;
+    tyrmphinfo.levelsize = levelsize;
+    tyrmphinfo.bits = bits;
+    tyrmphinfo.rankblocks = rankblocks;
+    for (level = 0; level < numoflevels; level++)
+    {
+      tyrmphinfo.leveloffset[level] = offset;
+      offset += levelsize[level];
+    }
+    for (idx = 0; idx < numofmers; idx++)
+    {
+      uint64_t hashvalue = tyrmph_basehash(merbytes,mertable + idx * merbytes);
+
+      for (level = 0; level < numoflevels; level++)
+      {
+        uint64_t position = tyrmphinfo.leveloffset[level]
+                            + tyrmph_levelposition(hashvalue,level,
+                                                   levelsize[level]);
+        if (TYRMPH_ISSET(bits,position))
+        {
+          tyrmph_setnumber(mernumbers,bitspernumber,
+                           tyrmph_rank(&tyrmphinfo,position),idx);
+          break;
+        }
+      }
+    }
+  }
+  if (verbose)
+  {
+    printf("# minimal perfect hash: "GT_WU" levels, "GT_WU" mers in fallback "
+           "table, %.2f bits per mer\n",(GtUword) numoflevels,
+           (GtUword) numofremaining,
+           numofmers == 0 ? 0.0
+                          : (double) (numofbits + 64 * numofrankblocks
+                                      + 128 * numofremaining
+                                      + 64 * numofnumberwords)
+                            / numofmers);
+  }
+
+  mphfp = gt_fa_fopen_with_suffix(tyrindexname,MPHSUFFIX,"wb",err);
+  if (mphfp == NULL)
+  {
+    haserr = true;
+  }
+  if (!haserr)
+  {
+    header[0] = numofmers;
+    header[1] = numoflevels;
+    header[2] = numofremaining;
+    header[3] = numofbits;
+    header[4] = bitspernumber;
+    gt_xfwrite(header,sizeof *header,(size_t) HEADERWORDS,mphfp);
+    gt_xfwrite(levelsize,sizeof *levelsize,(size_t) numoflevels,mphfp);
+    gt_xfwrite(bits,sizeof *bits,(size_t) (numofbits >> 6),mphfp);
+    gt_xfwrite(rankblocks,sizeof *rankblocks,(size_t) numofrankblocks,mphfp);
+    gt_xfwrite(fallback,sizeof *fallback,(size_t) (2 * numofremaining),mphfp);
+    gt_xfwrite(mernumbers,sizeof *mernumbers,(size_t) numofnumberwords,mphfp);
+  }
+  gt_fa_xfclose(mphfp);
+  gt_array_delete(levelbits);
+  gt_free(rankblocks);
+  gt_free(fallback);
+  gt_free(mernumbers);
+  gt_tyrindex_delete(&tyrindex);
+  return haserr ? -1 : 0;
+}
+
+Tyrmphinfo *gt_tyrmphinfo_new(const char *tyrindexname,
+                              const Tyrindex *tyrindex,
+                              GtError *err)
+{
+  size_t numofbytes;
+  Tyrmphinfo *tyrmphinfo;
+  const uint64_t *words;
+  uint64_t level, expected;
+  bool haserr = false;
+
+  gt_error_check(err);
+  tyrmphinfo = gt_malloc(sizeof *tyrmphinfo);
+  tyrmphinfo->mappedmphfileptr = gt_fa_mmap_read_with_suffix(tyrindexname,
+                                                             MPHSUFFIX,
+                                                             &numofbytes,err);
+  if (tyrmphinfo->mappedmphfileptr == NULL)
+  {
+    haserr = true;
+  }
+  if (!haserr && numofbytes < sizeof *words * HEADERWORDS)
+  {
+    gt_error_set(err,"file %s%s is too short",tyrindexname,MPHSUFFIX);
+    haserr = true;
+  }
+  if (!haserr)
+  {
+    words = (const uint64_t *) tyrmphinfo->mappedmphfileptr;
+    tyrmphinfo->numofmers = words[0];
+    tyrmphinfo->numoflevels = words[1];
+    tyrmphinfo->numoffallback = words[2];
+    tyrmphinfo->numofbits = words[3];
+    tyrmphinfo->bitspernumber = words[4];
+    expected = HEADERWORDS + tyrmphinfo->numoflevels
+               + (tyrmphinfo->numofbits >> 6)
+               + (tyrmphinfo->numofbits + RANKBLOCKBITS - 1)/RANKBLOCKBITS
+               + 2 * tyrmphinfo->numoffallback
+               + (((tyrmphinfo->numofmers - tyrmphinfo->numoffallback)
+                   * tyrmphinfo->bitspernumber + 63) >> 6);
+    if (tyrmphinfo->numoflevels > (uint64_t) MAXLEVELS ||
+        tyrmphinfo->numoffallback > tyrmphinfo->numofmers ||
+        numofbytes != sizeof *words * expected)
+    {
+      gt_error_set(err,"file %s%s is corrupt",tyrindexname,MPHSUFFIX);
+      haserr = true;
+    }
+  }
+  if (!haserr && tyrmphinfo->numofmers !=
+                 (gt_tyrindex_isempty(tyrindex)
+                  ? 0
+                  : (uint64_t) gt_tyrindex_ptr2number(tyrindex,
+                                               gt_tyrindex_lastmer(tyrindex))
+                    + 1))
+  {
+    gt_error_set(err,"file %s%s does not belong to index %s",tyrindexname,
+                 MPHSUFFIX,tyrindexname);
+    haserr = true;
+  }
+  if (!haserr)
+  {
+    uint64_t offset = 0;
+
+    tyrmphinfo->mertable = gt_tyrindex_mertable(tyrindex);
+    tyrmphinfo->merbytes = gt_tyrindex_merbytes(tyrindex);
+    tyrmphinfo->levelsize = words + HEADERWORDS;
+    for (level = 0; level < tyrmphinfo->numoflevels; level++)
+    {
+      tyrmphinfo->leveloffset[level] = offset;
+      offset += tyrmphinfo->levelsize[level];
+    }
+    tyrmphinfo->leveloffset[tyrmphinfo->numoflevels] = offset;
+    tyrmphinfo->bits = tyrmphinfo->levelsize + tyrmphinfo->numoflevels;
+    tyrmphinfo->rankblocks = tyrmphinfo->bits + (tyrmphinfo->numofbits >> 6);
+    tyrmphinfo->fallback = tyrmphinfo->rankblocks
+                           + (tyrmphinfo->numofbits + RANKBLOCKBITS - 1)
+                             /RANKBLOCKBITS;
+    tyrmphinfo->mernumbers = tyrmphinfo->fallback
+                             + 2 * tyrmphinfo->numoffallback;
+  }
+  if (haserr)
+  {
+    gt_fa_xmunmap(tyrmphinfo->mappedmphfileptr);
+    gt_free(tyrmphinfo);
+    return NULL;
+  }
+  return tyrmphinfo;
+}
+
+void gt_tyrmphinfo_delete(Tyrmphinfo **tyrmphinfoptr)
+{
+  Tyrmphinfo *tyrmphinfo = *tyrmphinfoptr;
+
+  gt_fa_xmunmap(tyrmphinfo->mappedmphfileptr);
+  tyrmphinfo->mappedmphfileptr = NULL;
+  gt_free(tyrmphinfo);
+  *tyrmphinfoptr = NULL;
+}
+
+void gt_tyrmphinfo_check(const Tyrmphinfo *tyrmphinfo,
+                         const Tyrindex *tyrindex)
+{
+  const GtUchar *mercodeptr, *result;
+  GtUword merbytes = gt_tyrindex_merbytes(tyrindex);
+
+  for (mercodeptr = gt_tyrindex_mertable(tyrindex);
+       mercodeptr <= gt_tyrindex_lastmer(tyrindex);
+       mercodeptr += merbytes)
+  {
+    result = gt_searchinmerhash(tyrindex,tyrmphinfo,mercodeptr);
+    if (result != mercodeptr)
+    {
+      fprintf(stderr,"mer "GT_WU" is not found by the hash function\n",
+              gt_tyrindex_ptr2number(tyrindex,mercodeptr));
+      exit(GT_EXIT_PROGRAMMING_ERROR);
+    }
+  }
+}
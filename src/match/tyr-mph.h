@@ -0,0 +1,63 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef TYR_MPH_H
+#define TYR_MPH_H
+
+#include <stdint.h>
+#include "core/error_api.h"
+#include "core/types_api.h"
+#include "tyr-map.h"
+
+/* A minimal perfect hash function over the mers of a tallymer index, stored
+   in a file with suffix <.mph>. It maps each mer of the index to a unique
+   number, from which the position of the mer in the mertable is looked up.
+   A lookup touches about two cache lines instead of the log2(n) cache lines
+   of a binary search. The hash values of mers not in the index are
+   arbitrary, so a candidate found by <gt_tyrmphinfo_mernumber()> has to be
+   compared with the query. */
+typedef struct Tyrmphinfo Tyrmphinfo;
+
+int gt_constructmerhash(const char *tyrindexname,bool verbose,GtError *err);
+
+Tyrmphinfo *gt_tyrmphinfo_new(const char *tyrindexname,
+                              const Tyrindex *tyrindex,
+                              GtError *err);
+
+void gt_tyrmphinfo_delete(Tyrmphinfo **tyrmphinfoptr);
+
+/* Return the hash value of the mer <bytecode>. */
+uint64_t gt_tyrmphinfo_hash(const Tyrmphinfo *tyrmphinfo,
+                            const GtUchar *bytecode);
+
+/* Prefetch the memory accessed first when looking up <hashvalue>. */
+void gt_tyrmphinfo_prefetch(const Tyrmphinfo *tyrmphinfo,uint64_t hashvalue);
+
+/* Return the number of the only mer in the index which may be equal to the
+   mer <bytecode> with hash value <hashvalue>, or GT_UNDEF_UWORD. */
+GtUword gt_tyrmphinfo_mernumber(const Tyrmphinfo *tyrmphinfo,
+                                uint64_t hashvalue,
+                                const GtUchar *bytecode);
+
+/* Verify that each mer of <tyrindex> is found by <tyrmphinfo>. */
+void gt_tyrmphinfo_check(const Tyrmphinfo *tyrmphinfo,
+                         const Tyrindex *tyrindex);
+
+/*@null@*/ const GtUchar *gt_searchinmerhash(const Tyrindex *tyrindex,
+                                             const Tyrmphinfo *tyrmphinfo,
+                                             const GtUchar *bytecode);
+
+#endif
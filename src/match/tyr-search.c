@@ -15,49 +15,120 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <stdio.h>
+#include <string.h>
 #include "core/alphabet.h"
 #include "core/fa_api.h"
+#include "core/fileutils_api.h"
 #include "core/unused_api.h"
 #include "core/seq_iterator_sequence_buffer_api.h"
 #include "core/chardef_api.h"
 #include "core/format64.h"
 #include "core/encseq.h"
 #include "core/ma_api.h"
+#include "core/minmax_api.h"
+#include "core/str_api.h"
+#include "core/thread_pool.h"
+#include "core/undef_api.h"
+#include "core/xansi_api.h"
 #include "revcompl.h"
+#include "tyr-basic.h"
 #include "tyr-map.h"
 #include "tyr-search.h"
 #include "tyr-show.h"
 #include "tyr-mersplit.h"
+#include "tyr-mph.h"
+
+/* Number of mers looked up together. The lookups of a batch are processed
+   in stages, so that the memory accessed by one stage is prefetched while
+   the previous stage is completed for the other mers of the batch. */
+#define TYRSEARCHBATCH         64
+
+/* Number of mer start positions of a query searched by one task. */
+#define TYRSEARCHTASKWIDTH     ((GtUword) 1 << 16)
+
+/* Total length of the query sequences read before the tasks are run, for
+   each worker of the thread pool. */
+#define TYRSEARCHCHUNKLENGTH   ((GtUword) 1 << 22)
+
+#ifdef __GNUC__
+#define TYRSEARCH_PREFETCH(PTR) __builtin_prefetch(PTR)
+#else
+#define TYRSEARCH_PREFETCH(PTR) /* Nothing */
+#endif
 
 typedef struct
 {
-  GtUchar *bytecode,  /* buffer for encoded word to be searched */
-        *rcbuf;
+  const Tyrindex *tyrindex;
+  const Tyrcountinfo *tyrcountinfo;
+  const Tyrbckinfo *tyrbckinfo;
+  const Tyrmphinfo *tyrmphinfo;
   const GtUchar *mertable, *lastmer;
-  GtUword mersize;
+  GtUword mersize, merbytes;
   unsigned int showmode,
                searchstrand;
   GtAlphabet *dnaalpha;
 } Tyrsearchinfo;
 
-static void gt_tyrsearchinfo_init(Tyrsearchinfo *tyrsearchinfo,
-                               const Tyrindex *tyrindex,
-                               unsigned int showmode,
-                               unsigned int searchstrand)
+typedef struct
+{
+  const GtUchar *qptr,   /* position of the mer in the query */
+                *result; /* the mer in the mertable or NULL */
+  uint64_t hashvalue;
+  bool forward;
+} Tyrsearchkey;
+
+/* The state of a worker, allocated when the worker runs its first task. */
+typedef struct
 {
-  GtUword merbytes;
+  GtUchar *bytecodes,  /* buffer for the encoded words to be searched */
+          *rcbuf;
+  Tyrsearchkey keys[TYRSEARCHBATCH];
+  GtUword nextfree;
+} Tyrsearchbatch;
 
-  merbytes = gt_tyrindex_merbytes(tyrindex);
+/* The mer start positions from <startpos> to <endpos>-1 of a query. */
+typedef struct
+{
+  uint64_t unitnum;
+  GtUword seqoffset,
+          querylen,
+          startpos,
+          endpos;
+  GtStr *output;
+} Tyrsearchtask;
+
+typedef struct
+{
+  const Tyrsearchinfo *tyrsearchinfo;
+  GtThreadPoolScratch *scratch;
+  GtUchar *sequences;
+  GtUword allocatedsequences,
+          totallength;
+  Tyrsearchtask *tasks;
+  GtUword allocatedtasks,
+          nextfreetask;
+} Tyrsearchchunk;
+
+static void gt_tyrsearchinfo_init(Tyrsearchinfo *tyrsearchinfo,
+                                  const Tyrindex *tyrindex,
+                                  const Tyrcountinfo *tyrcountinfo,
+                                  const Tyrbckinfo *tyrbckinfo,
+                                  const Tyrmphinfo *tyrmphinfo,
+                                  unsigned int showmode,
+                                  unsigned int searchstrand)
+{
+  tyrsearchinfo->tyrindex = tyrindex;
+  tyrsearchinfo->tyrcountinfo = tyrcountinfo;
+  tyrsearchinfo->tyrbckinfo = tyrbckinfo;
+  tyrsearchinfo->tyrmphinfo = tyrmphinfo;
+  tyrsearchinfo->merbytes = gt_tyrindex_merbytes(tyrindex);
   tyrsearchinfo->mersize = gt_tyrindex_mersize(tyrindex);
   tyrsearchinfo->mertable = gt_tyrindex_mertable(tyrindex);
   tyrsearchinfo->lastmer = gt_tyrindex_lastmer(tyrindex);
   tyrsearchinfo->showmode = showmode;
   tyrsearchinfo->searchstrand = searchstrand;
   tyrsearchinfo->dnaalpha = gt_alphabet_new_dna();
-  tyrsearchinfo->bytecode = gt_malloc(sizeof *tyrsearchinfo->bytecode
-                                      * merbytes);
-  tyrsearchinfo->rcbuf = gt_malloc(sizeof *tyrsearchinfo->rcbuf
-                                   * tyrsearchinfo->mersize);
 }
 
 static void gt_tyrsearchinfo_delete(Tyrsearchinfo *tyrsearchinfo)
@@ -65,44 +136,40 @@ static void gt_tyrsearchinfo_delete(Tyrsearchinfo *tyrsearchinfo)
   if (tyrsearchinfo != NULL)
   {
     gt_alphabet_delete(tyrsearchinfo->dnaalpha);
-    gt_free(tyrsearchinfo->bytecode);
-    gt_free(tyrsearchinfo->rcbuf);
   }
 }
 
-/*@null@*/ const GtUchar *gt_searchsinglemer(const GtUchar *qptr,
-                                        const Tyrindex *tyrindex,
-                                        const Tyrsearchinfo *tyrsearchinfo,
-                                        const Tyrbckinfo *tyrbckinfo)
+static Tyrsearchbatch *gt_tyrsearchbatch_get(GtThreadPoolScratch *scratch,
+                                             const Tyrsearchinfo
+                                               *tyrsearchinfo)
 {
-  const GtUchar *result;
+  Tyrsearchbatch *batch = gt_thread_pool_scratch_get(scratch);
 
-  gt_encseq_plainseq2bytecode(tyrsearchinfo->bytecode,qptr,
-                                       tyrsearchinfo->mersize);
-  if (tyrbckinfo == NULL)
-  {
-    result = gt_tyrindex_binmersearch(tyrindex,0,tyrsearchinfo->bytecode,
-                                   tyrsearchinfo->mertable,
-                                   tyrsearchinfo->lastmer);
-  } else
+  if (batch->bytecodes == NULL)
   {
-    result = gt_searchinbuckets(tyrindex,tyrbckinfo,tyrsearchinfo->bytecode);
+    batch->bytecodes = gt_malloc(sizeof *batch->bytecodes
+                                 * TYRSEARCHBATCH * tyrsearchinfo->merbytes);
+    batch->rcbuf = gt_malloc(sizeof *batch->rcbuf * tyrsearchinfo->mersize);
   }
-  return result;
+  return batch;
 }
 
-#define ADDTABULATOR\
-        if (firstitem)\
-        {\
-          firstitem = false;\
-        } else\
-        {\
-          (void) putchar('\t');\
-        }
+static void gt_tyrsearchbatch_wrap(GtThreadPoolScratch *scratch)
+{
+  unsigned int idx;
+
+  for (idx = 0; idx < gt_thread_pool_scratch_size(scratch); idx++)
+  {
+    Tyrsearchbatch *batch = gt_thread_pool_scratch_get_by_id(scratch,idx);
 
-static void mermatchoutput(const Tyrindex *tyrindex,
-                           const Tyrcountinfo *tyrcountinfo,
-                           const Tyrsearchinfo *tyrsearchinfo,
+    gt_free(batch->bytecodes);
+    gt_free(batch->rcbuf);
+  }
+  gt_thread_pool_scratch_delete(scratch);
+}
+
+static void mermatchoutput(const Tyrsearchinfo *tyrsearchinfo,
+                           GtStr *output,
                            const GtUchar *result,
                            const GtUchar *query,
                            const GtUchar *qptr,
@@ -110,58 +177,176 @@ static void mermatchoutput(const Tyrindex *tyrindex,
                            bool forward)
 {
   bool firstitem = true;
-  GtUword queryposition;
+  char buffer[32];
 
-  queryposition = (GtUword) (qptr-query);
   if (tyrsearchinfo->showmode & SHOWQSEQNUM)
   {
-    printf(Formatuint64_t,PRINTuint64_tcast(unitnum));
+    (void) snprintf(buffer,sizeof buffer,Formatuint64_t,
+                    PRINTuint64_tcast(unitnum));
+    gt_str_append_cstr(output,buffer);
     firstitem = false;
   }
   if (tyrsearchinfo->showmode & SHOWQPOS)
   {
-    ADDTABULATOR;
-    printf("%c"GT_WU"",forward ? '+' : '-',queryposition);
+    if (!firstitem)
+    {
+      gt_str_append_char(output,'\t');
+    }
+    firstitem = false;
+    gt_str_append_char(output,forward ? '+' : '-');
+    gt_str_append_uword(output,(GtUword) (qptr-query));
   }
   if (tyrsearchinfo->showmode & SHOWCOUNTS)
   {
-    GtUword mernumber = gt_tyrindex_ptr2number(tyrindex,result);
-    ADDTABULATOR;
-    printf(""GT_WU"",gt_tyrcountinfo_get(tyrcountinfo,mernumber));
+    GtUword mernumber = gt_tyrindex_ptr2number(tyrsearchinfo->tyrindex,
+                                               result);
+    if (!firstitem)
+    {
+      gt_str_append_char(output,'\t');
+    }
+    firstitem = false;
+    gt_str_append_uword(output,
+                        gt_tyrcountinfo_get(tyrsearchinfo->tyrcountinfo,
+                                            mernumber));
   }
   if (tyrsearchinfo->showmode & SHOWSEQUENCE)
   {
-    ADDTABULATOR;
-    gt_alphabet_decode_seq_to_fp(tyrsearchinfo->dnaalpha,
-                                 stdout,
-                                 qptr,
-                                 tyrsearchinfo->mersize);
+    GtUword idx;
+
+    if (!firstitem)
+    {
+      gt_str_append_char(output,'\t');
+    }
+    for (idx = 0; idx < tyrsearchinfo->mersize; idx++)
+    {
+      gt_str_append_char(output,gt_alphabet_decode(tyrsearchinfo->dnaalpha,
+                                                   qptr[idx]));
+    }
   }
   if (tyrsearchinfo->showmode & (SHOWSEQUENCE | SHOWQPOS | SHOWCOUNTS))
   {
-    (void) putchar('\n');
+    gt_str_append_char(output,'\n');
   }
 }
 
-static void singleseqtyrsearch(const Tyrindex *tyrindex,
-                               const Tyrcountinfo *tyrcountinfo,
-                               const Tyrsearchinfo *tyrsearchinfo,
-                               const Tyrbckinfo *tyrbckinfo,
-                               uint64_t unitnum,
-                               const GtUchar *query,
-                               GtUword querylen,
-                               GT_UNUSED const char *desc)
+/* Look up all mers of <batch> and output the matches in the order in which
+   the mers were added to the batch. */
+static void tyrsearchbatchflush(const Tyrsearchinfo *tyrsearchinfo,
+                                Tyrsearchbatch *batch,
+                                const Tyrsearchtask *task,
+                                const GtUchar *query)
 {
-  const GtUchar *qptr, *result;
+  GtUword idx;
+  const GtUword merbytes = tyrsearchinfo->merbytes;
+
+  if (tyrsearchinfo->tyrmphinfo != NULL)
+  {
+    for (idx = 0; idx < batch->nextfree; idx++)
+    {
+      batch->keys[idx].hashvalue
+        = gt_tyrmphinfo_hash(tyrsearchinfo->tyrmphinfo,
+                             batch->bytecodes + idx * merbytes);
+      gt_tyrmphinfo_prefetch(tyrsearchinfo->tyrmphinfo,
+                             batch->keys[idx].hashvalue);
+    }
+    for (idx = 0; idx < batch->nextfree; idx++)
+    {
+      GtUword mernumber
+        = gt_tyrmphinfo_mernumber(tyrsearchinfo->tyrmphinfo,
+                                  batch->keys[idx].hashvalue,
+                                  batch->bytecodes + idx * merbytes);
+      if (mernumber == GT_UNDEF_UWORD)
+      {
+        batch->keys[idx].result = NULL;
+      } else
+      {
+        batch->keys[idx].result = tyrsearchinfo->mertable
+                                  + mernumber * merbytes;
+        TYRSEARCH_PREFETCH(batch->keys[idx].result);
+      }
+    }
+    for (idx = 0; idx < batch->nextfree; idx++)
+    {
+      if (batch->keys[idx].result != NULL &&
+          memcmp(batch->keys[idx].result,batch->bytecodes + idx * merbytes,
+                 (size_t) merbytes) != 0)
+      {
+        batch->keys[idx].result = NULL;
+      }
+    }
+  } else
+  {
+    for (idx = 0; idx < batch->nextfree; idx++)
+    {
+      if (tyrsearchinfo->tyrbckinfo == NULL)
+      {
+        batch->keys[idx].result
+          = gt_tyrindex_binmersearch(tyrsearchinfo->tyrindex,0,
+                                     batch->bytecodes + idx * merbytes,
+                                     tyrsearchinfo->mertable,
+                                     tyrsearchinfo->lastmer);
+      } else
+      {
+        batch->keys[idx].result
+          = gt_searchinbuckets(tyrsearchinfo->tyrindex,
+                               tyrsearchinfo->tyrbckinfo,
+                               batch->bytecodes + idx * merbytes);
+      }
+    }
+  }
+  for (idx = 0; idx < batch->nextfree; idx++)
+  {
+    if (batch->keys[idx].result != NULL)
+    {
+      mermatchoutput(tyrsearchinfo,
+                     task->output,
+                     batch->keys[idx].result,
+                     query,
+                     batch->keys[idx].qptr,
+                     task->unitnum,
+                     batch->keys[idx].forward);
+    }
+  }
+  batch->nextfree = 0;
+}
+
+static void tyrsearchbatchadd(const Tyrsearchinfo *tyrsearchinfo,
+                              Tyrsearchbatch *batch,
+                              const Tyrsearchtask *task,
+                              const GtUchar *query,
+                              const GtUchar *qptr,
+                              const GtUchar *mer,
+                              bool forward)
+{
+  gt_encseq_plainseq2bytecode(batch->bytecodes
+                                + batch->nextfree * tyrsearchinfo->merbytes,
+                              mer,
+                              tyrsearchinfo->mersize);
+  batch->keys[batch->nextfree].qptr = qptr;
+  batch->keys[batch->nextfree].forward = forward;
+  if (++batch->nextfree == (GtUword) TYRSEARCHBATCH)
+  {
+    tyrsearchbatchflush(tyrsearchinfo,batch,task,query);
+  }
+}
+
+static void singleseqtyrsearch(const Tyrsearchinfo *tyrsearchinfo,
+                               Tyrsearchbatch *batch,
+                               const Tyrsearchtask *task,
+                               const GtUchar *query)
+{
+  const GtUchar *qptr, *lastqptr;
   GtUword offset, skipvalue;
 
-  if (tyrsearchinfo->mersize > querylen)
+  if (tyrsearchinfo->mersize > task->querylen)
   {
     return;
   }
-  qptr = query;
+  qptr = query + task->startpos;
+  lastqptr = query + GT_MIN(task->endpos,
+                         task->querylen - tyrsearchinfo->mersize + 1);
   offset = 0;
-  while (qptr <= query + querylen - tyrsearchinfo->mersize)
+  while (qptr < lastqptr)
   {
     skipvalue = gt_containsspecialbytestring(qptr,offset,
                                              tyrsearchinfo->mersize);
@@ -170,38 +355,14 @@ static void singleseqtyrsearch(const Tyrindex *tyrindex,
       offset = tyrsearchinfo->mersize-1;
       if (tyrsearchinfo->searchstrand & STRAND_FORWARD)
       {
-        result = gt_searchsinglemer(qptr,tyrindex,
-                                    tyrsearchinfo,tyrbckinfo);
-        if (result != NULL)
-        {
-          mermatchoutput(tyrindex,
-                         tyrcountinfo,
-                         tyrsearchinfo,
-                         result,
-                         query,
-                         qptr,
-                         unitnum,
-                         true);
-        }
+        tyrsearchbatchadd(tyrsearchinfo,batch,task,query,qptr,qptr,true);
       }
       if (tyrsearchinfo->searchstrand & STRAND_REVERSE)
       {
-        gt_assert(tyrsearchinfo->rcbuf != NULL);
-        gt_copy_reverse_complement(tyrsearchinfo->rcbuf,qptr,
-                                   tyrsearchinfo->mersize);
-        result = gt_searchsinglemer(tyrsearchinfo->rcbuf,tyrindex,
-                                    tyrsearchinfo,tyrbckinfo);
-        if (result != NULL)
-        {
-          mermatchoutput(tyrindex,
-                         tyrcountinfo,
-                         tyrsearchinfo,
-                         result,
-                         query,
-                         qptr,
-                         unitnum,
-                         false);
-        }
+        gt_assert(batch->rcbuf != NULL);
+        gt_copy_reverse_complement(batch->rcbuf,qptr,tyrsearchinfo->mersize);
+        tyrsearchbatchadd(tyrsearchinfo,batch,task,query,qptr,batch->rcbuf,
+                          false);
       }
       qptr++;
     } else
@@ -210,6 +371,148 @@ static void singleseqtyrsearch(const Tyrindex *tyrindex,
       qptr += (skipvalue+1);
     }
   }
+  tyrsearchbatchflush(tyrsearchinfo,batch,task,query);
+}
+
+static void tyrsearchtasks(GtUword start,GtUword end,void *data)
+{
+  Tyrsearchchunk *chunk = data;
+  Tyrsearchbatch *batch = gt_tyrsearchbatch_get(chunk->scratch,
+                                                chunk->tyrsearchinfo);
+  GtUword idx;
+
+  for (idx = start; idx < end; idx++)
+  {
+    const Tyrsearchtask *task = chunk->tasks + idx;
+
+    singleseqtyrsearch(chunk->tyrsearchinfo,batch,task,
+                       chunk->sequences + task->seqoffset);
+  }
+}
+
+/* Store the query <unitnum> in <chunk> and split its mer start positions
+   into tasks. */
+static void tyrsearchchunkadd(Tyrsearchchunk *chunk,
+                              uint64_t unitnum,
+                              const GtUchar *query,
+                              GtUword querylen)
+{
+  GtUword startpos = 0;
+
+  if (chunk->totallength + querylen > chunk->allocatedsequences)
+  {
+    chunk->allocatedsequences = chunk->totallength + querylen;
+    chunk->sequences = gt_realloc(chunk->sequences,
+                                  sizeof *chunk->sequences
+                                  * chunk->allocatedsequences);
+  }
+  memcpy(chunk->sequences + chunk->totallength,query,
+         sizeof *query * querylen);
+  do
+  {
+    Tyrsearchtask *task;
+
+    if (chunk->nextfreetask == chunk->allocatedtasks)
+    {
+      chunk->allocatedtasks = chunk->allocatedtasks * 1.2 + 16;
+      chunk->tasks = gt_realloc(chunk->tasks,sizeof *chunk->tasks
+                                             * chunk->allocatedtasks);
+      memset(chunk->tasks + chunk->nextfreetask,0,
+             sizeof *chunk->tasks
+             * (chunk->allocatedtasks - chunk->nextfreetask));
+    }
+    task = chunk->tasks + chunk->nextfreetask++;
+    task->unitnum = unitnum;
+    task->seqoffset = chunk->totallength;
+    task->querylen = querylen;
+    task->startpos = startpos;
+    task->endpos = startpos + TYRSEARCHTASKWIDTH;
+    if (task->output == NULL)
+    {
+      task->output = gt_str_new();
+    }
+    startpos += TYRSEARCHTASKWIDTH;
+  } while (startpos < querylen);
+  chunk->totallength += querylen;
+}
+
+/* Search the queries of <chunk> and output the results in input order. */
+static void tyrsearchchunkflush(Tyrsearchchunk *chunk)
+{
+  GtUword idx;
+
+  gt_thread_pool_parallel_for(0,chunk->nextfreetask,1,tyrsearchtasks,chunk);
+  for (idx = 0; idx < chunk->nextfreetask; idx++)
+  {
+    GtStr *output = chunk->tasks[idx].output;
+
+    gt_xfwrite(gt_str_get_mem(output),sizeof (char),
+               (size_t) gt_str_length(output),stdout);
+    gt_str_reset(output);
+  }
+  chunk->nextfreetask = 0;
+  chunk->totallength = 0;
+}
+
+static int tyrsearchqueries(const Tyrsearchinfo *tyrsearchinfo,
+                            const GtStrArray *queryfilenames,
+                            GtError *err)
+{
+  const GtUchar *query;
+  GtUword querylen, idx, chunklength;
+  char *desc = NULL;
+  uint64_t unitnum;
+  int retval;
+  bool haserr = false;
+  GtSeqIterator *seqit;
+  Tyrsearchchunk chunk;
+
+  seqit = gt_seq_iterator_sequence_buffer_new(queryfilenames, err);
+  if (seqit == NULL)
+  {
+    return -1;
+  }
+  gt_seq_iterator_set_symbolmap(seqit,
+                                gt_alphabet_symbolmap(tyrsearchinfo->dnaalpha));
+  memset(&chunk,0,sizeof chunk);
+  chunk.tyrsearchinfo = tyrsearchinfo;
+  chunk.scratch = gt_thread_pool_scratch_new(sizeof (Tyrsearchbatch));
+  chunklength = TYRSEARCHCHUNKLENGTH * gt_thread_pool_num_of_workers();
+  for (unitnum = 0; /* Nothing */; unitnum++)
+  {
+    retval = gt_seq_iterator_next(seqit,
+                                  &query,
+                                  &querylen,
+                                  &desc,
+                                  err);
+    if (retval < 0)
+    {
+      haserr = true;
+      break;
+    }
+    if (retval == 0)
+    {
+      break;
+    }
+    tyrsearchchunkadd(&chunk,unitnum,query,querylen);
+    if (chunk.totallength >= chunklength)
+    {
+      tyrsearchchunkflush(&chunk);
+    }
+  }
+  if (!haserr)
+  {
+    tyrsearchchunkflush(&chunk);
+  }
+  for (idx = 0; idx < chunk.allocatedtasks; idx++)
+  {
+    gt_str_delete(chunk.tasks[idx].output);
+  }
+  gt_free(chunk.tasks);
+  gt_free(chunk.sequences);
+  gt_tyrsearchbatch_wrap(chunk.scratch);
+  gt_seq_iterator_delete(seqit);
+  return haserr ? -1 : 0;
 }
 
 int gt_tyrsearch(const char *tyrindexname,
@@ -223,6 +526,7 @@ int gt_tyrsearch(const char *tyrindexname,
   Tyrindex *tyrindex;
   Tyrcountinfo *tyrcountinfo = NULL;
   Tyrbckinfo *tyrbckinfo = NULL;
+  Tyrmphinfo *tyrmphinfo = NULL;
   bool haserr = false;
 
   gt_error_check(err);
@@ -258,63 +562,51 @@ int gt_tyrsearch(const char *tyrindexname,
     gt_assert(tyrindex != NULL);
     if (!gt_tyrindex_isempty(tyrindex))
     {
-      tyrbckinfo = gt_tyrbckinfo_new(tyrindexname,
-                                     gt_tyrindex_alphasize(tyrindex),
-                                     err);
-      if (tyrbckinfo == NULL)
+      if (gt_file_exists_with_suffix(tyrindexname,MPHSUFFIX))
       {
-        haserr = true;
+        tyrmphinfo = gt_tyrmphinfo_new(tyrindexname,tyrindex,err);
+        if (tyrmphinfo == NULL)
+        {
+          haserr = true;
+        } else
+        {
+          if (performtest)
+          {
+            gt_tyrmphinfo_check(tyrmphinfo,tyrindex);
+          }
+        }
+      } else
+      {
+        if (gt_file_exists_with_suffix(tyrindexname,BUCKETSUFFIX))
+        {
+          tyrbckinfo = gt_tyrbckinfo_new(tyrindexname,
+                                         gt_tyrindex_alphasize(tyrindex),
+                                         err);
+          if (tyrbckinfo == NULL)
+          {
+            haserr = true;
+          }
+        }
       }
     }
   }
   if (!haserr)
   {
-    const GtUchar *query;
-    GtUword querylen;
-    char *desc = NULL;
-    uint64_t unitnum;
-    int retval;
     Tyrsearchinfo tyrsearchinfo;
-    GtSeqIterator *seqit;
 
     gt_assert(tyrindex != NULL);
-    gt_tyrsearchinfo_init(&tyrsearchinfo,tyrindex,showmode,searchstrand);
-    seqit = gt_seq_iterator_sequence_buffer_new(queryfilenames, err);
-    if (!seqit)
-      haserr = true;
-    if (!haserr)
+    gt_tyrsearchinfo_init(&tyrsearchinfo,tyrindex,tyrcountinfo,tyrbckinfo,
+                          tyrmphinfo,showmode,searchstrand);
+    if (tyrsearchqueries(&tyrsearchinfo,queryfilenames,err) != 0)
     {
-      gt_seq_iterator_set_symbolmap(seqit,
-                                 gt_alphabet_symbolmap(tyrsearchinfo.dnaalpha));
-      for (unitnum = 0; /* Nothing */; unitnum++)
-      {
-        retval = gt_seq_iterator_next(seqit,
-                                     &query,
-                                     &querylen,
-                                     &desc,
-                                     err);
-        if (retval < 0)
-        {
-          haserr = true;
-          break;
-        }
-        if (retval == 0)
-        {
-          break;
-        }
-        singleseqtyrsearch(tyrindex,
-                           tyrcountinfo,
-                           &tyrsearchinfo,
-                           tyrbckinfo,
-                           unitnum,
-                           query,
-                           querylen,
-                           desc);
-      }
-      gt_seq_iterator_delete(seqit);
+      haserr = true;
     }
     gt_tyrsearchinfo_delete(&tyrsearchinfo);
   }
+  if (tyrmphinfo != NULL)
+  {
+    gt_tyrmphinfo_delete(&tyrmphinfo);
+  }
   if (tyrbckinfo != NULL)
   {
     gt_tyrbckinfo_delete(&tyrbckinfo);
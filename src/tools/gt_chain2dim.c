@@ -17,6 +17,8 @@
 
 #include "core/option_api.h"
 #include "core/ma_api.h"
+#include "core/thread_pool.h"
+#include "core/thread_pool_output.h"
 #include "core/unused_api.h"
 #include "core/tool_api.h"
 #include "gt_chain2dim.h"
@@ -109,6 +111,14 @@ static GtOptionParser *gt_chain2dim_option_parser_new (void *tool_arguments)
                                          &arguments->maxgap,0);
   arguments->refoptionmaxgap = gt_option_ref(option);
   gt_option_parser_add_option(op, option);
+  option = gt_option_new_bool("seqpairs","each line of the matchfile begins "
+                                         "with the numbers of the two\n"
+                                         "sequences the match refers to; "
+                                         "chain the matches\nof each pair of "
+                                         "sequences separately and in\n"
+                                         "parallel, see option -j",
+                                         &arguments->seqpairs,false);
+  gt_option_parser_add_option(op, option);
   option = gt_option_new_bool("silent","do not output the chains but only "
                                        "report their lengths and scores",
                                        &arguments->silent,false);
@@ -194,6 +204,7 @@ static int gt_chain2dim_arguments_check (GT_UNUSED int rest_argc,
 typedef struct
 {
   GtUword chaincounter;
+  FILE *outfp;
 } Counter;
 
 static void gt_outputformatchaingeneric(
@@ -206,8 +217,8 @@ static void gt_outputformatchaingeneric(
   Counter *counter = (Counter *) data;
 
   chainlength = gt_chain_chainlength(chain);
-  printf("# chain "GT_WU": length "GT_WU" score "GT_WD"\n",
-         counter->chaincounter,chainlength,gt_chain_chainscore(chain));
+  fprintf(counter->outfp,"# chain "GT_WU": length "GT_WU" score "GT_WD"\n",
+          counter->chaincounter,chainlength,gt_chain_chainscore(chain));
   if (!silent)
   {
     GtChain2Dimmatchvalues value;
@@ -217,14 +228,14 @@ static void gt_outputformatchaingeneric(
       for (idx=chainlength; idx > 0; idx--)
       {
         gt_chain_extractchainelem(&value, matchtable, chain, idx - 1);
-        gt_chain_printchainelem(stdout,&value);
+        gt_chain_printchainelem(counter->outfp,&value);
       }
     } else
     {
       for (idx=0; idx < chainlength; idx++)
       {
         gt_chain_extractchainelem(&value, matchtable, chain, idx);
-        gt_chain_printchainelem(stdout,&value);
+        gt_chain_printchainelem(counter->outfp,&value);
       }
     }
   }
@@ -245,6 +256,111 @@ void gt_outputformatchain(void *data,
   gt_outputformatchaingeneric(false,data,matchtable,chain);
 }
 
+/* Number of chunks of sequence pairs per worker. */
+#define GT_CHAIN2DIM_CHUNKSPERWORKER 4U
+
+typedef struct
+{
+  const GtChain2dimoptions *arguments;
+  GtChain2Dimseqpair *seqpairs;
+} GtChain2dimSeqpairsinfo;
+
+static void gt_chain2dim_chainseqpair(const GtChain2dimoptions *arguments,
+                                      GtChain2Dimseqpair *seqpair,
+                                      FILE *outfp,
+                                      GtLogger *logger)
+{
+  const unsigned int presortdim = 1U;
+  GtChain2Dim *chain;
+  Counter counter;
+
+  fprintf(outfp,"# sequence pair "GT_WU" "GT_WU"\n",seqpair->seqnum[0],
+          seqpair->seqnum[1]);
+  gt_chain_possiblysortmatches(logger, seqpair->matchtable, presortdim);
+  chain = gt_chain_chain_new();
+  counter.chaincounter = 0;
+  counter.outfp = outfp;
+  gt_chain_fastchaining(arguments->gtchainmode,
+                        chain,
+                        seqpair->matchtable,
+                        true,
+                        presortdim,
+                        true,
+                        arguments->silent ? gt_outputformatchainsilent
+                                          : gt_outputformatchain,
+                        &counter,
+                        logger);
+  gt_chain_chain_delete(chain);
+}
+
+/* The log messages of a chunk are written to the output of the chunk, so
+   that they appear at the same place as in the sequential mode. */
+static void gt_chain2dim_chainseqpairs(GtUword start,GtUword end,FILE *outfp,
+                                       void *data)
+{
+  const GtChain2dimSeqpairsinfo *info = (const GtChain2dimSeqpairsinfo *) data;
+  GtLogger *logger = gt_logger_new(info->arguments->verbose,
+                                   GT_LOGGER_DEFLT_PREFIX,outfp);
+  GtUword idx;
+
+  for (idx = start; idx < end; idx++)
+  {
+    gt_chain2dim_chainseqpair(info->arguments,info->seqpairs + idx,outfp,
+                              logger);
+  }
+  gt_logger_delete(logger);
+}
+
+/* Chain the matches of the sequence pairs in parallel. The chains are
+   output in the order of the sequence pairs, as in the sequential mode. */
+static void gt_chain2dim_parallel_seqpairs(const GtChain2dimoptions
+                                             *arguments,
+                                           GtChain2Dimseqpair *seqpairs,
+                                           GtUword numofseqpairs)
+{
+  GtThreadPoolOutput *output
+    = gt_thread_pool_output_new(GT_CHAIN2DIM_CHUNKSPERWORKER);
+  GtChain2dimSeqpairsinfo info;
+
+  info.arguments = arguments;
+  info.seqpairs = seqpairs;
+  gt_thread_pool_output_parallel_for(output,0,numofseqpairs,
+                                     gt_chain2dim_chainseqpairs,&info,stdout);
+  gt_thread_pool_output_delete(output);
+}
+
+static int gt_chain2dim_seqpairs(const GtChain2dimoptions *arguments,
+                                 GtLogger *logger,
+                                 GtError *err)
+{
+  GtChain2Dimseqpair *seqpairs;
+  GtUword numofseqpairs, idx;
+
+  seqpairs = gt_chain_analyzeopenformatfile_seqpairs(arguments->weightfactor,
+                                                     gt_str_get(arguments->
+                                                                matchfile),
+                                                     &numofseqpairs,
+                                                     err);
+  if (seqpairs == NULL)
+  {
+    return -1;
+  }
+  gt_logger_log(logger,"chain the matches of "GT_WU" sequence pairs",
+                numofseqpairs);
+  if (gt_thread_pool_num_of_workers() > 1U && numofseqpairs > 1UL)
+  {
+    gt_chain2dim_parallel_seqpairs(arguments,seqpairs,numofseqpairs);
+  } else
+  {
+    for (idx = 0; idx < numofseqpairs; idx++)
+    {
+      gt_chain2dim_chainseqpair(arguments,seqpairs + idx,stdout,logger);
+    }
+  }
+  gt_chain_seqpairs_delete(seqpairs,numofseqpairs);
+  return 0;
+}
+
 static int gt_chain2dim_runner (GT_UNUSED int argc,
                                 GT_UNUSED const char **argv,
                                 GT_UNUSED int parsed_args,
@@ -260,6 +376,14 @@ static int gt_chain2dim_runner (GT_UNUSED int argc,
   gt_assert (arguments != NULL);
   gt_assert (parsed_args == argc);
 
+  if (arguments->seqpairs)
+  {
+    logger = gt_logger_new(arguments->verbose, GT_LOGGER_DEFLT_PREFIX, stdout);
+    haserr = gt_chain2dim_seqpairs(arguments,logger,err) != 0 ? true : false;
+    gt_chain_chainmode_delete(arguments->gtchainmode);
+    gt_logger_delete(logger);
+    return haserr ? -1 : 0;
+  }
   matchtable = gt_chain_analyzeopenformatfile(arguments->weightfactor,
                                               gt_str_get(arguments->
                                                          matchfile),
@@ -278,6 +402,7 @@ static int gt_chain2dim_runner (GT_UNUSED int argc,
     gt_chain_possiblysortmatches(logger, matchtable, presortdim);
     chain = gt_chain_chain_new();
     counter.chaincounter = 0;
+    counter.outfp = stdout;
     gt_chain_fastchaining(arguments->gtchainmode,
                           chain,
                           matchtable,
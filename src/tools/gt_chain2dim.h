@@ -29,7 +29,8 @@
 typedef struct
 {
   bool silent,
-       verbose;
+       verbose,
+       seqpairs;
   double weightfactor;
   GtUword maxgap;
   GtStr *matchfile;
@@ -22,6 +22,7 @@
 #include "core/versionfunc_api.h"
 #include "tools/gt_compressedbits.h"
 #include "tools/gt_consensus_sa.h"
+#include "tools/gt_esalcp.h"
 #include "tools/gt_extracttarget.h"
 #include "tools/gt_gdiffcalc.h"
 #include "tools/gt_guessprot.h"
@@ -60,6 +61,7 @@ static void* gt_dev_arguments_new(void)
   gt_toolbox_add(dev_toolbox, "trieins", gt_trieins);
   gt_toolbox_add_tool(dev_toolbox, "compbits", gt_compressedbits());
   gt_toolbox_add_tool(dev_toolbox, "consensus_sa", gt_consensus_sa_tool());
+  gt_toolbox_add_tool(dev_toolbox, "esalcp", gt_esalcp());
   gt_toolbox_add_tool(dev_toolbox, "extracttarget", gt_extracttarget());
   gt_toolbox_add_tool(dev_toolbox, "gdiffcalc", gt_gdiffcalc());
   gt_toolbox_add_tool(dev_toolbox, "idxlocali", gt_idxlocali());
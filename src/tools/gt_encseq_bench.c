@@ -27,7 +27,7 @@
 
 typedef struct
 {
-  GtUword ccext;
+  GtUword ccext, ssext, sslen;
   bool sortlenprepare, verbose;
 } GtEncseqBenchArguments;
 
@@ -64,6 +64,19 @@ static GtOptionParser* gt_encseq_bench_option_parser_new(void *tool_arguments)
                                &arguments->ccext, 0UL);
   gt_option_parser_add_option(op, option);
 
+  option = gt_option_new_uword("ssext", "specify number of random substring "
+                                        "extractions, performed with the "
+                                        "encseq reader and with each bulk "
+                                        "extraction kernel supported by the "
+                                        "CPU",
+                               &arguments->ssext, 0UL);
+  gt_option_parser_add_option(op, option);
+
+  option = gt_option_new_uword_min("sslen", "specify length of the substrings "
+                                            "extracted with option -ssext",
+                                   &arguments->sslen, 1000UL, 1UL);
+  gt_option_parser_add_option(op, option);
+
   option = gt_option_new_bool("solepr", "prepare data structure for sequences "
                                          "ordered by their length",
                                &arguments->sortlenprepare, false);
@@ -102,6 +115,121 @@ static void gt_bench_character_extractions(const GtEncseq *encseq,
   }
 }
 
+static GtUword gt_bench_substring_checksum(const GtUchar *buffer,
+                                           GtUword len)
+{
+  GtUword idx, sum = 0;
+
+  for (idx = 0; idx < len; idx++)
+    sum = sum * 31UL + (GtUword) buffer[idx];
+  return sum;
+}
+
+static int gt_bench_substring_extractions(const GtEncseq *encseq,
+                                          GtUword ssext,
+                                          GtUword sslen,
+                                          GtError *err)
+{
+  GtUword idx, *startpos, sum, refsum = 0, refrcsum = 0,
+          totallength = gt_encseq_total_length(encseq);
+  GtUchar *buffer, *reference;
+  GtEncseqReader *esr;
+  GtEncseqUnpackKernel kernel;
+  GtTimer *timer = NULL;
+  const bool isdna = gt_alphabet_is_dna(gt_encseq_alphabet(encseq));
+  int had_err = 0;
+
+  if (sslen > totallength) {
+    gt_error_set(err, "substring length "GT_WU" exceeds total length "GT_WU"",
+                 sslen, totallength);
+    return -1;
+  }
+  startpos = gt_malloc(sizeof (*startpos) * ssext);
+  for (idx = 0; idx < ssext; idx++)
+    startpos[idx] = gt_rand_max(totallength - sslen);
+  buffer = gt_malloc(sizeof (*buffer) * sslen);
+  reference = gt_malloc(sizeof (*reference) * sslen);
+  esr = gt_encseq_create_reader_with_readmode(encseq, GT_READMODE_FORWARD, 0);
+  if (isdna) {
+    /* the reverse complements are checked against the reader */
+    for (idx = 0; idx < ssext; idx++) {
+      GtUword j;
+      gt_encseq_reader_reinit_with_readmode(esr, encseq,
+                                            GT_READMODE_REVCOMPL,
+                                            totallength - startpos[idx]
+                                            - sslen);
+      for (j = 0; j < sslen; j++)
+        reference[j] = gt_encseq_reader_next_encoded_char(esr);
+      refrcsum += gt_bench_substring_checksum(reference, sslen);
+    }
+  }
+  if (gt_showtime_enabled()) {
+    timer = gt_timer_new_with_progress_description("run substring extractions "
+                                                   "with reader");
+    gt_timer_start(timer);
+  }
+  for (idx = 0; idx < ssext; idx++) {
+    GtUword j;
+    gt_encseq_reader_reinit_with_readmode(esr, encseq, GT_READMODE_FORWARD,
+                                          startpos[idx]);
+    for (j = 0; j < sslen; j++)
+      buffer[j] = gt_encseq_reader_next_encoded_char(esr);
+    refsum += gt_bench_substring_checksum(buffer, sslen);
+  }
+  printf("reader: sssum="GT_WU"\n", refsum);
+  for (kernel = GT_ENCSEQ_UNPACK_SCALAR;
+       !had_err && kernel < GT_ENCSEQ_UNPACK_NUMOFKERNELS;
+       kernel++) {
+    if (!gt_encseq_unpack_kernel_is_supported(kernel))
+      continue;
+    if (timer != NULL) {
+      gt_timer_show_progress_formatted(timer, stdout,
+                                       "run substring extractions with %s "
+                                       "kernel",
+                                       gt_encseq_unpack_kernel_name(kernel));
+    }
+    sum = 0;
+    for (idx = 0; idx < ssext; idx++) {
+      gt_encseq_extract_encoded_with_kernel(esr, encseq, buffer, startpos[idx],
+                                            startpos[idx] + sslen - 1, kernel);
+      sum += gt_bench_substring_checksum(buffer, sslen);
+    }
+    printf("%s: sssum="GT_WU"\n", gt_encseq_unpack_kernel_name(kernel), sum);
+    if (sum != refsum) {
+      gt_error_set(err, "checksum of %s kernel differs from reader",
+                   gt_encseq_unpack_kernel_name(kernel));
+      had_err = -1;
+    }
+  }
+  if (!had_err && isdna) {
+    if (timer != NULL) {
+      gt_timer_show_progress(timer, "run reverse complement substring "
+                                    "extractions", stdout);
+    }
+    sum = 0;
+    for (idx = 0; idx < ssext; idx++) {
+      gt_encseq_extract_encoded_rc(encseq, buffer, startpos[idx],
+                                   startpos[idx] + sslen - 1);
+      sum += gt_bench_substring_checksum(buffer, sslen);
+    }
+    printf("rc: sssum="GT_WU"\n", sum);
+    if (sum != refrcsum) {
+      gt_error_set(err, "checksum of reverse complement extraction differs "
+                        "from reader");
+      had_err = -1;
+    }
+  }
+  if (timer != NULL) {
+    gt_timer_show_progress_final(timer, stdout);
+    gt_timer_delete(timer);
+  }
+  gt_encseq_reader_delete(esr);
+  gt_free(startpos);
+  gt_free(buffer);
+  gt_free(reference);
+  return had_err;
+}
+
 typedef struct
 {
   GtUword minlength, maxlength, numofdifferentseqlen, *seqlenseppos,
@@ -327,6 +455,11 @@ static int gt_encseq_bench_runner(GT_UNUSED int argc, const char **argv,
       gt_logger_log(logger,"perform character extractions");
       gt_bench_character_extractions(encseq,arguments->ccext);
     }
+    if (!had_err && arguments->ssext > 0) {
+      gt_logger_log(logger,"perform substring extractions");
+      had_err = gt_bench_substring_extractions(encseq,arguments->ssext,
+                                               arguments->sslen,err);
+    }
   }
   gt_encseq_delete(encseq);
   gt_encseq_loader_delete(encseq_loader);
@@ -0,0 +1,182 @@
+/*
+  Copyright (c) 2026 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/ma_api.h"
+#include "core/logger.h"
+#include "core/minmax_api.h"
+#include "core/showtime.h"
+#include "core/str_api.h"
+#include "core/timer_api.h"
+#include "core/unused_api.h"
+#include "match/esa-map.h"
+#include "match/sfx-linlcp.h"
+#include "match/sfx-outprj.h"
+#include "tools/gt_esalcp.h"
+
+typedef struct
+{
+  bool verbose, lcpdist;
+  GtStr *indexname;
+} GtEsalcpArguments;
+
+static void* gt_esalcp_arguments_new(void)
+{
+  GtEsalcpArguments *arguments = gt_malloc(sizeof (*arguments));
+  arguments->indexname = gt_str_new();
+  return arguments;
+}
+
+static void gt_esalcp_arguments_delete(void *tool_arguments)
+{
+  GtEsalcpArguments *arguments = tool_arguments;
+
+  if (arguments != NULL)
+  {
+    gt_str_delete(arguments->indexname);
+    gt_free(arguments);
+  }
+}
+
+static GtOptionParser* gt_esalcp_option_parser_new(void *tool_arguments)
+{
+  GtEsalcpArguments *arguments = tool_arguments;
+  GtOptionParser *op;
+  GtOption *option;
+
+  gt_assert(arguments != NULL);
+  op = gt_option_parser_new("-esa <indexname> [option ...]",
+                            "Compute the lcp table of an existing enhanced "
+                            "suffix array from its mapped suffix array and "
+                            "write the files .lcp and .llv (in parallel, if "
+                            "more than one thread is used).");
+
+  /* -esa */
+  option = gt_option_new_string("esa","specify index (enhanced suffix array)",
+                                arguments->indexname, NULL);
+  gt_option_is_mandatory(option);
+  gt_option_parser_add_option(op, option);
+
+  /* -lcpdist */
+  option = gt_option_new_bool("lcpdist",
+                              "output distributions of values in lcptab",
+                              &arguments->lcpdist, false);
+  gt_option_parser_add_option(op, option);
+
+  /* -v */
+  option = gt_option_new_verbose(&arguments->verbose);
+  gt_option_parser_add_option(op, option);
+
+  gt_option_parser_set_min_max_args(op, 0U, 0U);
+  return op;
+}
+
+static int gt_esalcp_runner(GT_UNUSED int argc,
+                            GT_UNUSED const char **argv,
+                            GT_UNUSED int parsed_args,
+                            void *tool_arguments,
+                            GtError *err)
+{
+  GtEsalcpArguments *arguments = tool_arguments;
+  bool haserr = false;
+  Suffixarray suffixarray;
+  GtLogger *logger;
+  GtTimer *timer = NULL;
+
+  gt_error_check(err);
+  gt_assert(arguments != NULL);
+  logger = gt_logger_new(arguments->verbose,GT_LOGGER_DEFLT_PREFIX,stdout);
+  if (gt_showtime_enabled())
+  {
+    timer = gt_timer_new_with_progress_description("mapping suffix array");
+    gt_timer_start(timer);
+  }
+  if (gt_mapsuffixarray(&suffixarray,SARR_ESQTAB | SARR_SUFTAB,
+                        gt_str_get(arguments->indexname),logger,err) != 0)
+  {
+    haserr = true;
+  }
+  if (!haserr && suffixarray.suftab == NULL)
+  {
+    gt_error_set(err,"index %s has no suffix array",
+                 gt_str_get(arguments->indexname));
+    haserr = true;
+  }
+  if (!haserr)
+  {
+    GtLcptabsummary summary;
+    GtUword totallength = gt_encseq_total_length(suffixarray.encseq);
+
+    if (timer != NULL)
+    {
+      gt_timer_show_progress(timer,"computing lcp table",stdout);
+    }
+    if (gt_lcptab_phialgorithm2file(&summary,
+                                    gt_str_get(arguments->indexname),
+                                    suffixarray.encseq,
+                                    suffixarray.readmode,
+                                    suffixarray.suftab,
+                                    NULL,
+                                    GT_MIN(suffixarray.
+                                           numberofallsortedsuffixes,
+                                           totallength + 1),
+                                    arguments->lcpdist,
+                                    logger,
+                                    err) != 0)
+    {
+      haserr = true;
+    }
+    if (!haserr)
+    {
+      if (timer != NULL)
+      {
+        gt_timer_show_progress(timer,"updating project file",stdout);
+      }
+      if (gt_outprjfile(gt_str_get(arguments->indexname),
+                        suffixarray.readmode,
+                        suffixarray.encseq,
+                        suffixarray.numberofallsortedsuffixes,
+                        suffixarray.prefixlength,
+                        summary.numoflargelcpvalues,
+                        suffixarray.numberofallsortedsuffixes == 0
+                          ? 0.0
+                          : summary.lcptabsum/
+                            suffixarray.numberofallsortedsuffixes,
+                        summary.maxbranchdepth,
+                        &suffixarray.longest,
+                        err) != 0)
+      {
+        haserr = true;
+      }
+    }
+  }
+  gt_freesuffixarray(&suffixarray);
+  if (timer != NULL)
+  {
+    gt_timer_show_progress_final(timer,stdout);
+    gt_timer_delete(timer);
+  }
+  gt_logger_delete(logger);
+  return haserr ? -1 : 0;
+}
+
+GtTool* gt_esalcp(void)
+{
+  return gt_tool_new(gt_esalcp_arguments_new,
+                     gt_esalcp_arguments_delete,
+                     gt_esalcp_option_parser_new,
+                     NULL,
+                     gt_esalcp_runner);
+}
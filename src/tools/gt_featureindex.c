@@ -17,13 +17,18 @@
 
 #include <string.h>
 #include "core/fileutils_api.h"
+#include "core/hashmap_api.h"
 #include "core/ma_api.h"
+#include "core/mathsupport_api.h"
+#include "core/minmax_api.h"
 #include "core/password_entry.h"
 #include "core/str_api.h"
+#include "core/timer_api.h"
 #include "core/unused_api.h"
 #include "extended/anno_db_gfflike_api.h"
 #include "extended/anno_db_schema_api.h"
 #include "extended/feature_index_api.h"
+#include "extended/feature_index_mapped_api.h"
 #include "extended/feature_node.h"
 #include "extended/feature_stream_api.h"
 #include "extended/gff3_visitor.h"
@@ -38,6 +43,7 @@
 
 #define GT_SQLITE_BACKEND_STRING "sqlite"
 #define GT_MYSQL_BACKEND_STRING  "mysql"
+#define GT_MAPPED_BACKEND_STRING "mapped"
 
 typedef struct {
   GtRange qry_rng;
@@ -49,6 +55,8 @@ typedef struct {
         *pass,
         *database;
   int port;
+  GtUword benchmark,
+          benchwidth;
   bool verbose,
        retain,
        child_callback_check,
@@ -95,6 +103,7 @@ static GtOptionParser* gt_featureindex_option_parser_new(void *tool_arguments)
 #ifdef HAVE_MYSQL
     GT_MYSQL_BACKEND_STRING,
 #endif
+    GT_MAPPED_BACKEND_STRING,
     NULL
   };
   gt_assert(arguments);
@@ -121,12 +130,12 @@ static GtOptionParser* gt_featureindex_option_parser_new(void *tool_arguments)
   backend_option = gt_option_new_choice("backend", "database backend to use\n"
                                         "choose from ["
 #ifdef HAVE_SQLITE
-                                         GT_SQLITE_BACKEND_STRING
+                                        GT_SQLITE_BACKEND_STRING "|"
 #endif
 #ifdef HAVE_MYSQL
-                                        "|" GT_MYSQL_BACKEND_STRING
+                                        GT_MYSQL_BACKEND_STRING "|"
 #endif
-                                        "]",
+                                        GT_MAPPED_BACKEND_STRING "]",
                                         arguments->backend, backends[0],
                                         backends);
   gt_option_parser_add_option(op, backend_option);
@@ -134,7 +143,7 @@ static GtOptionParser* gt_featureindex_option_parser_new(void *tool_arguments)
   /* -filename */
   filenameoption = gt_option_new_string("filename",
                                         "filename for feature database "
-                                        "(sqlite backend only)",
+                                        "(sqlite and mapped backends)",
                                         arguments->filename, NULL);
   gt_option_parser_add_option(op, filenameoption);
 
@@ -176,6 +185,20 @@ static GtOptionParser* gt_featureindex_option_parser_new(void *tool_arguments)
   gt_option_parser_add_option(op, option);
   gt_option_is_development_option(option);
 
+  option = gt_option_new_uword("benchmark", "run the given number of random "
+                                            "range queries on the sequence "
+                                            "region and report the query "
+                                            "rate instead of GFF3 output",
+                               &arguments->benchmark, 0);
+  gt_option_parser_add_option(op, option);
+  gt_option_is_development_option(option);
+
+  option = gt_option_new_uword_min("benchwidth", "width of the ranges "
+                                                 "queried by -benchmark",
+                                   &arguments->benchwidth, 10000UL, 1UL);
+  gt_option_parser_add_option(op, option);
+  gt_option_is_development_option(option);
+
   option = gt_option_new_verbose(&arguments->verbose);
   gt_option_parser_add_option(op, option);
 
@@ -194,6 +217,66 @@ static int gt_featureindex_arguments_check(GT_UNUSED int rest_argc,
   return had_err;
 }
 
+static int gt_featureindex_delete_node(void *key, GT_UNUSED void *value,
+                                       GT_UNUSED void *data,
+                                       GT_UNUSED GtError *err)
+{
+  gt_genome_node_delete((GtGenomeNode*) key);
+  return 0;
+}
+
+/* Queries random ranges of width <benchwidth> inside the region <qry_rng>.
+   Nodes handed out by the index are reused by later queries, so each of them
+   is only deleted once at the end, unless they belong to the index
+   (<own_nodes> is false). */
+static int gt_featureindex_benchmark(GtFeatureIndex *fi,
+                                     GtFeatureindexArguments *arguments,
+                                     bool own_nodes,
+                                     GtError *err)
+{
+  GtArray *results;
+  GtHashmap *nodes;
+  GtTimer *timer;
+  GtRange rng;
+  GtUword i, j, width, nof_results = 0;
+  double seconds;
+  int had_err = 0;
+
+  width = GT_MIN(arguments->benchwidth, gt_range_length(&arguments->qry_rng));
+  results = gt_array_new(sizeof (GtFeatureNode*));
+  nodes = gt_hashmap_new(GT_HASH_DIRECT, NULL, NULL);
+  timer = gt_timer_new();
+  gt_timer_start(timer);
+  for (i = 0; !had_err && i < arguments->benchmark; i++) {
+    rng.start = arguments->qry_rng.start
+                + gt_rand_max(gt_range_length(&arguments->qry_rng) - width);
+    rng.end = rng.start + width - 1;
+    gt_array_reset(results);
+    had_err = gt_feature_index_get_features_for_range(fi, results,
+                                                   gt_str_get(arguments->seqid),
+                                                   &rng, err);
+    for (j = 0; !had_err && own_nodes && j < gt_array_size(results); j++) {
+      GtGenomeNode *gn = *(GtGenomeNode**) gt_array_get(results, j);
+      if (!gt_hashmap_get(nodes, gn))
+        gt_hashmap_add(nodes, gn, gn);
+    }
+    nof_results += gt_array_size(results);
+  }
+  gt_timer_stop(timer);
+  if (!had_err) {
+    seconds = (double) gt_timer_elapsed_usec(timer) / 1000000.0;
+    printf(GT_WU " range queries of width " GT_WU " returned " GT_WU
+           " features in %.2f s (%.1f queries/s)\n", arguments->benchmark,
+           width, nof_results, seconds,
+           seconds > 0.0 ? (double) arguments->benchmark / seconds : 0.0);
+  }
+  (void) gt_hashmap_foreach(nodes, gt_featureindex_delete_node, NULL, NULL);
+  gt_hashmap_delete(nodes);
+  gt_timer_delete(timer);
+  gt_array_delete(results);
+  return had_err;
+}
+
 static int gt_featureindex_runner(GT_UNUSED int argc,
                                   GT_UNUSED const char **argv,
                                   GT_UNUSED int parsed_args,
@@ -209,11 +292,19 @@ static int gt_featureindex_runner(GT_UNUSED int argc,
   GtNodeVisitor *gff3visitor = NULL;
   GtGenomeNode *regn = NULL;
   GtUword i = 0;
+  bool mapped;
   int had_err = 0;
 
   gt_error_check(err);
   gt_assert(arguments);
 
+  mapped = (strcmp(gt_str_get(arguments->backend),
+                   GT_MAPPED_BACKEND_STRING) == 0);
+  if (mapped) {
+    fi = gt_feature_index_mapped_new(gt_str_get(arguments->filename), err);
+    if (!fi)
+      had_err = -1;
+  }
 #ifdef HAVE_SQLITE
   if (!had_err) {
     if (strcmp(gt_str_get(arguments->backend),
@@ -247,15 +338,14 @@ static int gt_featureindex_runner(GT_UNUSED int argc,
     }
   }
 #endif
-  if (!had_err)
+  if (!had_err && !mapped) {
     adbs = gt_anno_db_gfflike_new();
-
-  if (!had_err && !adbs)
-    had_err = -1;
-
-  if (!had_err) {
-    fi = gt_anno_db_schema_get_feature_index(adbs, rdb, err);
-    had_err = fi ? 0 : -1;
+    if (!adbs)
+      had_err = -1;
+    if (!had_err) {
+      fi = gt_anno_db_schema_get_feature_index(adbs, rdb, err);
+      had_err = fi ? 0 : -1;
+    }
   }
 
   if (!had_err && gt_str_length(arguments->seqid) == 0) {
@@ -274,6 +364,14 @@ static int gt_featureindex_runner(GT_UNUSED int argc,
                                                    err);
   }
 
+  if (!had_err && arguments->benchmark > 0) {
+    had_err = gt_featureindex_benchmark(fi, arguments, !mapped, err);
+    gt_rdb_delete(rdb);
+    gt_anno_db_schema_delete(adbs);
+    gt_feature_index_delete(fi);
+    return had_err;
+  }
+
   if (!had_err) {
     results = gt_array_new(sizeof (GtFeatureNode*));
     had_err = gt_feature_index_get_features_for_range(fi, results,
@@ -316,7 +414,9 @@ static int gt_featureindex_runner(GT_UNUSED int argc,
         }
       }
       gt_genome_node_accept(gn, gff3visitor, err);
-      gt_genome_node_delete(gn);
+      /* nodes of a mapped index belong to the index */
+      if (!mapped)
+        gt_genome_node_delete(gn);
     }
   }
 
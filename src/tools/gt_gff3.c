@@ -20,6 +20,7 @@
 #include "core/option_api.h"
 #include "core/output_file_api.h"
 #include "core/undef_api.h"
+#include "core/unused_api.h"
 #include "core/versionfunc_api.h"
 #include "extended/add_introns_stream_api.h"
 #include "extended/genome_node.h"
@@ -53,10 +54,12 @@ typedef struct {
        strict,
        tidy,
        show,
-       fixboundaries;
+       fixboundaries,
+       arena;
   GtWord offset;
-  GtStr *offsetfile, *newsource;
-  GtUword width;
+  GtStr *offsetfile, *newsource, *sortmemlimit_str;
+  GtUword width,
+          sortmemlimit;
   GtTypecheckInfo *tci;
   GtXRFCheckInfo *xci;
   GtOutputFileInfo *ofi;
@@ -68,6 +71,7 @@ static void* gt_gff3_arguments_new(void)
   GFF3Arguments *arguments = gt_calloc(1, sizeof *arguments);
   arguments->newsource = gt_str_new();
   arguments->offsetfile = gt_str_new();
+  arguments->sortmemlimit_str = gt_str_new();
   arguments->tci = gt_typecheck_info_new();
   arguments->xci = gt_xrfcheck_info_new();
   arguments->ofi = gt_output_file_info_new();
@@ -84,6 +88,7 @@ static void gt_gff3_arguments_delete(void *tool_arguments)
   gt_typecheck_info_delete(arguments->tci);
   gt_xrfcheck_info_delete(arguments->xci);
   gt_str_delete(arguments->offsetfile);
+  gt_str_delete(arguments->sortmemlimit_str);
   gt_free(arguments);
 }
 
@@ -123,6 +128,16 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
   gt_option_parser_add_option(op, sortnum_option);
   gt_option_exclude(sortlines_option, sortnum_option);
 
+  /* -sortmemlimit */
+  option = gt_option_new_string("sortmemlimit", "bound the memory used for "
+                                "sorting (e.g. 500MB); sorted runs exceeding "
+                                "the limit are written to temporary files and "
+                                "merged afterwards",
+                                arguments->sortmemlimit_str, "");
+  gt_option_imply_either_3(option, sort_option, sortlines_option,
+                           sortnum_option);
+  gt_option_parser_add_option(op, option);
+
   /* -strict */
   strict_option = gt_option_new_bool("strict", "be very strict during GFF3 "
                                      "parsing (stricter than the specification "
@@ -190,6 +205,13 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
   gt_option_is_development_option(load_option);
   gt_option_parser_add_option(op, load_option);
 
+  /* -arena */
+  option = gt_option_new_bool("arena", "allocate the parsed features in bulk, "
+                              "one memory arena per sequence region (faster "
+                              "parsing and freeing of large files)",
+                              &arguments->arena, false);
+  gt_option_parser_add_option(op, option);
+
   /* -addintrons */
   addintrons_option = gt_option_new_bool("addintrons", "add intron features "
                                          "between existing exon features",
@@ -243,6 +265,27 @@ static GtOptionParser* gt_gff3_option_parser_new(void *tool_arguments)
   return op;
 }
 
+static int gt_gff3_arguments_check(GT_UNUSED int rest_argc,
+                                   void *tool_arguments, GtError *err)
+{
+  GFF3Arguments *arguments = tool_arguments;
+  int had_err = 0;
+  gt_error_check(err);
+  gt_assert(arguments);
+  arguments->sortmemlimit = 0;
+  if (gt_str_length(arguments->sortmemlimit_str) > 0) {
+    had_err = gt_option_parse_spacespec(&arguments->sortmemlimit,
+                                        "sortmemlimit",
+                                        arguments->sortmemlimit_str, err);
+    if (!had_err && arguments->sortmemlimit == 0) {
+      gt_error_set(err, "argument to option \"-sortmemlimit\" must be at "
+                   "least 1MB");
+      had_err = -1;
+    }
+  }
+  return had_err;
+}
+
 static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
                           void *tool_arguments, GtError *err)
 {
@@ -309,6 +352,10 @@ static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
   if (!had_err && arguments->tidy)
     gt_gff3_in_stream_enable_tidy_mode((GtGFF3InStream*) gff3_in_stream);
 
+  /* enable arena allocation (if necessary) */
+  if (!had_err && arguments->arena)
+    gt_gff3_in_stream_enable_arena((GtGFF3InStream*) gff3_in_stream);
+
   if (!had_err && arguments->fixboundaries)
     gt_gff3_in_stream_fix_region_boundaries((GtGFF3InStream*) gff3_in_stream);
 
@@ -322,6 +369,9 @@ static int gt_gff3_runner(int argc, const char **argv, int parsed_args,
   if (!had_err && (arguments->sort || arguments->sortlines ||
                    arguments->sortnum)) {
     sort_stream = gt_sort_stream_new(last_stream);
+    if (arguments->sortmemlimit > 0)
+      gt_sort_stream_set_memlimit((GtSortStream*) sort_stream,
+                                  arguments->sortmemlimit);
     last_stream = sort_stream;
   }
 
@@ -402,6 +452,6 @@ GtTool* gt_gff3(void)
   return gt_tool_new(gt_gff3_arguments_new,
                      gt_gff3_arguments_delete,
                      gt_gff3_option_parser_new,
-                     NULL,
+                     gt_gff3_arguments_check,
                      gt_gff3_runner);
 }
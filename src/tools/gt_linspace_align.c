@@ -38,6 +38,7 @@
 #include "extended/diagonalbandalign_affinegapcost.h"
 #include "extended/linearalign.h"
 #include "extended/linearalign_affinegapcost.h"
+#include "extended/linearalign_simd.h"
 #include "extended/linspace_management.h"
 #include "extended/scorehandler.h"
 #include "tools/gt_linspace_align.h"
@@ -746,6 +747,7 @@ static int gt_linspace_align_runner(GT_UNUSED int argc,
   GtLinspaceManagement *spacemanager;
   GtScoreHandler *scorehandler = NULL;
   GtTimer *linspacetimer = NULL;
+  bool affine = false;
   GtAlphabet *alphabet = NULL;
 
   gt_error_check(err);
@@ -824,8 +826,6 @@ static int gt_linspace_align_runner(GT_UNUSED int argc,
   /* alignment functions with linear gap costs */
   if (!had_err)
   {
-    bool affine;
-
     if (gt_str_array_size(arguments->linearcosts) > 0)
     {
       affine = false;
@@ -849,8 +849,13 @@ static int gt_linspace_align_runner(GT_UNUSED int argc,
   /*spacetime option*/
   if (!had_err && arguments->spacetime)
   {
+    /* affine gap costs are only computed by the scalar kernel */
+    const GtLinearalignSimdKernel kernel
+      = affine ? GT_LINEARALIGN_SIMD_SCALAR : gt_linearalign_simd_kernel_best();
+
     printf("# combined space peak in kilobytes: %f\n",
            GT_KILOBYTES(gt_linspace_management_get_spacepeak(spacemanager)));
+    printf("# DP kernel: %s\n",gt_linearalign_simd_kernel_name(kernel));
     gt_timer_show_formatted(linspacetimer,"# TIME overall " GT_WD ".%02ld\n",
                             stdout);
   }
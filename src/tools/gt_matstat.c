@@ -377,6 +377,8 @@ static int gt_matstat_runner(GT_UNUSED int argc, GT_UNUSED const char **argv,
   {
     const void *theindex;
     Greedygmatchforwardfunction gmatchforwardfunction;
+    Greedygmatchnewviewfunction newindexview = NULL;
+    Greedygmatchdeleteviewfunction deleteindexview = NULL;
 
     if (arguments->indextype == Fmindextype)
     {
@@ -404,6 +406,8 @@ static int gt_matstat_runner(GT_UNUSED int argc, GT_UNUSED const char **argv,
       {
         gt_assert(arguments->indextype == Packedindextype);
         theindex = (const void *) packedindex;
+        newindexview = gt_voidpackedindexview_new;
+        deleteindexview = gt_voidpackedindexview_delete;
         if (arguments->doms)
         {
           gmatchforwardfunction = gt_voidpackedindexmstatsforward;
@@ -439,6 +443,8 @@ static int gt_matstat_runner(GT_UNUSED int argc, GT_UNUSED const char **argv,
                                       theindex,
                                       totallength,
                                       gmatchforwardfunction,
+                                      newindexview,
+                                      deleteindexview,
                                       alphabet,
                                       arguments->queryfilenames,
                                       arguments->minlength,
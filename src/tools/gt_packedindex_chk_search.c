@@ -18,6 +18,7 @@
 #include <string.h>
 #include "core/error_api.h"
 #include "core/logger.h"
+#include "core/ma_api.h"
 #include "core/minmax_api.h"
 #include "core/option_api.h"
 #include "core/str_api.h"
@@ -33,6 +34,40 @@
 #include "match/sfx-apfxlen.h"
 
 #define DEFAULT_PROGRESS_INTERVAL  100000UL
+#define CHK_SEARCH_BATCH_SIZE      64
+
+struct chkSearchBatch
+{
+  Symbol *patterns;
+  const Symbol *queries[CHK_SEARCH_BATCH_SIZE];
+  size_t queryLens[CHK_SEARCH_BATCH_SIZE];
+  GtUword expectedCounts[CHK_SEARCH_BATCH_SIZE],
+    counts[CHK_SEARCH_BATCH_SIZE];
+  size_t maxPatLen, numQueries;
+};
+
+/* compare the match counts of the batch search with those of the
+ * suffix array */
+static bool
+chkSearchBatchFlush(struct chkSearchBatch *batch, const BWTSeq *bwtSeq,
+                    GtError *err)
+{
+  size_t i;
+  gt_BWTSeqMatchCountBatch(bwtSeq, batch->queries, batch->queryLens,
+                           batch->numQueries, false, batch->counts);
+  for (i = 0; i < batch->numQueries; ++i)
+  {
+    if (batch->counts[i] != batch->expectedCounts[i])
+    {
+      gt_error_set(err, "Number of matches not equal for suffix array ("
+                   GT_WU") and batch search of fmindex ("GT_WU").",
+                   batch->expectedCounts[i], batch->counts[i]);
+      return true;
+    }
+  }
+  batch->numQueries = 0;
+  return false;
+}
 
 struct chkSearchOptions
 {
@@ -60,9 +95,12 @@ gt_packedindex_chk_search(int argc, const char *argv[], GtError *err)
   int parsedArgs;
   bool had_err = false;
   BWTSeqExactMatchesIterator EMIter;
+  struct chkSearchBatch batch;
   bool EMIterInitialized = false;
   GtLogger *logger = NULL;
   inputProject = gt_str_new();
+  batch.patterns = NULL;
+  batch.numQueries = 0;
 
   do {
     gt_error_check(err);
@@ -174,6 +212,9 @@ gt_packedindex_chk_search(int argc, const char *argv[], GtError *err)
         fputs("Creation of pattern iterator failed!\n", stderr);
         break;
       }
+      batch.maxPatLen = (size_t) params.maxPatLen;
+      batch.patterns = gt_malloc(sizeof (*batch.patterns) * batch.maxPatLen
+                                 * CHK_SEARCH_BATCH_SIZE);
       for (trial = 0; !had_err && trial < params.numOfSamples; ++trial)
       {
         const GtUchar *pptr = gt_nextEnumpatterniterator(&patternLen, epi);
@@ -241,11 +282,26 @@ gt_packedindex_chk_search(int argc, const char *argv[], GtError *err)
                       numFMIMatches, numMMSearchMatches);
           }
         }
+        if (!had_err)
+        {
+          Symbol *pattern = batch.patterns
+            + batch.numQueries * batch.maxPatLen;
+          gt_assert(patternLen <= batch.maxPatLen);
+          memcpy(pattern, pptr, sizeof (*pattern) * patternLen);
+          batch.queries[batch.numQueries] = pattern;
+          batch.queryLens[batch.numQueries] = patternLen;
+          batch.expectedCounts[batch.numQueries++]
+            = gt_mmsearchiterator_count(mmsi);
+          if (batch.numQueries == CHK_SEARCH_BATCH_SIZE)
+            had_err = chkSearchBatchFlush(&batch, bwtSeq, err);
+        }
         gt_mmsearchiterator_delete(mmsi);
         mmsi = NULL;
         if (params.progressInterval && !((trial + 1) % params.progressInterval))
           putc('.', stderr);
       }
+      if (!had_err)
+        had_err = chkSearchBatchFlush(&batch, bwtSeq, err);
       if (params.progressInterval)
         putc('\n', stderr);
       fprintf(stderr, "Finished "GT_WU" of "GT_WU" matchings successfully.\n",
@@ -253,6 +309,7 @@ gt_packedindex_chk_search(int argc, const char *argv[], GtError *err)
     }
   } while (0);
   if (EMIterInitialized) gt_destructEMIterator(&EMIter);
+  gt_free(batch.patterns);
   if (saIsLoaded) gt_freesuffixarray(&suffixarray);
   gt_freeEnumpatterniterator(epi);
   if (bwtSeq) gt_deleteBWTSeq(bwtSeq);
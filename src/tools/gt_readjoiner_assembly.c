@@ -20,11 +20,15 @@
 #include "core/logger.h"
 #include "core/fa_api.h"
 #include "core/ma_api.h"
+#include "core/minmax_api.h"
 #include "core/unused_api.h"
 #include "core/showtime.h"
 #include "core/spacecalc.h"
+#include "core/thread_api.h"
+#include "match/firstcodes.h"
 #include "match/rdj-contigpaths.h"
 #include "match/rdj-cntlist.h"
+#include "match/rdj-spmfind.h"
 #include "match/rdj-spmlist.h"
 #include "match/rdj-strgraph.h"
 #include "match/rdj-filesuf-def.h"
@@ -37,7 +41,7 @@ typedef struct {
   unsigned int lengthcutoff, depthcutoff;
   GtStr  *readset, *buffersizearg;
   bool errors, paths2seq, redtrans, save, load, vd, astat, copynum,
-       show_contigs_info;
+       show_contigs_info, pipeline, savespm;
   unsigned int deadend, bubble, deadend_depth;
   GtOption *refoptionbuffersize;
   GtUword buffersize;
@@ -72,7 +76,8 @@ static GtOptionParser* gt_readjoiner_assembly_option_parser_new(
   GtReadjoinerAssemblyArguments *arguments = tool_arguments;
   GtOptionParser *op;
   GtOption *option, *errors_option, *deadend_option, *v_option,
-           *q_option, *bubble_option, *deadend_depth_option;
+           *q_option, *bubble_option, *deadend_depth_option, *l_option,
+           *spmfiles_option, *pipeline_option, *savespm_option;
   gt_assert(arguments);
 
   /* init */
@@ -86,17 +91,38 @@ static GtOptionParser* gt_readjoiner_assembly_option_parser_new(
   gt_option_is_mandatory(option);
 
   /* -spmfiles */
-  option = gt_option_new_uint_min("spmfiles", "number of SPM files to read\n"
-      "this must be equal to the value of -j for the overlap phase",
+  spmfiles_option = gt_option_new_uint_min("spmfiles", "number of SPM files "
+      "to read\nthis must be equal to the value of -j for the overlap phase",
       &arguments->nspmfiles, 1U, 1U);
-  gt_option_is_extended_option(option);
-  gt_option_parser_add_option(op, option);
+  gt_option_is_extended_option(spmfiles_option);
+  gt_option_parser_add_option(op, spmfiles_option);
 
   /* -l */
-  option = gt_option_new_uint_min("l", "specify the minimum SPM length",
+  l_option = gt_option_new_uint_min("l", "specify the minimum SPM length",
       &arguments->minmatchlength, 0, 2U);
-  gt_option_is_extended_option(option);
-  gt_option_parser_add_option(op, option);
+  gt_option_is_extended_option(l_option);
+  gt_option_parser_add_option(op, l_option);
+
+  /* -pipeline */
+  pipeline_option = gt_option_new_bool("pipeline", "compute the SPMs of the "
+      "minimum length specified by -l in memory and add them directly to the "
+      "string graph, instead of reading them from the files of the overlap "
+      "phase\nthe SPMs are computed twice, first to count the edges of "
+      "each vertex, then to insert them",
+      &arguments->pipeline, false);
+  gt_option_is_extended_option(pipeline_option);
+  gt_option_imply(pipeline_option, l_option);
+  gt_option_exclude(pipeline_option, spmfiles_option);
+  gt_option_parser_add_option(op, pipeline_option);
+
+  /* -savespm */
+  savespm_option = gt_option_new_bool("savespm", "in pipeline mode, save the "
+      "SPMs (and the contained reads, for reads of variable length) "
+      "to file, as in the overlap phase",
+      &arguments->savespm, false);
+  gt_option_is_extended_option(savespm_option);
+  gt_option_imply(savespm_option, pipeline_option);
+  gt_option_parser_add_option(op, savespm_option);
 
   /* -depthcutoff */
   option = gt_option_new_uint_min("depthcutoff", "specify the minimal "
@@ -204,6 +230,7 @@ static GtOptionParser* gt_readjoiner_assembly_option_parser_new(
   option = gt_option_new_bool("load", "save the string graph from file",
       &arguments->load, false);
   gt_option_is_development_option(option);
+  gt_option_exclude(option, pipeline_option);
   gt_option_parser_add_option(op, option);
 
   /* -save */
@@ -434,6 +461,174 @@ static int gt_readjoiner_assembly_build_graph(
   return had_err;
 }
 
+/* number of SPMs collected by each thread in pipeline mode, before they are
+   passed on to the string graph */
+#define GT_READJOINER_ASSEMBLY_SPMQUEUE_SIZE ((GtUword) 1 << 14)
+
+/* compute the SPMs of the mirrored readset <encseq> as done in the overlap
+   phase and pass them to <proc>; the threads hand over their SPMs through
+   queues of bounded size, so that <proc> is never called by two threads at
+   the same time; for reads of variable length, the contained reads are
+   marked in <contained> */
+static int gt_readjoiner_assembly_find_spm(const GtEncseq *encseq, bool eqlen,
+    unsigned int minmatchlength, GtSpmproc proc, void *procdata,
+    GtBitsequence *contained, const char *readset, GtUword *nof_irr_spm,
+    GtLogger *verbose_logger, GtError *err)
+{
+  int had_err = 0;
+  unsigned int threadcount;
+#ifdef GT_THREADS_ENABLED
+  const unsigned int threads = gt_jobs;
+#else
+  const unsigned int threads = 1U;
+#endif
+  const unsigned int kmersize = GT_MIN((unsigned int) GT_UNITSIN2BITENC,
+      minmatchlength);
+  const GtUword nofreads = GT_DIV2(gt_encseq_num_of_sequences(encseq));
+  GtBUstate_spmeq **state_table = gt_malloc(sizeof (*state_table) * threads);
+  GtSpmprocQueue **queues = gt_malloc(sizeof (*queues) * threads);
+  GtBitsequence **contained_table = NULL;
+  GtLogger *silent_logger = gt_logger_new(false, GT_LOGGER_DEFLT_PREFIX,
+      stdout);
+  GtMutex *mutex = gt_mutex_new();
+
+  if (!eqlen)
+    contained_table = gt_malloc(sizeof (*contained_table) * threads);
+  for (threadcount = 0; threadcount < threads; threadcount++)
+  {
+    queues[threadcount] = gt_spmproc_queue_new(
+        GT_READJOINER_ASSEMBLY_SPMQUEUE_SIZE, proc, procdata, mutex);
+    if (eqlen)
+      state_table[threadcount] = gt_spmfind_eqlen_state_new_with_proc(encseq,
+          (GtUword)minmatchlength, 32UL, true, gt_spmproc_queue_add,
+          queues[threadcount], readset, threadcount, silent_logger,
+          verbose_logger, err);
+    else
+    {
+      GT_INITBITTAB(contained_table[threadcount], nofreads);
+      state_table[threadcount] = gt_spmfind_varlen_state_new_with_proc(encseq,
+          (GtUword)minmatchlength, 32UL, true, gt_spmproc_queue_add,
+          queues[threadcount], contained_table[threadcount], readset,
+          threadcount, silent_logger, verbose_logger, err);
+    }
+  }
+  had_err = storefirstcodes_getencseqkmers_twobitencoding(encseq, kmersize,
+      0, 0, minmatchlength, false, false, false, 5U, 0, false, 1U,
+      eqlen ? gt_spmfind_eqlen_process : gt_spmfind_varlen_process,
+      eqlen ? gt_spmfind_eqlen_process_end : gt_spmfind_varlen_process_end,
+      state_table, silent_logger, err);
+  *nof_irr_spm = 0;
+  for (threadcount = 0; threadcount < threads; threadcount++)
+  {
+    if (eqlen)
+    {
+      *nof_irr_spm += gt_spmfind_eqlen_nof_irr_spm(state_table[threadcount]);
+      gt_spmfind_eqlen_state_delete(state_table[threadcount]);
+    }
+    else
+    {
+      size_t i;
+      *nof_irr_spm += gt_spmfind_varlen_nof_irr_spm(state_table[threadcount]);
+      gt_spmfind_varlen_state_delete(state_table[threadcount]);
+      for (i = 0; i < GT_NUMOFINTSFORBITS(nofreads); i++)
+        contained[i] |= contained_table[threadcount][i];
+      gt_free(contained_table[threadcount]);
+    }
+    gt_spmproc_queue_delete(queues[threadcount]);
+  }
+  gt_mutex_delete(mutex);
+  gt_logger_delete(silent_logger);
+  gt_free(contained_table);
+  gt_free(queues);
+  gt_free(state_table);
+  return had_err;
+}
+
+static int gt_readjoiner_assembly_build_graph_pipeline(
+    GtReadjoinerAssemblyArguments *arguments, GtStrgraph **strgraph,
+    GtEncseq *reads, const char *readset, bool eqlen, GtUword rlen,
+    GtUword nreads, GtBitsequence **contained, GtLogger *default_logger,
+    GtLogger *verbose_logger, GtTimer *timer, GtError *err)
+{
+  int had_err = 0;
+  GtEncseqLoader *el;
+  GtEncseq *encseq;
+  GtSpmprocSkipData skipdata;
+  GtUword nof_irr_spm = 0;
+
+  *strgraph = gt_strgraph_new(nreads);
+  gt_logger_log(verbose_logger, "SPM length = %u", arguments->minmatchlength);
+
+  el = gt_encseq_loader_new();
+  gt_encseq_loader_drop_description_support(el);
+  gt_encseq_loader_disable_autosupport(el);
+  encseq = gt_encseq_loader_load(el, readset, err);
+  if (encseq == NULL || gt_encseq_mirror(encseq, err) != 0)
+    had_err = -1;
+  if (had_err == 0 && !eqlen)
+    GT_INITBITTAB(*contained, nreads);
+
+  gt_logger_log(default_logger, GT_READJOINER_ASSEMBLY_MSG_COUNTSPM);
+  if (had_err == 0 && arguments->savespm)
+    had_err = gt_strgraph_open_spmlist_file(*strgraph, readset,
+        ".0" GT_READJOINER_SUFFIX_SPMLIST, true, 0, err);
+  if (had_err == 0)
+  {
+    had_err = gt_readjoiner_assembly_find_spm(encseq, eqlen,
+        arguments->minmatchlength, arguments->savespm
+        ? gt_spmproc_strgraph_count_and_save : gt_spmproc_strgraph_count,
+        *strgraph, *contained, readset, &nof_irr_spm, verbose_logger, err);
+    if (arguments->savespm)
+      gt_strgraph_close_spmlist_file(*strgraph);
+  }
+  if (had_err == 0)
+  {
+    gt_logger_log(verbose_logger, "number of irreducible suffix-prefix "
+        "matches = "GT_WU"", nof_irr_spm);
+    if (!eqlen)
+      gt_logger_log(verbose_logger, "number of contained reads = "GT_WU"",
+          gt_cntlist_count(*contained, nreads));
+  }
+  if (had_err == 0 && !eqlen && arguments->savespm)
+  {
+    GtStr *filename = gt_str_new_cstr(readset);
+    gt_str_append_cstr(filename, ".0" GT_READJOINER_SUFFIX_CNTLIST);
+    had_err = gt_cntlist_show(*contained, nreads, gt_str_get(filename), true,
+        err);
+    gt_str_delete(filename);
+  }
+  gt_readjoiner_assembly_show_current_space("(edges counted)");
+  if (gt_showtime_enabled())
+    gt_timer_show_progress(timer, GT_READJOINER_ASSEMBLY_MSG_BUILDSG, stdout);
+  gt_logger_log(default_logger, GT_READJOINER_ASSEMBLY_MSG_BUILDSG);
+
+  if (had_err == 0)
+  {
+    gt_assert((eqlen && rlen > 0 && reads == NULL) ||
+        (!eqlen && rlen == 0 && reads != NULL));
+    gt_strgraph_allocate_graph(*strgraph, rlen, reads);
+    gt_readjoiner_assembly_show_current_space("(graph allocated)");
+    gt_strgraph_begin_add(*strgraph, arguments->redtrans);
+    if (!eqlen)
+    {
+      skipdata.out.e.proc = gt_spmproc_strgraph_add;
+      skipdata.to_skip = *contained;
+      skipdata.out.e.data = *strgraph;
+      skipdata.skipped_counter = 0;
+    }
+    had_err = gt_readjoiner_assembly_find_spm(encseq, eqlen,
+        arguments->minmatchlength,
+        eqlen ? gt_spmproc_strgraph_add : gt_spmproc_skip,
+        eqlen ? (void*)*strgraph : (void*)&skipdata, *contained, readset,
+        &nof_irr_spm, NULL, err);
+    if (had_err == 0)
+      gt_strgraph_end_add(*strgraph);
+  }
+  gt_encseq_delete(encseq);
+  gt_encseq_loader_delete(el);
+  return had_err;
+}
+
 static void gt_readjoiner_assembly_load_graph(GtStrgraph **strgraph,
     GtEncseq *reads, const char *readset, GtUword rlen,
     GtLogger *default_logger, GtTimer *timer)
@@ -539,8 +734,9 @@ static int gt_readjoiner_assembly_runner(GT_UNUSED int argc,
       }
       else
       {
-        had_err = gt_readjoiner_assembly_build_contained_reads_list(
-          arguments, &contained, err);
+        if (!arguments->pipeline)
+          had_err = gt_readjoiner_assembly_build_contained_reads_list(
+            arguments, &contained, err);
         rlen = 0;
         gt_logger_log(verbose_logger, "read length = variable");
         gt_assert(reads != NULL);
@@ -549,7 +745,13 @@ static int gt_readjoiner_assembly_runner(GT_UNUSED int argc,
 
     if (had_err == 0)
     {
-      if (!arguments->load)
+      if (arguments->pipeline)
+      {
+        had_err = gt_readjoiner_assembly_build_graph_pipeline(arguments,
+            &strgraph, reads, readset, eqlen, rlen, nreads, &contained,
+            default_logger, verbose_logger, timer, err);
+      }
+      else if (!arguments->load)
       {
         had_err = gt_readjoiner_assembly_build_graph(arguments, &strgraph,
             reads, readset, eqlen, rlen, nreads, contained, default_logger,
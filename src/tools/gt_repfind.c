@@ -22,7 +22,10 @@
 #include "core/logger.h"
 #include "core/ma_api.h"
 #include "core/option_api.h"
+#include "core/seq_iterator_sequence_buffer_api.h"
 #include "core/str_api.h"
+#include "core/thread_pool.h"
+#include "core/thread_pool_output.h"
 #include "core/tool_api.h"
 #include "core/unused_api.h"
 #include "core/versionfunc_api.h"
@@ -37,6 +40,7 @@
 #include "match/test-maxpairs.h"
 #include "match/seed-extend.h"
 #include "match/esa-map.h"
+#include "match/querybatch.h"
 #include "tools/gt_repfind.h"
 
 typedef struct
@@ -559,6 +563,303 @@ typedef void (*Gt_extend_querymatch_func)(void *,
                                           const GtSeqorEncseq *,
                                           bool);
 
+static void gt_repfind_process_querymatch(
+                               const GtQuerysubstringmatchiterator *qsmi,
+                               const GtEncseq *dbencseq,
+                               const GtEncseq *query_encseq,
+                               bool selfmatch,
+                               bool same_encseq,
+                               GtQuerymatch *exactseed,
+                               Gt_extend_querymatch_func eqmf,
+                               void *eqmf_data,
+                               const GtSeedExtendDisplayFlag *out_display_flag)
+{
+  GtSeqorEncseq query_seqorencseq;
+  GtUword dbstart, dbseqnum, db_seqstart, dbseqlen,
+          matchlength, query_seqlen, querystart, query_seqstart;
+  uint64_t queryunitnum;
+
+  dbstart = gt_querysubstringmatchiterator_dbstart(qsmi);
+  if (gt_encseq_has_multiseq_support(dbencseq))
+  {
+    dbseqnum = gt_encseq_seqnum(dbencseq,dbstart);
+    dbseqlen = gt_encseq_seqlength(dbencseq, dbseqnum);
+    db_seqstart = gt_encseq_seqstartpos(dbencseq, dbseqnum);
+  } else
+  {
+    dbseqnum = dbseqlen = db_seqstart = 0;
+  }
+  matchlength = gt_querysubstringmatchiterator_matchlength(qsmi);
+  query_seqlen = gt_querysubstringmatchiterator_query_seqlen(qsmi);
+  queryunitnum = gt_querysubstringmatchiterator_queryunitnum(qsmi);
+  if (query_encseq != NULL)
+  {
+    GT_SEQORENCSEQ_INIT_ENCSEQ(&query_seqorencseq,query_encseq);
+    query_seqstart = gt_encseq_seqstartpos(query_encseq,queryunitnum);
+  } else
+  {
+    GT_SEQORENCSEQ_INIT_SEQ(&query_seqorencseq,
+                            gt_querysubstringmatchiterator_query(qsmi),
+                            gt_querysubstringmatchiterator_desc(qsmi),
+                            query_seqlen,
+                            NULL,
+                            0,
+                            true);
+    query_seqstart = 0;
+  }
+  querystart = gt_querysubstringmatchiterator_querystart(qsmi);
+  if (eqmf != NULL)
+  {
+    gt_querymatch_init(exactseed,
+                       matchlength,
+                       dbseqnum,
+                       dbstart - db_seqstart,
+                       db_seqstart,
+                       dbseqlen,
+                       0, /* score */
+                       0, /* edist */
+                       0, /* mismatches */
+                       selfmatch,
+                       queryunitnum,
+                       matchlength,
+                       querystart,
+                       query_seqstart,
+                       query_seqlen,
+                       NULL,
+                       NULL);
+    eqmf(eqmf_data,dbencseq,exactseed,&query_seqorencseq,same_encseq);
+  } else
+  {
+    GtSeqorEncseq dbes;
+
+    GT_SEQORENCSEQ_INIT_ENCSEQ(&dbes,dbencseq);
+    if (gt_querymatch_complete(exactseed,
+                               out_display_flag,
+                               matchlength,
+                               dbseqnum,
+                               dbstart - db_seqstart,
+                               db_seqstart,
+                               dbseqlen,
+                               0, /* score */
+                               0, /* edist */
+                               0, /* mismatches */
+                               selfmatch,
+                               queryunitnum,
+                               matchlength,
+                               querystart,
+                               &dbes,
+                               &query_seqorencseq,
+                               query_seqstart,
+                               query_seqlen,
+                               dbstart - db_seqstart,
+                               querystart - query_seqstart,
+                               matchlength,
+                               false))
+    {
+      /* for exact matches we do not output evalues and bitscores */
+      gt_querymatch_prettyprint(DBL_MAX,DBL_MAX,out_display_flag,exactseed);
+    }
+  }
+}
+
+/* Number of chunks of query sequences or parts of the suffix array per
+   worker. */
+#define GT_REPFIND_CHUNKSPERWORKER 4U
+
+typedef struct
+{
+  const Suffixarray *suffixarray;
+  GtReadmode query_readmode;
+  unsigned int userdefinedleastlength;
+  const GtSeedExtendDisplayFlag *out_display_flag;
+  GtQuerybatch *querybatch;
+  GtThreadPoolOutput *output;
+} GtRepfindBatchinfo;
+
+static void gt_repfind_match_queries(GtUword start,GtUword end,FILE *outfp,
+                                     void *data)
+{
+  const GtRepfindBatchinfo *batchinfo = (const GtRepfindBatchinfo *) data;
+  const Suffixarray *suffixarray = batchinfo->suffixarray;
+  const GtUword totallength = gt_encseq_total_length(suffixarray->encseq);
+  GtQuerysubstringmatchiterator *qsmi;
+  GtQuerymatch *exactseed;
+  GtUword idx;
+
+  qsmi = gt_querysubstringmatchiterator_new(suffixarray->encseq,
+                                            totallength,
+                                            suffixarray->suftab,
+                                            suffixarray->readmode,
+                                            totallength + 1,
+                                            NULL,
+                                            NULL,
+                                            batchinfo->query_readmode,
+                                            batchinfo->userdefinedleastlength,
+                                            NULL);
+  gt_assert(qsmi != NULL);
+  exactseed = gt_querymatch_new();
+  gt_querymatch_query_readmode_set(exactseed,batchinfo->query_readmode);
+  gt_querymatch_file_set(exactseed,outfp);
+  for (idx = start; idx < end; idx++)
+  {
+    const GtQuerybatchQuery *query
+      = gt_querybatch_queries(batchinfo->querybatch) + idx;
+
+    gt_querysubstringmatchiterator_set_query(qsmi,
+                                             query->unitnum,
+                                             gt_querybatch_sequence(
+                                                  batchinfo->querybatch,query),
+                                             query->length,
+                                             gt_querybatch_description(
+                                                  batchinfo->querybatch,
+                                                  query));
+    while (gt_querysubstringmatchiterator_next(qsmi, NULL) == 0)
+    {
+      gt_repfind_process_querymatch(qsmi,
+                                    suffixarray->encseq,
+                                    NULL,
+                                    false,
+                                    false,
+                                    exactseed,
+                                    NULL,
+                                    NULL,
+                                    batchinfo->out_display_flag);
+    }
+  }
+  gt_querymatch_delete(exactseed);
+  gt_querysubstringmatchiterator_delete(qsmi);
+}
+
+static void gt_repfind_batchflush(GtRepfindBatchinfo *batchinfo)
+{
+  gt_thread_pool_output_parallel_for(batchinfo->output,0,
+                                     gt_querybatch_size(batchinfo->querybatch),
+                                     gt_repfind_match_queries,batchinfo,
+                                     stdout);
+  gt_querybatch_reset(batchinfo->querybatch);
+}
+
+/* Match the sequences of <query_files> against the index in parallel. The
+   sequences are read in batches, and the matches are output in the order of
+   the query sequences, as in the sequential mode. */
+static int gt_repfind_parallel_querymatches(const Suffixarray *suffixarray,
+                                            const GtStrArray *query_files,
+                                            GtReadmode query_readmode,
+                                            unsigned int
+                                              userdefinedleastlength,
+                                            const GtSeedExtendDisplayFlag
+                                              *out_display_flag,
+                                            GtError *err)
+{
+  GtRepfindBatchinfo batchinfo;
+  GtSeqIterator *seqit;
+  const GtUchar *query;
+  GtUword querylen;
+  char *desc = NULL;
+  uint64_t unitnum;
+  bool haserr = false;
+
+  seqit = gt_seq_iterator_sequence_buffer_new(query_files, err);
+  if (seqit == NULL)
+  {
+    return -1;
+  }
+  gt_seq_iterator_set_symbolmap(seqit,
+                  gt_alphabet_symbolmap(gt_encseq_alphabet(
+                                              suffixarray->encseq)));
+  batchinfo.suffixarray = suffixarray;
+  batchinfo.query_readmode = query_readmode;
+  batchinfo.userdefinedleastlength = userdefinedleastlength;
+  batchinfo.out_display_flag = out_display_flag;
+  batchinfo.querybatch = gt_querybatch_new();
+  batchinfo.output = gt_thread_pool_output_new(GT_REPFIND_CHUNKSPERWORKER);
+  for (unitnum = 0; /* Nothing */; unitnum++)
+  {
+    int retval = gt_seq_iterator_next(seqit, &query, &querylen, &desc, err);
+
+    if (retval < 0)
+    {
+      haserr = true;
+      break;
+    }
+    if (retval == 0)
+    {
+      break;
+    }
+    if (querylen >= (GtUword) userdefinedleastlength)
+    {
+      gt_querybatch_add(batchinfo.querybatch,unitnum,query,querylen,desc);
+      if (gt_querybatch_is_full(batchinfo.querybatch))
+      {
+        gt_repfind_batchflush(&batchinfo);
+      }
+    }
+  }
+  /* the matches of the sequences preceding an erroneous sequence are
+     reported */
+  gt_repfind_batchflush(&batchinfo);
+  gt_thread_pool_output_delete(batchinfo.output);
+  gt_querybatch_delete(batchinfo.querybatch);
+  gt_seq_iterator_delete(seqit);
+  return haserr ? -1 : 0;
+}
+
+/* Enumerate the exact maximal repeats of the index in parallel, each part
+   of the suffix array writing to its own stream. The matches are output
+   in the same order as in the sequential mode. */
+static int gt_repfind_parallel_selfmatches(const char *indexname,
+                                           unsigned int seedlength,
+                                           GtUword maxfreq,
+                                           const
+                                           GtProcessinfo_and_querymatchspaceptr
+                                             *info_querymatch,
+                                           GtLogger *logger,
+                                           GtError *err)
+{
+  GtThreadPoolOutput *output
+    = gt_thread_pool_output_new(GT_REPFIND_CHUNKSPERWORKER);
+  const GtUword numofparts = gt_thread_pool_output_num_of_chunks(output);
+  GtProcessinfo_and_querymatchspaceptr *parttab;
+  void **processmaxpairsinfotab;
+  GtUword part;
+  bool haserr = false;
+
+  parttab = gt_malloc(sizeof *parttab * numofparts);
+  processmaxpairsinfotab = gt_malloc(sizeof *processmaxpairsinfotab *
+                                     numofparts);
+  for (part = 0; part < numofparts; part++)
+  {
+    parttab[part] = *info_querymatch;
+    parttab[part].querymatchspaceptr = gt_querymatch_new();
+    gt_querymatch_file_set(parttab[part].querymatchspaceptr,
+                           gt_thread_pool_output_stream(output,part));
+    processmaxpairsinfotab[part] = (void *) (parttab + part);
+  }
+  if (gt_callenummaxpairs_parts(indexname,
+                                seedlength,
+                                maxfreq,
+                                gt_exact_selfmatch_with_output,
+                                processmaxpairsinfotab,
+                                numofparts,
+                                logger,
+                                err) != 0)
+  {
+    haserr = true;
+  }
+  if (!haserr)
+  {
+    gt_thread_pool_output_flush(output,numofparts,stdout);
+  }
+  for (part = 0; part < numofparts; part++)
+  {
+    gt_querymatch_delete(parttab[part].querymatchspaceptr);
+  }
+  gt_thread_pool_output_delete(output);
+  gt_free(processmaxpairsinfotab);
+  gt_free(parttab);
+  return haserr ? -1 : 0;
+}
+
 static int gt_callenumquerymatches(bool selfmatch,
                                    const char *indexname,
                                    const GtStrArray *query_files,
@@ -575,7 +876,7 @@ static int gt_callenumquerymatches(bool selfmatch,
 {
   Suffixarray suffixarray;
   GtQuerysubstringmatchiterator *qsmi = NULL;
-  bool haserr = false, query_encseq_own = false;
+  bool haserr = false, query_encseq_own = false, with_query_files;
   GtEncseq *query_encseq = NULL;
   GtUword totallength = 0;
 
@@ -587,9 +888,11 @@ static int gt_callenumquerymatches(bool selfmatch,
   {
     haserr = true;
   }
+  with_query_files = (query_files != NULL &&
+                      gt_str_array_size(query_files) > 0) ? true : false;
   if (!haserr)
   {
-    if (query_files == NULL || gt_str_array_size(query_files) == 0)
+    if (!with_query_files)
     {
       if (query_indexname == NULL || gt_str_length(query_indexname) == 0)
       {
@@ -614,6 +917,21 @@ static int gt_callenumquerymatches(bool selfmatch,
       gt_assert(query_indexname == NULL || gt_str_length(query_indexname) == 0);
     }
   }
+  /* Exact matches of query sequences from files are independent of each
+     other. The extension of matches and the computation of alignments use
+     shared buffers and are therefore done sequentially. */
+  if (!haserr && with_query_files && eqmf == NULL &&
+      querymatchoutoptions == NULL && gt_thread_pool_num_of_workers() > 1U)
+  {
+    haserr = gt_repfind_parallel_querymatches(&suffixarray,
+                                              query_files,
+                                              query_readmode,
+                                              userdefinedleastlength,
+                                              out_display_flag,
+                                              err) != 0 ? true : false;
+    gt_freesuffixarray(&suffixarray);
+    return haserr ? -1 : 0;
+  }
   if (!haserr)
   {
     totallength = gt_encseq_total_length(suffixarray.encseq);
@@ -635,11 +953,10 @@ static int gt_callenumquerymatches(bool selfmatch,
   if (!haserr)
   {
     int retval;
-    GtSeqorEncseq query_seqorencseq;
     GtQuerymatch *exactseed = gt_querymatch_new();
     bool same_encseq;
 
-    if (query_files == NULL || gt_str_array_size(query_files) == 0)
+    if (!with_query_files)
     {
       same_encseq = (suffixarray.encseq == query_encseq) ? true : false;
     } else
@@ -654,92 +971,15 @@ static int gt_callenumquerymatches(bool selfmatch,
     while (!haserr &&
            (retval = gt_querysubstringmatchiterator_next(qsmi, err)) == 0)
     {
-      GtUword dbstart, dbseqnum, db_seqstart, dbseqlen,
-              matchlength, query_seqlen, querystart, query_seqstart;
-      uint64_t queryunitnum;
-
-      dbstart = gt_querysubstringmatchiterator_dbstart(qsmi);
-      if (gt_encseq_has_multiseq_support(suffixarray.encseq))
-      {
-        dbseqnum = gt_encseq_seqnum(suffixarray.encseq,dbstart);
-        dbseqlen = gt_encseq_seqlength(suffixarray.encseq, dbseqnum);
-        db_seqstart = gt_encseq_seqstartpos(suffixarray.encseq, dbseqnum);
-      } else
-      {
-        dbseqnum = dbseqlen = db_seqstart = 0;
-      }
-      matchlength = gt_querysubstringmatchiterator_matchlength(qsmi);
-      query_seqlen = gt_querysubstringmatchiterator_query_seqlen(qsmi);
-      queryunitnum = gt_querysubstringmatchiterator_queryunitnum(qsmi);
-      if (query_files == NULL || gt_str_array_size(query_files) == 0)
-      {
-        GT_SEQORENCSEQ_INIT_ENCSEQ(&query_seqorencseq,query_encseq);
-        query_seqstart = gt_encseq_seqstartpos(query_encseq,queryunitnum);
-      } else
-      {
-        GT_SEQORENCSEQ_INIT_SEQ(&query_seqorencseq,
-                                gt_querysubstringmatchiterator_query(qsmi),
-                                gt_querysubstringmatchiterator_desc(qsmi),
-                                query_seqlen,
-                                NULL,
-                                0,
-                                true);
-        query_seqstart = 0;
-      }
-      querystart = gt_querysubstringmatchiterator_querystart(qsmi);
-      if (eqmf != NULL)
-      {
-        gt_querymatch_init(exactseed,
-                           matchlength,
-                           dbseqnum,
-                           dbstart - db_seqstart,
-                           db_seqstart,
-                           dbseqlen,
-                           0, /* score */
-                           0, /* edist */
-                           0, /* mismatches */
-                           selfmatch,
-                           queryunitnum,
-                           matchlength,
-                           querystart,
-                           query_seqstart,
-                           query_seqlen,
-                           NULL,
-                           NULL);
-        eqmf(eqmf_data,suffixarray.encseq,exactseed,&query_seqorencseq,
-             same_encseq);
-      } else
-      {
-        GtSeqorEncseq dbes;
-
-        GT_SEQORENCSEQ_INIT_ENCSEQ(&dbes,suffixarray.encseq);
-        if (gt_querymatch_complete(exactseed,
-                                   out_display_flag,
-                                   matchlength,
-                                   dbseqnum,
-                                   dbstart - db_seqstart,
-                                   db_seqstart,
-                                   dbseqlen,
-                                   0, /* score */
-                                   0, /* edist */
-                                   0, /* mismatches */
-                                   selfmatch,
-                                   queryunitnum,
-                                   matchlength,
-                                   querystart,
-                                   &dbes,
-                                   &query_seqorencseq,
-                                   query_seqstart,
-                                   query_seqlen,
-                                   dbstart - db_seqstart,
-                                   querystart - query_seqstart,
-                                   matchlength,
-                                   false))
-        {
-          /* for exact matches we do not output evalues and bitscores */
-          gt_querymatch_prettyprint(DBL_MAX,DBL_MAX,out_display_flag,exactseed);
-        }
-      }
+      gt_repfind_process_querymatch(qsmi,
+                                    suffixarray.encseq,
+                                    query_encseq,
+                                    selfmatch,
+                                    same_encseq,
+                                    exactseed,
+                                    eqmf,
+                                    eqmf_data,
+                                    out_display_flag);
     }
     if (retval == -1)
     {
@@ -1033,16 +1273,36 @@ static int gt_repfind_runner(int argc,const char **argv, int parsed_args,
             }
             processmaxpairsdata = (void *) &info_querymatch;
           }
-          if (gt_callenummaxpairs(gt_str_get(arguments->indexname),
-                                  arguments->seedlength,
-                                  arguments->maxfreq,
-                                  arguments->scanfile,
-                                  processmaxpairs,
-                                  processmaxpairsdata,
-                                  logger,
-                                  err) != 0)
+          /* Exact maximal pairs are enumerated in parallel parts of the
+             mapped index. Extensions and alignments use shared buffers and
+             are therefore computed sequentially. */
+          if (processmaxpairs == gt_exact_selfmatch_with_output &&
+              querymatchoutoptions == NULL && !arguments->scanfile &&
+              gt_thread_pool_num_of_workers() > 1U)
           {
-            haserr = true;
+            if (gt_repfind_parallel_selfmatches(
+                                   gt_str_get(arguments->indexname),
+                                   arguments->seedlength,
+                                   arguments->maxfreq,
+                                   &info_querymatch,
+                                   logger,
+                                   err) != 0)
+            {
+              haserr = true;
+            }
+          } else
+          {
+            if (gt_callenummaxpairs(gt_str_get(arguments->indexname),
+                                    arguments->seedlength,
+                                    arguments->maxfreq,
+                                    arguments->scanfile,
+                                    processmaxpairs,
+                                    processmaxpairsdata,
+                                    logger,
+                                    err) != 0)
+            {
+              haserr = true;
+            }
           }
         }
         if (!haserr)
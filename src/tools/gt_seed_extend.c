@@ -55,12 +55,14 @@ typedef struct {
   GtUword dbs_maxfreq;
   GtUword dbs_suppress;
   GtUword dbs_memlimit;
+  GtUword dbs_spillmem;
   GtUword dbs_parts;
   GtRange seedpairdistance;
   GtStr *dbs_pick_str,
         *diagband_statistics_arg,
         *chainarguments,
-        *dbs_memlimit_str;
+        *dbs_memlimit_str,
+        *dbs_spillmem_str;
   bool dbs_debug_kmer;
   bool dbs_debug_seedpair;
   bool dbs_verify;
@@ -112,6 +114,7 @@ static void* gt_seed_extend_arguments_new(void)
   arguments->chainarguments = gt_str_new();
   arguments->diagband_statistics_arg = gt_str_new();
   arguments->dbs_memlimit_str = gt_str_new();
+  arguments->dbs_spillmem_str = gt_str_new();
   arguments->char_access_mode = gt_str_new();
   arguments->splt_string = gt_str_new();
   arguments->kmplt_string = gt_str_new();
@@ -129,6 +132,7 @@ static void gt_seed_extend_arguments_delete(void *tool_arguments)
     gt_str_delete(arguments->chainarguments);
     gt_str_delete(arguments->diagband_statistics_arg);
     gt_str_delete(arguments->dbs_memlimit_str);
+    gt_str_delete(arguments->dbs_spillmem_str);
     gt_str_delete(arguments->char_access_mode);
     gt_str_delete(arguments->splt_string);
     gt_str_delete(arguments->kmplt_string);
@@ -151,7 +155,8 @@ static GtOptionParser* gt_seed_extend_option_parser_new(void *tool_arguments)
     *op_his, *op_dif, *op_pmh,
     *op_seedlength, *op_spacedseed, *op_minlen, *op_minid, *op_evalue, *op_xbe,
     *op_sup, *op_frq,
-    *op_mem, *op_bia, *op_onlyseeds, *op_weakends, *op_relax_polish,
+    *op_mem, *op_spillmem, *op_debug_seedpair, *op_verify, *op_bia,
+    *op_onlyseeds, *op_weakends, *op_relax_polish,
     *op_verify_alignment, *op_only_selected_seqpairs, *op_spdist, *op_outfmt,
     *op_norev, *op_nofwd, *op_part, *op_pick, *op_overl, *op_trimstat,
     *op_cam_generic, *op_diagbandwidth, *op_mincoverage, *op_maxmat,
@@ -270,6 +275,17 @@ static GtOptionParser* gt_seed_extend_option_parser_new(void *tool_arguments)
                                 "");
   gt_option_parser_add_option(op, op_mem);
 
+  /* -spillmem */
+  op_spillmem = gt_option_new_string("spillmem",
+                                     "Maximum memory usage for the seeds; "
+                                     "if exceeded, sorted runs of seeds are "
+                                     "written to temporary files (in the "
+                                     "directory given by TMPDIR), which are "
+                                     "merged during the extension",
+                                     arguments->dbs_spillmem_str,
+                                     "");
+  gt_option_parser_add_option(op, op_spillmem);
+
   /* -debug-kmer */
   option = gt_option_new_bool("debug-kmer",
                               "Output KmerPos lists",
@@ -279,20 +295,23 @@ static GtOptionParser* gt_seed_extend_option_parser_new(void *tool_arguments)
   gt_option_parser_add_option(op, option);
 
   /* -debug-seedpair */
-  option = gt_option_new_bool("debug-seedpair",
-                              "Output SeedPair lists",
-                              &arguments->dbs_debug_seedpair,
-                              false);
-  gt_option_is_development_option(option);
-  gt_option_parser_add_option(op, option);
+  op_debug_seedpair = gt_option_new_bool("debug-seedpair",
+                                         "Output SeedPair lists",
+                                         &arguments->dbs_debug_seedpair,
+                                         false);
+  gt_option_is_development_option(op_debug_seedpair);
+  gt_option_exclude(op_debug_seedpair, op_spillmem);
+  gt_option_parser_add_option(op, op_debug_seedpair);
 
   /* -verify */
-  option = gt_option_new_bool("verify",
-                              "Check that k-mer seeds occur in the sequences",
-                              &arguments->dbs_verify,
-                              false);
-  gt_option_is_development_option(option);
-  gt_option_parser_add_option(op, option);
+  op_verify = gt_option_new_bool("verify",
+                                 "Check that k-mer seeds occur in the "
+                                 "sequences",
+                                 &arguments->dbs_verify,
+                                 false);
+  gt_option_is_development_option(op_verify);
+  gt_option_exclude(op_verify, op_spillmem);
+  gt_option_parser_add_option(op, op_verify);
 
   /* -extendxdrop */
   op_xdr = gt_option_new_uword_min_max("extendxdrop",
@@ -698,6 +717,20 @@ static int gt_seed_extend_arguments_check(int rest_argc, void *tool_arguments,
       had_err = -1;
     }
   }
+
+  /* parse spillmem argument */
+  arguments->dbs_spillmem = GT_UWORD_MAX;
+  if (!had_err && strcmp(gt_str_get(arguments->dbs_spillmem_str), "") != 0) {
+    had_err = gt_option_parse_spacespec(&arguments->dbs_spillmem,
+                                        "spillmem",
+                                        arguments->dbs_spillmem_str,
+                                        err);
+    if (!had_err && arguments->dbs_spillmem == 0) {
+      gt_error_set(err,
+                   "argument to option \"-spillmem\" must be at least 1MB");
+      had_err = -1;
+    }
+  }
 #ifdef GT_THREADS_ENABLED
   if (!had_err && arguments->compute_ani && gt_jobs > 1)
   {
@@ -1211,6 +1244,7 @@ static int gt_seed_extend_runner(int argc,
                                     bencseq,
                                     arguments->dbs_maxfreq,
                                     arguments->dbs_memlimit,
+                                    arguments->dbs_spillmem,
                                     arguments->dbs_spacedseedweight,
                                     arguments->dbs_seedlength,
                                     arguments->norev,
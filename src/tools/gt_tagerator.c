@@ -178,6 +178,11 @@ static GtOptionParser* gt_tagerator_option_parser_new(void *tool_arguments)
                                       arguments->outputspec);
   gt_option_parser_add_option(op, option);
 
+  option = gt_option_new_bool("benchmark","show the number of tags searched "
+                              "per second",
+                              &arguments->benchmark, false);
+  gt_option_parser_add_option(op, option);
+
   option = gt_option_new_verbose(&arguments->verbose);
   gt_option_parser_add_option(op, option);
 
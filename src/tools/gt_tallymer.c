@@ -34,6 +34,7 @@
 #include "match/tyr-show.h"
 #include "match/tyr-search.h"
 #include "match/tyr-mersplit.h"
+#include "match/tyr-mph.h"
 #include "match/tyr-occratio.h"
 #include "tools/gt_tallymer.h"
 
@@ -61,6 +62,7 @@ typedef struct
   GtStr *str_storeindex,
         *str_inputindex;
   bool storecounts,
+       storehash,
        performtest,
        verbose,
        scanfile;
@@ -97,6 +99,7 @@ static GtOptionParser *gt_tyr_mkindex_option_parser_new(void *tool_arguments)
            *optionmaxocc,
            *optionpl,
            *optionstoreindex,
+           *optionstorehash,
            *optionstorecounts,
            *optionscan,
            *optionesa;
@@ -157,6 +160,13 @@ static GtOptionParser *gt_tyr_mkindex_option_parser_new(void *tool_arguments)
                                          &arguments->storecounts,false);
   gt_option_parser_add_option(op, optionstorecounts);
 
+  optionstorehash = gt_option_new_bool("mph",
+                                       "construct a minimal perfect hash "
+                                       "function over the mers for faster "
+                                       "search",
+                                       &arguments->storehash,false);
+  gt_option_parser_add_option(op, optionstorehash);
+
   option = gt_option_new_bool("test", "perform tests to verify program "
                                       "correctness", &arguments->performtest,
                                       false);
@@ -175,6 +185,7 @@ static GtOptionParser *gt_tyr_mkindex_option_parser_new(void *tool_arguments)
 
   gt_option_imply(optionpl, optionstoreindex);
   gt_option_imply(optionstorecounts, optionstoreindex);
+  gt_option_imply(optionstorehash, optionstoreindex);
   gt_option_imply_either_2(optionstoreindex,optionminocc,optionmaxocc);
   return op;
 }
@@ -291,6 +302,14 @@ static int gt_tyr_mkindex_runner(GT_UNUSED int argc,
       haserr = true;
     }
   }
+  if (!haserr && arguments->storehash)
+  {
+    if (gt_constructmerhash(gt_str_get(arguments->str_storeindex),
+                            arguments->verbose,err) != 0)
+    {
+      haserr = true;
+    }
+  }
   gt_logger_delete(logger);
   return haserr ? - 1 : 0;
 }
@@ -38,6 +38,32 @@ Test do
   end
 end
 
+Name "gt chain2dim -seqpairs"
+Keywords "gt_chain2dim seqpairs"
+Test do
+  run "awk '{print NR%3,NR%2,$0}' #{$testdata}ecolicmp250.of"
+  run "mv #{last_stdout} pairs.of"
+  ["-global", "-local 2b -wf 1.8", "-global gc -maxgap 10"].each do |args|
+    File.open("expected.out","w") do |expected|
+      [[0,0],[0,1],[1,0],[1,1],[2,0],[2,1]].each do |s0,s1|
+        run "awk '$1 == #{s0} && $2 == #{s1} {print $3,$4,$5,$6,$7}' pairs.of"
+        run "mv #{last_stdout} pair.of"
+        run_test "#{$bin}gt chain2dim #{args} -m pair.of"
+        expected.puts "# sequence pair #{s0} #{s1}"
+        expected.write File.read(last_stdout)
+      end
+    end
+    run_test "#{$bin}gt chain2dim -seqpairs #{args} -m pairs.of"
+    run "cmp #{last_stdout} expected.out"
+    run_test "#{$bin}gt -j 4 chain2dim -seqpairs #{args} -m pairs.of"
+    run "cmp #{last_stdout} expected.out"
+    run_test "#{$bin}gt chain2dim -seqpairs -v #{args} -m pairs.of"
+    run "mv #{last_stdout} sequential.out"
+    run_test "#{$bin}gt -j 4 chain2dim -seqpairs -v #{args} -m pairs.of"
+    run "cmp #{last_stdout} sequential.out"
+  end
+end
+
 runchain2dimfailure("-maxgap 0")
 runchain2dimfailure("-maxgap -1")
 runchain2dimfailure("-wf 0.0")
@@ -86,6 +86,70 @@ Test do
   run "diff #{last_stdout} #{$testdata}dust.window32.out"
 end
 
+Name "gt encseq encode multithreaded"
+Keywords "encseq gt_encseq_encode threads"
+Test do
+  files = ["Atinsert.fna", "U89959_genomic.fas", "RandomN.fna", "dust.fna"]
+  files = files.map { |f| "#{$testdata}#{f}" }.join(" ")
+  [["", ""], ["-lossless", ".ois"], ["-dust", ""]].each do |opt, sfx|
+    ["1", "4"].each do |j|
+      run_test "#{$bin}gt -j #{j} encseq encode -des -ssp -sds -md5 " + \
+               "#{opt} -indexname j#{j} #{files}"
+    end
+    [".esq", ".des", ".ssp", ".sds", ".md5", sfx].uniq.each do |s|
+      next if s.empty?
+      run "cmp j1#{s} j4#{s}"
+    end
+  end
+  run_test "#{$bin}gt -j 4 encseq encode -dna -indexname foo " + \
+           "#{$testdata}TTT-small-wrongchar.fna", :retval => 1
+  grep(last_stderr, /illegal.*line 4/)
+end
+
+Name "gt encseq encode multithreaded, input of several chunks"
+Keywords "encseq gt_encseq_encode threads"
+Test do
+  # the parallel FASTA parser reads its input in chunks of 2MB, so the
+  # sequence of long.fna spans several chunks, including a run of wildcards
+  lines = File.readlines("#{$testdata}at1MB").reject { |l| l.start_with?(">") }
+  File.open("long.fna", "w") do |f|
+    f.puts ">long sequence"
+    6.times do |i|
+      f.puts(lines[0, lines.length/2])
+      f.puts("N" * (50 + i))
+      f.puts(lines[lines.length/2..-1])
+    end
+  end
+  files = ["long.fna", "#{$testdata}at1MB", "#{$testdata}RandomN.fna",
+           "#{$testdata}U89959_genomic.fas"].join(" ")
+  [["", ""], ["-lossless", ".ois"], ["-dust", ""]].each do |opt, sfx|
+    ["1", "3"].each do |j|
+      run_test "#{$bin}gt -j #{j} encseq encode -des -ssp -sds -md5 " + \
+               "#{opt} -indexname j#{j} #{files}", :maxtime => 300
+    end
+    [".esq", ".des", ".ssp", ".sds", ".md5", sfx].uniq.each do |s|
+      next if s.empty?
+      run "cmp j1#{s} j3#{s}"
+    end
+  end
+end
+
+Name "gt encseq bench substring extractions"
+Keywords "encseq gt_encseq_bench"
+Test do
+  ["direct", "bit", "uchar", "ushort", "uint32"].each do |sat|
+    run_test "#{$bin}gt encseq encode -sat #{sat} -indexname #{sat} " + \
+             "#{$testdata}RandomN.fna #{$testdata}Atinsert.fna"
+    [1, 31, 100, 1000].each do |len|
+      run_test "#{$bin}gt encseq bench -ssext 500 -sslen #{len} #{sat}"
+      grep(last_stdout, /^rc: sssum=/)
+    end
+  end
+  run_test "#{$bin}gt encseq encode -sat eqlen -indexname eqlen " + \
+           "#{$testdata}Reads1.fna"
+  run_test "#{$bin}gt encseq bench -ssext 500 -sslen 50 eqlen"
+end
+
 STDREADMODES  = ["fwd", "rev"]
 DNAREADMODES  = STDREADMODES + ["cpl", "rcl"]
 DNATESTSEQS   = ["#{$testdata}foobar.fas",
@@ -42,6 +42,15 @@ if not $arguments["nordb"] then
     run "#{$bin}gt featureindex -filename corrupt.db", :retval => 1
   end
 
+  Name "gt featureindex -benchmark"
+  Keywords "gt_featureindex"
+  Test do
+    run "#{$bin}gt mkfeatureindex -filename tmp.db #{$testdata}/encode_known_genes_Mar07.gff3"
+    run "#{$bin}gt featureindex -seqid chr11 -benchmark 50 -benchwidth 100000 " +
+        "-filename tmp.db"
+    grep(last_stdout, /^50 range queries of width 100000 returned \d+ features/)
+  end
+
   FEATUREINDEX_TEST_FILES = ["#{$testdata}/eden.gff3",
                              "#{$testdata}/standard_gene_simple.gff3",
                              "#{$testdata}/standard_gene_as_tree.gff3",
@@ -66,3 +75,90 @@ if not $arguments["nordb"] then
   end
 
 end
+
+Name "gt featureindex -backend mapped (empty file)"
+Keywords "gt_featureindex mapped"
+Test do
+  run "#{$bin}gt mkfeatureindex -backend mapped -filename tmp.idx " +
+      "#{$testdata}/gt_view_prob_1.gff3"
+  run "#{$bin}gt featureindex -backend mapped -filename tmp.idx", :retval => 1
+  grep(last_stderr, /no sequence regions in index/)
+end
+
+Name "gt featureindex -backend mapped (existing file)"
+Keywords "gt_featureindex mapped"
+Test do
+  run "#{$bin}gt mkfeatureindex -backend mapped -filename tmp.idx " +
+      "#{$testdata}/eden.gff3"
+  run "#{$bin}gt mkfeatureindex -backend mapped -filename tmp.idx " +
+      "#{$testdata}/eden.gff3", :retval => 1
+  grep(last_stderr, /exists already/)
+  run "#{$bin}gt mkfeatureindex -force -backend mapped -filename tmp.idx " +
+      "#{$testdata}/eden.gff3"
+end
+
+Name "gt featureindex -backend mapped (invalid sequence ID)"
+Keywords "gt_featureindex mapped"
+Test do
+  run "#{$bin}gt mkfeatureindex -backend mapped -filename tmp.idx " +
+      "#{$testdata}/standard_gene_simple.gff3"
+  run "#{$bin}gt featureindex -backend mapped -seqid foo -filename tmp.idx",
+      :retval => 1
+  grep(last_stderr, /not exist/)
+end
+
+Name "gt featureindex -backend mapped (corrupt file)"
+Keywords "gt_featureindex mapped"
+Test do
+  File.open("corrupt.idx", "w") do |file|
+    file.write("sdfnhsnl")
+  end
+  run "#{$bin}gt featureindex -backend mapped -filename corrupt.idx",
+      :retval => 1
+  grep(last_stderr, /not a mapped feature index/)
+end
+
+Name "gt featureindex -backend mapped (truncated file)"
+Keywords "gt_featureindex mapped"
+Test do
+  run "#{$bin}gt mkfeatureindex -backend mapped -filename tmp.idx " +
+      "#{$testdata}/encode_known_genes_Mar07.gff3"
+  File.truncate("tmp.idx", File.size("tmp.idx") / 2)
+  run "#{$bin}gt featureindex -backend mapped -filename tmp.idx",
+      :retval => 1
+  grep(last_stderr, /is corrupt/)
+end
+
+Name "gt featureindex -backend mapped -benchmark"
+Keywords "gt_featureindex mapped"
+Test do
+  run "#{$bin}gt mkfeatureindex -backend mapped -filename tmp.idx " +
+      "#{$testdata}/encode_known_genes_Mar07.gff3"
+  run "#{$bin}gt featureindex -backend mapped -seqid chr11 -benchmark 50 " +
+      "-benchwidth 100000 -filename tmp.idx"
+  grep(last_stdout, /^50 range queries of width 100000 returned \d+ features/)
+end
+
+["#{$testdata}/eden.gff3",
+ "#{$testdata}/standard_gene_simple.gff3",
+ "#{$testdata}/standard_gene_as_tree.gff3",
+ "#{$testdata}/standard_gene_as_dag.gff3",
+ "#{$testdata}/standard_gene_with_introns_as_tree.gff3",
+ "#{$testdata}/multi_feature_simple.gff3",
+ "#{$testdata}/encode_known_genes_Mar07.gff3"].each do |file|
+  Name "gt featureindex -backend mapped vs. parser (#{File.basename(file)})"
+  Keywords "gt_featureindex mapped"
+  Test do
+    run "#{$bin}gt seqids #{file}"
+    seqids = File.open(last_stdout).readlines
+    run "#{$bin}gt mkfeatureindex -backend mapped -filename tmp.idx #{file}"
+    seqids.each do |seqid|
+      seqid.chomp!
+      run "#{$bin}gt featureindex -backend mapped -seqid #{seqid} " +
+          "-retain no -filename tmp.idx > out.gff3"
+      run "#{$bin}gt gff3 -retainids no #{file} | " +
+          "#{$bin}gt select -seqid #{seqid}"
+      run "diff out.gff3 #{last_stdout}"
+    end
+  end
+end
@@ -1049,6 +1049,54 @@ Test do
   run_test "#{$bin}gt gff3 out.gff3.bz2 | diff #{$testdata}dynbuf.gff3 -"
 end
 
+if not $arguments["nozstd"] then
+  Name "gt gff3 print very long attributes (-zstd)"
+  Keywords "gt_gff3 compression"
+  Test do
+    run_test "#{$bin}gt gff3 -zstd -o out.gff3.zst -sort #{$testdata}dynbuf.gff3"
+    run_test "#{$bin}gt gff3 out.gff3.zst | diff #{$testdata}dynbuf.gff3 -"
+    run_test "#{$bin}gt -j 4 gff3 out.gff3.zst | diff #{$testdata}dynbuf.gff3 -"
+  end
+
+  Name "gt gff3 -zstd (suffix appended)"
+  Keywords "gt_gff3 compression"
+  Test do
+    run_test "#{$bin}gt gff3 -zstd -o out.gff3 #{$testdata}dynbuf.gff3"
+    grep last_stderr, /doesn't have correct suffix '.zst'/
+    run_test "#{$bin}gt gff3 out.gff3.zst | diff #{$testdata}dynbuf.gff3 -"
+  end
+
+  Name "gt gff3 -zstd (truncated input)"
+  Keywords "gt_gff3 compression"
+  Test do
+    run_test "#{$bin}gt gff3 -zstd -o out.gff3.zst " +
+             "#{$testdata}encode_known_genes_Mar07.gff3"
+    File.open("truncated.gff3.zst", "wb") do |f|
+      f.write(File.binread("out.gff3.zst")[0, 5000])
+    end
+    run_test "#{$bin}gt gff3 truncated.gff3.zst", :retval => 1
+    grep last_stderr, /unexpected end of input/
+  end
+end
+
+if not $arguments["noxz"] then
+  Name "gt gff3 print very long attributes (-xz)"
+  Keywords "gt_gff3 compression"
+  Test do
+    run_test "#{$bin}gt gff3 -xz -o out.gff3.xz -sort #{$testdata}dynbuf.gff3"
+    run_test "#{$bin}gt gff3 out.gff3.xz | diff #{$testdata}dynbuf.gff3 -"
+    run_test "#{$bin}gt -j 4 gff3 out.gff3.xz | diff #{$testdata}dynbuf.gff3 -"
+  end
+end
+
+Name "gt gff3 compressed output options exclude each other"
+Keywords "gt_gff3 compression"
+Test do
+  run_test "#{$bin}gt gff3 -zstd -xz -o out.gff3 #{$testdata}dynbuf.gff3",
+           :retval => 1
+  grep last_stderr, /exclude each other/
+end
+
 Name "custom_stream (C)"
 Keywords "gt_gff3 examples"
 Test do
@@ -1493,6 +1541,158 @@ Test do
   run "#{$bin}gt #{$testdata}/gtscripts/check_linesorting.lua 2"
 end
 
+Name "gt gff3 -sortmemlimit (multiple sequences)"
+Keywords "gt_gff3 sortmemlimit"
+Test do
+  run_test "#{$bin}gt gff3 -sort -retainids #{$testdata}encode_known_genes_Mar07.gff3 > 1"
+  run_test "#{$bin}gt gff3 -sort -retainids -sortmemlimit 1MB #{$testdata}encode_known_genes_Mar07.gff3 > 2"
+  run "diff 1 2"
+  run_test "#{$bin}gt gff3 -sortlines -retainids #{$testdata}encode_known_genes_Mar07.gff3 > 1"
+  run_test "#{$bin}gt gff3 -sortlines -retainids -sortmemlimit 1MB #{$testdata}encode_known_genes_Mar07.gff3 > 2"
+  run "diff 1 2"
+end
+
+Name "gt gff3 -sortmemlimit (multiple files)"
+Keywords "gt_gff3 sortmemlimit"
+Test do
+  run_test "#{$bin}gt gff3 -sort #{$testdata}standard_gene_as_tree.gff3 #{$testdata}encode_known_genes_Mar07.gff3 #{$testdata}standard_gene_as_dag.gff3 > 1"
+  run_test "#{$bin}gt gff3 -sort -sortmemlimit 1MB #{$testdata}standard_gene_as_tree.gff3 #{$testdata}encode_known_genes_Mar07.gff3 #{$testdata}standard_gene_as_dag.gff3 > 2"
+  run "diff 1 2"
+end
+
+Name "gt gff3 -sortmemlimit (invalid limit)"
+Keywords "gt_gff3 sortmemlimit"
+Test do
+  run_test("#{$bin}gt gff3 -sort -sortmemlimit 1KB #{$testdata}eden.gff3", :retval => 1)
+  grep(last_stderr, /must have one positive integer argument/)
+  run_test("#{$bin}gt gff3 -sortmemlimit 1MB #{$testdata}eden.gff3", :retval => 1)
+end
+
+["encode_known_genes_Mar07.gff3", "eden.gff3", "standard_gene_as_dag.gff3",
+ "multi_feature_simple.gff3", "multi_feature_orphan_succ.gff3",
+ "gt_gff3_undefined_range_tidy.gff3"].each do |file|
+  Name "gt gff3 -arena (#{file})"
+  Keywords "gt_gff3 arena"
+  Test do
+    run_test "#{$bin}gt gff3 -tidy -addintrons #{$testdata}#{file} > 1"
+    run_test "#{$bin}gt gff3 -tidy -addintrons -arena #{$testdata}#{file} > 2"
+    run "diff 1 2"
+    run_test "#{$bin}gt gff3 -sort -tidy -arena #{$testdata}#{file} > 3"
+    run_test "#{$bin}gt gff3 -sort -tidy #{$testdata}#{file} > 4"
+    run "diff 3 4"
+  end
+end
+
+Name "gt gff3 -arena (multiple files)"
+Keywords "gt_gff3 arena"
+Test do
+  run_test "#{$bin}gt gff3 -sort #{$testdata}standard_gene_as_tree.gff3 #{$testdata}encode_known_genes_Mar07.gff3 #{$testdata}standard_gene_as_dag.gff3 > 1"
+  run_test "#{$bin}gt gff3 -sort -arena #{$testdata}standard_gene_as_tree.gff3 #{$testdata}encode_known_genes_Mar07.gff3 #{$testdata}standard_gene_as_dag.gff3 > 2"
+  run "diff 1 2"
+end
+
+Name "gt gff3 -arena (parse error)"
+Keywords "gt_gff3 arena"
+Test do
+  run_test("#{$bin}gt gff3 -arena #{$testdata}multi_feature_undefined_parent.gff3", :retval => 1)
+end
+
+[["encode_known_genes_Mar07.gff3", 0], ["standard_fasta_example.gff3", 0],
+ ["two_fasta_seqs.gff3", 0], ["multi_feature_orphan_succ.gff3", 0],
+ ["gt_gff3_undefined_range_tidy.gff3", 0],
+ ["corrupt_large.gff3", 1]].each do |file, retval|
+  Name "gt gff3 parallel parsing (#{file})"
+  Keywords "gt_gff3 parallel"
+  Test do
+    ["", "-tidy", "-checkids -sort"].each do |opts|
+      run_test("#{$bin}gt gff3 #{opts} #{$testdata}#{file}",
+               :retval => retval)
+      seq_stdout, seq_stderr = last_stdout, last_stderr
+      run_test("#{$bin}gt -j 4 gff3 #{opts} #{$testdata}#{file}",
+               :retval => retval)
+      par_stdout, par_stderr = last_stdout, last_stderr
+      run "diff #{seq_stdout} #{par_stdout}"
+      run "diff #{seq_stderr} #{par_stderr}"
+    end
+  end
+end
+
+Name "gt gff3 parallel parsing (multiple files and stdin)"
+Keywords "gt_gff3 parallel"
+Test do
+  run_test "#{$bin}gt gff3 -sort #{$testdata}encode_known_genes_Mar07.gff3 #{$testdata}standard_fasta_example.gff3 #{$testdata}eden.gff3 > 1"
+  run_test "#{$bin}gt -j 3 gff3 -sort #{$testdata}encode_known_genes_Mar07.gff3 #{$testdata}standard_fasta_example.gff3 #{$testdata}eden.gff3 > 2"
+  run "diff 1 2"
+  run_test "cat #{$testdata}encode_known_genes_Mar07.gff3 | #{$bin}gt -j 3 gff3 -sort - #{$testdata}standard_fasta_example.gff3 #{$testdata}eden.gff3 > 3"
+  run "diff 1 3"
+end
+
+Name "gt gff3 parallel parsing (compressed input)"
+Keywords "gt_gff3 parallel"
+Test do
+  require 'zlib'
+  data = File.read("#{$testdata}encode_known_genes_Mar07.gff3")
+  Zlib::GzipWriter.open("gzip.gff3.gz") { |gz| gz.write(data) }
+  # BGZF: a series of gzip members with the block size in a "BC" subfield
+  File.open("bgzf.gff3.gz", "wb") do |f|
+    (data.scan(/.{1,65280}/m) + [""]).each do |block|
+      deflate = Zlib::Deflate.new(Zlib::DEFAULT_COMPRESSION, -Zlib::MAX_WBITS)
+      cdata = deflate.deflate(block, Zlib::FINISH)
+      deflate.close
+      f.write([31, 139, 8, 4, 0, 0, 255, 6, 66, 67, 2,
+               cdata.bytesize + 25].pack("CCCCVCCvCCvv"))
+      f.write(cdata)
+      f.write([Zlib.crc32(block), block.bytesize].pack("VV"))
+    end
+  end
+  run_test "#{$bin}gt gff3 -sort #{$testdata}encode_known_genes_Mar07.gff3 > 1"
+  ["gzip.gff3.gz", "bgzf.gff3.gz"].each do |file|
+    run_test "#{$bin}gt -j 4 gff3 -sort #{file} > 2"
+    run "diff 1 2"
+  end
+end
+
+Name "gt gff3 parallel parsing (compressed input larger than read ahead)"
+Keywords "gt_gff3 parallel"
+Test do
+  require 'zlib'
+  data = File.read("#{$testdata}encode_known_genes_Mar07.gff3")
+  # three copies with distinct IDs, more than the four 1 MB read ahead buffers
+  File.open("large.gff3", "w") do |f|
+    f.write(data)
+    1.upto(2) do |copy|
+      f.write(data.gsub(/^##(gff-version|sequence-region).*\n/, "").
+                   gsub(/(ID|Parent)=/, "\\1=c#{copy}_"))
+    end
+  end
+  Zlib::GzipWriter.open("large.gff3.gz") do |gz|
+    gz.write(File.read("large.gff3"))
+  end
+  run_test "#{$bin}gt gff3 large.gff3 > 1"
+  run_test "#{$bin}gt -j 4 gff3 large.gff3.gz > 2"
+  run "diff 1 2"
+end
+
+Name "gt gff3 memory mapped input (line terminators)"
+Keywords "gt_gff3 linesource"
+Test do
+  File.open("crlf.gff3", "w") do |f|
+    File.readlines("#{$testdata}encode_known_genes_Mar07.gff3").each do |line|
+      f.print line.chomp + "\r\n"
+    end
+  end
+  File.open("cr.gff3", "w") do |f|
+    f.print "##gff-version 3\r\r\n"
+    f.print "ctg1\t.\tgene\t1\t10\t.\t+\t.\tID=a;Note=x\r\r\r\n"
+    f.print "ctg1\t.\tgene\t1\t10\t.\t+\t.\tID=b"
+  end
+  ["crlf.gff3", "cr.gff3"].each do |file|
+    run_test "#{$bin}gt gff3 #{file} > mapped"
+    run_test "cat #{file} | #{$bin}gt gff3 - > read"
+    run "diff mapped read"
+  end
+end
+
 Name "gt gff3 -sortlines (empty annotation)"
 Keywords "gt_gff3 linesorting"
 Test do
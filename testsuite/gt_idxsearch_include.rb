@@ -10,12 +10,12 @@ allfiles = ["Atinsert.fna",
             "TTT-small.fna",
             "trna_glutamine.fna"]
 
-def makegreedyfwdmatcall(queryfile,indexarg,ms)
+def makegreedyfwdmatcall(queryfile,indexarg,ms,jobs=1)
   prog=""
   if ms
-    prog="#{$bin}gt matstat -verify"
+    prog="#{$bin}gt -j #{jobs} matstat -verify"
   else
-    prog="#{$bin}gt uniquesub"
+    prog="#{$bin}gt -j #{jobs} uniquesub"
   end
   constantargs="-min 1 -max 20 -query #{queryfile} #{indexarg}"
   return "#{prog} -output querypos #{constantargs}"
@@ -30,6 +30,10 @@ def checkgreedyfwdmat(queryfile,ms)
   run_test(makegreedyfwdmatcall(queryfile,"-pck pck",ms), :maxtime => 1200)
   run "mv #{last_stdout} tmp.pck"
   run "diff tmp.pck tmp.fmi"
+  run_test(makegreedyfwdmatcall(queryfile,"-pck pck",ms,4), :maxtime => 1200)
+  run "diff #{last_stdout} tmp.fmi"
+  run_test(makegreedyfwdmatcall(queryfile,"-esa sfx",ms,4), :maxtime => 1200)
+  run "diff #{last_stdout} tmp.fmi"
 end
 
 def checktagerator(queryfile,ms)
@@ -49,6 +53,20 @@ def checktagerator(queryfile,ms)
     run_test "#{$bin}gt prebwt -maxdepth 4 -pck pck", :maxtime => 180
     run_test("#{$bin}gt tagerator -rw -cmp -e 0 -pck pck -q patternfile",
              :maxtime => 240)
+    run_test("#{$bin}gt tagerator -rw -e 0 -pck pck -q patternfile " +
+             "-output tagnum tagseq dblength dbstartpos strand " +
+             "dbsequence", :maxtime => 240)
+    run "mv #{last_stdout} tmp.pck"
+    run_test("#{$bin}gt -j 4 tagerator -rw -e 0 -pck pck -q patternfile " +
+             "-output tagnum tagseq dblength dbstartpos strand " +
+             "dbsequence", :maxtime => 240)
+    run "diff #{last_stdout} tmp.pck"
+    run_test("#{$bin}gt tagerator -rw -e 0 -esa sfx -q patternfile " +
+             "-output tagnum tagseq dblength dbstartpos strand " +
+             "dbsequence", :maxtime => 240)
+    run "grep -v '^#' #{last_stdout} | sort > tmp.esa.sorted"
+    run "grep -v '^#' tmp.pck | sort > tmp.pck.sorted"
+    run "diff tmp.esa.sorted tmp.pck.sorted"
     run_test("#{$bin}gt tagerator -rw -cmp -e 1 -pck pck -q patternfile",
              :maxtime => 240)
     run_test("#{$bin}gt tagerator -rw -cmp -e 2 -pck pck -q patternfile",
@@ -1070,6 +1070,30 @@ Test do
   run_assembly
 end
 
+Name "gt readjoiner assembly -pipeline"
+Keywords "gt_readjoiner gt_readjoiner_assembly gt_readjoiner_pipeline"
+Test do
+  [["70x_161nt", 30], ["large_wset", 4], ["30x_long_varlen", 32],
+   ["contained_varlen", 32]].each do |fasta, minlen|
+    run_prefilter("#{$testdata}/readjoiner/#{fasta}.fas")
+    run_overlap(minlen)
+    run_assembly
+    run "mv reads.contigs.fas contigs"
+    run "rm -f reads.0.spm reads.0.cnt"
+    run_assembly("-l #{minlen} -pipeline")
+    run "diff reads.contigs.fas contigs"
+    if File.exist?("reads.0.spm")
+      failtest("reads.0.spm should not be written without -savespm")
+    end
+    run_assembly("-l #{minlen} -pipeline -savespm")
+    run "diff reads.contigs.fas contigs"
+    run_assembly
+    run "diff reads.contigs.fas contigs"
+  end
+  run_test "#{rdjA} -readset reads -pipeline", :retval => 1
+  grep last_stderr, /option "-pipeline" requires option "-l"/
+end
+
 Name "gt readjoiner spmtest pw"
 Keywords "gt_readjoiner gt_readjoiner_spmtest"
 Test do
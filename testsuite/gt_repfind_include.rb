@@ -83,6 +83,42 @@ def checkrepfindwithquery(reffile,queryfile)
   run "diff -I '^#' #{last_stdout} #{$gttestdata}repfind-result/#{reffile}-#{queryfile}.result"
 end
 
+Name "gt repfind -q with multiple threads"
+Keywords "gt_repfind query threads"
+Test do
+  run_test "#{$bin}gt suffixerator -db #{$testdata}at1MB " +
+           "-indexname at1MB -dna -tis -suf -lcp -ssp"
+  run "#{$bin}gt shredder -minlength 100 -maxlength 300 " +
+      "#{$testdata}U89959_genomic.fas > reads.fna"
+  run "cat #{$testdata}Atinsert.fna >> reads.fna"
+  ["-l 15", "-l 12 -r", "-l 14 -p",
+   "-l 20 -outfmt tabsep s.len s.seqnum s.start strand q.len q.seqnum " +
+   "q.start q.seqlen"].each do |opts|
+    run_test "#{$bin}gt repfind #{opts} -ii at1MB -q reads.fna"
+    run "mv #{last_stdout} sequential.out"
+    run_test "#{$bin}gt -j 4 repfind #{opts} -ii at1MB -q reads.fna"
+    run "diff #{last_stdout} sequential.out"
+  end
+end
+
+Name "gt repfind with multiple threads"
+Keywords "gt_repfind threads"
+Test do
+  run_test "#{$bin}gt suffixerator -db #{$testdata}at1MB " +
+           "#{$testdata}U89959_genomic.fas -indexname at1MB -dna " +
+           "-tis -suf -lcp -ssp"
+  ["-l 14", "-l 20 -maxfreq 3", "-l 12 -r",
+   "-l 16 -outfmt tabsep s.len s.seqnum s.start q.len q.seqnum q.start"].
+    each do |opts|
+    run_test "#{$bin}gt repfind #{opts} -ii at1MB"
+    run "mv #{last_stdout} sequential.out"
+    [2, 4].each do |jobs|
+      run_test "#{$bin}gt -j #{jobs} repfind #{opts} -ii at1MB"
+      run "diff #{last_stdout} sequential.out"
+    end
+  end
+end
+
 def crosstest(common,opts,key)
   run_test "#{common} #{opts}"
   run "mv #{last_stdout} #{key}.match"
@@ -209,6 +209,11 @@ Test do
   grep last_stderr, /option -memlimit too strict: need at least 21MB/
   run_test "#{$bin}gt seed_extend -memlimit 1KB -ii at1MB", :retval => 1
   grep last_stderr, /integer argument followed by one of the keywords MB and GB/
+  run_test "#{$bin}gt seed_extend -spillmem 0MB -ii at1MB", :retval => 1
+  grep last_stderr, /argument to option "-spillmem" must be at least 1MB/
+  run_test "#{$bin}gt seed_extend -spillmem 1MB -verify -ii at1MB",
+           :retval => 1
+  grep last_stderr, /option "-spillmem" and option "-verify" exclude each/
   run_test "#{$bin}gt seed_extend -extendgreedy -history 65 -benchmark " +
            "-ii at1MB", :retval => 1
   grep last_stderr, /argument to option "-history" must be an integer <= 64/
@@ -470,6 +475,22 @@ Test do
   end
 end
 
+Name "gt seed_extend: optimal alignments without polished ends"
+Keywords "gt_seed_extend extendgreedy relax-polish bitpar"
+Test do
+  run_test build_encseq("at1MB", "#{$testdata}at1MB")
+  for minidentity in [70, 80, 90] do
+    run_test "#{$bin}gt seed_extend -relax-polish -minidentity #{minidentity} " +
+             "-outfmt alignment=70 seed -ii at1MB -verify-alignment"
+    run "mv #{last_stdout} relax.out"
+    run_test "#{$bin}gt seed_extend -relax-polish -minidentity #{minidentity} " +
+             "-ii at1MB"
+    run "mv #{last_stdout} relax-nosequences.out"
+    run_test "#{$bin}gt dev show_seedext -relax-polish -verify-alignment " +
+             "-f relax-nosequences.out -outfmt alignment=70"
+  end
+end
+
 # Greedy extension options
 Name "gt seed_extend: history, percmathistory, maxalilendiff"
 Keywords "gt_seed_extend extendgreedy history percmathistory maxalilendiff"
@@ -557,6 +578,24 @@ Test do
 end
 
 # Part of encseq
+Name "gt seed_extend: spill seeds"
+Keywords "gt_seed_extend spillmem"
+Test do
+  run_test build_encseq("at1MB", "#{$testdata}at1MB")
+  run_test build_encseq("U89959_genomic","#{$testdata}U89959_genomic.fas")
+  for splt in $SPLT_LIST + ["-splt bytestring"] do
+    ["-ii at1MB -l 50 -seedlength 12",
+     "-ii at1MB -qii U89959_genomic -l 40 -seedlength 10",
+     "-ii at1MB -l 50 -seedlength 12 -maxmat 2"].each do |args|
+      run_test "#{$bin}gt seed_extend #{args} #{splt}"
+      run "mv #{last_stdout} default.out"
+      run_test "#{$bin}gt seed_extend #{args} #{splt} -spillmem 1MB -v"
+      grep last_stdout, /spilled [1-9][0-9]* sorted runs of seeds/
+      run "diff -I '^#' default.out #{last_stdout}"
+    end
+  end
+end
+
 Name "gt seed_extend: parts"
 Keywords "gt_seed_extend parts pick"
 Test do
@@ -574,4 +613,12 @@ Test do
     grep last_stdout, /24 209 15 P 26 2 248 35 5 80.00/
     grep last_stdout, /23 418 127 P 24 2 68 35 4 82.98/
   end
+  run_test "#{$bin}gt -j 3 seed_extend -ii at1MB -parts 5 -benchmark"
+  grep last_stdout, /TIME thread 2 processed [0-9]+ part pairs in/
+  ["", "-kmerfile no"].each do |kmerfile|
+    run_test "#{$bin}gt -j 1 seed_extend -ii at1MB -parts 5 #{kmerfile}"
+    run "mv #{last_stdout} parts-j1.out"
+    run_test "#{$bin}gt -j 3 seed_extend -ii at1MB -parts 5 #{kmerfile}"
+    run "cmp parts-j1.out #{last_stdout}"
+  end
 end
@@ -607,5 +607,104 @@ Keywords "gt_suffixerator multithreaded"
 Test do
   run "#{$bin}/gt -j 3 suffixerator -db #{$testdata}/at1MB -indexname foo " + \
       "-lcp -suf", :retval => 1
-  grep(last_stderr, /cannot be used when/)
+  grep(last_stderr, /option -lcp requires option -sain/)
+end
+
+# averagelcp in the .prj file is the average over the whole lcp table, also
+# when the lcp values are computed bucket-wise (it used to leave out the values
+# at special suffixes and gave 13.83 and 1.12 here)
+Name "gt suffixerator -lcp averagelcp"
+Keywords "gt_suffixerator sain"
+Test do
+  [["at1MB","14.23"],["Random.fna","1.93"]].each do |file,averagelcp|
+    ["","-sain"].each do |sainarg|
+      run_test "#{$bin}gt suffixerator -db #{$testdata}/#{file} -suf -lcp " +
+               "#{sainarg} -indexname sfx"
+      grep("sfx.prj", /^averagelcp=#{averagelcp}$/)
+    end
+  end
+end
+
+Name "gt suffixerator -sain"
+Keywords "gt_suffixerator sain multithreaded"
+Test do
+  ["at1MB","Atinsert.fna","RandomN.fna","trembl-eqlen.faa"].each do |file|
+    dirlist = file.end_with?(".faa") ? ["fwd","rev"] : ["fwd","rev","cpl","rcl"]
+    dirlist.each do |dirarg|
+      run_test "#{$bin}gt suffixerator -db #{$testdata}/#{file} -suf -bwt " +
+               "-indexname ref -dir #{dirarg}"
+      [1,3].each do |jobs|
+        run_test "#{$bin}gt -j #{jobs} suffixerator -db #{$testdata}/#{file} " +
+                 "-suf -bwt -sain -indexname sain -dir #{dirarg}"
+        run "cmp ref.suf sain.suf"
+        run "cmp ref.bwt sain.bwt"
+        run "grep -v indexname ref.prj > ref.txt"
+        run "grep -v indexname sain.prj > sain.txt"
+        run "diff ref.txt sain.txt"
+      end
+    end
+  end
+  run_test "#{$bin}gt dev sfxmap -suf -bwt -esa sain"
+end
+
+Name "gt suffixerator -sain failure"
+Keywords "gt_suffixerator sain"
+Test do
+  run_test "#{$bin}gt suffixerator -db #{$testdata}/at1MB -suf -sain -bck",
+           :retval => 1
+  grep(last_stderr, /option "-sain" and option "-bck" exclude each other/)
+end
+
+Name "gt suffixerator -sain -lcp"
+Keywords "gt_suffixerator sain lcp multithreaded"
+Test do
+  ["at1MB","Atinsert.fna","trembl-eqlen.faa"].each do |file|
+    dirlist = file.end_with?(".faa") ? ["fwd","rev"] : ["fwd","rcl"]
+    dirlist.each do |dirarg|
+      run_test "#{$bin}gt suffixerator -db #{$testdata}/#{file} -suf -lcp " +
+               "-indexname ref -dir #{dirarg}"
+      [1,3].each do |jobs|
+        run_test "#{$bin}gt -j #{jobs} suffixerator -db #{$testdata}/#{file} " +
+                 "-suf -lcp -sain -indexname sain -dir #{dirarg}"
+        run "cmp ref.lcp sain.lcp"
+        run "cmp ref.llv sain.llv"
+        run "cmp ref.prj sain.prj"
+      end
+    end
+  end
+  run_test "#{$bin}gt dev sfxmap -suf -lcp -esa sain"
+end
+
+Name "gt dev esalcp"
+Keywords "gt_suffixerator esalcp lcp multithreaded"
+Test do
+  ["at1MB","Atinsert.fna","trembl-eqlen.faa"].each do |file|
+    run_test "#{$bin}gt suffixerator -db #{$testdata}/#{file} -suf -lcp " +
+             "-indexname ref"
+    run_test "#{$bin}gt suffixerator -db #{$testdata}/#{file} -suf " +
+             "-indexname esa"
+    [1,3].each do |jobs|
+      run_test "#{$bin}gt -j #{jobs} dev esalcp -esa esa"
+      run "cmp ref.lcp esa.lcp"
+      run "cmp ref.llv esa.llv"
+      run "cmp ref.prj esa.prj"
+    end
+    run_test "#{$bin}gt dev sfxmap -suf -lcp -esa esa"
+  end
+  run_test "#{$bin}gt dev esalcp -esa nonexisting", :retval => 1
+end
+
+Name "gt sain multithreaded"
+Keywords "gt_suffixerator sain multithreaded"
+Test do
+  ["at1MB","U89959_genomic.fas"].each do |file|
+    [1,3].each do |jobs|
+      run_test "#{$bin}gt -j #{jobs} dev sain -fasta #{$testdata}/#{file} " +
+               "-suf -fcheck"
+      run "mv #{file}.suf #{file}.#{jobs}.suf"
+    end
+    run "cmp #{file}.1.suf #{file}.3.suf"
+  end
+  run_test "#{$bin}gt encseq encode -indexname at1MB #{$testdata}/at1MB"
+  run_test "#{$bin}gt -j 3 dev sain -esq at1MB -dir rcl -fcheck"
 end
@@ -36,6 +36,31 @@ def checktallymer(reffile,mersize)
   end
 end
 
+def checktallymermph(reffile,mersize)
+  reffilepath="#{$testdata}#{reffile}"
+  if reffile == 'at1MB'
+    query="#{$testdata}U89959_genomic.fas"
+  else
+    query="#{$testdata}at1MB"
+  end
+  searchoptions="-strand fp -output qseqnum qpos counts sequence"
+  run_test "#{$bin}gt suffixerator -pl -dna -tis -suf -lcp " +
+           "-indexname sfxidx -db #{reffilepath}", :maxtime => 360
+  ["", "-pl", "-mph"].each do |indexoption|
+    run_test "#{$bin}gt tallymer mkindex -counts #{indexoption} " +
+             "-mersize #{mersize} -minocc 2 -maxocc 30 " +
+             "-indexname tyr-index#{indexoption} -esa sfxidx", :maxtime => 360
+    run_test "#{$bin}gt tallymer search #{searchoptions} -test " +
+             "-tyr tyr-index#{indexoption} -q #{query}", :maxtime => 360
+    run "mv #{last_stdout} tyrseaout#{indexoption}"
+  end
+  run "cmp tyrseaout tyrseaout-pl"
+  run "cmp tyrseaout tyrseaout-mph"
+  run_test "#{$bin}gt -j 4 tallymer search #{searchoptions} " +
+           "-tyr tyr-index-mph -q #{query}", :maxtime => 360
+  run "cmp #{last_stdout} tyrseaout-mph"
+end
+
 tyrfiles = {"Atinsert.fna" => 19,
             "Duplicate.fna" => 12,
             "Random.fna" => 10,
@@ -58,3 +83,12 @@ if $gttestdata then
     end
   end
 end
+
+["Atinsert.fna", "Duplicate.fna", "Random159.fna", "RandomN.fna",
+ "trna_glutamine.fna", "at1MB"].each do |reffile|
+  Name "gt tallymer search -mph #{reffile}"
+  Keywords "gt_tallymer mph"
+  Test do
+    checktallymermph(reffile,tyrfiles[reffile])
+  end
+end